@@ -101,12 +101,14 @@ use constant CFGCMD_HELP                                            => 'help';
     push @EXPORT, qw(CFGCMD_HELP);
 use constant CFGCMD_INFO                                            => 'info';
     push @EXPORT, qw(CFGCMD_INFO);
+use constant CFGCMD_RELATION_RESTORE                                => 'relation-restore';
 use constant CFGCMD_REPO_CREATE                                     => 'repo-create';
 use constant CFGCMD_REPO_GET                                        => 'repo-get';
 use constant CFGCMD_REPO_LS                                         => 'repo-ls';
 use constant CFGCMD_REPO_PUT                                        => 'repo-put';
 use constant CFGCMD_REPO_RM                                         => 'repo-rm';
 use constant CFGCMD_RESTORE                                         => 'restore';
+use constant CFGCMD_SERVER                                          => 'server';
 use constant CFGCMD_STANZA_CREATE                                   => 'stanza-create';
 use constant CFGCMD_STANZA_DELETE                                   => 'stanza-delete';
 use constant CFGCMD_STANZA_UPGRADE                                  => 'stanza-upgrade';
@@ -159,6 +161,7 @@ use constant CFGOPT_TARGET_ACTION                                   => 'target-a
 use constant CFGOPT_TARGET_TIMELINE                                 => 'target-timeline';
 use constant CFGOPT_TYPE                                            => 'type';
 use constant CFGOPT_OUTPUT                                          => 'output';
+use constant CFGOPT_RELATION_PATH                                   => 'relation-path';
 
 # Command-line only local/remote options
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -179,6 +182,7 @@ use constant CFGOPT_SORT                                            => 'sort';
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPT_ARCHIVE_TIMEOUT                                 => 'archive-timeout';
 use constant CFGOPT_BUFFER_SIZE                                     => 'buffer-size';
+use constant CFGOPT_CIPHER_COMPAT                                   => 'cipher-compat';
 use constant CFGOPT_DB_TIMEOUT                                      => 'db-timeout';
 use constant CFGOPT_COMPRESS                                        => 'compress';
 use constant CFGOPT_COMPRESS_TYPE                                   => 'compress-type';
@@ -196,14 +200,23 @@ use constant CFGOPT_TCP_KEEP_ALIVE_COUNT                            => 'tcp-keep
 use constant CFGOPT_TCP_KEEP_ALIVE_IDLE                             => 'tcp-keep-alive-idle';
 use constant CFGOPT_TCP_KEEP_ALIVE_INTERVAL                         => 'tcp-keep-alive-interval';
 
+# TLS server
+use constant CFGOPT_TLS_SERVER_ADDRESS                              => 'tls-server-address';
+use constant CFGOPT_TLS_SERVER_CA_FILE                              => 'tls-server-ca-file';
+use constant CFGOPT_TLS_SERVER_CERT_FILE                            => 'tls-server-cert-file';
+use constant CFGOPT_TLS_SERVER_KEY_FILE                             => 'tls-server-key-file';
+use constant CFGOPT_TLS_SERVER_PORT                                 => 'tls-server-port';
+
 # Commands
 use constant CFGOPT_CMD_SSH                                         => 'cmd-ssh';
+use constant CFGOPT_CMD_SSH_CONTROL_PATH                            => 'cmd-ssh-control-path';
 
 # Paths
 use constant CFGOPT_LOCK_PATH                                       => 'lock-path';
     push @EXPORT, qw(CFGOPT_LOCK_PATH);
 use constant CFGOPT_LOG_PATH                                        => 'log-path';
     push @EXPORT, qw(CFGOPT_LOG_PATH);
+use constant CFGOPT_METRIC_PATH                                     => 'metric-path';
 use constant CFGOPT_SPOOL_PATH                                      => 'spool-path';
     push @EXPORT, qw(CFGOPT_SPOOL_PATH);
 
@@ -215,6 +228,7 @@ use constant CFGOPT_LOG_LEVEL_STDERR                                => 'log-leve
 use constant CFGOPT_LOG_SUBPROCESS                                  => 'log-subprocess';
 use constant CFGOPT_LOG_TIMESTAMP                                   => 'log-timestamp';
     push @EXPORT, qw(CFGOPT_LOG_TIMESTAMP);
+use constant CFGOPT_PROFILE                                         => 'profile';
 
 # Repository options
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -246,12 +260,16 @@ use constant CFGOPT_REPO_RETENTION_FULL_TYPE                        => CFGDEF_PR
 use constant CFGOPT_REPO_LOCAL                                      => CFGDEF_PREFIX_REPO . '-local';
 
 use constant CFGOPT_REPO_HOST                                       => CFGDEF_PREFIX_REPO . '-host';
+use constant CFGOPT_REPO_HOST_CA_FILE                               => CFGOPT_REPO_HOST . '-ca-file';
+use constant CFGOPT_REPO_HOST_CERT_FILE                             => CFGOPT_REPO_HOST . '-cert-file';
 use constant CFGOPT_REPO_HOST_CMD                                   => CFGOPT_REPO_HOST . '-cmd';
     push @EXPORT, qw(CFGOPT_REPO_HOST_CMD);
 use constant CFGOPT_REPO_HOST_CONFIG                                => CFGOPT_REPO_HOST . '-config';
 use constant CFGOPT_REPO_HOST_CONFIG_INCLUDE_PATH                   => CFGOPT_REPO_HOST_CONFIG . '-include-path';
 use constant CFGOPT_REPO_HOST_CONFIG_PATH                           => CFGOPT_REPO_HOST_CONFIG . '-path';
+use constant CFGOPT_REPO_HOST_KEY_FILE                              => CFGOPT_REPO_HOST . '-key-file';
 use constant CFGOPT_REPO_HOST_PORT                                  => CFGOPT_REPO_HOST . '-port';
+use constant CFGOPT_REPO_HOST_TYPE                                  => CFGOPT_REPO_HOST . '-type';
 use constant CFGOPT_REPO_HOST_USER                                  => CFGOPT_REPO_HOST . '-user';
 
 # Repository Azure
@@ -288,14 +306,20 @@ use constant CFGOPT_REPO_S3_VERIFY_TLS                              => CFGDEF_RE
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPT_ARCHIVE_ASYNC                                   => 'archive-async';
 use constant CFGOPT_ARCHIVE_GET_QUEUE_MAX                           => 'archive-get-queue-max';
+use constant CFGOPT_ARCHIVE_PUSH_BUFFER_MAX                         => 'archive-push-buffer-max';
 use constant CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                          => 'archive-push-queue-max';
+use constant CFGOPT_ARCHIVE_PUSH_REPO_QUEUE                         => 'archive-push-repo-queue';
+use constant CFGOPT_ARCHIVE_SERVER                                  => 'archive-server';
 
 # Backup options
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPT_ARCHIVE_CHECK                                   => 'archive-check';
 use constant CFGOPT_ARCHIVE_COPY                                    => 'archive-copy';
+use constant CFGOPT_BACKUP_DEDUP                                    => 'backup-dedup';
+use constant CFGOPT_BACKUP_PRECOPY                                  => 'backup-precopy';
 use constant CFGOPT_BACKUP_STANDBY                                  => 'backup-standby';
 use constant CFGOPT_CHECKSUM_PAGE                                   => 'checksum-page';
+use constant CFGOPT_COMPRESS_FRAME_SIZE                             => 'compress-frame-size';
 use constant CFGOPT_EXCLUDE                                         => 'exclude';
 use constant CFGOPT_EXPIRE_AUTO                                     => 'expire-auto';
 use constant CFGOPT_MANIFEST_SAVE_THRESHOLD                         => 'manifest-save-threshold';
@@ -312,6 +336,13 @@ use constant CFGOPT_LINK_MAP                                        => 'link-map
 use constant CFGOPT_TABLESPACE_MAP_ALL                              => 'tablespace-map-all';
 use constant CFGOPT_TABLESPACE_MAP                                  => 'tablespace-map';
 use constant CFGOPT_RECOVERY_OPTION                                 => 'recovery-option';
+use constant CFGOPT_SPARSE                                          => 'sparse';
+use constant CFGOPT_SYNC_BATCH                                      => 'sync-batch';
+
+# Verify options
+#-----------------------------------------------------------------------------------------------------------------------------------
+use constant CFGOPT_VERIFY_LEDGER                                   => 'verify-ledger';
+use constant CFGOPT_VERIFY_SAMPLE                                   => 'verify-sample';
 
 # Stanza options
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -365,10 +396,16 @@ use constant CFGOPTVAL_REPO_TYPE_CIFS                               => 'cifs';
 use constant CFGOPTVAL_REPO_TYPE_POSIX                              => 'posix';
 use constant CFGOPTVAL_REPO_TYPE_S3                                 => 's3';
 
+# Repo host type
+#-----------------------------------------------------------------------------------------------------------------------------------
+use constant CFGOPTVAL_REPO_HOST_TYPE_SSH                           => 'ssh';
+use constant CFGOPTVAL_REPO_HOST_TYPE_TLS                           => 'tls';
+
 # Repo encryption type
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPTVAL_REPO_CIPHER_TYPE_NONE                        => 'none';
 use constant CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC                 => 'aes-256-cbc';
+use constant CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM                 => 'aes-256-gcm';
 
 # Repo S3 URI style
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -613,6 +650,15 @@ my $rhCommandDefine =
         },
     },
 
+    &CFGCMD_RELATION_RESTORE =>
+    {
+        &CFGDEF_PARAMETER_ALLOWED => true,
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_REMOTE => {},
+        },
+    },
+
     &CFGCMD_REPO_CREATE =>
     {
         &CFGDEF_INTERNAL => true,
@@ -680,6 +726,10 @@ my $rhCommandDefine =
         },
     },
 
+    &CFGCMD_SERVER =>
+    {
+    },
+
     &CFGCMD_STANZA_CREATE =>
     {
         &CFGDEF_LOCK_REQUIRED => true,
@@ -879,6 +929,10 @@ my %hConfigDefine =
                     &CFGDEF_DEPEND_OPTION => CFGOPT_STANZA,
                 },
             },
+            &CFGCMD_RELATION_RESTORE =>
+            {
+                &CFGDEF_DEFAULT => 'latest',
+            },
             &CFGCMD_RESTORE =>
             {
                 &CFGDEF_DEFAULT => 'latest',
@@ -909,6 +963,7 @@ my %hConfigDefine =
             {
                 &CFGDEF_REQUIRED => false
             },
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE =>
             {
                 &CFGDEF_REQUIRED => false
@@ -1127,6 +1182,19 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_RELATION_PATH =>
+    {
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_RELATION_RESTORE => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     # Command-line only local/remote options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_EXEC_ID =>
@@ -1184,6 +1252,7 @@ my %hConfigDefine =
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
@@ -1346,12 +1415,14 @@ my %hConfigDefine =
             &CFGCMD_CHECK => {},
             &CFGCMD_EXPIRE => {},
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -1359,6 +1430,14 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_CIPHER_COMPAT =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND => CFGOPT_BUFFER_SIZE,
+    },
+
     &CFGOPT_SCK_BLOCK =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1410,6 +1489,47 @@ my %hConfigDefine =
         &CFGDEF_DEPEND => CFGOPT_TCP_KEEP_ALIVE_COUNT,
     },
 
+    &CFGOPT_TLS_SERVER_ADDRESS =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => 'localhost',
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_SERVER => {},
+        },
+    },
+
+    &CFGOPT_TLS_SERVER_CA_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_CERT_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_KEY_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_PORT =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 8432,
+        &CFGDEF_ALLOW_RANGE => [1, 65535],
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
     &CFGOPT_DB_TIMEOUT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1514,6 +1634,7 @@ my %hConfigDefine =
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
             &CFGCMD_REPO_PUT => {},
@@ -1543,6 +1664,7 @@ my %hConfigDefine =
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
             &CFGCMD_EXPIRE => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
@@ -1570,6 +1692,7 @@ my %hConfigDefine =
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
@@ -1589,6 +1712,14 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_CMD_SSH_CONTROL_PATH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND => CFGOPT_CMD_SSH,
+    },
+
     &CFGOPT_IO_TIMEOUT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1653,6 +1784,7 @@ my %hConfigDefine =
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
+            &CFGCMD_VERIFY => {},
         },
     },
 
@@ -1663,6 +1795,14 @@ my %hConfigDefine =
         &CFGDEF_DEFAULT => '/var/log/' . PROJECT_EXE,
     },
 
+    &CFGOPT_METRIC_PATH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND => CFGOPT_PROFILE,
+    },
+
     &CFGOPT_PROTOCOL_TIMEOUT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1676,12 +1816,14 @@ my %hConfigDefine =
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
             &CFGCMD_REPO_PUT => {},
             &CFGCMD_REPO_RM => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
@@ -1746,6 +1888,14 @@ my %hConfigDefine =
                     &CFGCMD_ROLE_REMOTE => {},
                 },
             },
+            &CFGCMD_RELATION_RESTORE =>
+            {
+                &CFGDEF_COMMAND_ROLE =>
+                {
+                    &CFGCMD_ROLE_DEFAULT => {},
+                    &CFGCMD_ROLE_REMOTE => {},
+                },
+            },
             &CFGCMD_REPO_CREATE =>
             {
                 &CFGDEF_COMMAND_ROLE =>
@@ -1842,7 +1992,7 @@ my %hConfigDefine =
         &CFGDEF_DEPEND =>
         {
             &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_CIPHER_TYPE,
-            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC],
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC, CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM],
         },
         &CFGDEF_NAME_ALT =>
         {
@@ -1861,6 +2011,7 @@ my %hConfigDefine =
         [
             &CFGOPTVAL_REPO_CIPHER_TYPE_NONE,
             &CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC,
+            &CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM,
         ],
         &CFGDEF_NAME_ALT =>
         {
@@ -1910,6 +2061,7 @@ my %hConfigDefine =
                 &CFGDEF_INTERNAL => true,
             },
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
@@ -1978,6 +2130,7 @@ my %hConfigDefine =
             &CFGCMD_ARCHIVE_PUSH => {},
             &CFGCMD_CHECK => {},
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
@@ -1998,6 +2151,60 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_REPO_HOST_TYPE =>
+    {
+        &CFGDEF_GROUP => CFGOPTGRP_REPO,
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => CFGOPTVAL_REPO_HOST_TYPE_SSH,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_REPO_HOST_TYPE_SSH,
+            &CFGOPTVAL_REPO_HOST_TYPE_TLS,
+        ],
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+            &CFGCMD_ROLE_ASYNC => {},
+            &CFGCMD_ROLE_LOCAL => {},
+        },
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST
+        },
+    },
+
+    &CFGOPT_REPO_HOST_CERT_FILE =>
+    {
+        &CFGDEF_GROUP => CFGOPTGRP_REPO,
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+            &CFGCMD_ROLE_ASYNC => {},
+            &CFGCMD_ROLE_LOCAL => {},
+        },
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_REPO_HOST_TYPE_TLS],
+        },
+    },
+
+    &CFGOPT_REPO_HOST_KEY_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_REPO_HOST_CERT_FILE,
+    },
+
+    &CFGOPT_REPO_HOST_CA_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_REPO_HOST_CERT_FILE,
+        &CFGDEF_REQUIRED => false,
+    },
+
     &CFGOPT_REPO_HOST_CONFIG =>
     {
         &CFGDEF_GROUP => CFGOPTGRP_REPO,
@@ -2531,6 +2738,14 @@ my %hConfigDefine =
                     &CFGCMD_ROLE_REMOTE => {},
                 },
             },
+            &CFGCMD_RELATION_RESTORE =>
+            {
+                &CFGDEF_COMMAND_ROLE =>
+                {
+                    &CFGCMD_ROLE_DEFAULT => {},
+                    &CFGCMD_ROLE_REMOTE => {},
+                },
+            },
             &CFGCMD_REPO_CREATE =>
             {
                 &CFGDEF_COMMAND_ROLE =>
@@ -2721,6 +2936,7 @@ my %hConfigDefine =
             &CFGCMD_BACKUP => {},
             &CFGCMD_CHECK => {},
             &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
             &CFGCMD_REPO_CREATE => {},
             &CFGCMD_REPO_GET => {},
             &CFGCMD_REPO_LS => {},
@@ -2742,6 +2958,33 @@ my %hConfigDefine =
         &CFGDEF_COMMAND => CFGOPT_LOG_LEVEL_CONSOLE,
     },
 
+    &CFGOPT_PROFILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_GET => {},
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_CHECK => {},
+            &CFGCMD_EXPIRE => {},
+            &CFGCMD_INFO => {},
+            &CFGCMD_RELATION_RESTORE => {},
+            &CFGCMD_REPO_CREATE => {},
+            &CFGCMD_REPO_GET => {},
+            &CFGCMD_REPO_LS => {},
+            &CFGCMD_REPO_PUT => {},
+            &CFGCMD_REPO_RM => {},
+            &CFGCMD_RESTORE => {},
+            &CFGCMD_STANZA_CREATE => {},
+            &CFGCMD_STANZA_DELETE => {},
+            &CFGCMD_STANZA_UPGRADE => {},
+            &CFGCMD_VERIFY => {},
+        }
+    },
+
     # Archive options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_ARCHIVE_ASYNC =>
@@ -2756,6 +2999,23 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_ARCHIVE_PUSH_BUFFER_MAX =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_SIZE,
+        &CFGDEF_DEFAULT => 0,
+        &CFGDEF_ALLOW_RANGE => [0, 1024 * 1024 * 1024],             # 0-1GB
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+            &CFGCMD_ROLE_ASYNC => {},
+        },
+    },
+
     &CFGOPT_ARCHIVE_PUSH_QUEUE_MAX =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2777,6 +3037,29 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_ARCHIVE_PUSH_REPO_QUEUE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH =>
+            {
+                &CFGDEF_DEPEND =>
+                {
+                    &CFGDEF_DEPEND_OPTION => CFGOPT_ARCHIVE_ASYNC,
+                    &CFGDEF_DEPEND_LIST => [true],
+                },
+            },
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+            &CFGCMD_ROLE_ASYNC => {},
+        },
+    },
+
     &CFGOPT_ARCHIVE_GET_QUEUE_MAX =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2794,6 +3077,19 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_ARCHIVE_SERVER =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND => CFGOPT_ARCHIVE_ASYNC,
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+            &CFGCMD_ROLE_ASYNC => {},
+        },
+    },
+
     # Backup options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_ARCHIVE_CHECK =>
@@ -2841,6 +3137,36 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_BACKUP_DEDUP =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
+    &CFGOPT_BACKUP_PRECOPY =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_BACKUP_STANDBY =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2874,6 +3200,22 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_COMPRESS_FRAME_SIZE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_SIZE,
+        &CFGDEF_DEFAULT => 0,
+        &CFGDEF_ALLOW_RANGE => [0, 1024 * 1024 * 1024],             # 0-1GB
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_EXCLUDE =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -3032,6 +3374,36 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_SPARSE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_RESTORE => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
+    &CFGOPT_SYNC_BATCH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_RESTORE => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     &CFGOPT_TABLESPACE_MAP_ALL =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -3090,6 +3462,46 @@ my %hConfigDefine =
         },
     },
 
+    # Verify options
+    #-------------------------------------------------------------------------------------------------------------------------------
+    &CFGOPT_VERIFY_LEDGER =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_INTERNAL => true,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_VERIFY => {},
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
+    &CFGOPT_VERIFY_SAMPLE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_INTERNAL => true,
+        &CFGDEF_DEFAULT => 10,
+        &CFGDEF_ALLOW_RANGE => [0, 100],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_VERIFY => {},
+        },
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_VERIFY_LEDGER,
+            &CFGDEF_DEPEND_LIST => [true],
+        },
+        &CFGDEF_COMMAND_ROLE =>
+        {
+            &CFGCMD_ROLE_DEFAULT => {},
+        },
+    },
+
     # Stanza options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_PG =>
@@ -60,7 +60,7 @@ foreach my $strLine (split("\n", $strProjectInfo))
     {
         eval("use constant PROJECT_VERSION => " . (split(" ", $strLine))[-1]);
     }
-    elsif ($strLine =~ /^#define REPOSITORY_FORMAT/)
+    elsif ($strLine =~ /^#define REPOSITORY_FORMAT\s/)
     {
         eval("use constant REPOSITORY_FORMAT => " . (split(" ", $strLine))[-1]);
     }
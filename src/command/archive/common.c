@@ -398,12 +398,285 @@ walIsSegment(const String *walSegment)
     FUNCTION_LOG_RETURN(BOOL, regExpMatch(regExpSegment, walSegment));
 }
 
+/***********************************************************************************************************************************
+List only the files that match a WAL segment. This is the cheapest lookup on object stores when a single segment is required.
+***********************************************************************************************************************************/
+static StringList *
+walSegmentList(const Storage *storage, const String *archiveId, const String *walSegment)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archiveId != NULL);
+    ASSERT(walSegment != NULL);
+
+    FUNCTION_LOG_RETURN(
+        STRING_LIST,
+        storageListP(
+            storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(strSubN(walSegment, 0, 16))),
+            .expression = strNewFmt(
+                "^%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(walSegment, 0, 24)),
+                    walIsPartial(walSegment) ? WAL_SEGMENT_PARTIAL_EXT : ""),
+            .nullOnMissing = true));
+}
+
+/***********************************************************************************************************************************
+WAL listing cache
+
+Listing a WAL directory is expensive on object stores and long-lived or multi-lookup callers often search the same directory for one
+segment after another, e.g. when a backup checks the archive or async archive-get looks ahead. These callers use the cache so each
+directory is listed once. Paths are keyed by repo index rather than storage since storage may be freed and reallocated. A segment
+that is not in the cached listing may have been archived after the directory was listed, so only that segment is listed and any
+match is added to the cached listing. Cached segments are not checked for existence since the check would cost as much as the narrow
+list that the cache replaces. A segment removed after it was listed (e.g. by expire) will error when it is read. Only the most
+recently used directories are kept since WAL is written sequentially. One-shot callers use walSegmentFind(), which lists only the
+requested segment.
+***********************************************************************************************************************************/
+#define WAL_SEGMENT_CACHE_MAX                                       8
+
+typedef struct WalSegmentCachePath
+{
+    unsigned int repoIdx;                                           // Repo the path was listed from
+    String *path;                                                   // Archive id and WAL directory, e.g. 13-1/0000000100000001
+    StringList *fileList;                                           // WAL files in the directory
+} WalSegmentCachePath;
+
+static struct WalSegmentCache
+{
+    MemContext *memContext;                                         // Mem context for the cache
+    List *pathList;                                                 // Cached paths, most recently used last
+} walSegmentCache;
+
+// Find a cached path and make it the most recently used
+static WalSegmentCachePath *
+walSegmentCachePathFind(unsigned int repoIdx, const String *path)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, repoIdx);
+        FUNCTION_TEST_PARAM(STRING, path);
+    FUNCTION_TEST_END();
+
+    WalSegmentCachePath *result = NULL;
+
+    if (walSegmentCache.pathList != NULL)
+    {
+        for (unsigned int pathIdx = 0; pathIdx < lstSize(walSegmentCache.pathList); pathIdx++)
+        {
+            WalSegmentCachePath *cachePath = lstGet(walSegmentCache.pathList, pathIdx);
+
+            if (cachePath->repoIdx == repoIdx && strEq(cachePath->path, path))
+            {
+                if (pathIdx != lstSize(walSegmentCache.pathList) - 1)
+                {
+                    WalSegmentCachePath cachePathMove = *cachePath;
+
+                    lstRemoveIdx(walSegmentCache.pathList, pathIdx);
+                    lstAdd(walSegmentCache.pathList, &cachePathMove);
+                }
+
+                result = lstGetLast(walSegmentCache.pathList);
+                break;
+            }
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// List a path that is not cached into the cache, removing the least recently used path when the cache is full
+static WalSegmentCachePath *
+walSegmentCacheLoad(unsigned int repoIdx, const String *path)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, path);
+    FUNCTION_LOG_END();
+
+    if (walSegmentCache.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("WalSegmentCache")
+            {
+                walSegmentCache.memContext = MEM_CONTEXT_NEW();
+                walSegmentCache.pathList = lstNewP(sizeof(WalSegmentCachePath));
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    ASSERT(walSegmentCachePathFind(repoIdx, path) == NULL);
+
+    WalSegmentCachePath *result = NULL;
+
+    MEM_CONTEXT_BEGIN(lstMemContext(walSegmentCache.pathList))
+    {
+        if (lstSize(walSegmentCache.pathList) == WAL_SEGMENT_CACHE_MAX)
+        {
+            WalSegmentCachePath *cachePathRemove = lstGet(walSegmentCache.pathList, 0);
+
+            strFree(cachePathRemove->path);
+            strLstFree(cachePathRemove->fileList);
+            lstRemoveIdx(walSegmentCache.pathList, 0);
+        }
+
+        result = lstAdd(walSegmentCache.pathList, &(WalSegmentCachePath){.repoIdx = repoIdx, .path = strDup(path)});
+
+        // List all segments in the path, including partials
+        result->fileList = storageListP(
+            storageRepoIdx(repoIdx), strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(path)),
+            .expression = strNewFmt(
+                "^%s[0-F]{8}(\\" WAL_SEGMENT_PARTIAL_EXT "){0,1}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$",
+                strZ(strBase(path))));
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_P(VOID, result);
+}
+
+// Add files from a cached path that match the prefix to the result list
+static void
+walSegmentCacheMatch(const WalSegmentCachePath *cachePath, const String *prefix, StringList *result)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, cachePath);
+        FUNCTION_TEST_PARAM(STRING, prefix);
+        FUNCTION_TEST_PARAM(STRING_LIST, result);
+    FUNCTION_TEST_END();
+
+    for (unsigned int fileIdx = 0; fileIdx < strLstSize(cachePath->fileList); fileIdx++)
+    {
+        if (strBeginsWith(strLstGet(cachePath->fileList, fileIdx), prefix))
+            strLstAdd(result, strLstGet(cachePath->fileList, fileIdx));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
-String *
-walSegmentFind(const Storage *storage, const String *archiveId, const String *walSegment, TimeMSec timeout)
+void
+walSegmentCacheAdd(unsigned int repoIdx, const String *archiveId, const String *walFile)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walFile);
+    FUNCTION_LOG_END();
+
+    ASSERT(archiveId != NULL);
+    ASSERT(walFile != NULL);
+    ASSERT(walIsSegment(strSubN(walFile, 0, 24)));
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Only paths that are already cached are updated since a path that is not cached will be listed when it is searched
+        WalSegmentCachePath *cachePath = walSegmentCachePathFind(
+            repoIdx, strNewFmt("%s/%s", strZ(archiveId), strZ(strSubN(walFile, 0, 16))));
+
+        if (cachePath != NULL)
+        {
+            // The file was just written so any other cached file for the same segment is stale and is removed
+            const String *prefix = strNewFmt("%s-", strZ(strLstGet(strLstNewSplitZ(walFile, "-"), 0)));
+
+            for (unsigned int fileIdx = strLstSize(cachePath->fileList); fileIdx > 0; fileIdx--)
+            {
+                String *file = strLstGet(cachePath->fileList, fileIdx - 1);
+
+                if (strBeginsWith(file, prefix))
+                {
+                    strLstRemoveIdx(cachePath->fileList, fileIdx - 1);
+                    strFree(file);
+                }
+            }
+
+            strLstAdd(cachePath->fileList, walFile);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+walSegmentCacheClear(void)
+{
+    FUNCTION_TEST_VOID();
+
+    if (walSegmentCache.memContext != NULL)
+    {
+        memContextFree(walSegmentCache.memContext);
+        walSegmentCache = (struct WalSegmentCache){0};
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+StringList *
+walSegmentCacheFindList(unsigned int repoIdx, const String *archiveId, const String *walSegment)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+    FUNCTION_LOG_END();
+
+    ASSERT(archiveId != NULL);
+    ASSERT(walSegment != NULL);
+    ASSERT(walIsSegment(walSegment));
+
+    StringList *result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *path = strNewFmt("%s/%s", strZ(archiveId), strZ(strSubN(walSegment, 0, 16)));
+        const String *prefix = strNewFmt("%s-", strZ(walSegment));
+
+        // Search the cached listing first
+        WalSegmentCachePath *cachePath = walSegmentCachePathFind(repoIdx, path);
+
+        if (cachePath != NULL)
+        {
+            walSegmentCacheMatch(cachePath, prefix, result);
+
+            // If the segment was not found then list only the segment since it may have been archived after the path was cached
+            if (strLstSize(result) == 0)
+            {
+                StringList *list = walSegmentList(storageRepoIdx(repoIdx), archiveId, walSegment);
+
+                for (unsigned int fileIdx = 0; list != NULL && fileIdx < strLstSize(list); fileIdx++)
+                {
+                    strLstAdd(cachePath->fileList, strLstGet(list, fileIdx));
+                    strLstAdd(result, strLstGet(list, fileIdx));
+                }
+            }
+        }
+        // Else list the path into the cache
+        else
+            walSegmentCacheMatch(walSegmentCacheLoad(repoIdx, path), prefix, result);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/***********************************************************************************************************************************
+Find a WAL segment, listing only the segment or using the WAL listing cache
+***********************************************************************************************************************************/
+static String *
+walSegmentFindInternal(
+    const Storage *storage, unsigned int repoIdx, bool cache, const String *archiveId, const String *walSegment, TimeMSec timeout)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(BOOL, cache);
         FUNCTION_LOG_PARAM(STRING, archiveId);
         FUNCTION_LOG_PARAM(STRING, walSegment);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
@@ -423,12 +696,12 @@ walSegmentFind(const Storage *storage, const String *archiveId, const String *wa
         do
         {
             // Get a list of all WAL segments that match
-            StringList *list = storageListP(
-                storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(strSubN(walSegment, 0, 16))),
-                .expression = strNewFmt(
-                    "^%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(walSegment, 0, 24)),
-                        walIsPartial(walSegment) ? WAL_SEGMENT_PARTIAL_EXT : ""),
-                .nullOnMissing = true);
+            StringList *list = NULL;
+
+            if (cache)
+                list = walSegmentCacheFindList(repoIdx, archiveId, walSegment);
+            else
+                list = walSegmentList(storage, archiveId, walSegment);
 
             // If there are results
             if (list != NULL && strLstSize(list) > 0)
@@ -469,6 +742,36 @@ walSegmentFind(const Storage *storage, const String *archiveId, const String *wa
     FUNCTION_LOG_RETURN(STRING, result);
 }
 
+/**********************************************************************************************************************************/
+String *
+walSegmentFind(const Storage *storage, const String *archiveId, const String *walSegment, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+
+    FUNCTION_LOG_RETURN(STRING, walSegmentFindInternal(storage, 0, false, archiveId, walSegment, timeout));
+}
+
+/**********************************************************************************************************************************/
+String *
+walSegmentCacheFind(unsigned int repoIdx, const String *archiveId, const String *walSegment, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(STRING, walSegmentFindInternal(storageRepoIdx(repoIdx), repoIdx, true, archiveId, walSegment, timeout));
+}
+
 /**********************************************************************************************************************************/
 String *
 walSegmentNext(const String *walSegment, size_t walSegmentSize, unsigned int pgVersion)
@@ -30,6 +30,9 @@ Status file extension constants
 #define STATUS_EXT_OK                                               ".ok"
 #define STATUS_EXT_OK_SIZE                                          (sizeof(STATUS_EXT_OK) - 1)
 
+// Per-repo lag written by async archive-push when there is more than one repo
+#define STATUS_EXT_LAG                                              ".lag"
+
 /***********************************************************************************************************************************
 WAL segment constants
 ***********************************************************************************************************************************/
@@ -96,6 +99,21 @@ String *walPath(const String *walFile, const String *pgPath, const String *comma
 // thing.
 String *walSegmentFind(const Storage *storage, const String *archiveId, const String *walSegment, TimeMSec timeout);
 
+// Find a WAL segment in the repository using the WAL listing cache. Only long-lived or multi-lookup callers should use the cache
+// since a one-shot lookup lists the entire WAL directory rather than only the segment. Cached matches are not checked for existence
+// and a segment missing from the cached listing is listed on its own.
+String *walSegmentCacheFind(unsigned int repoIdx, const String *archiveId, const String *walSegment, TimeMSec timeout);
+
+// Get all files in the repository that match a WAL segment using the WAL listing cache. walSegmentCacheFind() uses this function.
+StringList *walSegmentCacheFindList(unsigned int repoIdx, const String *archiveId, const String *walSegment);
+
+// Add a file that was just written to the repository to the WAL listing cache if the directory is cached. Other cached files for
+// the same segment are removed.
+void walSegmentCacheAdd(unsigned int repoIdx, const String *archiveId, const String *walFile);
+
+// Clear the WAL listing cache, e.g. after an error in a long-lived process
+void walSegmentCacheClear(void);
+
 // Get the next WAL segment given a WAL segment and WAL segment size
 String *walSegmentNext(const String *walSegment, size_t walSegmentSize, unsigned int pgVersion);
 
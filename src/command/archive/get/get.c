@@ -11,7 +11,9 @@ Archive Get Command
 
 #include "command/archive/common.h"
 #include "command/archive/get/file.h"
+#include "command/archive/get/get.h"
 #include "command/archive/get/protocol.h"
+#include "command/archive/server.h"
 #include "command/command.h"
 #include "common/debug.h"
 #include "common/log.h"
@@ -56,29 +58,27 @@ typedef struct ArchiveGetCheckResult
     const String *errorMessage;                                     // Error message if there was an error
 } ArchiveGetCheckResult;
 
-// Helper to find a single archive file in the repository using a cache to speed up the process and minimize storageListP() calls
-typedef struct ArchiveGetFindCache
+// Archive info cached by the archive server so it is only loaded once
+static struct ArchiveGetLocal
 {
-    const String *path;
-    const StringList *fileList;
-} ArchiveGetFindCache;
+    MemContext *memContext;                                         // Mem context for the cached archive info
+    InfoArchive *info;                                              // Cached archive info
+} archiveGetLocal;
 
+// Helper to find a single archive file in the repository using the WAL listing cache to minimize storageListP() calls
 static bool
-archiveGetFind(
-    const String *archiveFileRequest, const String *archiveId, ArchiveGetCheckResult *getCheckResult, List *cache, bool single)
+archiveGetFind(const String *archiveFileRequest, const String *archiveId, ArchiveGetCheckResult *getCheckResult, bool single)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, archiveFileRequest);
         FUNCTION_LOG_PARAM(STRING, archiveId);
         FUNCTION_LOG_PARAM_P(VOID, getCheckResult);
-        FUNCTION_LOG_PARAM(LIST, cache);
         FUNCTION_LOG_PARAM(BOOL, single);
     FUNCTION_LOG_END();
 
     ASSERT(archiveFileRequest != NULL);
     ASSERT(archiveId != NULL);
     ASSERT(getCheckResult != NULL);
-    ASSERT(cache != NULL);
 
     ArchiveFileMap archiveFileMap = {0};
 
@@ -102,40 +102,13 @@ archiveGetFind(
                         "^%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(archiveFileRequest, 0, 24)),
                             walIsPartial(archiveFileRequest) ? WAL_SEGMENT_PARTIAL_EXT : ""));
             }
-            // Else multiple files will be requested so cache list results
+            // Else multiple files will be requested so use the WAL listing cache
             else
             {
                 // Partial files cannot be in a list with multiple requests
                 ASSERT(!walIsPartial(archiveFileRequest));
 
-                // If the path does not exist in the cache then fetch it
-                const ArchiveGetFindCache *cachePath = lstFind(cache, &path);
-
-                if (cachePath == NULL)
-                {
-                    MEM_CONTEXT_BEGIN(lstMemContext(cache))
-                    {
-                        cachePath = lstAdd(
-                            cache,
-                            &(ArchiveGetFindCache)
-                            {
-                                .path = strDup(path),
-                                .fileList = storageListP(
-                                    storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(path)),
-                                    .expression = strNewFmt("^%s[0-F]{8}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(path))),
-                            });
-                    }
-                    MEM_CONTEXT_END();
-                }
-
-                // Get a list of all WAL segments that match
-                matchList = strLstNew();
-
-                for (unsigned int fileIdx = 0; fileIdx < strLstSize(cachePath->fileList); fileIdx++)
-                {
-                    if (strBeginsWith(strLstGet(cachePath->fileList, fileIdx), archiveFileRequest))
-                        strLstAdd(matchList, strLstGet(cachePath->fileList, fileIdx));
-                }
+                matchList = walSegmentCacheFindList(cfgOptionGroupIdxDefault(cfgOptGrpRepo), archiveId, archiveFileRequest);
             }
 
             // If there is a single result then return it
@@ -212,14 +185,21 @@ archiveGetCheck(const StringList *archiveRequestList)
 
         result.cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType));
 
-        // Attempt to load the archive info file
-        InfoArchive *info = infoArchiveLoadFile(
-            storageRepo(), INFO_ARCHIVE_PATH_FILE_STR, result.cipherType, cfgOptionStrNull(cfgOptRepoCipherPass));
+        // Attempt to load the archive info file unless it has been cached by the archive server
+        InfoArchive *info = archiveGetLocal.info;
+
+        if (info == NULL)
+        {
+            info = infoArchiveLoadFile(
+                storageRepo(), INFO_ARCHIVE_PATH_FILE_STR, result.cipherType, cfgOptionStrNull(cfgOptRepoCipherPass));
+
+            if (archiveGetLocal.memContext != NULL)
+                archiveGetLocal.info = infoArchiveMove(info, archiveGetLocal.memContext);
+        }
 
         // Loop through the pg history and determine which archiveId to use based on the first file in the list
         bool found = false;
         const String *archiveId = NULL;
-        List *cache = NULL;
 
         for (unsigned int pgIdx = 0; pgIdx < infoPgDataTotal(infoArchivePg(info)); pgIdx++)
         {
@@ -229,10 +209,7 @@ archiveGetCheck(const StringList *archiveRequestList)
             if (pgData.systemId == controlInfo.systemId && pgData.version == controlInfo.version)
             {
                 archiveId = infoPgArchiveId(infoArchivePg(info), pgIdx);
-                cache = lstNewP(sizeof(ArchiveGetFindCache), .comparator = lstComparatorStr);
-
-                found = archiveGetFind(
-                    strLstGet(archiveRequestList, 0), archiveId, &result, cache, strLstSize(archiveRequestList) == 1);
+                found = archiveGetFind(strLstGet(archiveRequestList, 0), archiveId, &result, strLstSize(archiveRequestList) == 1);
 
                 // If the file was found then use this archiveId for the rest of the files
                 if (found)
@@ -265,7 +242,7 @@ archiveGetCheck(const StringList *archiveRequestList)
             // Find the rest of the files in the list
             for (unsigned int archiveRequestIdx = 1; archiveRequestIdx < strLstSize(archiveRequestList); archiveRequestIdx++)
             {
-                if (!archiveGetFind(strLstGet(archiveRequestList, archiveRequestIdx), archiveId, &result, cache, false))
+                if (!archiveGetFind(strLstGet(archiveRequestList, archiveRequestIdx), archiveId, &result, false))
                     break;
             }
         }
@@ -349,6 +326,102 @@ queueNeed(const String *walSegment, bool found, uint64_t queueSize, size_t walSe
     FUNCTION_LOG_RETURN(STRING_LIST, result);
 }
 
+/***********************************************************************************************************************************
+Get an archive file synchronously. Returns true if the file was found.
+***********************************************************************************************************************************/
+static bool
+archiveGetSync(const String *walSegment, const String *walDestination)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+        FUNCTION_LOG_PARAM(STRING, walDestination);
+    FUNCTION_LOG_END();
+
+    ASSERT(walSegment != NULL);
+    ASSERT(walDestination != NULL);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Check for the archive file
+        StringList *archiveRequestList = strLstNew();
+        strLstAdd(archiveRequestList, walSegment);
+
+        ArchiveGetCheckResult checkResult = archiveGetCheck(archiveRequestList);
+
+        // If there was an error then throw it
+        if (checkResult.errorType != NULL)
+            THROW_CODE(errorTypeCode(checkResult.errorType), strZ(checkResult.errorMessage));
+
+        // Get the archive file
+        if (lstSize(checkResult.archiveFileMapList) > 0)
+        {
+            ASSERT(lstSize(checkResult.archiveFileMapList) == 1);
+
+            archiveGetFile(
+                storageLocalWrite(), ((ArchiveFileMap *)lstGet(checkResult.archiveFileMapList, 0))->actual, walDestination, false,
+                checkResult.cipherType, checkResult.cipherPassArchive);
+
+            // If there was no error then the file existed
+            LOG_INFO_FMT(
+                FOUND_IN_REPO_ARCHIVE_MSG, strZ(walSegment),
+                cfgOptionGroupIdxToKey(cfgOptGrpRepo, cfgOptionGroupIdxDefault(cfgOptGrpRepo)), strZ(checkResult.archiveId));
+
+            result = true;
+        }
+        // Else log that the file was not found
+        else
+            LOG_INFO_FMT(UNABLE_TO_FIND_IN_ARCHIVE_MSG, strZ(walSegment));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+bool
+archiveGetServerFile(const String *walSegment, const String *walDestination)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+        FUNCTION_LOG_PARAM(STRING, walDestination);
+    FUNCTION_LOG_END();
+
+    bool result = false;
+
+    // Create a mem context so archive info will be cached
+    if (archiveGetLocal.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("ArchiveGetLocal")
+            {
+                archiveGetLocal.memContext = MEM_CONTEXT_NEW();
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    TRY_BEGIN()
+    {
+        result = archiveGetSync(walSegment, walDestination);
+    }
+    // Reload archive info and WAL listings on the next request in case the error was caused by a change, e.g. stanza-upgrade
+    CATCH_ANY()
+    {
+        memContextFree(archiveGetLocal.memContext);
+        archiveGetLocal = (struct ArchiveGetLocal){0};
+        walSegmentCacheClear();
+
+        RETHROW();
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 /**********************************************************************************************************************************/
 int
 cmdArchiveGet(void)
@@ -384,8 +457,9 @@ cmdArchiveGet(void)
         const String *walDestination =
             walPath(strLstGet(commandParam, 1), cfgOptionStr(cfgOptPgPath), STR(cfgCommandName(cfgCommand())));
 
-        // Async get can only be performed on WAL segments, history or other files must use synchronous mode
-        if (cfgOptionBool(cfgOptArchiveAsync) && walIsSegment(walSegment))
+        // Async get can only be performed on WAL segments, history or other files must use synchronous mode. The archive server
+        // takes precedence over async mode.
+        if (cfgOptionBool(cfgOptArchiveAsync) && !cfgOptionBool(cfgOptArchiveServer) && walIsSegment(walSegment))
         {
             bool found = false;                                         // Has the WAL segment been found yet?
             bool queueFull = false;                                     // Is the queue half or more full?
@@ -510,39 +584,32 @@ cmdArchiveGet(void)
                 LOG_INFO_FMT(UNABLE_TO_FIND_IN_ARCHIVE_MSG " asynchronously", strZ(walSegment));
 
         }
-        // Else perform synchronous get
-        else
+        // Else get using the archive server when enabled
+        else if (cfgOptionBool(cfgOptArchiveServer))
         {
-            // Check for the archive file
-            StringList *archiveRequestList = strLstNew();
-            strLstAdd(archiveRequestList, walSegment);
-
-            ArchiveGetCheckResult checkResult = archiveGetCheck(archiveRequestList);
+            ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_GET_SERVER_STR);
+            protocolCommandParamAdd(command, VARSTR(walSegment));
+            protocolCommandParamAdd(command, VARSTR(walDestination));
 
-            // If there was an error then throw it
-            if (checkResult.errorType != NULL)
-                THROW_CODE(errorTypeCode(checkResult.errorType), strZ(checkResult.errorMessage));
+            ArchiveServerResult serverResult = archiveServerExecute(archiveModeGet, command);
 
-            // Get the archive file
-            if (lstSize(checkResult.archiveFileMapList) > 0)
+            if (serverResult.executed)
             {
-                ASSERT(lstSize(checkResult.archiveFileMapList) == 1);
-
-                archiveGetFile(
-                    storageLocalWrite(), ((ArchiveFileMap *)lstGet(checkResult.archiveFileMapList, 0))->actual, walDestination,
-                    false, checkResult.cipherType, checkResult.cipherPassArchive);
-
-                // If there was no error then the file existed
-                LOG_INFO_FMT(
-                    FOUND_IN_REPO_ARCHIVE_MSG, strZ(walSegment),
-                    cfgOptionGroupIdxToKey(cfgOptGrpRepo, cfgOptionGroupIdxDefault(cfgOptGrpRepo)), strZ(checkResult.archiveId));
-
-                result = 0;
+                if (varBool(serverResult.output))
+                {
+                    LOG_INFO_FMT(FOUND_IN_ARCHIVE_MSG " using the archive server", strZ(walSegment));
+                    result = 0;
+                }
+                else
+                    LOG_INFO_FMT(UNABLE_TO_FIND_IN_ARCHIVE_MSG " using the archive server", strZ(walSegment));
             }
-            // Else log that the file was not found
-            else
-                LOG_INFO_FMT(UNABLE_TO_FIND_IN_ARCHIVE_MSG, strZ(walSegment));
+            // Else get synchronously until the server is running
+            else if (archiveGetSync(walSegment, walDestination))
+                result = 0;
         }
+        // Else perform synchronous get
+        else if (archiveGetSync(walSegment, walDestination))
+            result = 0;
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -4,6 +4,8 @@ Archive Get Command
 #ifndef COMMAND_ARCHIVE_GET_GET_H
 #define COMMAND_ARCHIVE_GET_GET_H
 
+#include "common/type/string.h"
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -13,4 +15,8 @@ int cmdArchiveGet(void);
 // Async version of archive get that runs in parallel for performance
 void cmdArchiveGetAsync(void);
 
+// Get an archive file for the archive server. Archive info is loaded on the first call and reused until there is an error. Returns
+// true if the file was found.
+bool archiveGetServerFile(const String *walSegment, const String *walDestination);
+
 #endif
@@ -4,6 +4,7 @@ Archive Get Protocol Handler
 #include "build.auto.h"
 
 #include "command/archive/get/file.h"
+#include "command/archive/get/get.h"
 #include "command/archive/get/protocol.h"
 #include "common/debug.h"
 #include "common/io/io.h"
@@ -16,6 +17,7 @@ Archive Get Protocol Handler
 Constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(PROTOCOL_COMMAND_ARCHIVE_GET_STR,                     PROTOCOL_COMMAND_ARCHIVE_GET);
+STRING_EXTERN(PROTOCOL_COMMAND_ARCHIVE_GET_SERVER_STR,              PROTOCOL_COMMAND_ARCHIVE_GET_SERVER);
 
 /**********************************************************************************************************************************/
 bool
@@ -47,6 +49,11 @@ archiveGetProtocol(const String *command, const VariantList *paramList, Protocol
 
             protocolServerResponse(server, NULL);
         }
+        else if (strEq(command, PROTOCOL_COMMAND_ARCHIVE_GET_SERVER_STR))
+        {
+            protocolServerResponse(
+                server, VARBOOL(archiveGetServerFile(varStr(varLstGet(paramList, 0)), varStr(varLstGet(paramList, 1)))));
+        }
         else
             found = false;
     }
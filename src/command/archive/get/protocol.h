@@ -13,6 +13,8 @@ Constants
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_ARCHIVE_GET                                "archiveGet"
     STRING_DECLARE(PROTOCOL_COMMAND_ARCHIVE_GET_STR);
+#define PROTOCOL_COMMAND_ARCHIVE_GET_SERVER                         "archiveGetServer"
+    STRING_DECLARE(PROTOCOL_COMMAND_ARCHIVE_GET_SERVER_STR);
 
 /***********************************************************************************************************************************
 Functions
@@ -9,6 +9,7 @@ Archive Push File
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
 #include "common/debug.h"
+#include "common/io/bufferRead.h"
 #include "common/io/filter/group.h"
 #include "common/io/io.h"
 #include "common/log.h"
@@ -16,11 +17,37 @@ Archive Push File
 #include "postgres/interface.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Find a WAL segment in a repo before pushing it. Segments are rarely found when pushing, so a segment found in the WAL listing cache
+is confirmed by listing only the segment. This costs nothing in the common case and a stale cache entry cannot cause the segment to
+be skipped or rejected.
+***********************************************************************************************************************************/
+static String *
+archivePushFind(unsigned int repoIdx, const String *archiveId, const String *archiveFile, bool walCache)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, archiveFile);
+        FUNCTION_LOG_PARAM(BOOL, walCache);
+    FUNCTION_LOG_END();
+
+    ASSERT(archiveId != NULL);
+    ASSERT(archiveFile != NULL);
+
+    String *result = NULL;
+
+    if (!walCache || walSegmentCacheFind(repoIdx, archiveId, archiveFile, 0) != NULL)
+        result = walSegmentFind(storageRepoIdx(repoIdx), archiveId, archiveFile, 0);
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
+
 /**********************************************************************************************************************************/
 String *
 archivePushFile(
     const String *walSource, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile, CompressType compressType,
-    int compressLevel, const ArchivePushFileRepoData *repoData)
+    int compressLevel, uint64_t bufferMax, const ArchivePushFileRepoData *repoData, bool walCache)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, walSource);
@@ -29,7 +56,9 @@ archivePushFile(
         FUNCTION_LOG_PARAM(STRING, archiveFile);
         FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(INT, compressLevel);
+        FUNCTION_LOG_PARAM(UINT64, bufferMax);
         FUNCTION_LOG_PARAM_P(VOID, repoData);
+        FUNCTION_LOG_PARAM(BOOL, walCache);
     FUNCTION_LOG_END();
 
     ASSERT(walSource != NULL);
@@ -46,10 +75,28 @@ archivePushFile(
         // Is this a WAL segment?
         bool isSegment = walIsSegment(archiveFile);
 
+        // If the file is no larger than bufferMax then read it into memory so it is only read from disk once. The WAL header check,
+        // checksum, and copy to each repo are all done from memory, which matters when the archiver is competing with PostgreSQL
+        // for disk I/O. Otherwise the file is streamed once for the checksum and again for the copy so memory use stays bounded.
+        const Buffer *walBuffer = NULL;
+
+        if (bufferMax > 0 && storageInfoP(storageLocal(), walSource, .ignoreMissing = true).size <= bufferMax)
+            walBuffer = storageGetP(storageNewReadP(storageLocal(), walSource));
+
         // If this is a segment compare archive version and systemId to the WAL header
         if (isSegment)
         {
-            PgWal walInfo = pgWalFromFile(walSource, storageLocal());
+            PgWal walInfo = {0};
+
+            if (walBuffer != NULL)
+            {
+                if (bufUsed(walBuffer) < PG_WAL_HEADER_SIZE)
+                    THROW_FMT(FileReadError, "unable to read %u byte(s) from '%s'", PG_WAL_HEADER_SIZE, strZ(walSource));
+
+                walInfo = pgWalFromBuffer(walBuffer);
+            }
+            else
+                walInfo = pgWalFromFile(walSource, storageLocal());
 
             if (walInfo.version != pgVersion || walInfo.systemId != pgSystemId)
             {
@@ -69,7 +116,7 @@ archivePushFile(
         bool *destinationCopy = memNew(sizeof(bool) * repoTotal);
 
         for (unsigned int repoIdx = 0; repoIdx < repoTotal; repoIdx++)
-            destinationCopy[repoIdx] = true;
+            destinationCopy[repoIdx] = repoData[repoIdx].archiveId != NULL;
 
         // Get wal segment checksum and compare it to what exists in the repo, if any
         if (isSegment)
@@ -78,17 +125,35 @@ archivePushFile(
             destinationCopyAny = false;
 
             // Generate a sha1 checksum for the wal segment
-            IoRead *read = storageReadIo(storageNewReadP(storageLocal(), walSource));
-            ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
-            ioReadDrain(read);
+            const String *walSegmentChecksum = NULL;
 
-            const String *walSegmentChecksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
+            if (walBuffer != NULL)
+                walSegmentChecksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer));
+            else
+            {
+                IoRead *read = storageReadIo(storageNewReadP(storageLocal(), walSource));
+                ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+                ioReadDrain(read);
+
+                walSegmentChecksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
+            }
 
             // Check each repo for the WAL segment
             for (unsigned int repoIdx = 0; repoIdx < repoTotal; repoIdx++)
             {
+                // Skip repos that were not requested
+                if (repoData[repoIdx].archiveId == NULL)
+                    continue;
+
+                // Queued repos are checked when the queued file is pushed to the repo
+                if (repoData[repoIdx].queue)
+                {
+                    destinationCopyAny = true;
+                    continue;
+                }
+
                 // If the wal segment already exists in the repo then compare checksums
-                const String *walSegmentFile = walSegmentFind(storageRepoIdx(repoIdx), repoData[repoIdx].archiveId, archiveFile, 0);
+                const String *walSegmentFile = archivePushFind(repoIdx, repoData[repoIdx].archiveId, archiveFile, walCache);
 
                 if (walSegmentFile != NULL)
                 {
@@ -137,8 +202,9 @@ archivePushFile(
         // Copy the file if one or more repos require it
         if (destinationCopyAny)
         {
-            // Source file is read once and copied to all repos
-            StorageRead *source = storageNewReadP(storageLocal(), walSource);
+            // Source is copied from memory when the file was buffered, else it is read from disk again
+            IoRead *source =
+                walBuffer != NULL ? ioBufferReadNew(walBuffer) : storageReadIo(storageNewReadP(storageLocal(), walSource));
 
             // Is the file compressible during the copy?
             bool compressible = true;
@@ -147,7 +213,7 @@ archivePushFile(
             if (isSegment && compressType != compressTypeNone)
             {
                 compressExtCat(archiveDestination, compressType);
-                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), compressFilter(compressType, compressLevel));
+                ioFilterGroupAdd(ioReadFilterGroup(source), compressFilter(compressType, compressLevel));
                 compressible = false;
             }
 
@@ -159,11 +225,24 @@ archivePushFile(
                 // Does this repo need a copy?
                 if (destinationCopy[repoIdx])
                 {
-                    // Create destination file
-                    destination[repoIdx] = storageNewWriteP(
-                        storageRepoIdxWrite(repoIdx),
-                        strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(repoData[repoIdx].archiveId), strZ(archiveDestination)),
-                        .compressible = compressible);
+                    // Queued repos get the file in the spool queue exactly as it will be stored in the repo, i.e. compressed and
+                    // encrypted with the cipher of the repo, so unencrypted WAL is never left in the spool path
+                    if (repoData[repoIdx].queue)
+                    {
+                        destination[repoIdx] = storageNewWriteP(
+                            storageSpoolWrite(),
+                            strNewFmt(
+                                STORAGE_SPOOL_ARCHIVE_QUEUE "/repo%u/%s",
+                                cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx), strZ(archiveDestination)));
+                    }
+                    // Else create destination file
+                    else
+                    {
+                        destination[repoIdx] = storageNewWriteP(
+                            storageRepoIdxWrite(repoIdx),
+                            strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(repoData[repoIdx].archiveId), strZ(archiveDestination)),
+                            .compressible = compressible);
+                    }
 
                     // If there is a cipher then add the encrypt filter
                     if (repoData[repoIdx].cipherType != cipherTypeNone)
@@ -176,10 +255,10 @@ archivePushFile(
                 }
             }
 
-            // Open source file
-            ioReadOpen(storageReadIo(source));
+            // Open source
+            ioReadOpen(source);
 
-            // Open the destination files now that we know the source file exists and is readable
+            // Open the destination files
             for (unsigned int repoIdx = 0; repoIdx < repoTotal; repoIdx++)
             {
                 if (destinationCopy[repoIdx])
@@ -192,7 +271,7 @@ archivePushFile(
             do
             {
                 // Read from source
-                ioRead(storageReadIo(source), read);
+                ioRead(source, read);
 
                 // Write to each destination
                 for (unsigned int repoIdx = 0; repoIdx < repoTotal; repoIdx++)
@@ -204,17 +283,105 @@ archivePushFile(
                 // Clear buffer
                 bufUsedZero(read);
             }
-            while (!ioReadEof(storageReadIo(source)));
+            while (!ioReadEof(source));
 
             // Close the source and destination files
-            ioReadClose(storageReadIo(source));
+            ioReadClose(source);
 
             for (unsigned int repoIdx = 0; repoIdx < repoTotal; repoIdx++)
             {
                 if (destinationCopy[repoIdx])
+                {
                     ioWriteClose(storageWriteIo(destination[repoIdx]));
+
+                    // Add the segment to the WAL listing cache so later searches in this process find it without a listing
+                    if (isSegment && walCache && !repoData[repoIdx].queue)
+                        walSegmentCacheAdd(repoIdx, repoData[repoIdx].archiveId, archiveDestination);
+                }
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
+
+/**********************************************************************************************************************************/
+String *
+archivePushQueueFile(const String *queueFile, unsigned int repoIdx, const String *archiveId, CipherType cipherType)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, queueFile);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+    FUNCTION_LOG_END();
+
+    ASSERT(queueFile != NULL);
+    ASSERT(archiveId != NULL);
+
+    String *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *queuePath = strNewFmt(
+            STORAGE_SPOOL_ARCHIVE_QUEUE "/repo%u/%s", cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx), strZ(queueFile));
+
+        // The archive file is the part of the queue file before the checksum, if there is one
+        const String *archiveFile = strLstGet(strLstNewSplitZ(queueFile, "-"), 0);
+        bool isSegment = walIsSegment(archiveFile);
+
+        // If the wal segment already exists in the repo then compare checksums
+        bool copy = true;
+
+        if (isSegment)
+        {
+            const String *walSegmentFile = archivePushFind(repoIdx, archiveId, archiveFile, true);
+
+            if (walSegmentFile != NULL)
+            {
+                // If the checksums are the same then succeed but warn in case this is a symptom of some other issue
+                if (strEq(
+                        strSubN(walSegmentFile, strSize(archiveFile) + 1, HASH_TYPE_SHA1_SIZE_HEX),
+                        strSubN(queueFile, strSize(archiveFile) + 1, HASH_TYPE_SHA1_SIZE_HEX)))
+                {
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        result = strNewFmt(
+                            "WAL file '%s' already exists in the repo%u archive with the same checksum"
+                                "\nHINT: this is valid in some recovery scenarios but may also indicate a problem.",
+                            strZ(archiveFile), cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx));
+                    }
+                    MEM_CONTEXT_PRIOR_END();
+
+                    copy = false;
+                }
+                // Else error so we don't overwrite the existing segment
+                else
+                {
+                    THROW_FMT(
+                        ArchiveDuplicateError, "WAL file '%s' already exists in the repo%u archive with a different checksum",
+                        strZ(archiveFile), cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx));
+                }
             }
         }
+
+        // Copy the queued file to the repo as is since it was compressed and encrypted when it was queued
+        if (copy)
+        {
+            storageCopyP(
+                storageNewReadP(storageSpool(), queuePath),
+                storageNewWriteP(
+                    storageRepoIdxWrite(repoIdx), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(queueFile)),
+                    .compressible = compressTypeFromName(queueFile) == compressTypeNone && cipherType == cipherTypeNone));
+
+            // Add the segment to the WAL listing cache so later searches in this process find it without a listing
+            if (isSegment)
+                walSegmentCacheAdd(repoIdx, archiveId, queueFile);
+        }
+
+        // The file is in the repo so remove it from the queue
+        storageRemoveP(storageSpoolWrite(), queuePath, .errorOnMissing = true);
     }
     MEM_CONTEXT_TEMP_END();
 
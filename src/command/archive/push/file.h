@@ -11,21 +11,31 @@ Archive Push File
 
 /***********************************************************************************************************************************
 Structure to hold information for each repository the archive file will be pushed to. An array of these must be passed to
-archivePushFile() with size equal to cfgOptionGroupIdxTotal(cfgOptGrpRepo).
+archivePushFile() with size equal to cfgOptionGroupIdxTotal(cfgOptGrpRepo). Repos with a NULL archiveId are skipped so the file can
+be pushed to a subset of the repos. Repos with queue set get the file in the spool queue, compressed and encrypted for the repo, and
+archivePushQueueFile() pushes it to the repo later.
 ***********************************************************************************************************************************/
 typedef struct ArchivePushFileRepoData
 {
     const String *archiveId;
     CipherType cipherType;
     const String *cipherPass;
+    bool queue;
 } ArchivePushFileRepoData;
 
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
-// Copy a file from the source to the archive
+// Copy a file from the source to the archive. Files no larger than bufferMax are read into memory once and the checksum, duplicate
+// check, and copy to each repo are done from memory so local I/O is not doubled. A bufferMax of zero disables buffering. Set
+// walCache when the process pushes more than one file, e.g. async locals or the archive server, so the WAL listing cache is used
+// for the duplicate check.
 String *archivePushFile(
     const String *walSource, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile, CompressType compressType,
-    int compressLevel, const ArchivePushFileRepoData *repoData);
+    int compressLevel, uint64_t bufferMax, const ArchivePushFileRepoData *repoData, bool walCache);
+
+// Push a file from the spool queue to a repo and remove it from the queue. The file is copied as is since it was compressed and
+// encrypted when it was queued.
+String *archivePushQueueFile(const String *queueFile, unsigned int repoIdx, const String *archiveId, CipherType cipherType);
 
 #endif
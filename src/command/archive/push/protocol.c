@@ -5,6 +5,7 @@ Archive Push Protocol Handler
 
 #include "command/archive/push/file.h"
 #include "command/archive/push/protocol.h"
+#include "command/archive/push/push.h"
 #include "common/debug.h"
 #include "common/io/io.h"
 #include "common/log.h"
@@ -16,6 +17,8 @@ Archive Push Protocol Handler
 Constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR,                     PROTOCOL_COMMAND_ARCHIVE_PUSH);
+STRING_EXTERN(PROTOCOL_COMMAND_ARCHIVE_PUSH_QUEUE_STR,               PROTOCOL_COMMAND_ARCHIVE_PUSH_QUEUE);
+STRING_EXTERN(PROTOCOL_COMMAND_ARCHIVE_PUSH_SERVER_STR,              PROTOCOL_COMMAND_ARCHIVE_PUSH_SERVER);
 
 /**********************************************************************************************************************************/
 bool
@@ -36,8 +39,8 @@ archivePushProtocol(const String *command, const VariantList *paramList, Protoco
     {
         if (strEq(command, PROTOCOL_COMMAND_ARCHIVE_PUSH_STR))
         {
-            const unsigned int paramFixed = 6;                      // Fixed params before the repo param array
-            const unsigned int paramRepo = 3;                       // Parameters in each index of the repo array
+            const unsigned int paramFixed = 7;                      // Fixed params before the repo param array
+            const unsigned int paramRepo = 4;                       // Parameters in each index of the repo array
 
             // Check that the correct number of repo parameters were passed
             CHECK(varLstSize(paramList) - paramFixed == cfgOptionGroupIdxTotal(cfgOptGrpRepo) * paramRepo);
@@ -51,6 +54,7 @@ archivePushProtocol(const String *command, const VariantList *paramList, Protoco
                 repoData[repoIdx].cipherType = (CipherType)varUIntForce(
                     varLstGet(paramList, paramFixed + (repoIdx * paramRepo) + 1));
                 repoData[repoIdx].cipherPass = varStr(varLstGet(paramList, paramFixed + (repoIdx * paramRepo) + 2));
+                repoData[repoIdx].queue = varBool(varLstGet(paramList, paramFixed + (repoIdx * paramRepo) + 3));
             }
 
             // Push the file
@@ -60,8 +64,19 @@ archivePushProtocol(const String *command, const VariantList *paramList, Protoco
                     archivePushFile(
                         varStr(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), varUInt64(varLstGet(paramList, 2)),
                         varStr(varLstGet(paramList, 3)), (CompressType)varUIntForce(varLstGet(paramList, 4)),
-                        varIntForce(varLstGet(paramList, 5)), repoData)));
+                        varIntForce(varLstGet(paramList, 5)), varUInt64Force(varLstGet(paramList, 6)), repoData, true)));
         }
+        else if (strEq(command, PROTOCOL_COMMAND_ARCHIVE_PUSH_QUEUE_STR))
+        {
+            protocolServerResponse(
+                server,
+                VARSTR(
+                    archivePushQueueFile(
+                        varStr(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), varStr(varLstGet(paramList, 2)),
+                        (CipherType)varUIntForce(varLstGet(paramList, 3)))));
+        }
+        else if (strEq(command, PROTOCOL_COMMAND_ARCHIVE_PUSH_SERVER_STR))
+            protocolServerResponse(server, VARSTR(archivePushServerFile(varStr(varLstGet(paramList, 0)))));
         else
             found = false;
     }
@@ -13,6 +13,10 @@ Constants
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_ARCHIVE_PUSH                               "archivePush"
     STRING_DECLARE(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR);
+#define PROTOCOL_COMMAND_ARCHIVE_PUSH_QUEUE                         "archivePushQueue"
+    STRING_DECLARE(PROTOCOL_COMMAND_ARCHIVE_PUSH_QUEUE_STR);
+#define PROTOCOL_COMMAND_ARCHIVE_PUSH_SERVER                        "archivePushServer"
+    STRING_DECLARE(PROTOCOL_COMMAND_ARCHIVE_PUSH_SERVER_STR);
 
 /***********************************************************************************************************************************
 Functions
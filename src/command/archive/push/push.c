@@ -4,11 +4,14 @@ Archive Push Command
 #include "build.auto.h"
 
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "command/archive/common.h"
 #include "command/archive/push/file.h"
 #include "command/archive/push/protocol.h"
+#include "command/archive/push/push.h"
+#include "command/archive/server.h"
 #include "command/command.h"
 #include "command/control/common.h"
 #include "common/compress/helper.h"
@@ -24,6 +27,7 @@ Archive Push Command
 #include "protocol/helper.h"
 #include "protocol/parallel.h"
 #include "storage/helper.h"
+#include "storage/write.intern.h"
 
 /***********************************************************************************************************************************
 Ready file extension constants
@@ -118,8 +122,8 @@ archivePushReadyList(const String *walPath)
 /***********************************************************************************************************************************
 Determine which WAL files need to be pushed to the archive when in async mode
 
-This is the heart of the "look ahead" functionality in async archiving.  Any files in the out directory that do not end in ok are
-removed and any ok files that do not have a corresponding ready file in archive_status (meaning it has been acknowledged by
+This is the heart of the "look ahead" functionality in async archiving.  Any files in the out directory that do not end in ok or lag
+are removed and any ok files that do not have a corresponding ready file in archive_status (meaning it has been acknowledged by
 PostgreSQL) are removed.  Then all ready files that do not have a corresponding ok file (meaning it has already been processed) are
 returned for processing.
 ***********************************************************************************************************************************/
@@ -152,7 +156,8 @@ archivePushProcessList(const String *walPath)
 
             if (strEndsWithZ(statusFile, STATUS_EXT_OK))
                 strLstAdd(okList, strSubN(statusFile, 0, strSize(statusFile) - STATUS_EXT_OK_SIZE));
-            else
+            // Lag files are preserved between runs so they are always available for monitoring
+            else if (!strEndsWithZ(statusFile, STATUS_EXT_LAG))
             {
                 storageRemoveP(
                     storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_OUT "/%s", strZ(statusFile)), .errorOnMissing = true);
@@ -220,8 +225,9 @@ archivePushCheck(bool pgPathSet)
             // Get the repo storage in case it is remote and encryption settings need to be pulled down
             storageRepoIdx(repoIdx);
 
-            // Set cipher type in repo data
-            result.repoData[repoIdx].cipherType = cipherType(cfgOptionIdxStr(cfgOptRepoCipherType, repoIdx));
+            // Initialize repo data with the cipher type
+            result.repoData[repoIdx] =
+                (ArchivePushFileRepoData){.cipherType = cipherType(cfgOptionIdxStr(cfgOptRepoCipherType, repoIdx))};
 
             // Attempt to load the archive info file
             InfoArchive *info = infoArchiveLoadFile(
@@ -264,6 +270,68 @@ archivePushCheck(bool pgPathSet)
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
 
+/***********************************************************************************************************************************
+Archive info cached by the archive server so it is only loaded once
+***********************************************************************************************************************************/
+static struct ArchivePushLocal
+{
+    MemContext *memContext;                                         // Mem context for the cached archive info
+    ArchivePushCheckResult archiveInfo;                             // Cached archive info
+} archivePushLocal;
+
+/**********************************************************************************************************************************/
+String *
+archivePushServerFile(const String *walFile)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walFile);
+    FUNCTION_LOG_END();
+
+    ASSERT(walFile != NULL);
+
+    String *result = NULL;
+
+    // Test for stop file since the server may have been running when the stanza was stopped
+    lockStopTest();
+
+    // Load archive info if it is not cached
+    if (archivePushLocal.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("ArchivePushLocal")
+            {
+                archivePushLocal.archiveInfo = archivePushCheck(cfgOptionTest(cfgOptPgPath));
+
+                // Only cache the archive info once the check has succeeded. The context is freed automatically on error.
+                archivePushLocal.memContext = MEM_CONTEXT_NEW();
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    TRY_BEGIN()
+    {
+        result = archivePushFile(
+            walFile, archivePushLocal.archiveInfo.pgVersion, archivePushLocal.archiveInfo.pgSystemId, strBase(walFile),
+            compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel),
+            cfgOptionUInt64(cfgOptArchivePushBufferMax), archivePushLocal.archiveInfo.repoData, true);
+    }
+    // Reload archive info and WAL listings on the next request in case the error was caused by a change, e.g. stanza-upgrade
+    CATCH_ANY()
+    {
+        memContextFree(archivePushLocal.memContext);
+        archivePushLocal = (struct ArchivePushLocal){0};
+        walSegmentCacheClear();
+
+        RETHROW();
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
+
 /**********************************************************************************************************************************/
 void
 cmdArchivePush(void)
@@ -290,7 +358,8 @@ cmdArchivePush(void)
         String *walFile = walPath(strLstGet(commandParam, 0), cfgOptionStrNull(cfgOptPgPath), STR(cfgCommandName(cfgCommand())));
         String *archiveFile = strBase(walFile);
 
-        if (cfgOptionBool(cfgOptArchiveAsync))
+        // The archive server takes precedence over async mode
+        if (cfgOptionBool(cfgOptArchiveAsync) && !cfgOptionBool(cfgOptArchiveServer))
         {
             bool pushed = false;                                        // Has the WAL segment been pushed yet?
             bool forked = false;                                        // Has the async process been forked yet?
@@ -373,20 +442,42 @@ cmdArchivePush(void)
             // Else push the file
             else
             {
-                // Check archive info for each repo
-                ArchivePushCheckResult archiveInfo = archivePushCheck(cfgOptionTest(cfgOptPgPath));
+                // Push the file using the archive server when enabled
+                ArchiveServerResult serverResult = {0};
+
+                if (cfgOptionBool(cfgOptArchiveServer))
+                {
+                    ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_PUSH_SERVER_STR);
+                    protocolCommandParamAdd(command, VARSTR(walFile));
+
+                    serverResult = archiveServerExecute(archiveModePush, command);
+                }
 
-                // Push the file to the archive
-                String *warning = archivePushFile(
-                    walFile, archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
-                    compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel), archiveInfo.repoData);
+                const String *warning = NULL;
+
+                if (serverResult.executed)
+                    warning = varStr(serverResult.output);
+                // Else push the file directly
+                else
+                {
+                    // Check archive info for each repo
+                    ArchivePushCheckResult archiveInfo = archivePushCheck(cfgOptionTest(cfgOptPgPath));
+
+                    // Push the file to the archive
+                    warning = archivePushFile(
+                        walFile, archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
+                        compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel),
+                        cfgOptionUInt64(cfgOptArchivePushBufferMax), archiveInfo.repoData, false);
+                }
 
                 // If a warning was returned then log it
                 if (warning != NULL)
                     LOG_WARN(strZ(warning));
 
                 // Log success
-                LOG_INFO_FMT("pushed WAL file '%s' to the archive", strZ(archiveFile));
+                LOG_INFO_FMT(
+                    "pushed WAL file '%s' to the archive%s", strZ(archiveFile),
+                    serverResult.executed ? " using the archive server" : "");
             }
         }
     }
@@ -395,14 +486,23 @@ cmdArchivePush(void)
     FUNCTION_LOG_RETURN_VOID();
 }
 
-/**********************************************************************************************************************************/
+/***********************************************************************************************************************************
+Async push data. By default WAL is pushed directly to every repo and the status file is written once all repos have the WAL.
+
+When archive-push-repo-queue is enabled WAL is pushed directly to the first repo only and the status file is written as soon as that
+push completes, so only the first repo can delay or fail archive_command. For each other repo the WAL is written to a spool queue,
+compressed and encrypted for the repo, and the queued files are pushed by a separate local process. A slow or failing repo falls
+behind in its queue without holding up the first repo and the state of each queue is written to repo<N>.lag in the spool out path.
+***********************************************************************************************************************************/
 typedef struct ArchivePushAsyncData
 {
     const String *walPath;                                          // Path to pg_wal/pg_xlog
-    const StringList *walFileList;                                  // List of wal files to process
+    StringList *walFileList;                                        // List of wal files to process
     unsigned int walFileIdx;                                        // Current index in the list to be processed
     CompressType compressType;                                      // Type of compression for WAL segments
     int compressLevel;                                              // Compression level for wal files
+    uint64_t bufferMax;                                             // Max size of WAL files read into memory
+    bool repoQueue;                                                 // Queue WAL for repos after the first?
     ArchivePushCheckResult archiveInfo;                             // Archive info
 } ArchivePushAsyncData;
 
@@ -432,13 +532,15 @@ archivePushAsyncCallback(void *data, unsigned int clientIdx)
         protocolCommandParamAdd(command, VARSTR(walFile));
         protocolCommandParamAdd(command, VARUINT(jobData->compressType));
         protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+        protocolCommandParamAdd(command, VARUINT64(jobData->bufferMax));
 
-        // Add data for each repo to push to
+        // Add data for each repo to push to. Repos after the first are queued when enabled.
         for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
         {
             protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.repoData[repoIdx].archiveId));
             protocolCommandParamAdd(command, VARUINT(jobData->archiveInfo.repoData[repoIdx].cipherType));
             protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.repoData[repoIdx].cipherPass));
+            protocolCommandParamAdd(command, VARBOOL(jobData->repoQueue && repoIdx > 0));
         }
 
         FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(walFile), command));
@@ -447,6 +549,201 @@ archivePushAsyncCallback(void *data, unsigned int clientIdx)
     FUNCTION_TEST_RETURN(NULL);
 }
 
+/***********************************************************************************************************************************
+Async queue data. Queued files are pushed by a single local process so at most one queued file is being pushed at any time. Repos
+are pushed round-robin so a slow repo does not stop the others from making progress. A repo that fails is skipped until more WAL
+has been queued.
+***********************************************************************************************************************************/
+// How often to check for new WAL while a queued file is being pushed
+#define ARCHIVE_PUSH_QUEUE_POLL                                     100
+
+typedef struct ArchivePushAsyncQueueRepo
+{
+    bool skip;                                                      // Skip until more WAL is queued, e.g. after an error
+    int errorCode;                                                  // Error code of the last push or 0 if it succeeded
+    String *errorMessage;                                           // Error message of the last push
+} ArchivePushAsyncQueueRepo;
+
+typedef struct ArchivePushAsyncQueueData
+{
+    const ArchivePushCheckResult *archiveInfo;                      // Archive info
+    unsigned int repoTotal;                                         // Total repos including the first repo which is not queued
+    unsigned int repoIdx;                                           // Repo of the last queued file pushed
+    ProtocolParallelJob *job;                                       // Last job returned by the callback
+    ArchivePushAsyncQueueRepo *repo;                                // State of each queued repo
+    bool stop;                                                      // Stop pushing queued files, e.g. after a WAL error
+} ArchivePushAsyncQueueData;
+
+// Get the files queued for a repo in the order they were queued. Files still being written to the queue are excluded.
+static StringList *
+archivePushAsyncQueueList(unsigned int repoIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, repoIdx);
+    FUNCTION_TEST_END();
+
+    StringList *result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StringList *queueList = strLstSort(
+            storageListP(
+                storageSpool(), strNewFmt(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo%u", cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx))),
+            sortOrderAsc);
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            for (unsigned int queueIdx = 0; queueIdx < strLstSize(queueList); queueIdx++)
+            {
+                if (!strEndsWithZ(strLstGet(queueList, queueIdx), "." STORAGE_FILE_TEMP_EXT))
+                    strLstAdd(result, strLstGet(queueList, queueIdx));
+            }
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Get the next queued file to push and the repo it should be pushed to. NULL is returned when there is nothing to push.
+static String *
+archivePushAsyncQueueNext(const ArchivePushAsyncQueueData *queueData, unsigned int *repoIdxNext)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, queueData);
+        FUNCTION_TEST_PARAM_P(UINT, repoIdxNext);
+    FUNCTION_TEST_END();
+
+    ASSERT(queueData != NULL);
+    ASSERT(repoIdxNext != NULL);
+
+    String *result = NULL;
+
+    if (!queueData->stop)
+    {
+        // Start with the repo after the repo of the last file pushed
+        for (unsigned int repoOffset = 1; repoOffset < queueData->repoTotal; repoOffset++)
+        {
+            const unsigned int repoIdx = (queueData->repoIdx - 1 + repoOffset) % (queueData->repoTotal - 1) + 1;
+
+            if (queueData->repo[repoIdx].skip)
+                continue;
+
+            StringList *queueList = archivePushAsyncQueueList(repoIdx);
+
+            if (strLstSize(queueList) > 0)
+            {
+                result = strDup(strLstGet(queueList, 0));
+                *repoIdxNext = repoIdx;
+
+                strLstFree(queueList);
+                break;
+            }
+
+            strLstFree(queueList);
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+static ProtocolParallelJob *
+archivePushAsyncQueueCallback(void *data, unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    // There is only one client
+    (void)clientIdx;
+
+    ArchivePushAsyncQueueData *queueData = data;
+
+    // The last job is complete but its result has not been processed yet, so skip the repo now if the job failed. Otherwise the
+    // same file would be pushed again before the error is seen.
+    if (queueData->job != NULL && protocolParallelJobErrorCode(queueData->job) != 0)
+        queueData->repo[queueData->repoIdx].skip = true;
+
+    queueData->job = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        unsigned int repoIdx = 0;
+        const String *queueFile = archivePushAsyncQueueNext(queueData, &repoIdx);
+
+        if (queueFile != NULL)
+        {
+            queueData->repoIdx = repoIdx;
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_PUSH_QUEUE_STR);
+                protocolCommandParamAdd(command, VARSTR(queueFile));
+                protocolCommandParamAdd(command, VARUINT(repoIdx));
+                protocolCommandParamAdd(command, VARSTR(queueData->archiveInfo->repoData[repoIdx].archiveId));
+                protocolCommandParamAdd(command, VARUINT(queueData->archiveInfo->repoData[repoIdx].cipherType));
+
+                // The key identifies both the repo and the queued file
+                VariantList *key = varLstNew();
+                varLstAdd(key, varNewUInt(repoIdx));
+                varLstAdd(key, varNewStr(queueFile));
+
+                queueData->job = protocolParallelJobNew(varNewVarLst(key), command);
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(queueData->job);
+}
+
+/***********************************************************************************************************************************
+Write the lag status file for a queued repo. The file contains the number of files in the queue, how many seconds the oldest file
+has been queued, and the error from the last push if it failed, so monitoring can see when a repo is falling behind.
+***********************************************************************************************************************************/
+static void
+archivePushAsyncLagWrite(unsigned int repoIdx, const ArchivePushAsyncQueueRepo *repo)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM_P(VOID, repo);
+    FUNCTION_LOG_END();
+
+    ASSERT(repo != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const unsigned int repoKey = cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx);
+        const StringList *queueList = archivePushAsyncQueueList(repoIdx);
+        time_t queueAge = 0;
+
+        if (strLstSize(queueList) > 0)
+        {
+            const StorageInfo info = storageInfoP(
+                storageSpool(), strNewFmt(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo%u/%s", repoKey, strZ(strLstGet(queueList, 0))),
+                .ignoreMissing = true);
+
+            if (info.exists && time(NULL) > info.timeModified)
+                queueAge = time(NULL) - info.timeModified;
+        }
+
+        String *status = strNewFmt("%u\n%" PRId64, strLstSize(queueList), (int64_t)queueAge);
+
+        if (repo->errorCode != 0)
+            strCatFmt(status, "\n%d\n%s", repo->errorCode, strZ(repo->errorMessage));
+
+        storagePutP(
+            storageNewWriteP(storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_OUT "/repo%u" STATUS_EXT_LAG, repoKey)),
+            BUFSTR(status));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 void
 cmdArchivePushAsync(void)
 {
@@ -470,6 +767,8 @@ cmdArchivePushAsync(void)
             .walPath = strLstGet(commandParam, 0),
             .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .bufferMax = cfgOptionUInt64(cfgOptArchivePushBufferMax),
+            .repoQueue = cfgOptionBool(cfgOptArchivePushRepoQueue),
         };
 
         TRY_BEGIN()
@@ -484,38 +783,73 @@ cmdArchivePushAsync(void)
             if (strLstSize(jobData.walFileList) == 0)
                 THROW(AssertError, "no WAL files to process");
 
-            LOG_INFO_FMT(
-                "push %u WAL file(s) to archive: %s%s", strLstSize(jobData.walFileList), strZ(strLstGet(jobData.walFileList, 0)),
-                strLstSize(jobData.walFileList) == 1 ?
-                    "" : strZ(strNewFmt("...%s", strZ(strLstGet(jobData.walFileList, strLstSize(jobData.walFileList) - 1)))));
+            // WAL files that have a status, from this run or a prior run, are not pushed again when checking for new WAL
+            StringList *walFileDone = strLstMergeAnti(archivePushReadyList(jobData.walPath), jobData.walFileList);
 
-            // Drop files if queue max has been exceeded
-            if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData.walPath, jobData.walFileList))
+            // Initialize queue state for repos after the first
+            ArchivePushAsyncQueueData queueData =
             {
-                for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData.walFileList); walFileIdx++)
-                {
-                    const String *walFile = strLstGet(jobData.walFileList, walFileIdx);
-                    const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
+                .archiveInfo = &jobData.archiveInfo,
+                .repoTotal = cfgOptionGroupIdxTotal(cfgOptGrpRepo),
+                .repoIdx = cfgOptionGroupIdxTotal(cfgOptGrpRepo) - 1,
+                .repo = memNew(cfgOptionGroupIdxTotal(cfgOptGrpRepo) * sizeof(ArchivePushAsyncQueueRepo)),
+            };
 
-                    archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
-                    LOG_WARN(strZ(warning));
-                }
-            }
-            // Else continue processing
-            else
+            for (unsigned int repoIdx = 0; repoIdx < queueData.repoTotal; repoIdx++)
+                queueData.repo[repoIdx] = (ArchivePushAsyncQueueRepo){0};
+
+            ProtocolParallel *parallelExec = NULL;                  // Push WAL to the first repo and the queue
+            ProtocolParallel *queueExec = NULL;                     // Push queued files to the other repos
+
+            do
             {
-                // Check archive info for each repo
-                jobData.archiveInfo = archivePushCheck(true);
+                // Start pushing WAL files that are ready
+                if (parallelExec == NULL && strLstSize(jobData.walFileList) > 0)
+                {
+                    LOG_INFO_FMT(
+                        "push %u WAL file(s) to archive: %s%s", strLstSize(jobData.walFileList),
+                        strZ(strLstGet(jobData.walFileList, 0)),
+                        strLstSize(jobData.walFileList) == 1 ?
+                            "" :
+                            strZ(strNewFmt("...%s", strZ(strLstGet(jobData.walFileList, strLstSize(jobData.walFileList) - 1)))));
+
+                    // Drop files if queue max has been exceeded
+                    if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData.walPath, jobData.walFileList))
+                    {
+                        for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData.walFileList); walFileIdx++)
+                        {
+                            const String *walFile = strLstGet(jobData.walFileList, walFileIdx);
+                            const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
+
+                            archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
+                            LOG_WARN(strZ(warning));
+                        }
+                    }
+                    // Else continue processing
+                    else
+                    {
+                        // Check archive info for each repo
+                        if (jobData.archiveInfo.repoData == NULL)
+                            jobData.archiveInfo = archivePushCheck(true);
 
-                // Create the parallel executor
-                ProtocolParallel *parallelExec = protocolParallelNew(
-                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, archivePushAsyncCallback, &jobData);
+                        // Create the parallel executor
+                        jobData.walFileIdx = 0;
 
-                for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
-                    protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
+                        parallelExec = protocolParallelNew(
+                            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, archivePushAsyncCallback, &jobData);
 
-                // Process jobs
-                do
+                        for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+                            protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
+                    }
+
+                    for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData.walFileList); walFileIdx++)
+                        strLstAdd(walFileDone, strLstGet(jobData.walFileList, walFileIdx));
+
+                    strLstSort(walFileDone, sortOrderAsc);
+                }
+
+                // Push WAL files. Queued files are not pushed until these are done so another repo never delays new WAL.
+                if (parallelExec != NULL)
                 {
                     unsigned int completed = protocolParallelProcess(parallelExec);
 
@@ -531,9 +865,10 @@ cmdArchivePushAsync(void)
                         // The job was successful
                         if (protocolParallelJobErrorCode(job) == 0)
                         {
-                            // If there was a warning then output it to the log
+                            // Get any warnings returned
                             const String *warning = varStr(protocolParallelJobResult(job));
 
+                            // Output file warnings
                             if (warning != NULL)
                                 LOG_WARN_PID(processId, strZ(warning));
 
@@ -553,13 +888,143 @@ cmdArchivePushAsync(void)
 
                             archiveAsyncStatusErrorWrite(
                                 archiveModePush, walFile, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
+
+                            // Exit once running jobs are done so the next async process retries the failed WAL
+                            queueData.stop = true;
                         }
 
                         protocolParallelJobFree(job);
                     }
+
+                    if (protocolParallelDone(parallelExec))
+                    {
+                        protocolParallelFree(parallelExec);
+                        parallelExec = NULL;
+
+                        // Retry repos that were skipped now that more WAL has been queued and update the lag for each repo
+                        if (jobData.repoQueue)
+                        {
+                            for (unsigned int repoIdx = 1; repoIdx < queueData.repoTotal; repoIdx++)
+                            {
+                                queueData.repo[repoIdx].skip = false;
+                                archivePushAsyncLagWrite(repoIdx, &queueData.repo[repoIdx]);
+                            }
+                        }
+                    }
+                }
+                // Else push queued files
+                else if (queueExec != NULL)
+                {
+                    unsigned int completed = protocolParallelProcess(queueExec);
+
+                    for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                    {
+                        protocolKeepAlive();
+
+                        MEM_CONTEXT_TEMP_BEGIN()
+                        {
+                            // Get the job and decode the repo and wal file from the job key
+                            ProtocolParallelJob *job = protocolParallelResult(queueExec);
+                            unsigned int processId = cfgOptionUInt(cfgOptProcessMax) + 1;
+                            const VariantList *key = varVarLst(protocolParallelJobKey(job));
+                            const unsigned int repoIdx = varUInt(varLstGet(key, 0));
+                            const String *walFile = strLstGet(strLstNewSplitZ(varStr(varLstGet(key, 1)), "-"), 0);
+                            ArchivePushAsyncQueueRepo *repo = &queueData.repo[repoIdx];
+
+                            strFree(repo->errorMessage);
+                            repo->errorMessage = NULL;
+
+                            // The job was successful
+                            if (protocolParallelJobErrorCode(job) == 0)
+                            {
+                                const String *warning = varStr(protocolParallelJobResult(job));
+
+                                if (warning != NULL)
+                                    LOG_WARN_PID(processId, strZ(warning));
+
+                                LOG_DETAIL_PID_FMT(
+                                    processId, "pushed queued WAL file '%s' to the repo%u archive", strZ(walFile),
+                                    cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx));
+
+                                repo->errorCode = 0;
+                            }
+                            // Else skip the repo until more WAL is queued and record the error in the lag file
+                            else
+                            {
+                                LOG_WARN_PID_FMT(
+                                    processId,
+                                    "could not push queued WAL file '%s' to the repo%u archive (will be retried): [%d] %s",
+                                    strZ(walFile), cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx),
+                                    protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
+
+                                repo->skip = true;
+                                repo->errorCode = protocolParallelJobErrorCode(job);
+
+                                MEM_CONTEXT_PRIOR_BEGIN()
+                                {
+                                    repo->errorMessage = strDup(protocolParallelJobErrorMessage(job));
+                                }
+                                MEM_CONTEXT_PRIOR_END();
+                            }
+
+                            archivePushAsyncLagWrite(repoIdx, repo);
+                        }
+                        MEM_CONTEXT_TEMP_END();
+                    }
+
+                    if (protocolParallelDone(queueExec))
+                    {
+                        protocolParallelFree(queueExec);
+                        queueExec = NULL;
+                    }
+                }
+
+                // Check for new WAL when no WAL is being pushed
+                if (parallelExec == NULL)
+                {
+                    strLstFree(jobData.walFileList);
+                    jobData.walFileList = strLstNew();
+
+                    if (!queueData.stop)
+                    {
+                        lockStopTest();
+
+                        MEM_CONTEXT_TEMP_BEGIN()
+                        {
+                            // Only WAL that is still ready needs to be remembered as done
+                            StringList *readyList = archivePushReadyList(jobData.walPath);
+                            StringList *walFileList = strLstMergeAnti(readyList, walFileDone);
+
+                            strLstFree(walFileDone);
+                            walFileDone = strLstMove(strLstMergeAnti(readyList, walFileList), memContextPrior());
+                            strLstFree(jobData.walFileList);
+                            jobData.walFileList = strLstMove(walFileList, memContextPrior());
+
+                            // Start pushing queued files if there are any, including files queued before the repo queue was
+                            // disabled. The process after process-max is used so queued files never share a process with WAL.
+                            unsigned int repoIdx = 0;
+
+                            if (queueExec == NULL && queueData.repoTotal > 1 && jobData.archiveInfo.repoData != NULL &&
+                                archivePushAsyncQueueNext(&queueData, &repoIdx) != NULL)
+                            {
+                                queueData.job = NULL;
+
+                                MEM_CONTEXT_PRIOR_BEGIN()
+                                {
+                                    queueExec = protocolParallelNew(
+                                        ARCHIVE_PUSH_QUEUE_POLL, archivePushAsyncQueueCallback, &queueData);
+                                    protocolParallelClientAdd(
+                                        queueExec,
+                                        protocolLocalGet(protocolStorageTypeRepo, 0, cfgOptionUInt(cfgOptProcessMax) + 1));
+                                }
+                                MEM_CONTEXT_PRIOR_END();
+                            }
+                        }
+                        MEM_CONTEXT_TEMP_END();
+                    }
                 }
-                while (!protocolParallelDone(parallelExec));
             }
+            while (parallelExec != NULL || queueExec != NULL || strLstSize(jobData.walFileList) > 0);
         }
         // On any global error write a single error file to cover all unprocessed files
         CATCH_ANY()
@@ -4,6 +4,8 @@ Archive Push Command
 #ifndef COMMAND_ARCHIVE_PUSH_PUSH_H
 #define COMMAND_ARCHIVE_PUSH_PUSH_H
 
+#include "common/type/string.h"
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -13,4 +15,7 @@ void cmdArchivePush(void);
 // Async version of archive push that runs in parallel for performance
 void cmdArchivePushAsync(void);
 
+// Push a WAL segment for the archive server. Archive info is loaded on the first call and reused until there is an error.
+String *archivePushServerFile(const String *walFile);
+
 #endif
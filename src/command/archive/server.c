@@ -0,0 +1,322 @@
+/***********************************************************************************************************************************
+Archive Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "command/archive/get/protocol.h"
+#include "command/archive/push/protocol.h"
+#include "command/archive/server.h"
+#include "command/control/common.h"
+#include "common/debug.h"
+#include "common/io/fd.h"
+#include "common/io/fdRead.h"
+#include "common/io/fdWrite.h"
+#include "common/lock.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "config/config.h"
+#include "config/exec.h"
+#include "protocol/client.h"
+#include "protocol/server.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+#define PROTOCOL_SERVICE_ARCHIVE_SERVER                             "archive-server"
+    STRING_STATIC(PROTOCOL_SERVICE_ARCHIVE_SERVER_STR,              PROTOCOL_SERVICE_ARCHIVE_SERVER);
+
+/***********************************************************************************************************************************
+Get the socket path and address for the server. There is a separate server for archive-push and archive-get since they are
+configured independently.
+***********************************************************************************************************************************/
+static String *
+archiveServerSocketPath(ArchiveMode archiveMode)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, archiveMode);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(
+        strNewFmt(
+            "%s/%s-%s.sock", strZ(cfgOptionStr(cfgOptLockPath)), strZ(cfgOptionStr(cfgOptStanza)),
+            archiveMode == archiveModeGet ? CFGCMD_ARCHIVE_GET : CFGCMD_ARCHIVE_PUSH));
+}
+
+static struct sockaddr_un
+archiveServerAddress(const String *socketPath)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, socketPath);
+    FUNCTION_TEST_END();
+
+    ASSERT(socketPath != NULL);
+
+    struct sockaddr_un result = {.sun_family = AF_UNIX};
+
+    if (strSize(socketPath) >= sizeof(result.sun_path))
+    {
+        THROW_FMT(
+            OptionInvalidValueError, "archive server socket '%s' is longer than %zu characters\n"
+                "HINT: use a shorter path for the '" CFGOPT_LOCK_PATH "' option.",
+            strZ(socketPath), sizeof(result.sun_path) - 1);
+    }
+
+    memcpy(result.sun_path, strZ(socketPath), strSize(socketPath));
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Create a socket that will be closed when the current mem context is freed. Since child contexts are freed before the callback runs
+the protocol client/server will be freed while the socket is still open.
+***********************************************************************************************************************************/
+static void
+archiveServerSocketClose(void *fd)
+{
+    close(*(int *)fd);
+}
+
+static int
+archiveServerSocketNew(void)
+{
+    FUNCTION_TEST_VOID();
+
+    int *result = memNew(sizeof(int));
+
+    *result = socket(AF_UNIX, SOCK_STREAM, 0);
+    THROW_ON_SYS_ERROR(*result == -1, HostConnectError, "unable to create socket");
+
+    memContextCallbackSet(memContextCurrent(), archiveServerSocketClose, result);
+
+    FUNCTION_TEST_RETURN(*result);
+}
+
+/***********************************************************************************************************************************
+Connect to the server. Returns false if the server is not running.
+***********************************************************************************************************************************/
+static bool
+archiveServerConnect(int fd, const struct sockaddr_un *address)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, fd);
+        FUNCTION_TEST_PARAM_P(VOID, address);
+    FUNCTION_TEST_END();
+
+    ASSERT(address != NULL);
+
+    FUNCTION_TEST_RETURN(connect(fd, (const struct sockaddr *)address, sizeof(*address)) == 0);
+}
+
+/**********************************************************************************************************************************/
+ArchiveServerResult
+archiveServerExecute(ArchiveMode archiveMode, const ProtocolCommand *command)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, archiveMode);
+        FUNCTION_LOG_PARAM(PROTOCOL_COMMAND, command);
+    FUNCTION_LOG_END();
+
+    ASSERT(command != NULL);
+
+    ArchiveServerResult result = {0};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *socketPath = archiveServerSocketPath(archiveMode);
+        const struct sockaddr_un address = archiveServerAddress(socketPath);
+        int fd = archiveServerSocketNew();
+
+        // If the server is running then send the command
+        if (archiveServerConnect(fd, &address))
+        {
+            IoRead *read = ioFdReadNew(socketPath, fd, cfgOptionUInt64(cfgOptProtocolTimeout));
+            ioReadOpen(read);
+            IoWrite *write = ioFdWriteNew(socketPath, fd, cfgOptionUInt64(cfgOptProtocolTimeout));
+            ioWriteOpen(write);
+
+            ProtocolClient *client = protocolClientNew(
+                PROTOCOL_SERVICE_ARCHIVE_SERVER_STR, PROTOCOL_SERVICE_ARCHIVE_SERVER_STR, read, write);
+            const Variant *output = protocolClientExecute(client, command, true);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result.executed = true;
+                result.output = varDup(output);
+            }
+            MEM_CONTEXT_PRIOR_END();
+
+            // Free the client explicitly so the exit command is sent before read/write are freed
+            protocolClientFree(client);
+        }
+        // Else start the server in the background so it is available for the next request. Use the archive lock to prevent more
+        // than one server from being started at a time.
+        else if (
+            lockAcquire(
+                cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgOptionStr(cfgOptExecId), cfgLockType(), 0, false))
+        {
+            // The server should not output on the console at all
+            KeyValue *optionReplace = kvNew();
+
+            kvPut(optionReplace, VARSTR(CFGOPT_LOG_LEVEL_CONSOLE_STR), VARSTRDEF("off"));
+            kvPut(optionReplace, VARSTR(CFGOPT_LOG_LEVEL_STDERR_STR), VARSTRDEF("off"));
+
+            // Generate command options. The server runs in the async role with no parameters.
+            StringList *commandExec = cfgExecParam(cfgCommand(), cfgCmdRoleAsync, optionReplace, true, false);
+            strLstInsert(commandExec, 0, cfgExe());
+
+            // Release the lock so the server can acquire it
+            lockRelease(true);
+
+            // Execute the server
+            archiveAsyncExec(archiveMode, commandExec);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_STRUCT(result);
+}
+
+/***********************************************************************************************************************************
+Process requests from a single client until it exits
+***********************************************************************************************************************************/
+static void
+archiveServerSession(ArchiveMode archiveMode, const String *socketPath, int fd)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, archiveMode);
+        FUNCTION_LOG_PARAM(STRING, socketPath);
+        FUNCTION_LOG_PARAM(INT, fd);
+    FUNCTION_LOG_END();
+
+    TRY_BEGIN()
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            IoRead *read = ioFdReadNew(socketPath, fd, cfgOptionUInt64(cfgOptProtocolTimeout));
+            ioReadOpen(read);
+            IoWrite *write = ioFdWriteNew(socketPath, fd, cfgOptionUInt64(cfgOptProtocolTimeout));
+            ioWriteOpen(write);
+
+            ProtocolServer *server = protocolServerNew(
+                PROTOCOL_SERVICE_ARCHIVE_SERVER_STR, PROTOCOL_SERVICE_ARCHIVE_SERVER_STR, read, write);
+            protocolServerHandlerAdd(server, archiveMode == archiveModeGet ? archiveGetProtocol : archivePushProtocol);
+            protocolServerProcess(server, NULL);
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+    // A client that goes away without exiting should not stop the server
+    CATCH_ANY()
+    {
+        LOG_WARN_FMT("archive server client terminated unexpectedly: [%d] %s", errorCode(), errorMessage());
+    }
+    FINALLY()
+    {
+        close(fd);
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+cmdArchiveServer(ArchiveMode archiveMode, uint64_t connectionMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, archiveMode);
+        FUNCTION_LOG_PARAM(UINT64, connectionMax);
+    FUNCTION_LOG_END();
+
+    ASSERT(cfgOptionBool(cfgOptArchiveServer));
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *socketPath = archiveServerSocketPath(archiveMode);
+        const struct sockaddr_un address = archiveServerAddress(socketPath);
+        bool running = false;
+
+        // Check if another server is already running
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            running = archiveServerConnect(archiveServerSocketNew(), &address);
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        if (running)
+            LOG_INFO_FMT("archive server is already running on '%s'", strZ(socketPath));
+        else
+        {
+            MEM_CONTEXT_NEW_BEGIN("ArchiveServer")
+            {
+                int fd = archiveServerSocketNew();
+
+                // Remove the socket left behind by a server that did not exit cleanly
+                storageRemoveP(storageLocalWrite(), socketPath);
+
+                THROW_ON_SYS_ERROR_FMT(
+                    bind(fd, (const struct sockaddr *)&address, sizeof(address)) == -1, HostConnectError,
+                    "unable to bind socket '%s'", strZ(socketPath));
+
+                TRY_BEGIN()
+                {
+                    // Only the owner may send requests to the server
+                    THROW_ON_SYS_ERROR_FMT(
+                        chmod(strZ(socketPath), 0600) == -1, FileModeError, "unable to set mode for socket '%s'", strZ(socketPath));
+
+                    THROW_ON_SYS_ERROR_FMT(
+                        listen(fd, SOMAXCONN) == -1, HostConnectError, "unable to listen on socket '%s'", strZ(socketPath));
+
+                    // The lock was only needed to make sure a single server binds the socket. Holding it any longer would block
+                    // other commands that need the archive lock, e.g. stanza-upgrade.
+                    lockRelease(false);
+
+                    LOG_INFO_FMT("archive server listening on '%s'", strZ(socketPath));
+
+                    // Process connections. Exit when idle for half the protocol timeout since remotes held by the server would time
+                    // out anyway.
+                    uint64_t connectionTotal = 0;
+
+                    do
+                    {
+                        if (!fdReadyRead(fd, cfgOptionUInt64(cfgOptProtocolTimeout) / 2))
+                        {
+                            LOG_INFO("archive server exiting because it is idle");
+                            break;
+                        }
+
+                        int fdSession = accept(fd, NULL, NULL);
+                        THROW_ON_SYS_ERROR_FMT(
+                            fdSession == -1, HostConnectError, "unable to accept connection on socket '%s'", strZ(socketPath));
+
+                        archiveServerSession(archiveMode, socketPath, fdSession);
+                        connectionTotal++;
+
+                        // Exit when the stanza is stopped
+                        if (storageExistsP(storageLocal(), lockStopFileName(cfgOptionStr(cfgOptStanza))))
+                        {
+                            LOG_INFO("archive server exiting because the stanza is stopped");
+                            break;
+                        }
+                    }
+                    while (connectionTotal < connectionMax);
+                }
+                FINALLY()
+                {
+                    storageRemoveP(storageLocalWrite(), socketPath);
+                }
+                TRY_END();
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
@@ -0,0 +1,37 @@
+/***********************************************************************************************************************************
+Archive Server
+
+The archive server is a long-lived process for each stanza that archive-push/archive-get send requests to over a unix socket.
+Configuration, archive info, and repository connections are loaded once by the server and reused for each request rather than by a
+new process for every WAL segment.
+***********************************************************************************************************************************/
+#ifndef COMMAND_ARCHIVE_SERVER_H
+#define COMMAND_ARCHIVE_SERVER_H
+
+#include <stdint.h>
+
+#include "command/archive/common.h"
+#include "common/type/variant.h"
+#include "protocol/command.h"
+
+/***********************************************************************************************************************************
+Result of a command sent to the archive server
+***********************************************************************************************************************************/
+typedef struct ArchiveServerResult
+{
+    bool executed;                                                  // Was the command executed by the server?
+    const Variant *output;                                          // Command output
+} ArchiveServerResult;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Execute a command on the archive server. If the server is not running then it is started in the background and the command is
+// not executed so the caller must process the request itself.
+ArchiveServerResult archiveServerExecute(ArchiveMode archiveMode, const ProtocolCommand *command);
+
+// Run the archive server until it is idle for half of protocol-timeout, the stanza is stopped, or connectionMax connections have
+// been processed
+void cmdArchiveServer(ArchiveMode archiveMode, uint64_t connectionMax);
+
+#endif
@@ -35,6 +35,12 @@ Backup Command
 #include "storage/helper.h"
 #include "version.h"
 
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+// Time to sleep between checks for the backup to start once all files have been pre-copied
+#define BACKUP_PRECOPY_WAIT_SLEEP                                   100
+
 /**********************************************************************************************************************************
 Generate a unique backup label that does not contain a timestamp from a previous backup
 ***********************************************************************************************************************************/
@@ -478,17 +484,20 @@ backupBuildIncrPrior(const InfoBackup *infoBackup)
 }
 
 static bool
-backupBuildIncr(const InfoBackup *infoBackup, Manifest *manifest, Manifest *manifestPrior, const String *archiveStart)
+backupBuildIncr(
+    const InfoBackup *infoBackup, Manifest *manifest, Manifest *manifestPrior, const String *archiveStart, List **dedupList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(INFO_BACKUP, infoBackup);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM(MANIFEST, manifestPrior);
         FUNCTION_LOG_PARAM(STRING, archiveStart);
+        FUNCTION_LOG_PARAM_P(LIST, dedupList);
     FUNCTION_LOG_END();
 
     ASSERT(infoBackup != NULL);
     ASSERT(manifest != NULL);
+    ASSERT(dedupList != NULL);
 
     bool result = false;
 
@@ -506,6 +515,10 @@ backupBuildIncr(const InfoBackup *infoBackup, Manifest *manifest, Manifest *mani
             // Set the cipher subpass from prior manifest since we want a single subpass for the entire backup set
             manifestCipherSubPassSet(manifest, manifestCipherSubPass(manifestPrior));
 
+            // Find files that may be referenced from the prior backup even though they have a different name
+            if (cfgOptionBool(cfgOptBackupDedup))
+                *dedupList = lstMove(manifestBuildDedup(manifest, manifestPrior), memContextPrior());
+
             // Incremental was built
             result = true;
         }
@@ -628,7 +641,7 @@ void backupResumeCallback(void *data, const StorageInfo *info)
             else
             {
                 manifestFileUpdate(
-                    resumeData->manifest, manifestName, file->size, fileResume->sizeRepo, fileResume->checksumSha1, NULL,
+                    resumeData->manifest, manifestName, file->size, fileResume->sizeRepo, fileResume->checksumSha1, NULL, NULL,
                     fileResume->checksumPage, fileResume->checksumPageError, fileResume->checksumPageErrorList);
             }
 
@@ -667,11 +680,12 @@ void backupResumeCallback(void *data, const StorageInfo *info)
 
 // Helper to find a resumable backup
 static const Manifest *
-backupResumeFind(const Manifest *manifest, const String *cipherPassBackup)
+backupResumeFind(const Manifest *manifest, const String *cipherPassBackup, bool precopy)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+        FUNCTION_LOG_PARAM(BOOL, precopy);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
@@ -705,8 +719,9 @@ backupResumeFind(const Manifest *manifest, const String *cipherPassBackup)
                     reason = STRDEF("resume is disabled");
 
                     // Attempt to read the manifest file in the resumable backup to see if it can be used. If any error at all
-                    // occurs then the backup will be considered unusable and a resume will not be attempted.
-                    if (cfgOptionBool(cfgOptResume))
+                    // occurs then the backup will be considered unusable and a resume will not be attempted. Files pre-copied by
+                    // this backup are always resumed.
+                    if (cfgOptionBool(cfgOptResume) || precopy)
                     {
                         reason = strNewFmt("unable to read %s" INFO_COPY_EXT, strZ(manifestFile));
 
@@ -782,11 +797,12 @@ backupResumeFind(const Manifest *manifest, const String *cipherPassBackup)
 }
 
 static bool
-backupResume(Manifest *manifest, const String *cipherPassBackup)
+backupResume(Manifest *manifest, const String *cipherPassBackup, bool precopy)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+        FUNCTION_LOG_PARAM(BOOL, precopy);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
@@ -795,7 +811,7 @@ backupResume(Manifest *manifest, const String *cipherPassBackup)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        const Manifest *manifestResume = backupResumeFind(manifest, cipherPassBackup);
+        const Manifest *manifestResume = backupResumeFind(manifest, cipherPassBackup, precopy);
 
         // If a resumable backup was found set the label and cipher subpass
         if (manifestResume)
@@ -806,9 +822,19 @@ backupResume(Manifest *manifest, const String *cipherPassBackup)
             // Set the backup label to the resumed backup
             manifestBackupLabelSet(manifest, manifestData(manifestResume)->backupLabel);
 
-            LOG_WARN_FMT(
-                "resumable backup %s of same type exists -- remove invalid files and resume",
-                strZ(manifestData(manifest)->backupLabel));
+            // Files copied while waiting for the backup to start are expected so there is no need to warn
+            if (precopy)
+            {
+                LOG_INFO_FMT(
+                    "check files pre-copied to backup %s -- remove changed files and resume",
+                    strZ(manifestData(manifest)->backupLabel));
+            }
+            else
+            {
+                LOG_WARN_FMT(
+                    "resumable backup %s of same type exists -- remove invalid files and resume",
+                    strZ(manifestData(manifest)->backupLabel));
+            }
 
             // If resuming a full backup then copy cipher subpass since it was used to encrypt the resumable files
             if (manifestData(manifest)->backupType == backupTypeFull)
@@ -843,14 +869,117 @@ typedef struct BackupStartResult
     VariantList *tablespaceList;
 } BackupStartResult;
 
+// State of an online backup while waiting for the backup to start and for replay on the standby to catch up
+typedef struct BackupStartWait
+{
+    BackupData *backupData;                                         // Backup data
+    MemContext *memContext;                                         // Context for the result
+    BackupStartResult result;                                       // Backup start result
+    bool started;                                                   // Has the backup started on the primary?
+} BackupStartWait;
+
+// Get the backup start result and begin waiting for replay on the standby
+static void
+backupStartWaitStarted(BackupStartWait *wait)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, wait);
+    FUNCTION_LOG_END();
+
+    ASSERT(wait != NULL);
+    ASSERT(!wait->started);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        DbBackupStartResult dbBackupStartResult = dbBackupStartEnd(wait->backupData->dbPrimary);
+
+        MEM_CONTEXT_BEGIN(wait->memContext)
+        {
+            wait->result.lsn = strDup(dbBackupStartResult.lsn);
+            wait->result.walSegmentName = strDup(dbBackupStartResult.walSegmentName);
+            wait->result.dbList = dbList(wait->backupData->dbPrimary);
+            wait->result.tablespaceList = dbTablespaceList(wait->backupData->dbPrimary);
+        }
+        MEM_CONTEXT_END();
+
+        LOG_INFO_FMT("backup start archive = %s, lsn = %s", strZ(wait->result.walSegmentName), strZ(wait->result.lsn));
+
+        // Begin waiting for replay on the standby to catch up
+        if (cfgOptionBool(cfgOptBackupStandby))
+        {
+            LOG_INFO_FMT("wait for replay on the standby to reach %s", strZ(wait->result.lsn));
+            dbReplayWaitBegin(wait->backupData->dbStandby, wait->result.lsn, cfgOptionUInt64(cfgOptArchiveTimeout));
+        }
+
+        wait->started = true;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Check if the backup has started and replay on the standby has caught up without blocking
+static bool
+backupStartWaitReady(BackupStartWait *wait)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, wait);
+    FUNCTION_LOG_END();
+
+    ASSERT(wait != NULL);
+
+    bool result = false;
+
+    if (!wait->started && dbBackupStartReady(wait->backupData->dbPrimary))
+        backupStartWaitStarted(wait);
+
+    if (wait->started)
+        result = !cfgOptionBool(cfgOptBackupStandby) || dbReplayWaitReady(wait->backupData->dbStandby);
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+// Wait for the backup to start and for replay on the standby to catch up
+static void
+backupStartWaitEnd(BackupStartWait *wait)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, wait);
+    FUNCTION_LOG_END();
+
+    ASSERT(wait != NULL);
+
+    if (!wait->started)
+        backupStartWaitStarted(wait);
+
+    if (cfgOptionBool(cfgOptBackupStandby))
+    {
+        dbReplayWaitEnd(wait->backupData->dbStandby);
+        LOG_INFO_FMT("replay on the standby reached %s", strZ(wait->result.lsn));
+
+        // The standby db object won't be used anymore so free it
+        dbFree(wait->backupData->dbStandby);
+
+        // The standby protocol connection won't be used anymore so free it
+        protocolRemoteFree(wait->backupData->pgIdxStandby);
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Copy files while waiting for the backup to start. Defined with the backup processing functions that it shares.
+static void backupPrecopy(BackupData *backupData, Manifest *manifest, const String *cipherPassBackup, BackupStartWait *wait);
+
 static BackupStartResult
-backupStart(BackupData *backupData)
+backupStart(BackupData *backupData, Manifest *manifestPrecopy, const String *cipherPassBackup)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
+        FUNCTION_LOG_PARAM(MANIFEST, manifestPrecopy);
+        FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
     FUNCTION_LOG_END();
 
-    BackupStartResult result = {.lsn = NULL};
+    BackupStartWait wait = {.backupData = backupData, .memContext = memContextCurrent()};
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
@@ -888,38 +1017,18 @@ backupStart(BackupData *backupData)
                 backupData->version >= PG_VERSION_96 ? "non-" : "",
                 cfgOptionBool(cfgOptStartFast) ? "requested immediate" : "next regular");
 
-            DbBackupStartResult dbBackupStartResult = dbBackupStart(
-                backupData->dbPrimary, cfgOptionBool(cfgOptStartFast), cfgOptionBool(cfgOptStopAuto));
-
-            MEM_CONTEXT_PRIOR_BEGIN()
-            {
-                result.lsn = strDup(dbBackupStartResult.lsn);
-                result.walSegmentName = strDup(dbBackupStartResult.walSegmentName);
-                result.dbList = dbList(backupData->dbPrimary);
-                result.tablespaceList = dbTablespaceList(backupData->dbPrimary);
-            }
-            MEM_CONTEXT_PRIOR_END();
-
-            LOG_INFO_FMT("backup start archive = %s, lsn = %s", strZ(result.walSegmentName), strZ(result.lsn));
+            dbBackupStartBegin(backupData->dbPrimary, cfgOptionBool(cfgOptStartFast), cfgOptionBool(cfgOptStopAuto));
 
-            // Wait for replay on the standby to catch up
-            if (cfgOptionBool(cfgOptBackupStandby))
-            {
-                LOG_INFO_FMT("wait for replay on the standby to reach %s", strZ(result.lsn));
-                dbReplayWait(backupData->dbStandby, result.lsn, cfgOptionUInt64(cfgOptArchiveTimeout));
-                LOG_INFO_FMT("replay on the standby reached %s", strZ(result.lsn));
-
-                // The standby db object won't be used anymore so free it
-                dbFree(backupData->dbStandby);
+            // Copy files that are not expected to change while waiting for the checkpoint and replay on the standby
+            if (manifestPrecopy != NULL)
+                backupPrecopy(backupData, manifestPrecopy, cipherPassBackup, &wait);
 
-                // The standby protocol connection won't be used anymore so free it
-                protocolRemoteFree(backupData->pgIdxStandby);
-            }
+            backupStartWaitEnd(&wait);
         }
     }
     MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_LOG_RETURN_STRUCT(result);
+    FUNCTION_LOG_RETURN_STRUCT(wait.result);
 }
 
 /***********************************************************************************************************************************
@@ -1061,11 +1170,12 @@ Log the results of a job and throw errors
 ***********************************************************************************************************************************/
 static uint64_t
 backupJobResult(
-    Manifest *manifest, const String *host, const String *const fileName, StringList *fileRemove, ProtocolParallelJob *const job,
-    const uint64_t sizeTotal, uint64_t sizeCopied)
+    Manifest *manifest, const List *dedupList, const String *host, const String *const fileName, StringList *fileRemove,
+    ProtocolParallelJob *const job, const uint64_t sizeTotal, uint64_t sizeCopied)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_LOG_PARAM(LIST, dedupList);
         FUNCTION_LOG_PARAM(STRING, host);
         FUNCTION_LOG_PARAM(STRING, fileName);
         FUNCTION_LOG_PARAM(STRING_LIST, fileRemove);
@@ -1107,11 +1217,29 @@ backupJobResult(
             const String *const logChecksum = copySize != 0 ? strNewFmt(" checksum %s", strZ(copyChecksum)) : EMPTY_STR;
 
             // If the file is in a prior backup and nothing changed, just log it
-            if (copyResult == backupCopyResultNoOp)
+            if (copyResult == backupCopyResultNoOp && file->reference != NULL)
             {
                 LOG_DETAIL_PID_FMT(
                     processId, "match file from prior backup %s (%s)%s", strZ(fileLog), strZ(logProgress), strZ(logChecksum));
             }
+            // Else if the file matched a file with a different name in a prior backup then reference the prior file
+            else if (copyResult == backupCopyResultNoOp)
+            {
+                const ManifestFileDedup *const fileDedup = lstFind(dedupList, &file->name);
+                ASSERT(fileDedup != NULL);
+
+                // The checksum returned identifies the prior file that matched
+                const ManifestFileDedupPrior *const prior = lstFind(fileDedup->priorList, strZ(copyChecksum));
+                ASSERT(prior != NULL);
+
+                LOG_DETAIL_PID_FMT(
+                    processId, "match file from prior backup %s to %s (%s)%s", strZ(fileLog), strZ(prior->referenceName),
+                    strZ(logProgress), strZ(logChecksum));
+
+                manifestFileUpdate(
+                    manifest, file->name, copySize, prior->sizeRepo, prior->checksumSha1, VARSTR(prior->reference),
+                    prior->referenceName, prior->checksumPage, prior->checksumPageError, prior->checksumPageErrorList);
+            }
             // Else if the repo matched the expect checksum, just log it
             else if (copyResult == backupCopyResultChecksum)
             {
@@ -1217,7 +1345,7 @@ backupJobResult(
 
                 // Update file info and remove any reference to the file's existence in a prior backup
                 manifestFileUpdate(
-                    manifest, file->name, copySize, repoSize, strZ(copyChecksum), VARSTR(NULL), file->checksumPage,
+                    manifest, file->name, copySize, repoSize, strZ(copyChecksum), VARSTR(NULL), NULL, file->checksumPage,
                     checksumPageError, checksumPageErrorList);
             }
         }
@@ -1440,11 +1568,14 @@ typedef struct BackupJobData
 {
     const String *const backupLabel;                                // Backup label (defines the backup path)
     const bool backupStandby;                                       // Backup from standby
+    const CipherType cipherType;                                    // Cipher type
     const String *const cipherSubPass;                              // Passphrase used to encrypt files in the backup
     const CompressType compressType;                                // Backup compression type
     const int compressLevel;                                        // Compress level if backup is compressed
+    const size_t compressFrameSize;                                 // Compress frame size (0 if frames are not used)
     const bool delta;                                               // Is this a checksum delta backup?
     const uint64_t lsnStart;                                        // Starting lsn for the backup
+    const List *const dedupList;                                    // Files that may match a prior file with a different name
 
     List *queueList;                                                // List of processing queues
 } BackupJobData;
@@ -1480,6 +1611,13 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
             {
                 const ManifestFile *file = *(ManifestFile **)lstGet(queue, 0);
 
+                // If the file may match a prior file with a different name then check the content of the pg file against the
+                // prior file as if it were a delta backup. Files being resumed already have a copy in the repo and are not checked.
+                const ManifestFileDedup *fileDedup = NULL;
+
+                if (jobData->dedupList != NULL && file->reference == NULL && file->checksumSha1[0] == 0)
+                    fileDedup = lstFind(jobData->dedupList, &file->name);
+
                 // Create backup job
                 ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_BACKUP_FILE_STR);
 
@@ -1488,15 +1626,35 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
                     command, VARBOOL(!strEq(file->name, STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL))));
                 protocolCommandParamAdd(command, VARUINT64(file->size));
                 protocolCommandParamAdd(command, VARBOOL(!file->primary));
+
                 protocolCommandParamAdd(command, file->checksumSha1[0] != 0 ? VARSTRZ(file->checksumSha1) : NULL);
+
+                if (fileDedup != NULL)
+                {
+                    VariantList *checksumDedup = varLstNew();
+
+                    for (unsigned int priorIdx = 0; priorIdx < lstSize(fileDedup->priorList); priorIdx++)
+                    {
+                        varLstAdd(
+                            checksumDedup,
+                            varNewStrZ(((const ManifestFileDedupPrior *)lstGet(fileDedup->priorList, priorIdx))->checksumSha1));
+                    }
+
+                    protocolCommandParamAdd(command, varNewVarLst(checksumDedup));
+                }
+                else
+                    protocolCommandParamAdd(command, NULL);
+
                 protocolCommandParamAdd(command, VARBOOL(file->checksumPage));
                 protocolCommandParamAdd(command, VARUINT64(jobData->lsnStart));
                 protocolCommandParamAdd(command, VARSTR(file->name));
-                protocolCommandParamAdd(command, VARBOOL(file->reference != NULL));
+                protocolCommandParamAdd(command, VARBOOL(file->reference != NULL || fileDedup != NULL));
                 protocolCommandParamAdd(command, VARUINT(jobData->compressType));
                 protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+                protocolCommandParamAdd(command, VARUINT64(jobData->compressFrameSize));
                 protocolCommandParamAdd(command, VARSTR(jobData->backupLabel));
-                protocolCommandParamAdd(command, VARBOOL(jobData->delta));
+                protocolCommandParamAdd(command, VARBOOL(jobData->delta || fileDedup != NULL));
+                protocolCommandParamAdd(command, VARUINT(jobData->cipherType));
                 protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
 
                 // Remove job from the queue
@@ -1521,11 +1679,13 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
 }
 
 static void
-backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart, const String *cipherPassBackup)
+backupProcess(
+    BackupData *backupData, Manifest *manifest, const List *dedupList, const String *lsnStart, const String *cipherPassBackup)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_LOG_PARAM(LIST, dedupList);
         FUNCTION_LOG_PARAM(STRING, lsnStart);
         FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
     FUNCTION_LOG_END();
@@ -1587,9 +1747,12 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
             .backupStandby = backupStandby,
             .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .compressFrameSize = (size_t)cfgOptionUInt64(cfgOptCompressFrameSize),
+            .cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType)),
             .cipherSubPass = manifestCipherSubPass(manifest),
             .delta = cfgOptionBool(cfgOptDelta),
             .lsnStart = cfgOptionBool(cfgOptOnline) ? pgLsnFromStr(lsnStart) : 0xFFFFFFFFFFFFFFFF,
+            .dedupList = dedupList,
         };
 
         uint64_t sizeTotal = backupProcessQueue(manifest, &jobData.queueList);
@@ -1633,7 +1796,7 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
                     ProtocolParallelJob *job = protocolParallelResult(parallelExec);
 
                     sizeCopied = backupJobResult(
-                        manifest,
+                        manifest, dedupList,
                         backupStandby && protocolParallelJobProcessId(job) > 1 ? backupData->hostStandby : backupData->hostPrimary,
                         storagePathP(
                             protocolParallelJobProcessId(job) > 1 ? storagePgIdx(pgIdx) : backupData->storagePrimary,
@@ -1689,7 +1852,9 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
                         storageRepo(), strNewFmt("%s/%s%s", strZ(backupPathExp), strZ(file->name), compressExt));
                     const String *const linkDestination =  storagePathP(
                         storageRepo(),
-                        strNewFmt(STORAGE_REPO_BACKUP "/%s/%s%s", strZ(file->reference), strZ(file->name), compressExt));
+                        strNewFmt(
+                            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(file->reference),
+                            strZ(file->referenceName != NULL ? file->referenceName : file->name), compressExt));
 
                     THROW_ON_SYS_ERROR_FMT(
                         link(strZ(linkDestination), strZ(linkName)) == -1, FileOpenError,
@@ -1721,6 +1886,219 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Copy files while waiting for the backup to start
+
+A spread checkpoint can take a long time to complete and no files can be copied until it does, so files that are not expected to
+change are copied in the meantime. Only files that have not been modified since the pre-copy manifest was built are copied. When the
+backup starts the pre-copied files are checked against the backup manifest in the same way as a resumed backup so any file that was
+modified in the meantime is removed and copied again.
+
+When backing up from a standby, pre-copy continues until replay on the standby has reached the backup start lsn since no files can
+be copied from the standby until then. Files are still pre-copied from the primary because a file on the standby might be missing
+changes that have not been replayed yet even if the file looks unchanged.
+***********************************************************************************************************************************/
+// Build the manifest used to pre-copy files. NULL is returned when pre-copy is not enabled.
+static Manifest *
+backupPrecopyBuild(
+    BackupData *backupData, const InfoPgData *infoPg, const Manifest *manifestPrior, time_t timestampStart,
+    const String *cipherPassBackup)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
+        FUNCTION_LOG_PARAM_P(INFO_PG_DATA, infoPg);
+        FUNCTION_LOG_PARAM(MANIFEST, manifestPrior);
+        FUNCTION_LOG_PARAM(TIME, timestampStart);
+        FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+    FUNCTION_LOG_END();
+
+    ASSERT(backupData != NULL);
+    ASSERT(infoPg != NULL);
+
+    Manifest *result = NULL;
+
+    // Pre-copy is only useful when waiting for a checkpoint
+    if (cfgOptionBool(cfgOptOnline) && cfgOptionBool(cfgOptBackupPrecopy))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Build the manifest. This must be done before the backup start is requested since no other commands can be sent to
+            // the primary while waiting.
+            result = manifestNewBuild(
+                backupData->storagePrimary, infoPg->version, infoPg->catalogVersion, true, cfgOptionBool(cfgOptChecksumPage),
+                strLstNewVarLst(cfgOptionLst(cfgOptExclude)), dbTablespaceList(backupData->dbPrimary));
+
+            // Validate the manifest using the copy start time. Files modified after this time will not be pre-copied.
+            manifestBuildValidate(
+                result, cfgOptionBool(cfgOptDelta), backupTime(backupData, true),
+                compressTypeEnum(cfgOptionStr(cfgOptCompressType)));
+
+            // Reference files in the prior backup since they will not be copied. The cipher subpass must match the backup.
+            if (manifestPrior != NULL)
+            {
+                manifestBuildIncr(result, manifestPrior, backupType(cfgOptionStr(cfgOptType)), NULL);
+                manifestCipherSubPassSet(result, manifestCipherSubPass(manifestPrior));
+            }
+            else
+                manifestCipherSubPassSet(result, cipherPassGen(cipherType(cfgOptionStr(cfgOptRepoCipherType))));
+
+            // Resume a backup when possible so files that have already been copied are not pre-copied
+            if (!backupResume(result, cipherPassBackup, false))
+            {
+                manifestBackupLabelSet(
+                    result,
+                    backupLabelCreate(
+                        backupType(cfgOptionStr(cfgOptType)), manifestData(result)->backupLabelPrior, timestampStart));
+            }
+
+            manifestMove(result, memContextPrior());
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN(MANIFEST, result);
+}
+
+static void
+backupPrecopy(BackupData *backupData, Manifest *manifest, const String *cipherPassBackup, BackupStartWait *wait)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
+        FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+        FUNCTION_LOG_PARAM_P(VOID, wait);
+    FUNCTION_LOG_END();
+
+    ASSERT(backupData != NULL);
+    ASSERT(manifest != NULL);
+    ASSERT(wait != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Queue files that have not been modified since the copy start time. Files that are referenced, were resumed, or are empty
+        // do not need to be copied and pg_control must always be copied after the backup starts.
+        const time_t copyStart = manifestData(manifest)->backupTimestampCopyStart;
+        List *queue = lstNewP(sizeof(ManifestFile *), .comparator = backupProcessQueueComparator);
+        uint64_t sizeTotal = 0;
+
+        for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(manifest); fileIdx++)
+        {
+            const ManifestFile *const file = manifestFile(manifest, fileIdx);
+
+            if (file->reference != NULL || file->checksumSha1[0] != '\0' || file->size == 0 || file->timestamp >= copyStart ||
+                strEq(file->name, STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL)))
+            {
+                continue;
+            }
+
+            lstAdd(queue, &file);
+            sizeTotal += file->size;
+        }
+
+        if (lstSize(queue) > 0)
+        {
+            LOG_INFO_FMT(
+                "pre-copy up to %u file(s) (%s) while waiting for the backup to start", lstSize(queue),
+                strZ(strSizeFormat(sizeTotal)));
+
+            // Copy the largest files first
+            lstSort(queue, sortOrderDesc);
+
+            BackupJobData jobData =
+            {
+                .backupLabel = manifestData(manifest)->backupLabel,
+                .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
+                .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+                .compressFrameSize = (size_t)cfgOptionUInt64(cfgOptCompressFrameSize),
+                .cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType)),
+                .cipherSubPass = manifestCipherSubPass(manifest),
+                .delta = cfgOptionBool(cfgOptDelta),
+                .lsnStart = 0xFFFFFFFFFFFFFFFF,                     // All pages are expected to be valid since they did not change
+                .queueList = lstNewP(sizeof(List *)),
+            };
+
+            lstAdd(jobData.queueList, &queue);
+
+            // Create the parallel executor. All files are copied from the primary since the standby may not have replayed the
+            // latest changes to the files.
+            ProtocolParallel *parallelExec = protocolParallelNew(
+                cfgOptionUInt64(cfgOptProtocolTimeout) / 2, backupJobCallback, &jobData);
+
+            for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+            {
+                protocolParallelClientAdd(
+                    parallelExec, protocolLocalGet(protocolStorageTypePg, backupData->pgIdxPrimary, processIdx));
+            }
+
+            // Files removed during pre-copy do not need to be tracked since they will not be in the backup manifest
+            StringList *fileRemove = strLstNew();
+            uint64_t sizeCopied = 0;
+            bool ready = false;
+
+            MEM_CONTEXT_TEMP_RESET_BEGIN()
+            {
+                do
+                {
+                    // Stop queueing files once the backup has started and replay on the standby has caught up. Files that are
+                    // being copied are allowed to complete.
+                    if (!ready && backupStartWaitReady(wait))
+                    {
+                        LOG_DETAIL(
+                            cfgOptionBool(cfgOptBackupStandby) ?
+                                "backup started and standby replay caught up, stop pre-copy" : "backup started, stop pre-copy");
+
+                        lstClear(queue);
+                        ready = true;
+                    }
+
+                    unsigned int completed = protocolParallelProcess(parallelExec);
+
+                    for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                    {
+                        ProtocolParallelJob *job = protocolParallelResult(parallelExec);
+
+                        sizeCopied = backupJobResult(
+                            manifest, NULL, backupData->hostPrimary,
+                            storagePathP(
+                                backupData->storagePrimary,
+                                manifestPathPg(manifestFileFind(manifest, varStr(protocolParallelJobKey(job)))->name)),
+                            fileRemove, job, sizeTotal, sizeCopied);
+                    }
+
+                    // A keep-alive is required here for the remotes and locals that are idle while the checkpoint completes.
+                    // Remotes running the backup start or replay query are skipped.
+                    protocolKeepAlive();
+
+                    // Reset the memory context occasionally so we don't use too much memory or slow down processing
+                    MEM_CONTEXT_TEMP_RESET(1000);
+                }
+                while (!protocolParallelDone(parallelExec));
+
+                // Continue sending keep-alives when all files have been pre-copied before the backup has started since a spread
+                // checkpoint can take longer than the protocol timeout
+                while (!ready)
+                {
+                    sleepMSec(BACKUP_PRECOPY_WAIT_SLEEP);
+
+                    ready = backupStartWaitReady(wait);
+
+                    if (!ready)
+                        protocolKeepAlive();
+
+                    MEM_CONTEXT_TEMP_RESET(1000);
+                }
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+
+        // Save the manifest so the pre-copied files can be resumed after the backup starts
+        backupManifestSaveCopy(manifest, cipherPassBackup);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Check and copy WAL segments required to make the backup consistent
 ***********************************************************************************************************************************/
@@ -1769,9 +2147,9 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
             {
                 const String *walSegment = strLstGet(walSegmentList, walSegmentIdx);
 
-                // Find the actual wal segment file in the archive
-                const String *archiveFile = walSegmentFind(
-                    storageRepo(), archiveId, walSegment,  cfgOptionUInt64(cfgOptArchiveTimeout));
+                // Find the actual wal segment file in the archive using the WAL listing cache since segments are searched in order
+                const String *archiveFile = walSegmentCacheFind(
+                    cfgOptionGroupIdxDefault(cfgOptGrpRepo), archiveId, walSegment, cfgOptionUInt64(cfgOptArchiveTimeout));
 
                 if (cfgOptionBool(cfgOptArchiveCopy))
                 {
@@ -1953,8 +2331,11 @@ cmdBackup(void)
         // Check if there is a prior manifest when backup type is diff/incr
         Manifest *manifestPrior = backupBuildIncrPrior(infoBackup);
 
+        // Build a manifest for the files that can be copied while waiting for the backup to start
+        Manifest *manifestPrecopy = backupPrecopyBuild(backupData, &infoPg, manifestPrior, timestampStart, cipherPassBackup);
+
         // Start the backup
-        BackupStartResult backupStartResult = backupStart(backupData);
+        BackupStartResult backupStartResult = backupStart(backupData, manifestPrecopy, cipherPassBackup);
 
         // Build the manifest
         Manifest *manifest = manifestNewBuild(
@@ -1966,15 +2347,17 @@ cmdBackup(void)
             manifest, cfgOptionBool(cfgOptDelta), backupTime(backupData, true), compressTypeEnum(cfgOptionStr(cfgOptCompressType)));
 
         // Build an incremental backup if type is not full (manifestPrior will be freed in this call)
-        if (!backupBuildIncr(infoBackup, manifest, manifestPrior, backupStartResult.walSegmentName))
+        List *dedupList = NULL;
+
+        if (!backupBuildIncr(infoBackup, manifest, manifestPrior, backupStartResult.walSegmentName, &dedupList))
             manifestCipherSubPassSet(manifest, cipherPassGen(cipherType(cfgOptionStr(cfgOptRepoCipherType))));
 
         // Set delta if it is not already set and the manifest requires it
         if (!cfgOptionBool(cfgOptDelta) && varBool(manifestData(manifest)->backupOptionDelta))
             cfgOptionSet(cfgOptDelta, cfgSourceParam, BOOL_TRUE_VAR);
 
-        // Resume a backup when possible
-        if (!backupResume(manifest, cipherPassBackup))
+        // Resume a backup when possible. The pre-copied backup is always resumed.
+        if (!backupResume(manifest, cipherPassBackup, manifestPrecopy != NULL))
         {
             manifestBackupLabelSet(
                 manifest,
@@ -1985,7 +2368,7 @@ cmdBackup(void)
         backupManifestSaveCopy(manifest, cipherPassBackup);
 
         // Process the backup manifest
-        backupProcess(backupData, manifest, backupStartResult.lsn, cipherPassBackup);
+        backupProcess(backupData, manifest, dedupList, backupStartResult.lsn, cipherPassBackup);
 
         // Stop the backup
         BackupStopResult backupStopResult = backupStop(backupData, manifest);
@@ -37,9 +37,9 @@ segmentNumber(const String *pgFile)
 BackupFileResult
 backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
-    bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
-    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
-    const String *cipherPass)
+    const StringList *pgFileChecksumDedup, bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile,
+    bool repoFileHasReference, CompressType repoFileCompressType, int repoFileCompressLevel, size_t repoFileCompressFrameSize,
+    const String *backupLabel, bool delta, CipherType cipherType, const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, pgFile);                         // Database file to copy to the repo
@@ -47,12 +47,14 @@ backupFile(
         FUNCTION_LOG_PARAM(UINT64, pgFileSize);                     // Size of the database file
         FUNCTION_LOG_PARAM(BOOL, pgFileCopyExactSize);              // Copy only pgFileSize bytes even if the file has grown
         FUNCTION_LOG_PARAM(STRING, pgFileChecksum);                 // Checksum to verify the database file
+        FUNCTION_LOG_PARAM(STRING_LIST, pgFileChecksumDedup);       // Checksums of prior files the database file may match
         FUNCTION_LOG_PARAM(BOOL, pgFileChecksumPage);               // Should page checksums be validated
         FUNCTION_LOG_PARAM(UINT64, pgFileChecksumPageLsnLimit);     // Upper LSN limit to which page checksums must be valid
         FUNCTION_LOG_PARAM(STRING, repoFile);                       // Destination in the repo to copy the pg file
         FUNCTION_LOG_PARAM(BOOL, repoFileHasReference);             // Does the repo file exist in a prior backup in the set?
         FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);             // Compress type for repo file
         FUNCTION_LOG_PARAM(INT,  repoFileCompressLevel);            // Compression level for repo file
+        FUNCTION_LOG_PARAM(SIZE, repoFileCompressFrameSize);        // Compression frame size for repo file (0 for no frames)
         FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of current backup
         FUNCTION_LOG_PARAM(BOOL, delta);                            // Is the delta option on?
         FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
@@ -75,7 +77,7 @@ backupFile(
 
         // If checksum is defined then the file needs to be checked. If delta option then check the DB and possibly the repo, else
         // just check the repo.
-        if (pgFileChecksum != NULL)
+        if (pgFileChecksum != NULL || pgFileChecksumDedup != NULL)
         {
             // Does the file in pg match the checksum and size passed?
             bool pgFileMatch = false;
@@ -101,8 +103,11 @@ backupFile(
                         ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
                     uint64_t pgTestSize = varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR));
 
-                    // Does the pg file match?
-                    if (pgFileSize == pgTestSize && strEq(pgFileChecksum, pgTestChecksum))
+                    // Does the pg file match? When checking against prior files with different names the checksum returned
+                    // identifies the prior file that matched.
+                    if (pgFileSize == pgTestSize &&
+                        (strEq(pgFileChecksum, pgTestChecksum) ||
+                         (pgFileChecksumDedup != NULL && strLstExists(pgFileChecksumDedup, pgTestChecksum))))
                     {
                         pgFileMatch = true;
 
@@ -216,7 +221,8 @@ backupFile(
             if (repoFileCompressType != compressTypeNone)
             {
                 ioFilterGroupAdd(
-                    ioReadFilterGroup(storageReadIo(read)), compressFilter(repoFileCompressType, repoFileCompressLevel));
+                    ioReadFilterGroup(storageReadIo(read)),
+                    compressFilterFrame(repoFileCompressType, repoFileCompressLevel, repoFileCompressFrameSize));
             }
 
             // If there is a cipher then add the encrypt filter
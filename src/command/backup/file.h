@@ -7,6 +7,7 @@ Backup File
 #include "common/compress/helper.h"
 #include "common/crypto/common.h"
 #include "common/type/keyValue.h"
+#include "common/type/stringList.h"
 
 /***********************************************************************************************************************************
 Backup file types
@@ -35,8 +36,8 @@ typedef struct BackupFileResult
 
 BackupFileResult backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
-    bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
-    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
-    const String *cipherPass);
+    const StringList *pgFileChecksumDedup, bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile,
+    bool repoFileHasReference, CompressType repoFileCompressType, int repoFileCompressLevel, size_t repoFileCompressFrameSize,
+    const String *backupLabel, bool delta, CipherType cipherType, const String *cipherPass);
 
 #endif
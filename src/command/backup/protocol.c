@@ -39,11 +39,13 @@ backupProtocol(const String *command, const VariantList *paramList, ProtocolServ
             // Backup the file
             BackupFileResult result = backupFile(
                 varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)), varUInt64(varLstGet(paramList, 2)),
-                varBool(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)), varBool(varLstGet(paramList, 5)),
-                varUInt64(varLstGet(paramList, 6)), varStr(varLstGet(paramList, 7)), varBool(varLstGet(paramList, 8)),
-                (CompressType)varUIntForce(varLstGet(paramList, 9)), varIntForce(varLstGet(paramList, 10)),
-                varStr(varLstGet(paramList, 11)), varBool(varLstGet(paramList, 12)),
-                varStr(varLstGet(paramList, 13)) == NULL ? cipherTypeNone : cipherTypeAes256Cbc, varStr(varLstGet(paramList, 13)));
+                varBool(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)),
+                varLstGet(paramList, 5) != NULL ? strLstNewVarLst(varVarLst(varLstGet(paramList, 5))) : NULL,
+                varBool(varLstGet(paramList, 6)), varUInt64(varLstGet(paramList, 7)), varStr(varLstGet(paramList, 8)),
+                varBool(varLstGet(paramList, 9)), (CompressType)varUIntForce(varLstGet(paramList, 10)),
+                varIntForce(varLstGet(paramList, 11)), (size_t)varUInt64(varLstGet(paramList, 12)),
+                varStr(varLstGet(paramList, 13)), varBool(varLstGet(paramList, 14)),
+                (CipherType)varUIntForce(varLstGet(paramList, 15)), varStr(varLstGet(paramList, 16)));
 
             // Return backup result
             VariantList *resultList = varLstNew();
@@ -14,6 +14,7 @@ Common Command Routines
 #include "common/type/json.h"
 #include "config/config.intern.h"
 #include "config/parse.h"
+#include "storage/helper.h"
 #include "version.h"
 
 /***********************************************************************************************************************************
@@ -21,6 +22,8 @@ Track time command started
 ***********************************************************************************************************************************/
 static TimeMSec timeBegin;
 static String *cmdOptionStr;
+static String *cmdProfileFile;
+static String *cmdMetricFile;
 
 /**********************************************************************************************************************************/
 void
@@ -197,6 +200,55 @@ cmdBegin(void)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+cmdStatFileSet(const String *profileFile, const String *metricFile)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STRING, profileFile);
+        FUNCTION_LOG_PARAM(STRING, metricFile);
+    FUNCTION_LOG_END();
+
+    strFree(cmdProfileFile);
+    strFree(cmdMetricFile);
+
+    MEM_CONTEXT_BEGIN(memContextTop())
+    {
+        cmdProfileFile = strDup(profileFile);
+        cmdMetricFile = strDup(metricFile);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write stats to a file. An error here should not change the result of the command so only warn on failure.
+***********************************************************************************************************************************/
+static void
+cmdStatWrite(const String *file, const String *content)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STRING, file);
+        FUNCTION_LOG_PARAM(STRING, content);
+    FUNCTION_LOG_END();
+
+    ASSERT(file != NULL);
+    ASSERT(content != NULL);
+
+    TRY_BEGIN()
+    {
+        storagePutP(storageNewWriteP(storageLocalWrite(), file), BUFSTR(content));
+    }
+    CATCH_ANY()
+    {
+        LOG_WARN_FMT("unable to write stats: %s", errorMessage());
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 cmdEnd(int code, const String *errorMessage)
@@ -237,6 +289,37 @@ cmdEnd(int code, const String *errorMessage)
         MEM_CONTEXT_TEMP_END();
     }
 
+    // Write stats if enabled
+    if (cmdProfileFile != NULL || cmdMetricFile != NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Gauges for the command so alerts can be set on duration, result, and the time since the command last ran
+            statGaugeSet(STRDEF("command.duration.msec"), (int64_t)(timeMSec() - timeBegin));
+            statGaugeSet(STRDEF("command.end.sec"), (int64_t)time(NULL));
+            statGaugeSet(STRDEF("command.result"), code);
+
+            if (cmdProfileFile != NULL)
+                cmdStatWrite(cmdProfileFile, jsonFromKv(statToKv()));
+
+            if (cmdMetricFile != NULL)
+            {
+                // Label each metric with the stanza, command, and role so metrics from different commands do not conflict
+                String *label = strNew("");
+
+                if (cfgOptionValid(cfgOptStanza) && cfgOptionTest(cfgOptStanza))
+                    strCatFmt(label, "stanza=\"%s\",", strZ(cfgOptionStr(cfgOptStanza)));
+
+                strCatFmt(
+                    label, "command=\"%s\",role=\"%s\"", cfgCommandName(cfgCommand()),
+                    cfgCommandRole() == cfgCmdRoleDefault ? "default" : strZ(cfgCommandRoleStr(cfgCommandRole())));
+
+                cmdStatWrite(cmdMetricFile, statToPrometheus(label));
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
     // Reset timeBegin in case there is another command following this one
     timeBegin = timeMSec();
 
@@ -22,4 +22,8 @@ const String *cmdOption(void);
 // End the command
 void cmdEnd(int code, const String *errorMessage);
 
+// Set files where stats are written at command end. Stats are written to the profile file as JSON and to the metric file in the
+// Prometheus text format. Either file may be NULL.
+void cmdStatFileSet(const String *profileFile, const String *metricFile);
+
 #endif
@@ -275,6 +275,67 @@ static const unsigned char helpDataPack[] =
             0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
             0x2E,
 
+        // relation-restore command
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x09, 0x25, // Summary
+            0x52, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xB1, 0x08, // Description
+            0x52, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65,
+            0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x65, 0x74, 0x20,
+            0x69, 0x6E, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x20,
+            0x65, 0x2E, 0x67, 0x2E, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x20, 0x73, 0x69,
+            0x6E, 0x67, 0x6C, 0x65, 0x20, 0x64, 0x61, 0x6D, 0x61, 0x67, 0x65, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77,
+            0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6D,
+            0x65, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66,
+            0x69, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x64, 0x61, 0x74, 0x61,
+            0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x62, 0x61, 0x73,
+            0x65, 0x2F, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2F, 0x31, 0x36, 0x33, 0x38, 0x35, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61,
+            0x6C, 0x6C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+            0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64,
+            0x2E, 0x20, 0x41, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x6D, 0x61, 0x79, 0x20,
+            0x62, 0x65, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F,
+            0x72, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73,
+            0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x62, 0x61, 0x73, 0x65, 0x2F, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2F, 0x31, 0x36,
+            0x33, 0x38, 0x35, 0x3A, 0x31, 0x30, 0x30, 0x30, 0x2D, 0x31, 0x30, 0x31, 0x30, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x77, 0x68,
+            0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20,
+            0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20,
+            0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61,
+            0x6D, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+            0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x67, 0x6D,
+            0x65, 0x6E, 0x74, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x62, 0x61, 0x73, 0x65, 0x2F, 0x31, 0x36, 0x33, 0x38, 0x34,
+            0x2F, 0x31, 0x36, 0x33, 0x38, 0x35, 0x2E, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x2D, 0x31, 0x30, 0x30, 0x30, 0x2D, 0x31,
+            0x30, 0x31, 0x30, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6D, 0x69, 0x73, 0x74, 0x61,
+            0x6B, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
+            0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20,
+            0x65, 0x6E, 0x74, 0x69, 0x72, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66,
+            0x69, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x68, 0x65,
+            0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x72, 0x61,
+            0x6E, 0x67, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65,
+            0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x69, 0x65,
+            0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x2E, 0x0A, 0x0A,
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+            0x61, 0x69, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x73, 0x6F, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E,
+            0x63, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61,
+            0x74, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+            0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x6F,
+            0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65,
+            0x73, 0x73, 0x2D, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x69, 0x73, 0x20,
+            0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x2C, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+            0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+            0x69, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20,
+            0x6E, 0x6F, 0x74, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x2E,
+
         // repo-create command
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeBool << 4 | 0x08, // Internal
@@ -363,6 +424,53 @@ static const unsigned char helpDataPack[] =
             0x63, 0x65, 0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x74, 0x20, 0x6D, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62,
             0x65, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x65, 0x64, 0x2E,
 
+        // server command
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x09, 0x22, // Summary
+            0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63,
+            0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x54, 0x4C, 0x53, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xF9, 0x05, // Description
+            0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x20, 0x54,
+            0x4C, 0x53, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+            0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73,
+            0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x73, 0x65,
+            0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x73,
+            0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x76, 0x69, 0x61, 0x20, 0x53, 0x53, 0x48, 0x2E, 0x20, 0x43, 0x6C, 0x69, 0x65,
+            0x6E, 0x74, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x63,
+            0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6C, 0x73, 0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2D, 0x63, 0x61, 0x2D, 0x66,
+            0x69, 0x6C, 0x65, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68,
+            0x6F, 0x72, 0x69, 0x74, 0x79, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69,
+            0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x6E,
+            0x65, 0x77, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+            0x72, 0x76, 0x65, 0x72, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6F, 0x77, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A,
+            0x53, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+            0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20,
+            0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x65, 0x6C,
+            0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2C, 0x20, 0x73, 0x74, 0x61,
+            0x6E, 0x7A, 0x61, 0x2C, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F,
+            0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x75, 0x73, 0x65,
+            0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x63,
+            0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72,
+            0x76, 0x65, 0x72, 0x2E, 0x0A, 0x0A,
+            0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x77, 0x69,
+            0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x74, 0x6C,
+            0x73, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E,
+            0x20, 0x53, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F,
+            0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6C,
+            0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x65, 0x73, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x74, 0x68,
+            0x69, 0x73, 0x20, 0x61, 0x76, 0x6F, 0x69, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x48, 0x20, 0x63, 0x6F,
+            0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x75, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65,
+            0x61, 0x63, 0x68, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69,
+            0x73, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x72,
+            0x65, 0x71, 0x75, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64,
+            0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65,
+            0x74, 0x2E,
+
         // stanza-create command
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x09, 0x20, // Summary
@@ -644,6 +752,43 @@ static const unsigned char helpDataPack[] =
             0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x50, 0x6F,
             0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x3C, 0x20, 0x31, 0x32, 0x2E,
 
+        // archive-push-buffer-max option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x35, // Summary
+            0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x57, 0x41, 0x4C, 0x20,
+            0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x62, 0x79, 0x20,
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xFB, 0x03, // Description
+            0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72,
+            0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x6F, 0x6E, 0x63, 0x65,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x61, 0x6E,
+            0x64, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73,
+            0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+            0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x4C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73,
+            0x2C, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20,
+            0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+            0x74, 0x29, 0x2C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x6F,
+            0x20, 0x63, 0x61, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B,
+            0x73, 0x75, 0x6D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x70,
+            0x79, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x69, 0x65,
+            0x73, 0x2E, 0x0A, 0x0A,
+            0x45, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x68, 0x6F, 0x6C,
+            0x64, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x65,
+            0x6D, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x6F, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65,
+            0x20, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7A, 0x65,
+            0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D,
+            0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2E, 0x0A, 0x0A,
+            0x53, 0x69, 0x7A, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20,
+            0x69, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x20, 0x6F,
+            0x72, 0x20, 0x4B, 0x42, 0x2C, 0x20, 0x4D, 0x42, 0x2C, 0x20, 0x47, 0x42, 0x2C, 0x20, 0x54, 0x42, 0x2C, 0x20, 0x6F, 0x72,
+            0x20, 0x50, 0x42, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70,
+            0x6C, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x31,
+            0x30, 0x32, 0x34, 0x2E,
+
         // archive-push-queue-max option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -701,10 +846,123 @@ static const unsigned char helpDataPack[] =
                 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2D, 0x6D, 0x61, 0x78,
         0x00, // Deprecated names end
 
-        // archive-timeout option
+        // archive-push-repo-queue option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0A, 0x07, // Section
             0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x3A, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x61, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76,
+            0x65, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xB5, 0x08, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E,
+            0x6F, 0x75, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x72, 0x65, 0x70,
+            0x6F, 0x72, 0x74, 0x73, 0x20, 0x61, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61,
+            0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51,
+            0x4C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20,
+            0x62, 0x65, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+            0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x6C,
+            0x6F, 0x77, 0x20, 0x6F, 0x72, 0x20, 0x75, 0x6E, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x72, 0x65,
+            0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68,
+            0x69, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20,
+            0x57, 0x41, 0x4C, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x6E,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74,
+            0x2E, 0x0A, 0x0A,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x61, 0x20, 0x57, 0x41, 0x4C, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x73, 0x6F, 0x6F, 0x6E, 0x20, 0x61, 0x73, 0x20,
+            0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69,
+            0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F,
+            0x72, 0x79, 0x2E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x72,
+            0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64,
+            0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6C,
+            0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20,
+            0x74, 0x6F, 0x20, 0x61, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70,
+            0x6F, 0x6F, 0x6C, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64,
+            0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x6C,
+            0x61, 0x74, 0x65, 0x72, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x70,
+            0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+            0x66, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x61, 0x67, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6C, 0x64, 0x65, 0x73, 0x74, 0x20, 0x71, 0x75,
+            0x65, 0x75, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+            0x61, 0x73, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65,
+            0x6E, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x3C, 0x4E, 0x3E, 0x2E, 0x6C, 0x61, 0x67, 0x20, 0x69, 0x6E, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2F, 0x5B, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x5D,
+            0x2F, 0x6F, 0x75, 0x74, 0x20, 0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73, 0x6F, 0x20, 0x6C,
+            0x61, 0x67, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E,
+            0x0A, 0x0A,
+            0x57, 0x41, 0x52, 0x4E, 0x49, 0x4E, 0x47, 0x3A, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20,
+            0x6D, 0x61, 0x79, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72,
+            0x65, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64,
+            0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69,
+            0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x2E, 0x20, 0x55, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75,
+            0x65, 0x75, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x69,
+            0x65, 0x73, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6F,
+            0x6F, 0x6C, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73,
+            0x20, 0x6C, 0x6F, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x69, 0x73, 0x20, 0x6D, 0x69, 0x73,
+            0x73, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F,
+            0x73, 0x69, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x50, 0x49, 0x54, 0x52, 0x20, 0x66, 0x72,
+            0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+            0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x73, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70,
+            0x6F, 0x69, 0x6E, 0x74, 0x2E, 0x20, 0x50, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6F, 0x6F,
+            0x6C, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x64, 0x75, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x74,
+            0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x20,
+            0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+
+        // archive-server option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x38, // Summary
+            0x50, 0x75, 0x73, 0x68, 0x2F, 0x67, 0x65, 0x74, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74,
+            0x73, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74,
+            0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xC4, 0x05, // Description
+            0x53, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65,
+            0x73, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63,
+            0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68,
+            0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20,
+            0x6C, 0x6F, 0x61, 0x64, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x6F, 0x6E, 0x63,
+            0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F,
+            0x72, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20,
+            0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x2C, 0x20, 0x77, 0x68,
+            0x69, 0x63, 0x68, 0x20, 0x61, 0x76, 0x6F, 0x69, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x73, 0x74, 0x20,
+            0x6F, 0x66, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x72,
+            0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x57, 0x41, 0x4C, 0x20,
+            0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65,
+            0x64, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64,
+            0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61,
+            0x20, 0x75, 0x6E, 0x69, 0x78, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x6C, 0x6F, 0x63, 0x6B, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20,
+            0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72,
+            0x6F, 0x6E, 0x6F, 0x75, 0x73, 0x6C, 0x79, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+            0x72, 0x76, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x54,
+            0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x65, 0x78, 0x69, 0x74, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6E,
+            0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x69, 0x64, 0x6C, 0x65, 0x20, 0x66, 0x6F,
+            0x72, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2D, 0x74,
+            0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+            0x74, 0x61, 0x6E, 0x7A, 0x61, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x2E, 0x20, 0x52, 0x65,
+            0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x62, 0x79, 0x20,
+            0x73, 0x74, 0x6F, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E,
+            0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+            0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x70, 0x72,
+            0x65, 0x63, 0x65, 0x64, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76,
+            0x65, 0x2D, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x2E,
+
+        // archive-timeout option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
         pckTypeStr << 4 | 0x08, 0x10, // Summary
             0x41, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x2E,
         pckTypeStr << 4 | 0x08, 0xE9, 0x01, // Description
@@ -721,6 +979,92 @@ static const unsigned char helpDataPack[] =
             0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x74, 0x6F,
             0x20, 0x62, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x64, 0x2E,
 
+        // backup-dedup option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+        pckTypeStr << 4 | 0x08, 0x3F, // Summary
+            0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x68, 0x61, 0x74,
+            0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+            0x6E, 0x74, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xAC, 0x04, // Description
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+            0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75,
+            0x70, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72,
+            0x69, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+            0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x65, 0x2E, 0x67,
+            0x2E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x20,
+            0x62, 0x79, 0x20, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x44, 0x41, 0x54, 0x41, 0x42, 0x41, 0x53, 0x45, 0x2C, 0x20,
+            0x6F, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6E, 0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x65, 0x72, 0x20, 0x65, 0x78,
+            0x69, 0x73, 0x74, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+            0x20, 0x72, 0x65, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x62, 0x79, 0x20, 0x56, 0x41, 0x43, 0x55, 0x55, 0x4D,
+            0x20, 0x46, 0x55, 0x4C, 0x4C, 0x20, 0x6F, 0x72, 0x20, 0x43, 0x4C, 0x55, 0x53, 0x54, 0x45, 0x52, 0x2E, 0x20, 0x57, 0x68,
+            0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20,
+            0x61, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69,
+            0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65,
+            0x64, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64,
+            0x2E, 0x0A, 0x0A,
+            0x4E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68,
+            0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x20, 0x73, 0x69, 0x7A,
+            0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x63,
+            0x68, 0x65, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x61, 0x6E,
+            0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x69, 0x66,
+            0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64,
+            0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+            0x6D, 0x6F, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x6C,
+            0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x66, 0x74, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x70,
+            0x69, 0x65, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x77, 0x69, 0x74,
+            0x68, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x2E,
+
+        // backup-precopy option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+        pckTypeStr << 4 | 0x08, 0x31, // Summary
+            0x43, 0x6F, 0x70, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x69,
+            0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20,
+            0x74, 0x6F, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x9C, 0x05, // Description
+            0x57, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2D, 0x66, 0x61, 0x73, 0x74, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73,
+            0x74, 0x61, 0x72, 0x74, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20,
+            0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x63,
+            0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20,
+            0x74, 0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x6F, 0x6E, 0x20,
+            0x61, 0x20, 0x62, 0x75, 0x73, 0x79, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E,
+            0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74,
+            0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+            0x69, 0x65, 0x64, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+            0x20, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x20, 0x66, 0x72,
+            0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65,
+            0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65,
+            0x63, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x2E, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+            0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x64, 0x20,
+            0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20,
+            0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x2E, 0x0A,
+            0x0A,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x74, 0x61, 0x72,
+            0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x61, 0x79, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73,
+            0x75, 0x6D, 0x65, 0x64, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74,
+            0x68, 0x61, 0x74, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x61, 0x66,
+            0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x63, 0x6F,
+            0x70, 0x69, 0x65, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64,
+            0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E,
+            0x74, 0x2E, 0x0A, 0x0A,
+            0x57, 0x69, 0x74, 0x68, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2D, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x62, 0x79, 0x20,
+            0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x63, 0x6F,
+            0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E,
+            0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x73, 0x74, 0x61, 0x6E, 0x64, 0x62, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69,
+            0x6F, 0x6E, 0x2E,
+
         // backup-standby option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x06, // Section
@@ -804,6 +1148,31 @@ static const unsigned char helpDataPack[] =
             0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B,
             0x75, 0x70, 0x20, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74, 0x2E,
 
+        // cipher-compat option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x39, // Summary
+            0x44, 0x65, 0x63, 0x72, 0x79, 0x70, 0x74, 0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x63, 0x62, 0x63, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x67,
+            0x63, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xA3, 0x02, // Description
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x63, 0x62, 0x63, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74,
+            0x20, 0x61, 0x75, 0x74, 0x68, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x62,
+            0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72,
+            0x65, 0x6A, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74,
+            0x6F, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+            0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x67, 0x63, 0x6D, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+            0x65, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F,
+            0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x65, 0x64, 0x20, 0x69,
+            0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2E, 0x20,
+            0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+            0x6F, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E,
+            0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F,
+            0x72, 0x79, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61,
+            0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x67, 0x63, 0x6D, 0x2E,
+
         // cipher-pass option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeBool << 4 | 0x0A, // Internal
@@ -822,6 +1191,41 @@ static const unsigned char helpDataPack[] =
             0x65, 0x20, 0x73, 0x73, 0x68, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20,
             0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x50, 0x41, 0x54, 0x48, 0x2E,
 
+        // cmd-ssh-control-path option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x35, // Summary
+            0x50, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x53, 0x53, 0x48, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65,
+            0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74,
+            0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xED, 0x03, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x53, 0x53, 0x48, 0x20, 0x63, 0x6F,
+            0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+            0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x20,
+            0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x63, 0x6F, 0x6E,
+            0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4F, 0x70,
+            0x65, 0x6E, 0x53, 0x53, 0x48, 0x20, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x4D, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20,
+            0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20,
+            0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73,
+            0x20, 0x69, 0x74, 0x73, 0x20, 0x6F, 0x77, 0x6E, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63,
+            0x65, 0x73, 0x73, 0x20, 0x62, 0x75, 0x74, 0x20, 0x53, 0x53, 0x48, 0x20, 0x61, 0x75, 0x74, 0x68, 0x65, 0x6E, 0x74, 0x69,
+            0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x43, 0x50, 0x20, 0x63,
+            0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65,
+            0x73, 0x74, 0x61, 0x62, 0x6C, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x2C, 0x20, 0x77, 0x68, 0x69,
+            0x63, 0x68, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 0x20, 0x74,
+            0x69, 0x6D, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x53, 0x53, 0x48, 0x20, 0x43, 0x50, 0x55, 0x20, 0x75, 0x73, 0x61, 0x67,
+            0x65, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74,
+            0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x69, 0x73,
+            0x20, 0x68, 0x69, 0x67, 0x68, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6D, 0x75, 0x73, 0x74,
+            0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6F, 0x6E,
+            0x6C, 0x79, 0x20, 0x62, 0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x67, 0x42,
+            0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x53, 0x53, 0x48, 0x20, 0x63, 0x6C, 0x69,
+            0x65, 0x6E, 0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x25, 0x43, 0x20, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x20, 0x28, 0x4F, 0x70, 0x65, 0x6E, 0x53, 0x53, 0x48, 0x20, 0x36,
+            0x2E, 0x37, 0x20, 0x6F, 0x72, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x29, 0x2E,
+
         // compress option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -839,6 +1243,47 @@ static const unsigned char helpDataPack[] =
             0x65, 0x73, 0x73, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x75,
             0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x2E,
 
+        // compress-frame-size option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+        pckTypeStr << 4 | 0x08, 0x25, // Summary
+            0x43, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x6E,
+            0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xEE, 0x04, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+            0x73, 0x20, 0x6C, 0x7A, 0x34, 0x20, 0x6F, 0x72, 0x20, 0x7A, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x69,
+            0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x6E, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+            0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x70,
+            0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66,
+            0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69,
+            0x65, 0x64, 0x20, 0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x73, 0x69, 0x7A, 0x65,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20,
+            0x74, 0x6F, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6E,
+            0x64, 0x65, 0x78, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73,
+            0x6B, 0x69, 0x70, 0x70, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+            0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x6C, 0x7A, 0x34, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x7A, 0x73, 0x74, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D,
+            0x61, 0x6E, 0x64, 0x2D, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x6F, 0x6F, 0x6C, 0x73, 0x2E, 0x20, 0x46, 0x72, 0x61, 0x6D,
+            0x65, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x6F, 0x75, 0x74, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x72, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x63, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x77, 0x68, 0x61, 0x74, 0x20,
+            0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x61,
+            0x74, 0x69, 0x6F, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+            0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x6F,
+            0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2E, 0x0A, 0x0A,
+            0x53, 0x69, 0x7A, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20,
+            0x69, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x20, 0x6F,
+            0x72, 0x20, 0x4B, 0x42, 0x2C, 0x20, 0x4D, 0x42, 0x2C, 0x20, 0x47, 0x42, 0x2C, 0x20, 0x54, 0x42, 0x2C, 0x20, 0x6F, 0x72,
+            0x20, 0x50, 0x42, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70,
+            0x6C, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x31,
+            0x30, 0x32, 0x34, 0x2E,
+
         // compress-level option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -1187,7 +1632,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x07, // Command overrides begin
 
-            pckTypeObj << 4 | 0x09, 0x01, // Command repo-ls override begin
+            pckTypeObj << 4 | 0x0A, 0x01, // Command repo-ls override begin
                 pckTypeStr << 4 | 0x09, 0x28, // Summary
                     0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68,
                     0x20, 0x61, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
@@ -1249,7 +1694,7 @@ static const unsigned char helpDataPack[] =
                     0x2E,
             0x00, // Command backup override end
 
-            pckTypeObj << 4 | 0x09, 0x01, // Command restore override begin
+            pckTypeObj << 4 | 0x0A, 0x01, // Command restore override begin
                 pckTypeStr << 4 | 0x09, 0x10, // Summary
                     0x46, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x2E,
                 pckTypeStr << 4 | 0x08, 0xC4, 0x01, // Description
@@ -1266,7 +1711,7 @@ static const unsigned char helpDataPack[] =
                     0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x2E,
             0x00, // Command restore override end
 
-            pckTypeObj << 4, // Command stanza-create override begin
+            pckTypeObj << 4 | 0x01, // Command stanza-create override begin
                 pckTypeBool << 4 | 0x08, // Internal
             0x00, // Command stanza-create override end
 
@@ -1322,7 +1767,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x05, // Command overrides begin
 
-            pckTypeObj << 4 | 0x08, 0x01, // Command repo-get override begin
+            pckTypeObj << 4 | 0x09, 0x01, // Command repo-get override begin
                 pckTypeStr << 4 | 0x09, 0x1B, // Summary
                     0x49, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x6F, 0x75,
                     0x72, 0x63, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
@@ -1604,6 +2049,48 @@ static const unsigned char helpDataPack[] =
             0x6C, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x31,
             0x30, 0x32, 0x34, 0x2E,
 
+        // metric-path option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x03, // Section
+            0x6C, 0x6F, 0x67,
+        pckTypeStr << 4 | 0x08, 0x1E, // Summary
+            0x50, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x61,
+            0x72, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xFC, 0x04, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65,
+            0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x50, 0x72, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x65, 0x75, 0x73, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x6F, 0x72,
+            0x6D, 0x61, 0x74, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x73,
+            0x63, 0x72, 0x61, 0x70, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x65,
+            0x78, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x72, 0x20, 0x74, 0x65, 0x78, 0x74, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6C,
+            0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x2E, 0x20, 0x53, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x20, 0x66,
+            0x72, 0x6F, 0x6D, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x72, 0x67, 0x65,
+            0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x6F,
+            0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E, 0x20,
+            0x4D, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x65, 0x64, 0x20,
+            0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x2C, 0x20, 0x63, 0x6F, 0x6D,
+            0x6D, 0x61, 0x6E, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x6F, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+            0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x61, 0x79,
+            0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D,
+            0x65, 0x20, 0x62, 0x75, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x20, 0x65,
+            0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x0A, 0x0A,
+            0x49, 0x6E, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+            0x72, 0x6F, 0x66, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x2C,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5F, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F,
+            0x6E, 0x5F, 0x6D, 0x73, 0x65, 0x63, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5F, 0x65, 0x6E, 0x64, 0x5F,
+            0x73, 0x65, 0x63, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5F, 0x72, 0x65, 0x73,
+            0x75, 0x6C, 0x74, 0x20, 0x67, 0x61, 0x75, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74,
+            0x65, 0x6E, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+            0x73, 0x65, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C,
+            0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x73, 0x69,
+            0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6C, 0x61, 0x73, 0x74,
+            0x20, 0x72, 0x61, 0x6E, 0x2E,
+
         // neutral-umask option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -1664,7 +2151,7 @@ static const unsigned char helpDataPack[] =
                     0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
             0x00, // Command backup override end
 
-            pckTypeObj << 4 | 0x0A, 0x01, // Command stanza-create override begin
+            pckTypeObj << 4 | 0x0C, 0x01, // Command stanza-create override begin
                 pckTypeStr << 4 | 0x09, 0x1C, // Summary
                     0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x69, 0x6E,
                     0x65, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x2E,
@@ -1713,7 +2200,7 @@ static const unsigned char helpDataPack[] =
                     0x6E, 0x20, 0x69, 0x6E, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2E,
             0x00, // Command info override end
 
-            pckTypeObj << 4 | 0x02, // Command repo-ls override begin
+            pckTypeObj << 4 | 0x03, // Command repo-ls override begin
                 pckTypeStr << 4 | 0x09, 0x0E, // Summary
                     0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2E,
                 pckTypeStr << 4 | 0x08, 0xA7, 0x01, // Description
@@ -1786,7 +2273,7 @@ static const unsigned char helpDataPack[] =
                 pckTypeBool << 4 | 0x08, // Internal
             0x00, // Command archive-push override end
 
-            pckTypeObj << 4 | 0x0A, 0x01, // Command restore override begin
+            pckTypeObj << 4 | 0x0B, 0x01, // Command restore override begin
                 pckTypeBool << 4 | 0x08, // Internal
             0x00, // Command restore override end
 
@@ -2056,6 +2543,39 @@ static const unsigned char helpDataPack[] =
             0x74, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6D, 0x70, 0x61, 0x63, 0x74, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73,
             0x65, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x2E,
 
+        // profile option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x03, // Section
+            0x6C, 0x6F, 0x67,
+        pckTypeStr << 4 | 0x08, 0x1B, // Summary
+            0x57, 0x72, 0x69, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x61, 0x74,
+            0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xC8, 0x03, // Description
+            0x4D, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x72,
+            0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x74, 0x6F, 0x72,
+            0x61, 0x67, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x69,
+            0x6E, 0x67, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C,
+            0x74, 0x65, 0x72, 0x20, 0x28, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F,
+            0x6E, 0x2C, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B,
+            0x73, 0x75, 0x6D, 0x73, 0x29, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20,
+            0x72, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x74, 0x72, 0x69, 0x70, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65,
+            0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x20, 0x61, 0x72,
+            0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x20, 0x69, 0x6E,
+            0x20, 0x6C, 0x6F, 0x67, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+            0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x6C, 0x6F, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x20, 0x61, 0x20, 0x2E, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x65, 0x78, 0x74,
+            0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x77, 0x72,
+            0x69, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x2E, 0x0A, 0x0A,
+            0x50, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x64, 0x64, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6D, 0x61,
+            0x6C, 0x6C, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61,
+            0x64, 0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20,
+            0x66, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x6C, 0x6F, 0x77, 0x20,
+            0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E,
+            0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x20, 0x75, 0x73, 0x65, 0x2E,
+
         // protocol-timeout option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -2139,7 +2659,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x07, // Command overrides begin
 
-            pckTypeObj << 4 | 0x09, 0x01, // Command repo-ls override begin
+            pckTypeObj << 4 | 0x0A, 0x01, // Command repo-ls override begin
                 pckTypeStr << 4 | 0x09, 0x1F, // Summary
                     0x49, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x75, 0x62, 0x70, 0x61, 0x74,
                     0x68, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2E,
@@ -2162,6 +2682,26 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
+        // relation-path option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeArray << 4 | 0x05, // Command overrides begin
+
+            pckTypeObj << 4 | 0x07, // Command relation-restore override begin
+                pckTypeStr << 4 | 0x09, 0x27, // Summary
+                    0x50, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F,
+                    0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72,
+                    0x65, 0x64, 0x2E,
+                pckTypeStr << 4 | 0x08, 0x63, // Description
+                    0x52, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+                    0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70,
+                    0x61, 0x74, 0x68, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x70, 0x61,
+                    0x74, 0x68, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+                    0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64,
+                    0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E,
+            0x00, // Command relation-restore override end
+
+        0x00, // Command overrides end
+
         // remote-type option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeBool << 4 | 0x08, // Internal
@@ -2339,7 +2879,7 @@ static const unsigned char helpDataPack[] =
         pckTypeStr << 4 | 0x08, 0x26, // Summary
             0x43, 0x69, 0x70, 0x68, 0x65, 0x72, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79,
             0x70, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E,
-        pckTypeStr << 4 | 0x08, 0x89, 0x02, // Description
+        pckTypeStr << 4 | 0x08, 0xD3, 0x05, // Description
             0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x69, 0x70, 0x68, 0x65, 0x72,
             0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64,
             0x3A, 0x0A, 0x0A,
@@ -2349,13 +2889,36 @@ static const unsigned char helpDataPack[] =
             0x2A, 0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x63, 0x62, 0x63, 0x20, 0x2D, 0x20, 0x41, 0x64, 0x76, 0x61,
             0x6E, 0x63, 0x65, 0x64, 0x20, 0x45, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x53, 0x74, 0x61, 0x6E,
             0x64, 0x61, 0x72, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x32, 0x35, 0x36, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6B, 0x65,
-            0x79, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x0A, 0x0A,
-            0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E,
-            0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64,
-            0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66,
-            0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x79, 0x70, 0x65,
-            0x20, 0x28, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x53, 0x33, 0x29, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20,
-            0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+            0x79, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x0A,
+            0x2A, 0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x67, 0x63, 0x6D, 0x20, 0x2D, 0x20, 0x41, 0x64, 0x76, 0x61,
+            0x6E, 0x63, 0x65, 0x64, 0x20, 0x45, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x53, 0x74, 0x61, 0x6E,
+            0x64, 0x61, 0x72, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x32, 0x35, 0x36, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6B, 0x65,
+            0x79, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x47, 0x61, 0x6C, 0x6F, 0x69, 0x73, 0x2F, 0x43,
+            0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61,
+            0x72, 0x65, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65,
+            0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x61, 0x75, 0x74, 0x68, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61,
+            0x74, 0x65, 0x64, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x73, 0x6F, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70,
+            0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x72, 0x75, 0x6E, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+            0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D,
+            0x6F, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65,
+            0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x61, 0x65, 0x73, 0x2D, 0x32, 0x35, 0x36, 0x2D, 0x63, 0x62, 0x63, 0x20, 0x6F,
+            0x6E, 0x20, 0x43, 0x50, 0x55, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x41, 0x45, 0x53, 0x20, 0x69, 0x6E, 0x73, 0x74,
+            0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x63, 0x72, 0x79, 0x70, 0x74,
+            0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x73, 0x73, 0x6C, 0x20,
+            0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2D, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x6F, 0x6F, 0x6C, 0x2E, 0x0A, 0x0A,
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x69, 0x70, 0x68, 0x65, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
+            0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20, 0x73, 0x6F, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x63, 0x69, 0x70, 0x68, 0x65, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6D, 0x61, 0x79, 0x20,
+            0x62, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78,
+            0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x4E,
+            0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+            0x69, 0x73, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20,
+            0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
+            0x28, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x53, 0x33, 0x29, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x65,
+            0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
 
         // repo-hardlink option
         // -------------------------------------------------------------------------------------------------------------------------
@@ -2423,7 +2986,7 @@ static const unsigned char helpDataPack[] =
                 pckTypeBool << 4 | 0x08, // Internal
             0x00, // Command expire override end
 
-            pckTypeObj << 4 | 0x08, 0x01, // Command stanza-create override begin
+            pckTypeObj << 4 | 0x0A, 0x01, // Command stanza-create override begin
                 pckTypeBool << 4 | 0x08, // Internal
             0x00, // Command stanza-create override end
 
@@ -2437,10 +3000,41 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
-        // repo-host-cmd option
+        // repo-host-ca-file option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x09, 0x0A, // Section
             0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x2B, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74,
+            0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x56, // Description
+            0x55, 0x73, 0x65, 0x20, 0x61, 0x20, 0x43, 0x41, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x64, 0x65, 0x66, 0x61,
+            0x75, 0x6C, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+            0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66,
+            0x69, 0x63, 0x61, 0x74, 0x65, 0x2E,
+
+        // repo-host-cert-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x28, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x6C, 0x69, 0x65,
+            0x6E, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x86, 0x01, // Description
+            0x43, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x65,
+            0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20,
+            0x68, 0x6F, 0x73, 0x74, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6D,
+            0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x63,
+            0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79,
+            0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x74, 0x6C, 0x73, 0x2D, 0x73,
+            0x65, 0x72, 0x76, 0x65, 0x72, 0x2D, 0x63, 0x61, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+
+        // repo-host-cmd option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
         pckTypeStr << 4 | 0x08, 0x2B, // Summary
             0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x65, 0x78, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
             0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F,
@@ -2527,6 +3121,17 @@ static const unsigned char helpDataPack[] =
             0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
             0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E,
 
+        // repo-host-key-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x20, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x6C, 0x69, 0x65,
+            0x6E, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x27, // Description
+            0x50, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2E,
+
         // repo-host-port option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x0A, // Section
@@ -2535,23 +3140,42 @@ static const unsigned char helpDataPack[] =
             0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x6F, 0x72, 0x74,
             0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73,
             0x65, 0x74, 0x2E,
-        pckTypeStr << 4 | 0x08, 0x6F, // Description
+        pckTypeStr << 4 | 0x08, 0x81, 0x01, // Description
             0x55, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73,
             0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
             0x20, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69,
             0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2E, 0x20,
-            0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x53, 0x53, 0x48, 0x20, 0x69,
-            0x73, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D,
+            0x74, 0x6C, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x70, 0x6F, 0x72, 0x74,
+            0x20, 0x69, 0x73, 0x20, 0x38, 0x34, 0x33, 0x32, 0x2E,
 
         pckTypeArray << 4, // Deprecated names begin
             pckTypeStr << 4 | 0x08, 0x0F, // backup-ssh-port
                 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2D, 0x73, 0x73, 0x68, 0x2D, 0x70, 0x6F, 0x72, 0x74,
         0x00, // Deprecated names end
 
-        // repo-host-user option
+        // repo-host-type option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0A, 0x0A, // Section
             0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x1E, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74,
+            0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x81, 0x01, // Description
+            0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63,
+            0x6F, 0x6C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74,
+            0x65, 0x64, 0x3A, 0x0A, 0x0A,
+            0x2A, 0x20, 0x73, 0x73, 0x68, 0x20, 0x2D, 0x20, 0x53, 0x65, 0x63, 0x75, 0x72, 0x65, 0x20, 0x53, 0x68, 0x65, 0x6C, 0x6C,
+            0x2E, 0x0A,
+            0x2A, 0x20, 0x74, 0x6C, 0x73, 0x20, 0x2D, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x54,
+            0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+            0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E,
+            0x64, 0x2E,
+
+        // repo-host-user option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
         pckTypeStr << 4 | 0x08, 0x2B, // Summary
             0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x72,
             0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73,
@@ -3168,6 +3792,21 @@ static const unsigned char helpDataPack[] =
                     0x69, 0x65, 0x64, 0x2E,
             0x00, // Command info override end
 
+            pckTypeObj << 4, // Command relation-restore override begin
+                pckTypeStr << 4 | 0x09, 0x1B, // Summary
+                    0x42, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74,
+                    0x6F, 0x72, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x2E,
+                pckTypeStr << 4 | 0x08, 0x86, 0x01, // Description
+                    0x54, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x61,
+                    0x74, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77,
+                    0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x66, 0x72,
+                    0x6F, 0x6D, 0x2E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x75, 0x73,
+                    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75,
+                    0x70, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69,
+                    0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+                    0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
+            0x00, // Command relation-restore override end
+
             pckTypeObj << 4 | 0x05, // Command restore override begin
                 pckTypeStr << 4 | 0x09, 0x16, // Summary
                     0x42, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74,
@@ -3182,7 +3821,7 @@ static const unsigned char helpDataPack[] =
                     0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x2E,
             0x00, // Command restore override end
 
-            pckTypeObj << 4 | 0x05, // Command verify override begin
+            pckTypeObj << 4 | 0x06, // Command verify override begin
                 pckTypeBool << 4 | 0x08, // Internal
             0x00, // Command verify override end
 
@@ -3192,7 +3831,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x05, // Command overrides begin
 
-            pckTypeObj << 4 | 0x09, 0x01, // Command repo-ls override begin
+            pckTypeObj << 4 | 0x0A, 0x01, // Command repo-ls override begin
                 pckTypeStr << 4 | 0x09, 0x2B, // Summary
                     0x53, 0x6F, 0x72, 0x74, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6E, 0x64,
                     0x69, 0x6E, 0x67, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x6F,
@@ -3211,9 +3850,37 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
-        // spool-path option
+        // sparse option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x09, 0x07, // Section
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+        pckTypeStr << 4 | 0x08, 0x27, // Summary
+            0x52, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x73, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xED, 0x02, // Description
+            0x5A, 0x65, 0x72, 0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69,
+            0x6E, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+            0x20, 0x6E, 0x6F, 0x74, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x79,
+            0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x6E,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65,
+            0x72, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E,
+            0x20, 0x57, 0x41, 0x4C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x67, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2C,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x6C,
+            0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x2E, 0x0A,
+            0x57, 0x41, 0x52, 0x4E, 0x49, 0x4E, 0x47, 0x3A, 0x20, 0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x73, 0x6B, 0x69, 0x70, 0x70, 0x65, 0x64, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69, 0x73,
+            0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x50, 0x6F, 0x73, 0x74,
+            0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+            0x6D, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x6F,
+            0x72, 0x6D, 0x61, 0x6C, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x66,
+            0x61, 0x69, 0x6C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x73,
+            0x70, 0x61, 0x63, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x76, 0x6F, 0x6C, 0x75,
+            0x6D, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x6F, 0x72, 0x20, 0x74,
+            0x68, 0x69, 0x6E, 0x2D, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x65, 0x64, 0x2E,
+
+        // spool-path option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
             0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
         pckTypeStr << 4 | 0x08, 0x24, // Summary
             0x50, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x65, 0x6E, 0x74,
@@ -3386,6 +4053,61 @@ static const unsigned char helpDataPack[] =
             0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x28, 0x29, 0x20, 0x73, 0x6F, 0x20, 0x61,
             0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2E,
 
+        // sync-batch option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+        pckTypeStr << 4 | 0x08, 0x40, // Summary
+            0x53, 0x79, 0x6E, 0x63, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20,
+            0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72,
+            0x20, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F,
+            0x72, 0x65, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xE8, 0x06, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x20, 0x69, 0x73, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x61,
+            0x73, 0x20, 0x73, 0x6F, 0x6F, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x74,
+            0x6F, 0x72, 0x65, 0x64, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x64, 0x6F, 0x6D, 0x69,
+            0x6E, 0x61, 0x74, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77, 0x68,
+            0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65,
+            0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x57, 0x68,
+            0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72,
+            0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x79,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E,
+            0x69, 0x6E, 0x67, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x28, 0x65, 0x2E, 0x67,
+            0x2E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x73, 0x29, 0x20, 0x69, 0x73,
+            0x20, 0x73, 0x79, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C,
+            0x65, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+            0x64, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20,
+            0x63, 0x61, 0x6E, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+            0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6F,
+            0x6E, 0x63, 0x65, 0x2E, 0x20, 0x41, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73,
+            0x79, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63,
+            0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70,
+            0x67, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65,
+            0x6E, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x72,
+            0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20,
+            0x62, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73,
+            0x20, 0x73, 0x79, 0x6E, 0x63, 0x66, 0x73, 0x28, 0x29, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20,
+            0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x4C, 0x69,
+            0x6E, 0x75, 0x78, 0x2E, 0x20, 0x4C, 0x69, 0x6E, 0x75, 0x78, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x73, 0x20, 0x62,
+            0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x35, 0x2E, 0x38, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x70,
+            0x6F, 0x72, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x79, 0x6E, 0x63,
+            0x66, 0x73, 0x28, 0x29, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+            0x74, 0x20, 0x62, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x20,
+            0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x6E,
+            0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+            0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x4E, 0x6F, 0x74, 0x65,
+            0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x72,
+            0x69, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x66,
+            0x69, 0x6C, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x65,
+            0x64, 0x2C, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20,
+            0x62, 0x79, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x2E,
+
         // tablespace-map option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -3461,7 +4183,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x07, // Command overrides begin
 
-            pckTypeObj << 4 | 0x0C, 0x01, // Command restore override begin
+            pckTypeObj << 4 | 0x0D, 0x01, // Command restore override begin
                 pckTypeStr << 4 | 0x09, 0x10, // Summary
                     0x52, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2E,
                 pckTypeStr << 4 | 0x08, 0x3E, // Description
@@ -3477,7 +4199,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x05, // Command overrides begin
 
-            pckTypeObj << 4 | 0x0C, 0x01, // Command restore override begin
+            pckTypeObj << 4 | 0x0D, 0x01, // Command restore override begin
                 pckTypeStr << 4 | 0x09, 0x2F, // Summary
                     0x41, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x77, 0x68, 0x65,
                     0x6E, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20,
@@ -3520,7 +4242,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x05, // Command overrides begin
 
-            pckTypeObj << 4 | 0x0C, 0x01, // Command restore override begin
+            pckTypeObj << 4 | 0x0D, 0x01, // Command restore override begin
                 pckTypeStr << 4 | 0x09, 0x30, // Summary
                     0x53, 0x74, 0x6F, 0x70, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x74,
                     0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
@@ -3553,7 +4275,7 @@ static const unsigned char helpDataPack[] =
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x05, // Command overrides begin
 
-            pckTypeObj << 4 | 0x0C, 0x01, // Command restore override begin
+            pckTypeObj << 4 | 0x0D, 0x01, // Command restore override begin
                 pckTypeStr << 4 | 0x09, 0x19, // Summary
                     0x52, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x74, 0x69,
                     0x6D, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x2E,
@@ -3626,6 +4348,71 @@ static const unsigned char helpDataPack[] =
             0x50, 0x49, 0x4E, 0x54, 0x56, 0x4C, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
             0x2E,
 
+        // tls-server-address option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        pckTypeStr << 4 | 0x08, 0x13, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x49, // Description
+            0x49, 0x50, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6E,
+            0x61, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+            0x6C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74,
+            0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E,
+
+        // tls-server-ca-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        pckTypeStr << 4 | 0x08, 0x2D, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x65,
+            0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x6B, // Description
+            0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74,
+            0x20, 0x61, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x65,
+            0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61,
+            0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E,
+
+        // tls-server-cert-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        pckTypeStr << 4 | 0x08, 0x1C, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61,
+            0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x8A, 0x01, // Description
+            0x43, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x65,
+            0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x63,
+            0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63,
+            0x61, 0x74, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x66, 0x6F,
+            0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+            0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x6E,
+            0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E,
+
+        // tls-server-key-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        pckTypeStr << 4 | 0x08, 0x14, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x27, // Description
+            0x50, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2E,
+
+        // tls-server-port option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        pckTypeStr << 4 | 0x08, 0x10, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x36, // Description
+            0x50, 0x6F, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+            0x20, 0x6C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E,
+            0x74, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E,
+
         // type option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeArray << 4 | 0x07, // Command overrides begin
@@ -3653,7 +4440,7 @@ static const unsigned char helpDataPack[] =
                     0x63, 0x6B, 0x75, 0x70, 0x2E,
             0x00, // Command backup override end
 
-            pckTypeObj << 4 | 0x09, 0x01, // Command restore override begin
+            pckTypeObj << 4 | 0x0A, 0x01, // Command restore override begin
                 pckTypeStr << 4 | 0x09, 0x0E, // Summary
                     0x52, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E,
                 pckTypeStr << 4 | 0x08, 0x84, 0x06, // Description
@@ -3709,6 +4496,14 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
+        // verify-ledger option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeBool << 4 | 0x08, // Internal
+
+        // verify-sample option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeBool << 4 | 0x0D, 0x01, // Internal
+
     0x00, // Options end
 
     0x00, // Pack end
@@ -6,6 +6,7 @@ Remote Command
 #include <string.h>
 
 #include "command/control/common.h"
+#include "command/remote/remote.h"
 #include "common/debug.h"
 #include "common/io/fdRead.h"
 #include "common/io/fdWrite.h"
@@ -31,6 +32,28 @@ cmdRemote(int fdRead, int fdWrite)
         IoWrite *write = ioFdWriteNew(name, fdWrite, cfgOptionUInt64(cfgOptProtocolTimeout));
         ioWriteOpen(write);
 
+        cmdRemoteSession(read, write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+cmdRemoteSession(IoRead *read, IoWrite *write)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+    ASSERT(write != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        String *name = strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u", cfgOptionUInt(cfgOptProcess));
         ProtocolServer *server = protocolServerNew(name, PROTOCOL_SERVICE_REMOTE_STR, read, write);
         protocolServerHandlerAdd(server, storageRemoteProtocol);
         protocolServerHandlerAdd(server, dbProtocol);
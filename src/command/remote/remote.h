@@ -4,10 +4,16 @@ Remote Command
 #ifndef COMMAND_REMOTE_REMOTE_H
 #define COMMAND_REMOTE_REMOTE_H
 
+#include "common/io/read.h"
+#include "common/io/write.h"
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
 // Remote command
 void cmdRemote(int fdRead, int fdWrite);
 
+// Remote command on existing read/write interfaces, e.g. a session accepted by the server command
+void cmdRemoteSession(IoRead *read, IoWrite *write);
+
 #endif
@@ -0,0 +1,348 @@
+/***********************************************************************************************************************************
+Restore Clean Path
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "command/restore/clean.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/user.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Log a message or add it to the list of messages to be logged by the caller
+***********************************************************************************************************************************/
+static void
+restoreCleanLog(StringList *logList, const String *message)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, logList);
+        FUNCTION_TEST_PARAM(STRING, message);
+    FUNCTION_TEST_END();
+
+    ASSERT(message != NULL);
+
+    if (logList == NULL)
+        LOG_DETAIL(strZ(message));
+    else
+        strLstAdd(logList, message);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+restoreCleanOwnership(
+    const String *pgPath, const String *manifestUserName, const String *manifestGroupName, uid_t actualUserId, gid_t actualGroupId,
+    bool new, StringList *logList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, pgPath);
+        FUNCTION_TEST_PARAM(STRING, manifestUserName);
+        FUNCTION_TEST_PARAM(STRING, manifestGroupName);
+        FUNCTION_TEST_PARAM(UINT, actualUserId);
+        FUNCTION_TEST_PARAM(UINT, actualGroupId);
+        FUNCTION_TEST_PARAM(BOOL, new);
+        FUNCTION_TEST_PARAM(STRING_LIST, logList);
+    FUNCTION_TEST_END();
+
+    ASSERT(pgPath != NULL);
+
+    // Get the expected user id
+    uid_t expectedUserId = userId();
+
+    if (manifestUserName != NULL)
+    {
+        uid_t manifestUserId = userIdFromName(manifestUserName);
+
+        if (manifestUserId != (uid_t)-1)
+            expectedUserId = manifestUserId;
+    }
+
+    // Get the expected group id
+    gid_t expectedGroupId = groupId();
+
+    if (manifestGroupName != NULL)
+    {
+        uid_t manifestGroupId = groupIdFromName(manifestGroupName);
+
+        if (manifestGroupId != (uid_t)-1)
+            expectedGroupId = manifestGroupId;
+    }
+
+    // Update ownership if not as expected
+    if (actualUserId != expectedUserId || actualGroupId != expectedGroupId)
+    {
+        // If this is a newly created file/link/path then there's no need to log updated permissions
+        if (!new)
+            restoreCleanLog(logList, strNewFmt("update ownership for '%s'", strZ(pgPath)));
+
+        THROW_ON_SYS_ERROR_FMT(
+            lchown(strZ(pgPath), expectedUserId, expectedGroupId) == -1, FileOwnerError, "unable to set ownership for '%s'",
+            strZ(pgPath));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+restoreCleanMode(const String *pgPath, mode_t manifestMode, const StorageInfo *info, StringList *logList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, pgPath);
+        FUNCTION_TEST_PARAM(MODE, manifestMode);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
+        FUNCTION_TEST_PARAM(STRING_LIST, logList);
+    FUNCTION_TEST_END();
+
+    ASSERT(pgPath != NULL);
+    ASSERT(info != NULL);
+
+    // Update mode if not as expected
+    if (manifestMode != info->mode)
+    {
+        restoreCleanLog(logList, strNewFmt("update mode for '%s' to %04o", strZ(pgPath), manifestMode));
+
+        THROW_ON_SYS_ERROR_FMT(
+            chmod(strZ(pgPath), manifestMode) == -1, FileOwnerError, "unable to set mode for '%s'", strZ(pgPath));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Clean a path
+***********************************************************************************************************************************/
+typedef struct RestoreCleanPathData
+{
+    const String *pgPath;                                           // Path being cleaned
+    const List *entryList;                                          // Entries expected in the path
+    const StringList *fileIgnore;                                   // Files to ignore during clean
+    StringList *logList;                                            // Messages to be logged
+} RestoreCleanPathData;
+
+// Comparator to order entries by name then type
+static int
+restoreCleanEntryComparator(const void *item1, const void *item2)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, item1);
+        FUNCTION_TEST_PARAM_P(VOID, item2);
+    FUNCTION_TEST_END();
+
+    ASSERT(item1 != NULL);
+    ASSERT(item2 != NULL);
+
+    int result = strCmp(((RestoreCleanEntry *)item1)->name, ((RestoreCleanEntry *)item2)->name);
+
+    if (result == 0)
+    {
+        if (((RestoreCleanEntry *)item1)->type < ((RestoreCleanEntry *)item2)->type)
+            result = -1;
+        else if (((RestoreCleanEntry *)item1)->type > ((RestoreCleanEntry *)item2)->type)
+            result = 1;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Find an entry by name and type
+static const RestoreCleanEntry *
+restoreCleanEntryFind(const List *entryList, const String *name, StorageType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, entryList);
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    ASSERT(entryList != NULL);
+    ASSERT(name != NULL);
+
+    FUNCTION_TEST_RETURN(lstFind(entryList, &(RestoreCleanEntry){.name = name, .type = type}));
+}
+
+// storageInfoList() callback that cleans the path
+static void
+restoreCleanPathCallback(void *data, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(info != NULL);
+
+    RestoreCleanPathData *cleanData = (RestoreCleanPathData *)data;
+
+    // Don't include backup.manifest or recovery.conf (when preserved) in the comparison
+    if (cleanData->fileIgnore != NULL && info->type == storageTypeFile && strLstExists(cleanData->fileIgnore, info->name))
+    {
+        FUNCTION_TEST_RETURN_VOID();
+        return;
+    }
+
+    // Skip the . path because it has already been cleaned by the job for the parent path
+    if (strEq(info->name, DOT_STR))
+    {
+        FUNCTION_TEST_RETURN_VOID();
+        return;
+    }
+
+    // Construct the path of this file/link/path in the PostgreSQL data directory
+    const String *pgPath = strNewFmt("%s/%s", strZ(cleanData->pgPath), strZ(info->name));
+    const RestoreCleanEntry *entry = restoreCleanEntryFind(cleanData->entryList, info->name, info->type);
+
+    switch (info->type)
+    {
+        case storageTypeFile:
+        {
+            if (entry != NULL)
+            {
+                restoreCleanOwnership(pgPath, entry->user, entry->group, info->userId, info->groupId, false, cleanData->logList);
+                restoreCleanMode(pgPath, entry->mode, info, cleanData->logList);
+            }
+            else
+            {
+                restoreCleanLog(cleanData->logList, strNewFmt("remove invalid file '%s'", strZ(pgPath)));
+                storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
+            }
+
+            break;
+        }
+
+        case storageTypeLink:
+        {
+            if (entry != NULL)
+            {
+                if (!strEq(entry->destination, info->linkDestination))
+                {
+                    restoreCleanLog(cleanData->logList, strNewFmt("remove link '%s' because destination changed", strZ(pgPath)));
+                    storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
+                }
+                else
+                {
+                    restoreCleanOwnership(
+                        pgPath, entry->user, entry->group, info->userId, info->groupId, false, cleanData->logList);
+                }
+            }
+            else
+            {
+                restoreCleanLog(cleanData->logList, strNewFmt("remove invalid link '%s'", strZ(pgPath)));
+                storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
+            }
+
+            break;
+        }
+
+        case storageTypePath:
+        {
+            // Check ownership/permissions. The contents of the path are cleaned by the job for the path.
+            if (entry != NULL)
+            {
+                restoreCleanOwnership(pgPath, entry->user, entry->group, info->userId, info->groupId, false, cleanData->logList);
+                restoreCleanMode(pgPath, entry->mode, info, cleanData->logList);
+            }
+            else
+            {
+                restoreCleanLog(cleanData->logList, strNewFmt("remove invalid path '%s'", strZ(pgPath)));
+                storagePathRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true, .recurse = true);
+            }
+
+            break;
+        }
+
+        // Special file types cannot exist in the manifest so just delete them
+        case storageTypeSpecial:
+        {
+            restoreCleanLog(cleanData->logList, strNewFmt("remove special file '%s'", strZ(pgPath)));
+            storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+StringList *
+restoreCleanPath(const String *pgPath, List *entryList, const StringList *fileIgnore)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, pgPath);
+        FUNCTION_LOG_PARAM(LIST, entryList);
+        FUNCTION_LOG_PARAM(STRING_LIST, fileIgnore);
+    FUNCTION_LOG_END();
+
+    ASSERT(pgPath != NULL);
+    ASSERT(entryList != NULL);
+
+    StringList *result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Sort entries so they can be found by name and type
+        lstComparatorSet(entryList, restoreCleanEntryComparator);
+        lstSort(entryList, sortOrderAsc);
+
+        // Clean the path
+        RestoreCleanPathData cleanData =
+        {
+            .pgPath = pgPath,
+            .entryList = entryList,
+            .fileIgnore = fileIgnore,
+            .logList = result,
+        };
+
+        storageInfoListP(
+            storageLocalWrite(), pgPath, restoreCleanPathCallback, &cleanData, .errorOnMissing = true, .sortOrder = sortOrderAsc);
+
+        // Create missing links and paths
+        for (unsigned int entryIdx = 0; entryIdx < lstSize(entryList); entryIdx++)
+        {
+            const RestoreCleanEntry *entry = lstGet(entryList, entryIdx);
+
+            // Files are created by the restore jobs
+            if (entry->type == storageTypeFile)
+                continue;
+
+            // A path that has been mapped as a link was created as part of target creation (or it might have already existed)
+            if (entry->type == storageTypePath && restoreCleanEntryFind(entryList, entry->name, storageTypeLink) != NULL)
+                continue;
+
+            const String *entryPath = strNewFmt("%s/%s", strZ(pgPath), strZ(entry->name));
+
+            // Create the link/path if it is missing. If it exists it should already have the correct ownership, mode, and
+            // destination.
+            if (!storageInfoP(storageLocal(), entryPath, .ignoreMissing = true).exists)
+            {
+                if (entry->type == storageTypeLink)
+                {
+                    restoreCleanLog(
+                        result, strNewFmt("create symlink '%s' to '%s'", strZ(entryPath), strZ(entry->destination)));
+
+                    THROW_ON_SYS_ERROR_FMT(
+                        symlink(strZ(entry->destination), strZ(entryPath)) == -1, FileOpenError,
+                        "unable to create symlink '%s' to '%s'", strZ(entryPath), strZ(entry->destination));
+                }
+                else
+                {
+                    restoreCleanLog(result, strNewFmt("create path '%s'", strZ(entryPath)));
+
+                    storagePathCreateP(
+                        storageLocalWrite(), entryPath, .mode = entry->mode, .noParentCreate = true, .errorOnExists = true);
+                }
+
+                restoreCleanOwnership(entryPath, entry->user, entry->group, userId(), groupId(), true, result);
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
@@ -0,0 +1,43 @@
+/***********************************************************************************************************************************
+Restore Clean Path
+***********************************************************************************************************************************/
+#ifndef COMMAND_RESTORE_CLEAN_H
+#define COMMAND_RESTORE_CLEAN_H
+
+#include <sys/types.h>
+
+#include "common/type/list.h"
+#include "common/type/string.h"
+#include "common/type/stringList.h"
+#include "storage/info.h"
+
+/***********************************************************************************************************************************
+File, link, or path expected in a path being cleaned
+***********************************************************************************************************************************/
+typedef struct RestoreCleanEntry
+{
+    const String *name;                                             // Name in the path being cleaned
+    StorageType type;                                               // Type (file, link, or path)
+    mode_t mode;                                                    // Mode of file/path
+    const String *user;                                             // User name
+    const String *group;                                            // Group name
+    const String *destination;                                      // Destination of link
+} RestoreCleanEntry;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Update ownership on a file/link/path. Messages are added to logList or logged when logList is NULL.
+void restoreCleanOwnership(
+    const String *pgPath, const String *manifestUserName, const String *manifestGroupName, uid_t actualUserId, gid_t actualGroupId,
+    bool new, StringList *logList);
+
+// Update mode on a file/path. Messages are added to logList or logged when logList is NULL.
+void restoreCleanMode(const String *pgPath, mode_t manifestMode, const StorageInfo *info, StringList *logList);
+
+// Clean a path that is expected to contain the entries in entryList. Entries that are not in the list are removed, ownership and
+// mode are updated on the entries that are, and links/paths that are missing are created. Subpaths are not cleaned since they are
+// cleaned by their own jobs. Files in fileIgnore are skipped. Returns the messages to log for the changes that were made.
+StringList *restoreCleanPath(const String *pgPath, List *entryList, const StringList *fileIgnore);
+
+#endif
@@ -24,7 +24,7 @@ restoreFile(
     const String *repoFile, const String *repoFileReference, CompressType repoFileCompressType, const String *pgFile,
     const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode,
     const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
-    const String *cipherPass)
+    CipherType cipherType, const String *cipherPass, bool sync, bool sparse)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, repoFile);
@@ -41,12 +41,16 @@ restoreFile(
         FUNCTION_LOG_PARAM(TIME, copyTimeBegin);
         FUNCTION_LOG_PARAM(BOOL, delta);
         FUNCTION_LOG_PARAM(BOOL, deltaForce);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
         FUNCTION_TEST_PARAM(STRING, cipherPass);
+        FUNCTION_LOG_PARAM(BOOL, sync);
+        FUNCTION_LOG_PARAM(BOOL, sparse);
     FUNCTION_LOG_END();
 
     ASSERT(repoFile != NULL);
     ASSERT(repoFileReference != NULL);
     ASSERT(pgFile != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
 
     // Was the file copied?
     bool result = true;
@@ -113,10 +117,12 @@ restoreFile(
         // Copy file from repository to database or create zero-length/sparse file
         if (result)
         {
-            // Create destination file
+            // Create destination file. When sparse is set zero-filled blocks are skipped so they do not use space in the restored
+            // cluster.
             StorageWrite *pgFileWrite = storageNewWriteP(
                 storagePgWrite(), pgFile, .modeFile = pgFileMode, .user = pgFileUser, .group = pgFileGroup,
-                .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncPath = true);
+                .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncFile = !sync, .noSyncPath = true,
+                .sparse = sparse);
 
             // If size is zero/sparse no need to actually copy
             if (pgFileSize == 0 || pgFileZero)
@@ -142,13 +148,16 @@ restoreFile(
                 IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(pgFileWrite));
 
                 // Add decryption filter
-                if (cipherPass != NULL)
+                if (cipherType != cipherTypeNone)
                 {
-                    ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+                    ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherType, BUFSTR(cipherPass), NULL));
                     compressible = false;
                 }
 
-                // Add decompression filter
+                // Add decompression filter. ??? Files compressed in frames (see compress-frame-size) are still decoded
+                // sequentially by a single process. Decoding frames in parallel would require splitting large framed files into
+                // range jobs that each read their frames with storageNewReadRangeP() and write at an offset, with the checksum
+                // verified once all ranges are complete.
                 if (repoFileCompressType != compressTypeNone)
                 {
                     ioFilterGroupAdd(filterGroup, decompressFilter(repoFileCompressType));
@@ -12,11 +12,11 @@ Restore File
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
-// Copy a file from the backup to the specified destination
+// Copy a file from the backup to the specified destination. If sync is false then the caller is responsible for syncing the file.
 bool restoreFile(
     const String *repoFile, const String *repoFileReference, CompressType repoFileCompressType, const String *pgFile,
     const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode,
     const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
-    const String *cipherPass);
+    CipherType cipherType, const String *cipherPass, bool sync, bool sparse);
 
 #endif
@@ -3,6 +3,7 @@ Restore Protocol Handler
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/restore/clean.h"
 #include "command/restore/file.h"
 #include "command/restore/protocol.h"
 #include "common/debug.h"
@@ -15,6 +16,7 @@ Restore Protocol Handler
 /***********************************************************************************************************************************
 Constants
 ***********************************************************************************************************************************/
+STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_CLEAN_STR,                   PROTOCOL_COMMAND_RESTORE_CLEAN);
 STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_FILE_STR,                    PROTOCOL_COMMAND_RESTORE_FILE);
 
 /**********************************************************************************************************************************/
@@ -47,7 +49,39 @@ restoreProtocol(const String *command, const VariantList *paramList, ProtocolSer
                         (mode_t)cvtZToUIntBase(strZ(varStr(varLstGet(paramList, 8))), 8),
                         varStr(varLstGet(paramList, 9)), varStr(varLstGet(paramList, 10)),
                         (time_t)varInt64Force(varLstGet(paramList, 11)), varBoolForce(varLstGet(paramList, 12)),
-                        varBoolForce(varLstGet(paramList, 13)), varStr(varLstGet(paramList, 14)))));
+                        varBoolForce(varLstGet(paramList, 13)), (CipherType)varUIntForce(varLstGet(paramList, 14)),
+                        varStr(varLstGet(paramList, 15)), varBool(varLstGet(paramList, 16)), varBool(varLstGet(paramList, 17)))));
+        }
+        else if (strEq(command, PROTOCOL_COMMAND_RESTORE_CLEAN_STR))
+        {
+            // Build the list of entries expected in the path
+            const VariantList *entryParamList = varVarLst(varLstGet(paramList, 2));
+            List *entryList = lstNewP(sizeof(RestoreCleanEntry));
+
+            for (unsigned int entryIdx = 0; entryIdx < varLstSize(entryParamList); entryIdx++)
+            {
+                const VariantList *entryParam = varVarLst(varLstGet(entryParamList, entryIdx));
+
+                lstAdd(
+                    entryList,
+                    &(RestoreCleanEntry)
+                    {
+                        .name = varStr(varLstGet(entryParam, 0)),
+                        .type = (StorageType)varUIntForce(varLstGet(entryParam, 1)),
+                        .mode = (mode_t)cvtZToUIntBase(strZ(varStr(varLstGet(entryParam, 2))), 8),
+                        .user = varStr(varLstGet(entryParam, 3)),
+                        .group = varStr(varLstGet(entryParam, 4)),
+                        .destination = varStr(varLstGet(entryParam, 5)),
+                    });
+            }
+
+            protocolServerResponse(
+                server,
+                varNewVarLst(
+                    varLstNewStrLst(
+                        restoreCleanPath(
+                            varStr(varLstGet(paramList, 0)), entryList,
+                            varLstGet(paramList, 1) == NULL ? NULL : strLstNewVarLst(varVarLst(varLstGet(paramList, 1)))))));
         }
         else
             found = false;
@@ -11,6 +11,8 @@ Restore Protocol Handler
 /***********************************************************************************************************************************
 Constants
 ***********************************************************************************************************************************/
+#define PROTOCOL_COMMAND_RESTORE_CLEAN                              "restoreClean"
+    STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_CLEAN_STR);
 #define PROTOCOL_COMMAND_RESTORE_FILE                               "restoreFile"
     STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_FILE_STR);
 
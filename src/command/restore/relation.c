@@ -0,0 +1,375 @@
+/***********************************************************************************************************************************
+Relation Restore Command
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+
+#include "command/backup/pageChecksum.h"
+#include "command/restore/relation.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
+#include "common/debug.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/regExp.h"
+#include "common/type/convert.h"
+#include "config/config.h"
+#include "info/infoBackup.h"
+#include "info/manifest.h"
+#include "postgres/interface.h"
+#include "storage/helper.h"
+#include "storage/range.h"
+
+/***********************************************************************************************************************************
+Relation to restore
+***********************************************************************************************************************************/
+typedef struct RelationRestoreParam
+{
+    const String *name;                                             // Manifest name of the first relation segment
+    bool blockRange;                                                // Restore only a range of blocks?
+    uint64_t blockFirst;                                            // First block to restore
+    uint64_t blockLast;                                             // Last block to restore
+} RelationRestoreParam;
+
+/***********************************************************************************************************************************
+Parse a relation parameter, i.e. a path relative to the data directory with an optional block range, e.g. base/1/2:10-20
+***********************************************************************************************************************************/
+static RelationRestoreParam
+relationRestoreParam(const String *param)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, param);
+    FUNCTION_TEST_END();
+
+    ASSERT(param != NULL);
+
+    RelationRestoreParam result = {0};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *path = param;
+        const int rangeIdx = strChr(param, ':');
+
+        // Parse the block range
+        if (rangeIdx != -1)
+        {
+            path = strSubN(param, 0, (size_t)rangeIdx);
+            const String *range = strSub(param, (size_t)rangeIdx + 1);
+
+            if (!regExpMatchOne(STRDEF("^[0-9]+(-[0-9]+)?$"), range))
+                THROW_FMT(ParamInvalidError, "invalid block range in '%s'", strZ(param));
+
+            const int lastIdx = strChr(range, '-');
+
+            result.blockRange = true;
+            result.blockFirst = cvtZToUInt64(strZ(lastIdx == -1 ? range : strSubN(range, 0, (size_t)lastIdx)));
+            result.blockLast = lastIdx == -1 ? result.blockFirst : cvtZToUInt64(strZ(range) + lastIdx + 1);
+
+            if (result.blockLast < result.blockFirst)
+                THROW_FMT(ParamInvalidError, "invalid block range in '%s'", strZ(param));
+        }
+
+        // The relation must be relative to the data directory
+        if (strSize(path) == 0 || strBeginsWith(path, FSLASH_STR))
+            THROW_FMT(ParamInvalidError, "relation '%s' must be relative to the data directory", strZ(path));
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            // Relations in tablespaces are already named as they are in the manifest
+            if (strBeginsWithZ(path, MANIFEST_TARGET_PGTBLSPC "/"))
+                result.name = strDup(path);
+            else
+                result.name = strNewFmt(MANIFEST_TARGET_PGDATA "/%s", strZ(path));
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Get the segment number when the file is a segment of the relation, e.g. 16385.2 is segment 2 of 16385. Returns false when the file
+is not part of the relation.
+***********************************************************************************************************************************/
+static bool
+relationRestoreSegment(const String *relation, const String *fileName, uint64_t *segmentNo)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, relation);
+        FUNCTION_TEST_PARAM(STRING, fileName);
+        FUNCTION_TEST_PARAM_P(UINT64, segmentNo);
+    FUNCTION_TEST_END();
+
+    ASSERT(relation != NULL);
+    ASSERT(fileName != NULL);
+    ASSERT(segmentNo != NULL);
+
+    bool result = false;
+
+    if (strEq(fileName, relation))
+    {
+        *segmentNo = 0;
+        result = true;
+    }
+    else if (strBeginsWith(fileName, relation) && strZ(fileName)[strSize(relation)] == '.')
+    {
+        const char *segment = strZ(fileName) + strSize(relation) + 1;
+
+        if (*segment != '\0' && strspn(segment, "0123456789") == strlen(segment))
+        {
+            *segmentNo = cvtZToUInt64(segment);
+            result = true;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Restore a range of a file to relation-path
+***********************************************************************************************************************************/
+static void
+relationRestoreFile(
+    const Manifest *manifest, const ManifestFile *file, uint64_t segmentNo, uint64_t offset, uint64_t size,
+    const String *restoreName)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_LOG_PARAM(STRING, file->name);
+        FUNCTION_LOG_PARAM(UINT64, segmentNo);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+        FUNCTION_LOG_PARAM(STRING, restoreName);
+    FUNCTION_LOG_END();
+
+    ASSERT(manifest != NULL);
+    ASSERT(file != NULL);
+    ASSERT(restoreName != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StorageWrite *write = storageNewWriteP(
+            storageLocalWrite(), strNewFmt("%s/%s", strZ(cfgOptionStr(cfgOptRelationPath)), strZ(restoreName)));
+
+        // Write an empty file when there is nothing to read
+        if (size == 0)
+            storagePutP(write, NULL);
+        else
+        {
+            // Read the range from the backup that contains the file
+            const CompressType compressType = manifestData(manifest)->backupOptionCompressType;
+
+            StorageRead *read = storageNewReadRangeP(
+                storageRepo(),
+                strNewFmt(
+                    STORAGE_REPO_BACKUP "/%s/%s%s",
+                    strZ(file->reference != NULL ? file->reference : manifestData(manifest)->backupLabel),
+                    strZ(file->referenceName != NULL ? file->referenceName : file->name), strZ(compressExtStr(compressType))),
+                offset, size, .compressType = compressType, .cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType)),
+                .cipherPass = manifestCipherSubPass(manifest));
+
+            // The checksum can only be verified when the entire file is restored
+            const bool checksum = offset == 0 && size == file->size;
+
+            if (checksum)
+                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cryptoHashNew(HASH_TYPE_SHA1_STR));
+
+            // Else verify page checksums of the restored blocks if the backup verified them. The page number offset is the segment
+            // number multiplied by the segment page total so pass the first block with a page total of one.
+            const bool checksumPage = !checksum && file->checksumPage;
+
+            if (checksumPage)
+            {
+                ioFilterGroupAdd(
+                    ioReadFilterGroup(storageReadIo(read)),
+                    pageChecksumNew(
+                        (unsigned int)(segmentNo * PG_SEGMENT_PAGE_DEFAULT + offset / PG_PAGE_SIZE_DEFAULT), 1,
+                        manifestData(manifest)->backupOptionOnline ?
+                            pgLsnFromStr(manifestData(manifest)->lsnStart) : 0xFFFFFFFFFFFFFFFF));
+            }
+
+            storageCopyP(read, write);
+
+            if (checksum)
+            {
+                const String *actual = varStr(
+                    ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), CRYPTO_HASH_FILTER_TYPE_STR));
+
+                if (!strEqZ(actual, file->checksumSha1))
+                {
+                    THROW_FMT(
+                        ChecksumError, "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'",
+                        strZ(manifestPathPg(file->name)), strZ(actual), file->checksumSha1);
+                }
+            }
+
+            if (checksumPage)
+            {
+                const KeyValue *result = varKv(
+                    ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), PAGE_CHECKSUM_FILTER_TYPE_STR));
+
+                if (!varBool(kvGet(result, VARSTRDEF("valid"))))
+                {
+                    // Format the invalid blocks, e.g. 1, 3-5
+                    String *error = strNew("");
+                    const Variant *errorVar = kvGet(result, VARSTRDEF("error"));
+
+                    if (errorVar == NULL)
+                        strCatZ(error, "page misalignment");
+                    else
+                    {
+                        const VariantList *errorList = varVarLst(errorVar);
+
+                        strCatZ(error, "invalid page checksum in relation block(s) ");
+
+                        for (unsigned int errorIdx = 0; errorIdx < varLstSize(errorList); errorIdx++)
+                        {
+                            const Variant *errorItem = varLstGet(errorList, errorIdx);
+
+                            if (errorIdx != 0)
+                                strCatZ(error, ", ");
+
+                            if (varType(errorItem) == varTypeVariantList)
+                            {
+                                strCatFmt(
+                                    error, "%u-%u", varUInt(varLstGet(varVarLst(errorItem), 0)),
+                                    varUInt(varLstGet(varVarLst(errorItem), 1)));
+                            }
+                            else
+                                strCatFmt(error, "%u", varUInt(errorItem));
+                        }
+                    }
+
+                    // Errors the backup already reported are expected so only warn about them
+                    if (file->checksumPageError)
+                        LOG_WARN_FMT("restored '%s' with %s", strZ(restoreName), strZ(error));
+                    else
+                        THROW_FMT(ChecksumError, "error restoring '%s': %s", strZ(restoreName), strZ(error));
+                }
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+cmdRelationRestore(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Parse relations before accessing the repository so invalid parameters are reported quickly
+        if (strLstSize(cfgCommandParam()) == 0)
+            THROW(ParamRequiredError, "relation to restore required");
+
+        List *relationList = lstNewP(sizeof(RelationRestoreParam));
+
+        for (unsigned int paramIdx = 0; paramIdx < strLstSize(cfgCommandParam()); paramIdx++)
+        {
+            RelationRestoreParam relation = relationRestoreParam(strLstGet(cfgCommandParam(), paramIdx));
+            lstAdd(relationList, &relation);
+        }
+
+        // Load backup.info
+        InfoBackup *infoBackup = infoBackupLoadFile(
+            storageRepo(), INFO_BACKUP_PATH_FILE_STR, cipherType(cfgOptionStr(cfgOptRepoCipherType)),
+            cfgOptionStrNull(cfgOptRepoCipherPass));
+
+        // Get the backup set
+        const String *backupSet = NULL;
+
+        if (cfgOptionSource(cfgOptSet) == cfgSourceDefault)
+        {
+            if (infoBackupDataTotal(infoBackup) == 0)
+                THROW(BackupSetInvalidError, "no backup sets to restore");
+
+            backupSet = infoBackupData(infoBackup, infoBackupDataTotal(infoBackup) - 1).backupLabel;
+        }
+        else
+        {
+            backupSet = cfgOptionStr(cfgOptSet);
+
+            if (infoBackupDataByLabel(infoBackup, backupSet) == NULL)
+                THROW_FMT(BackupSetInvalidError, "backup set %s is not valid", strZ(backupSet));
+        }
+
+        // Load manifest
+        const Manifest *manifest = manifestLoadFile(
+            storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE, strZ(backupSet)),
+            cipherType(cfgOptionStr(cfgOptRepoCipherType)), infoPgCipherPass(infoBackupPg(infoBackup)));
+
+        LOG_INFO_FMT("restore relations from backup set %s", strZ(backupSet));
+
+        // Restore each relation
+        for (unsigned int relationIdx = 0; relationIdx < lstSize(relationList); relationIdx++)
+        {
+            const RelationRestoreParam *relation = lstGet(relationList, relationIdx);
+            bool found = false;
+            bool restored = false;
+
+            for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(manifest); fileIdx++)
+            {
+                const ManifestFile *file = manifestFile(manifest, fileIdx);
+                uint64_t segmentNo = 0;
+
+                if (!relationRestoreSegment(relation->name, file->name, &segmentNo))
+                    continue;
+
+                found = true;
+
+                // Restore the entire segment unless a block range was requested
+                uint64_t offset = 0;
+                uint64_t size = file->size;
+                const String *restoreName = manifestPathPg(file->name);
+
+                if (relation->blockRange)
+                {
+                    // Skip the segment if it does not contain any blocks in the range
+                    const uint64_t segmentFirst = segmentNo * PG_SEGMENT_PAGE_DEFAULT;
+                    const uint64_t segmentTotal = (file->size + PG_PAGE_SIZE_DEFAULT - 1) / PG_PAGE_SIZE_DEFAULT;
+
+                    if (relation->blockLast < segmentFirst || relation->blockFirst >= segmentFirst + segmentTotal)
+                        continue;
+
+                    const uint64_t blockFirst = relation->blockFirst > segmentFirst ? relation->blockFirst : segmentFirst;
+                    const uint64_t segmentLast = segmentFirst + segmentTotal - 1;
+                    const uint64_t blockLast = relation->blockLast < segmentLast ? relation->blockLast : segmentLast;
+
+                    offset = (blockFirst - segmentFirst) * PG_PAGE_SIZE_DEFAULT;
+                    size = (blockLast - blockFirst + 1) * PG_PAGE_SIZE_DEFAULT;
+
+                    // Blocks are not written at their offsets in the segment so give the file a name that cannot be mistaken for
+                    // the segment, e.g. base/1/16384.1.blocks-10-20 where the block numbers are relative to the segment
+                    restoreName = strNewFmt(
+                        "%s.blocks-%" PRIu64 "-%" PRIu64, strZ(manifestPathPg(file->name)), blockFirst - segmentFirst,
+                        blockLast - segmentFirst);
+                }
+
+                LOG_INFO_FMT("restore file %s (%s)", strZ(restoreName), strZ(strSizeFormat(size)));
+
+                relationRestoreFile(manifest, file, segmentNo, offset, size, restoreName);
+                restored = true;
+            }
+
+            if (!found)
+            {
+                THROW_FMT(
+                    FileMissingError, "relation '%s' does not exist in backup set %s", strZ(manifestPathPg(relation->name)),
+                    strZ(backupSet));
+            }
+
+            if (!restored)
+                LOG_WARN_FMT("relation '%s' does not contain the requested blocks", strZ(manifestPathPg(relation->name)));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
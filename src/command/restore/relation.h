@@ -0,0 +1,13 @@
+/***********************************************************************************************************************************
+Relation Restore Command
+***********************************************************************************************************************************/
+#ifndef COMMAND_RESTORE_RELATION_H
+#define COMMAND_RESTORE_RELATION_H
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Restore relation files (or block ranges of relation files) from a backup set to relation-path
+void cmdRelationRestore(void);
+
+#endif
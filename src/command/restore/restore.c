@@ -8,12 +8,14 @@ Restore Command
 #include <time.h>
 #include <unistd.h>
 
+#include "command/restore/clean.h"
 #include "command/restore/protocol.h"
 #include "command/restore/restore.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/regExp.h"
+#include "common/time.h"
 #include "common/user.h"
 #include "config/config.h"
 #include "config/exec.h"
@@ -27,6 +29,11 @@ Restore Command
 #include "storage/write.intern.h"
 #include "version.h"
 
+/***********************************************************************************************************************************
+Interval between restore throughput log messages
+***********************************************************************************************************************************/
+#define RESTORE_PROGRESS_INTERVAL                                   (10 * MSEC_PER_SEC)
+
 /***********************************************************************************************************************************
 Recovery constants
 ***********************************************************************************************************************************/
@@ -656,228 +663,141 @@ restoreManifestOwner(Manifest *manifest)
 
 /***********************************************************************************************************************************
 Clean the data directory of any paths/files/links that are not in the manifest and create missing links/paths
+
+The targets are checked and created here but the paths are cleaned by jobs that run in the local processes. Each path is cleaned by
+its own job after the path that contains it has been cleaned. Files are restored into a path as soon as the path has been cleaned so
+the clean runs in parallel with the file restores.
 ***********************************************************************************************************************************/
 typedef struct RestoreCleanCallbackData
 {
-    const Manifest *manifest;                                       // Manifest to compare against
     const ManifestTarget *target;                                   // Current target being compared
     const String *targetName;                                       // Name to use when finding files/paths/links
     const String *targetPath;                                       // Path of target currently being compared
-    const String *subPath;                                          // Subpath in target currently being compared
     bool basePath;                                                  // Is this the base path?
     bool exists;                                                    // Does the target path exist?
-    bool delta;                                                     // Is this a delta restore?
     StringList *fileIgnore;                                         // Files to ignore during clean
 } RestoreCleanCallbackData;
 
-// Helper to update ownership on a file/link/path
+typedef struct RestoreCleanPath
+{
+    const String *name;                                             // Manifest name of the path
+    const String *pgPath;                                           // Path to clean
+    const String *parent;                                           // Path that must be cleaned first (NULL when none)
+    const StringList *fileIgnore;                                   // Files to ignore during clean
+    List *entryList;                                                // Files/links/paths expected in the path
+    List *childList;                                                // Paths waiting for this path to be cleaned
+    List *fileList;                                                 // Files waiting for this path to be cleaned
+    bool clean;                                                     // Has the path been cleaned?
+} RestoreCleanPath;
+
+// storageInfoList() callback that errors when a target path is not empty
 static void
-restoreCleanOwnership(
-    const String *pgPath, const String *manifestUserName, const String *manifestGroupName, uid_t actualUserId, gid_t actualGroupId,
-    bool new)
+restoreCleanInfoListCallback(void *data, const StorageInfo *info)
 {
     FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM(STRING, pgPath);
-        FUNCTION_TEST_PARAM(STRING, manifestUserName);
-        FUNCTION_TEST_PARAM(STRING, manifestGroupName);
-        FUNCTION_TEST_PARAM(UINT, actualUserId);
-        FUNCTION_TEST_PARAM(UINT, actualGroupId);
-        FUNCTION_TEST_PARAM(BOOL, new);
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
     FUNCTION_TEST_END();
 
-    ASSERT(pgPath != NULL);
+    ASSERT(data != NULL);
+    ASSERT(info != NULL);
 
-    // Get the expected user id
-    uid_t expectedUserId = userId();
+    RestoreCleanCallbackData *cleanData = (RestoreCleanCallbackData *)data;
 
-    if (manifestUserName != NULL)
+    // Don't include backup.manifest or recovery.conf (when preserved) in the empty directory check
+    if (cleanData->basePath && info->type == storageTypeFile && strLstExists(cleanData->fileIgnore, info->name))
     {
-        uid_t manifestUserId = userIdFromName(manifestUserName);
-
-        if (manifestUserId != (uid_t)-1)
-            expectedUserId = manifestUserId;
+        FUNCTION_TEST_RETURN_VOID();
+        return;
     }
 
-    // Get the expected group id
-    gid_t expectedGroupId = groupId();
-
-    if (manifestGroupName != NULL)
+    // Ignore the . path
+    if (strEq(info->name, DOT_STR))
     {
-        uid_t manifestGroupId = groupIdFromName(manifestGroupName);
-
-        if (manifestGroupId != (uid_t)-1)
-            expectedGroupId = manifestGroupId;
+        FUNCTION_TEST_RETURN_VOID();
+        return;
     }
 
-    // Update ownership if not as expected
-    if (actualUserId != expectedUserId || actualGroupId != expectedGroupId)
-    {
-        // If this is a newly created file/link/path then there's no need to log updated permissions
-        if (!new)
-            LOG_DETAIL_FMT("update ownership for '%s'", strZ(pgPath));
-
-        THROW_ON_SYS_ERROR_FMT(
-            lchown(strZ(pgPath), expectedUserId, expectedGroupId) == -1, FileOwnerError, "unable to set ownership for '%s'",
-            strZ(pgPath));
-    }
+    THROW_FMT(
+        PathNotEmptyError,
+        "unable to restore to path '%s' because it contains files\n"
+        "HINT: try using --delta if this is what you intended.",
+        strZ(cleanData->targetPath));
 
     FUNCTION_TEST_RETURN_VOID();
 }
 
-// Helper to update mode on a file/path
+// Helper to add a path to clean
 static void
-restoreCleanMode(const String *pgPath, mode_t manifestMode, const StorageInfo *info)
+restoreCleanPathAdd(
+    List *cleanPathList, const String *name, const String *pgPath, const String *parent, const StringList *fileIgnore)
 {
     FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, cleanPathList);
+        FUNCTION_TEST_PARAM(STRING, name);
         FUNCTION_TEST_PARAM(STRING, pgPath);
-        FUNCTION_TEST_PARAM(MODE, manifestMode);
-        FUNCTION_TEST_PARAM(INFO, info);
+        FUNCTION_TEST_PARAM(STRING, parent);
+        FUNCTION_TEST_PARAM(STRING_LIST, fileIgnore);
     FUNCTION_TEST_END();
 
+    ASSERT(cleanPathList != NULL);
+    ASSERT(name != NULL);
     ASSERT(pgPath != NULL);
-    ASSERT(info != NULL);
 
-    // Update mode if not as expected
-    if (manifestMode != info->mode)
+    MEM_CONTEXT_BEGIN(lstMemContext(cleanPathList))
     {
-        LOG_DETAIL_FMT("update mode for '%s' to %04o", strZ(pgPath), manifestMode);
-
-        THROW_ON_SYS_ERROR_FMT(
-            chmod(strZ(pgPath), manifestMode) == -1, FileOwnerError, "unable to set mode for '%s'", strZ(pgPath));
+        RestoreCleanPath cleanPath =
+        {
+            .name = strDup(name),
+            .pgPath = strDup(pgPath),
+            .parent = strDup(parent),
+            .fileIgnore = strLstDup(fileIgnore),
+            .entryList = lstNewP(sizeof(RestoreCleanEntry)),
+            .childList = lstNewP(sizeof(unsigned int)),
+            .fileList = lstNewP(sizeof(ManifestFile *)),
+        };
+
+        lstAdd(cleanPathList, &cleanPath);
     }
+    MEM_CONTEXT_END();
 
     FUNCTION_TEST_RETURN_VOID();
 }
 
-// storageInfoList() callback that cleans the paths
+// Helper to add an entry to the path that contains it. Entries that are not contained by a path to clean are skipped, e.g. the
+// tablespace paths that only map to the manifest.
 static void
-restoreCleanInfoListCallback(void *data, const StorageInfo *info)
+restoreCleanEntryAdd(List *cleanPathList, const String *manifestName, RestoreCleanEntry entry)
 {
     FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM_P(VOID, data);
-        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
+        FUNCTION_TEST_PARAM(LIST, cleanPathList);
+        FUNCTION_TEST_PARAM(STRING, manifestName);
     FUNCTION_TEST_END();
 
-    ASSERT(data != NULL);
-    ASSERT(info != NULL);
-
-    RestoreCleanCallbackData *cleanData = (RestoreCleanCallbackData *)data;
-
-    // Don't include backup.manifest or recovery.conf (when preserved) in the comparison or empty directory check
-    if (cleanData->basePath && info->type == storageTypeFile && strLstExists(cleanData->fileIgnore, info->name))
-    {
-        FUNCTION_TEST_RETURN_VOID();
-        return;
-    }
-
-    // Skip all . paths because they have already been cleaned on the previous level of recursion
-    if (strEq(info->name, DOT_STR))
-    {
-        FUNCTION_TEST_RETURN_VOID();
-        return;
-    }
-
-    // If this is not a delta then error because the directory is expected to be empty.  Ignore the . path.
-    if (!cleanData->delta)
-    {
-        THROW_FMT(
-            PathNotEmptyError,
-            "unable to restore to path '%s' because it contains files\n"
-            "HINT: try using --delta if this is what you intended.",
-            strZ(cleanData->targetPath));
-    }
-
-    // Construct the name used to find this file/link/path in the manifest
-    const String *manifestName = strNewFmt("%s/%s", strZ(cleanData->targetName), strZ(info->name));
-
-    // Construct the path of this file/link/path in the PostgreSQL data directory
-    const String *pgPath = strNewFmt("%s/%s", strZ(cleanData->targetPath), strZ(info->name));
+    ASSERT(cleanPathList != NULL);
+    ASSERT(manifestName != NULL);
 
-    switch (info->type)
+    MEM_CONTEXT_TEMP_BEGIN()
     {
-        case storageTypeFile:
-        {
-            const ManifestFile *manifestFile = manifestFileFindDefault(cleanData->manifest, manifestName, NULL);
-
-            if (manifestFile != NULL)
-            {
-                restoreCleanOwnership(pgPath, manifestFile->user, manifestFile->group, info->userId, info->groupId, false);
-                restoreCleanMode(pgPath, manifestFile->mode, info);
-            }
-            else
-            {
-                LOG_DETAIL_FMT("remove invalid file '%s'", strZ(pgPath));
-                storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
-            }
-
-            break;
-        }
-
-        case storageTypeLink:
-        {
-            const ManifestLink *manifestLink = manifestLinkFindDefault(cleanData->manifest, manifestName, NULL);
-
-            if (manifestLink != NULL)
-            {
-                if (!strEq(manifestLink->destination, info->linkDestination))
-                {
-                    LOG_DETAIL_FMT("remove link '%s' because destination changed", strZ(pgPath));
-                    storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
-                }
-                else
-                    restoreCleanOwnership(pgPath, manifestLink->user, manifestLink->group, info->userId, info->groupId, false);
-            }
-            else
-            {
-                LOG_DETAIL_FMT("remove invalid link '%s'", strZ(pgPath));
-                storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
-            }
-
-            break;
-        }
+        const String *parent = strPath(manifestName);
+        RestoreCleanPath *cleanPath = lstFind(cleanPathList, &parent);
 
-        case storageTypePath:
+        if (cleanPath != NULL)
         {
-            const ManifestPath *manifestPath = manifestPathFindDefault(cleanData->manifest, manifestName, NULL);
-
-            if (manifestPath != NULL)
+            MEM_CONTEXT_BEGIN(lstMemContext(cleanPath->entryList))
             {
-                // Check ownership/permissions
-                restoreCleanOwnership(pgPath, manifestPath->user, manifestPath->group, info->userId, info->groupId, false);
-                restoreCleanMode(pgPath, manifestPath->mode, info);
-
-                // Recurse into the path
-                RestoreCleanCallbackData cleanDataSub = *cleanData;
-                cleanDataSub.targetName = strNewFmt("%s/%s", strZ(cleanData->targetName), strZ(info->name));
-                cleanDataSub.targetPath = strNewFmt("%s/%s", strZ(cleanData->targetPath), strZ(info->name));
-                cleanDataSub.basePath = false;
-
-                storageInfoListP(
-                    storageLocalWrite(), cleanDataSub.targetPath, restoreCleanInfoListCallback, &cleanDataSub,
-                    .errorOnMissing = true, .sortOrder = sortOrderAsc);
+                entry.name = strBase(manifestName);
+                lstAdd(cleanPath->entryList, &entry);
             }
-            else
-            {
-                LOG_DETAIL_FMT("remove invalid path '%s'", strZ(pgPath));
-                storagePathRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true, .recurse = true);
-            }
-
-            break;
-        }
-
-        // Special file types cannot exist in the manifest so just delete them
-        case storageTypeSpecial:
-        {
-            LOG_DETAIL_FMT("remove special file '%s'", strZ(pgPath));
-            storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
-            break;
+            MEM_CONTEXT_END();
         }
     }
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_TEST_RETURN_VOID();
 }
 
-static void
+static List *
 restoreCleanBuild(Manifest *manifest)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
@@ -886,6 +806,8 @@ restoreCleanBuild(Manifest *manifest)
 
     ASSERT(manifest != NULL);
 
+    List *result = NULL;
+
     MEM_CONTEXT_TEMP_BEGIN()
     {
         // Is this a delta restore?
@@ -904,9 +826,7 @@ restoreCleanBuild(Manifest *manifest)
 
             *cleanData = (RestoreCleanCallbackData)
             {
-                .manifest = manifest,
                 .target = manifestTarget(manifest, targetIdx),
-                .delta = delta,
                 .fileIgnore = strLstNew(),
             };
 
@@ -973,7 +893,7 @@ restoreCleanBuild(Manifest *manifest)
                 }
 
                 // If not a delta restore then check that the directories are empty, or if a file link, that the file doesn't exist
-                if (!cleanData->delta)
+                if (!delta)
                 {
                     if (cleanData->target->file == NULL)
                     {
@@ -994,9 +914,6 @@ restoreCleanBuild(Manifest *manifest)
                                 strZ(file));
                         }
                     }
-
-                    // Now that we know there are no files in this target enable delta for processing in step 2
-                    cleanData->delta = true;
                 }
 
                 // The target directory exists and is valid and will need to be cleaned
@@ -1049,18 +966,13 @@ restoreCleanBuild(Manifest *manifest)
                     if (delta)
                         LOG_INFO_FMT("remove invalid files/links/paths from '%s'", strZ(cleanData->targetPath));
 
-                    // Check target ownership/permissions
-                    const ManifestPath *manifestPath = manifestPathFind(cleanData->manifest, cleanData->targetName);
+                    // Check target ownership/permissions. The target is cleaned by a restore job.
+                    const ManifestPath *manifestPath = manifestPathFind(manifest, cleanData->targetName);
                     StorageInfo info = storageInfoP(storageLocal(), cleanData->targetPath, .followLink = true);
 
                     restoreCleanOwnership(
-                        cleanData->targetPath, manifestPath->user, manifestPath->group, info.userId, info.groupId, false);
-                    restoreCleanMode(cleanData->targetPath, manifestPath->mode, &info);
-
-                    // Clean the target
-                    storageInfoListP(
-                        storageLocalWrite(), cleanData->targetPath, restoreCleanInfoListCallback, cleanData, .errorOnMissing = true,
-                        .sortOrder = sortOrderAsc);
+                        cleanData->targetPath, manifestPath->user, manifestPath->group, info.userId, info.groupId, false, NULL);
+                    restoreCleanMode(cleanData->targetPath, manifestPath->mode, &info, NULL);
                 }
             }
             // If the target does not exist we'll attempt to create it
@@ -1078,12 +990,44 @@ restoreCleanBuild(Manifest *manifest)
                     path = manifestPathFind(manifest, cleanData->target->name);
 
                 storagePathCreateP(storageLocalWrite(), cleanData->targetPath, .mode = path->mode);
-                restoreCleanOwnership(cleanData->targetPath, path->user, path->group, userId(), groupId(), true);
+                restoreCleanOwnership(cleanData->targetPath, path->user, path->group, userId(), groupId(), true, NULL);
             }
         }
 
-        // Step 3: Create missing paths and path links
+        // Step 3: Build the list of paths to clean. Link targets are cleaned after the path containing the link since the link is
+        // created when that path is cleaned.
         // -------------------------------------------------------------------------------------------------------------------------
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = lstNewP(sizeof(RestoreCleanPath), .comparator = lstComparatorStr);
+        }
+        MEM_CONTEXT_PRIOR_END();
+
+        for (unsigned int targetIdx = 0; targetIdx < manifestTargetTotal(manifest); targetIdx++)
+        {
+            RestoreCleanCallbackData *cleanData = &cleanDataList[targetIdx];
+
+            // File links are not cleaned since the link is in a path that is cleaned
+            if (cleanData->target->file != NULL)
+                continue;
+
+            const String *parent = NULL;
+
+            if (!cleanData->basePath)
+            {
+                parent = cleanData->target->tablespaceId != 0 ?
+                    STRDEF(MANIFEST_TARGET_PGDATA "/" MANIFEST_TARGET_PGTBLSPC) : strPath(cleanData->target->name);
+            }
+
+            restoreCleanPathAdd(
+                result, cleanData->targetName, cleanData->targetPath, parent, cleanData->basePath ? cleanData->fileIgnore : NULL);
+        }
+
+        lstSort(result, sortOrderAsc);
+
+        // Add paths that are not targets
+        StringList *pathAddList = strLstNew();
+
         for (unsigned int pathIdx = 0; pathIdx < manifestPathTotal(manifest); pathIdx++)
         {
             const ManifestPath *path = manifestPath(manifest, pathIdx);
@@ -1093,71 +1037,80 @@ restoreCleanBuild(Manifest *manifest)
             if (strEq(path->name, MANIFEST_TARGET_PGTBLSPC_STR))
                 continue;
 
-            // If this path has been mapped as a link then create a link.  The path has already been created as part of target
-            // creation (or it might have already existed).
-            const ManifestLink *link = manifestLinkFindDefault(
-                manifest,
-                strBeginsWith(path->name, MANIFEST_TARGET_PGTBLSPC_STR) ?
-                    strNewFmt(MANIFEST_TARGET_PGDATA "/%s", strZ(path->name)) : path->name,
-                NULL);
+            // Skip paths that are targets
+            if (lstFind(result, &path->name) != NULL)
+                continue;
 
-            if (link != NULL)
+            // Skip paths that have been mapped as a link but are not targets, i.e. tablespace paths that contain the target
+            if (manifestLinkFindDefault(
+                    manifest,
+                    strBeginsWith(path->name, MANIFEST_TARGET_PGTBLSPC_STR) ?
+                        strNewFmt(MANIFEST_TARGET_PGDATA "/%s", strZ(path->name)) : path->name,
+                    NULL) != NULL)
             {
-                const String *pgPath = storagePathP(storagePg(), manifestPathPg(link->name));
-                StorageInfo linkInfo = storageInfoP(storagePg(), pgPath, .ignoreMissing = true);
+                continue;
+            }
 
-                // Create the link if it is missing.  If it exists it should already have the correct ownership and destination.
-                if (!linkInfo.exists)
-                {
-                    LOG_DETAIL_FMT("create symlink '%s' to '%s'", strZ(pgPath), strZ(link->destination));
+            strLstAdd(pathAddList, path->name);
+        }
 
-                    THROW_ON_SYS_ERROR_FMT(
-                        symlink(strZ(link->destination), strZ(pgPath)) == -1, FileOpenError,
-                        "unable to create symlink '%s' to '%s'", strZ(pgPath), strZ(link->destination));
-                    restoreCleanOwnership(pgPath, link->user, link->group, userId(), groupId(), true);
-                }
-            }
-            // Create the path normally
-            else
-            {
-                const String *pgPath = storagePathP(storagePg(), manifestPathPg(path->name));
-                StorageInfo pathInfo = storageInfoP(storagePg(), pgPath, .ignoreMissing = true);
+        for (unsigned int pathIdx = 0; pathIdx < strLstSize(pathAddList); pathIdx++)
+        {
+            const String *name = strLstGet(pathAddList, pathIdx);
 
-                // Create the path if it is missing  If it exists it should already have the correct ownership and mode.
-                if (!pathInfo.exists)
-                {
-                    LOG_DETAIL_FMT("create path '%s'", strZ(pgPath));
+            restoreCleanPathAdd(result, name, storagePathP(storagePg(), manifestPathPg(name)), strPath(name), NULL);
+        }
 
-                    storagePathCreateP(storagePgWrite(), pgPath, .mode = path->mode, .noParentCreate = true, .errorOnExists = true);
-                    restoreCleanOwnership(storagePathP(storagePg(), pgPath), path->user, path->group, userId(), groupId(), true);
-                }
-            }
+        lstSort(result, sortOrderAsc);
+
+        // Add the files/links/paths expected in each path
+        for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(manifest); fileIdx++)
+        {
+            const ManifestFile *file = manifestFile(manifest, fileIdx);
+
+            restoreCleanEntryAdd(
+                result, file->name,
+                (RestoreCleanEntry){.type = storageTypeFile, .mode = file->mode, .user = file->user, .group = file->group});
         }
 
-        // Step 4: Create file links.  These don't get created during path creation because they do not have a matching path entry.
-        // -------------------------------------------------------------------------------------------------------------------------
         for (unsigned int linkIdx = 0; linkIdx < manifestLinkTotal(manifest); linkIdx++)
         {
             const ManifestLink *link = manifestLink(manifest, linkIdx);
 
-            const String *pgPath = storagePathP(storagePg(), manifestPathPg(link->name));
-            StorageInfo linkInfo = storageInfoP(storagePg(), pgPath, .ignoreMissing = true);
+            restoreCleanEntryAdd(
+                result, link->name,
+                (RestoreCleanEntry){
+                    .type = storageTypeLink, .user = link->user, .group = link->group, .destination = link->destination});
+        }
+
+        for (unsigned int pathIdx = 0; pathIdx < manifestPathTotal(manifest); pathIdx++)
+        {
+            const ManifestPath *path = manifestPath(manifest, pathIdx);
+
+            restoreCleanEntryAdd(
+                result, path->name,
+                (RestoreCleanEntry){.type = storageTypePath, .mode = path->mode, .user = path->user, .group = path->group});
+        }
 
-            // Create the link if it is missing.  If it exists it should already have the correct ownership and destination.
-            if (!linkInfo.exists)
+        // Link each path to the path that must be cleaned first. If that path is not cleaned then there is nothing to wait for.
+        for (unsigned int cleanPathIdx = 0; cleanPathIdx < lstSize(result); cleanPathIdx++)
+        {
+            RestoreCleanPath *cleanPath = lstGet(result, cleanPathIdx);
+
+            if (cleanPath->parent != NULL)
             {
-                LOG_DETAIL_FMT("create symlink '%s' to '%s'", strZ(pgPath), strZ(link->destination));
+                RestoreCleanPath *cleanPathParent = lstFind(result, &cleanPath->parent);
 
-                THROW_ON_SYS_ERROR_FMT(
-                    symlink(strZ(link->destination), strZ(pgPath)) == -1, FileOpenError,
-                    "unable to create symlink '%s' to '%s'", strZ(pgPath), strZ(link->destination));
-                restoreCleanOwnership(pgPath, link->user, link->group, userId(), groupId(), true);
+                if (cleanPathParent != NULL)
+                    lstAdd(cleanPathParent->childList, &cleanPathIdx);
+                else
+                    cleanPath->parent = NULL;
             }
         }
     }
     MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_LOG_RETURN_VOID();
+    FUNCTION_LOG_RETURN(LIST, result);
 }
 
 /***********************************************************************************************************************************
@@ -1862,56 +1815,68 @@ restoreJobResult(const Manifest *manifest, ProtocolParallelJob *job, RegExp *zer
     {
         MEM_CONTEXT_TEMP_BEGIN()
         {
-            const ManifestFile *file = manifestFileFind(manifest, varStr(protocolParallelJobKey(job)));
-            bool zeroed = restoreFileZeroed(file->name, zeroExp);
-            bool copy = varBool(protocolParallelJobResult(job));
+            // Log changes made by a clean job
+            if (varType(protocolParallelJobKey(job)) == varTypeUInt)
+            {
+                const VariantList *logList = varVarLst(protocolParallelJobResult(job));
 
-            String *log = strNew("restore");
+                for (unsigned int logIdx = 0; logIdx < varLstSize(logList); logIdx++)
+                    LOG_PID(logLevelDetail, protocolParallelJobProcessId(job), 0, strZ(varStr(varLstGet(logList, logIdx))));
+            }
+            // Else log the restored file
+            else
+            {
+                const ManifestFile *file = manifestFileFind(manifest, varStr(protocolParallelJobKey(job)));
+                bool zeroed = restoreFileZeroed(file->name, zeroExp);
+                bool copy = varBool(protocolParallelJobResult(job));
 
-            // Note if file was zeroed (i.e. selective restore)
-            if (zeroed)
-                strCatZ(log, " zeroed");
+                String *log = strNew("restore");
 
-            // Add filename
-            strCatFmt(log, " file %s", strZ(restoreFilePgPath(manifest, file->name)));
+                // Note if file was zeroed (i.e. selective restore)
+                if (zeroed)
+                    strCatZ(log, " zeroed");
 
-            // If not copied and not zeroed add details to explain why it was not copied
-            if (!copy && !zeroed)
-            {
-                strCatZ(log, " - ");
+                // Add filename
+                strCatFmt(log, " file %s", strZ(restoreFilePgPath(manifest, file->name)));
 
-                // On force we match on size and modification time
-                if (cfgOptionBool(cfgOptForce))
+                // If not copied and not zeroed add details to explain why it was not copied
+                if (!copy && !zeroed)
                 {
-                    strCatFmt(
-                        log, "exists and matches size %" PRIu64 " and modification time %" PRIu64, file->size,
-                        (uint64_t)file->timestamp);
-                }
-                // Else a checksum delta or file is zero-length
-                else
-                {
-                    strCatZ(log, "exists and ");
+                    strCatZ(log, " - ");
 
-                    // No need to copy zero-length files
-                    if (file->size == 0)
+                    // On force we match on size and modification time
+                    if (cfgOptionBool(cfgOptForce))
                     {
-                        strCatZ(log, "is zero size");
+                        strCatFmt(
+                            log, "exists and matches size %" PRIu64 " and modification time %" PRIu64, file->size,
+                            (uint64_t)file->timestamp);
                     }
-                    // The file matched the manifest checksum so did not need to be copied
+                    // Else a checksum delta or file is zero-length
                     else
-                        strCatZ(log, "matches backup");
+                    {
+                        strCatZ(log, "exists and ");
+
+                        // No need to copy zero-length files
+                        if (file->size == 0)
+                        {
+                            strCatZ(log, "is zero size");
+                        }
+                        // The file matched the manifest checksum so did not need to be copied
+                        else
+                            strCatZ(log, "matches backup");
+                    }
                 }
-            }
 
-            // Add size and percent complete
-            sizeRestored += file->size;
-            strCatFmt(log, " (%s, %" PRIu64 "%%)", strZ(strSizeFormat(file->size)), sizeRestored * 100 / sizeTotal);
+                // Add size and percent complete
+                sizeRestored += file->size;
+                strCatFmt(log, " (%s, %" PRIu64 "%%)", strZ(strSizeFormat(file->size)), sizeRestored * 100 / sizeTotal);
 
-            // If not zero-length add the checksum
-            if (file->size != 0 && !zeroed)
-                strCatFmt(log, " checksum %s", file->checksumSha1);
+                // If not zero-length add the checksum
+                if (file->size != 0 && !zeroed)
+                    strCatFmt(log, " checksum %s", file->checksumSha1);
 
-            LOG_PID(copy ? logLevelInfo : logLevelDetail, protocolParallelJobProcessId(job), 0, strZ(log));
+                LOG_PID(copy ? logLevelInfo : logLevelDetail, protocolParallelJobProcessId(job), 0, strZ(log));
+            }
         }
         MEM_CONTEXT_TEMP_END();
 
@@ -1925,6 +1890,48 @@ restoreJobResult(const Manifest *manifest, ProtocolParallelJob *job, RegExp *zer
     FUNCTION_LOG_RETURN(UINT64, sizeRestored);
 }
 
+/***********************************************************************************************************************************
+Sync all restored files when sync-batch is enabled. Files are restored without being synced so the filesystem can write back data
+for many files at once, then the filesystem containing each target is synced in a single call. Targets on the same filesystem are
+synced more than once but the later syncs have little left to write.
+***********************************************************************************************************************************/
+static void
+restoreSyncBatch(const Manifest *manifest)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, manifest);
+    FUNCTION_LOG_END();
+
+    ASSERT(manifest != NULL);
+
+    TimeMSec timeBegin = timeMSec();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StringList *pathSynced = strLstNew();
+
+        for (unsigned int targetIdx = 0; targetIdx < manifestTargetTotal(manifest); targetIdx++)
+        {
+            const String *pgPath = manifestTargetPath(manifest, manifestTarget(manifest, targetIdx));
+
+            // Don't sync the same path twice, e.g. multiple file links in the same path
+            if (strLstExists(pathSynced, pgPath))
+                continue;
+
+            strLstAdd(pathSynced, pgPath);
+            storagePathSyncP(storageLocalWrite(), pgPath, .fileSystem = true);
+        }
+
+        // Report time spent syncing separately from time spent restoring files
+        LOG_DETAIL_FMT(
+            "sync %u file(s) on %u target(s) in %" PRIu64 "ms", manifestFileTotal(manifest), strLstSize(pathSynced),
+            timeMSec() - timeBegin);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Return new restore jobs as requested
 ***********************************************************************************************************************************/
@@ -1933,7 +1940,14 @@ typedef struct RestoreJobData
     Manifest *manifest;                                             // Backup manifest
     List *queueList;                                                // List of processing queues
     RegExp *zeroExp;                                                // Identify files that should be sparse zeroed
+    RegExp *sparseExp;                                              // Identify relation files that can be restored as sparse
+    CipherType cipherType;                                          // Cipher type of the repo
     const String *cipherSubPass;                                    // Passphrase used to decrypt files in the backup
+    List *cleanPathList;                                            // Paths to clean
+    List *cleanQueue;                                               // Paths ready to be cleaned
+    List *cleanJobList;                                             // Clean jobs that are running
+    List *fileReadyList;                                            // Files that were waiting for a path to be cleaned
+    bool syncBatch;                                                 // Sync target filesystems after all files are restored?
 } RestoreJobData;
 
 // Helper to caculate the next queue to scan based on the client index
@@ -1958,6 +1972,194 @@ restoreJobQueueNext(unsigned int clientIdx, int queueIdx, unsigned int queueTota
     FUNCTION_TEST_RETURN(queueIdx);
 }
 
+// Helper to get the index of the next file in a queue based on the client index. Queues are sorted largest to smallest so even
+// clients take the largest file and odd clients take the smallest. This prevents small files from waiting behind large files,
+// which is especially costly when the repo has high per-request latency, e.g. object stores.
+static unsigned int
+restoreJobQueueFileIdx(unsigned int clientIdx, unsigned int queueSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+        FUNCTION_TEST_PARAM(UINT, queueSize);
+    FUNCTION_TEST_END();
+
+    ASSERT(queueSize > 0);
+
+    FUNCTION_TEST_RETURN(clientIdx % 2 ? queueSize - 1 : 0);
+}
+
+// Helper to release the paths and files that were waiting for clean jobs that have completed. Clean jobs are checked here rather
+// than when the results are processed because the callback is called first and the released jobs can be started immediately.
+static void
+restoreJobCleanComplete(RestoreJobData *jobData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+    FUNCTION_TEST_END();
+
+    ASSERT(jobData != NULL);
+
+    unsigned int jobIdx = 0;
+
+    while (jobIdx < lstSize(jobData->cleanJobList))
+    {
+        ProtocolParallelJob *job = *(ProtocolParallelJob **)lstGet(jobData->cleanJobList, jobIdx);
+
+        if (protocolParallelJobState(job) == protocolParallelJobStateDone)
+        {
+            // Release waiting paths and files only when the clean was successful. Otherwise the error will be thrown when the
+            // results are processed.
+            if (protocolParallelJobErrorCode(job) == 0)
+            {
+                RestoreCleanPath *cleanPath = lstGet(jobData->cleanPathList, varUInt(protocolParallelJobKey(job)));
+                cleanPath->clean = true;
+
+                for (unsigned int childIdx = 0; childIdx < lstSize(cleanPath->childList); childIdx++)
+                    lstAdd(jobData->cleanQueue, lstGet(cleanPath->childList, childIdx));
+
+                for (unsigned int fileIdx = 0; fileIdx < lstSize(cleanPath->fileList); fileIdx++)
+                    lstAdd(jobData->fileReadyList, lstGet(cleanPath->fileList, fileIdx));
+
+                lstClear(cleanPath->fileList);
+            }
+
+            lstRemoveIdx(jobData->cleanJobList, jobIdx);
+        }
+        else
+            jobIdx++;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Helper to determine if a file must wait for its path to be cleaned. If so the file is added to the list of files waiting on the
+// path.
+static bool
+restoreJobFileWait(RestoreJobData *jobData, const ManifestFile *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(jobData != NULL);
+    ASSERT(file != NULL);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *path = strPath(file->name);
+        RestoreCleanPath *cleanPath = lstFind(jobData->cleanPathList, &path);
+
+        if (cleanPath != NULL && !cleanPath->clean)
+        {
+            lstAdd(cleanPath->fileList, &file);
+            result = true;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Helper to create a clean job
+static ProtocolParallelJob *
+restoreJobClean(RestoreJobData *jobData, unsigned int cleanPathIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(UINT, cleanPathIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(jobData != NULL);
+
+    ProtocolParallelJob *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const RestoreCleanPath *cleanPath = lstGet(jobData->cleanPathList, cleanPathIdx);
+        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_RESTORE_CLEAN_STR);
+
+        protocolCommandParamAdd(command, VARSTR(cleanPath->pgPath));
+        protocolCommandParamAdd(
+            command, cleanPath->fileIgnore == NULL ? NULL : varNewVarLst(varLstNewStrLst(cleanPath->fileIgnore)));
+
+        VariantList *entryParamList = varLstNew();
+
+        for (unsigned int entryIdx = 0; entryIdx < lstSize(cleanPath->entryList); entryIdx++)
+        {
+            const RestoreCleanEntry *entry = lstGet(cleanPath->entryList, entryIdx);
+            VariantList *entryParam = varLstNew();
+
+            varLstAdd(entryParam, varNewStr(entry->name));
+            varLstAdd(entryParam, varNewUInt(entry->type));
+            varLstAdd(entryParam, varNewStr(strNewFmt("%04o", entry->mode)));
+            varLstAdd(entryParam, varNewStr(entry->user));
+            varLstAdd(entryParam, varNewStr(entry->group));
+            varLstAdd(entryParam, varNewStr(entry->destination));
+
+            varLstAdd(entryParamList, varNewVarLst(entryParam));
+        }
+
+        protocolCommandParamAdd(command, varNewVarLst(entryParamList));
+
+        // Clean jobs are keyed by the index of the path so they can be distinguished from file jobs, which are keyed by name
+        result = protocolParallelJobNew(VARUINT(cleanPathIdx), command);
+        lstAdd(jobData->cleanJobList, &result);
+
+        protocolParallelJobMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Helper to create a file job
+static ProtocolParallelJob *
+restoreJobFile(RestoreJobData *jobData, const ManifestFile *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(jobData != NULL);
+    ASSERT(file != NULL);
+
+    ProtocolParallelJob *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_RESTORE_FILE_STR);
+
+        protocolCommandParamAdd(command, VARSTR(file->referenceName != NULL ? file->referenceName : file->name));
+        protocolCommandParamAdd(
+            command, file->reference != NULL ? VARSTR(file->reference) : VARSTR(manifestData(jobData->manifest)->backupLabel));
+        protocolCommandParamAdd(command, VARUINT(manifestData(jobData->manifest)->backupOptionCompressType));
+        protocolCommandParamAdd(command, VARSTR(restoreFilePgPath(jobData->manifest, file->name)));
+        protocolCommandParamAdd(command, VARSTRZ(file->checksumSha1));
+        protocolCommandParamAdd(command, VARBOOL(restoreFileZeroed(file->name, jobData->zeroExp)));
+        protocolCommandParamAdd(command, VARUINT64(file->size));
+        protocolCommandParamAdd(command, VARUINT64((uint64_t)file->timestamp));
+        protocolCommandParamAdd(command, VARSTR(strNewFmt("%04o", file->mode)));
+        protocolCommandParamAdd(command, VARSTR(file->user));
+        protocolCommandParamAdd(command, VARSTR(file->group));
+        protocolCommandParamAdd(command, VARUINT64((uint64_t)manifestData(jobData->manifest)->backupTimestampCopyStart));
+        protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta)));
+        protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta) && cfgOptionBool(cfgOptForce)));
+        protocolCommandParamAdd(command, VARUINT(jobData->cipherType));
+        protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
+        protocolCommandParamAdd(command, VARBOOL(!jobData->syncBatch));
+        protocolCommandParamAdd(command, VARBOOL(jobData->sparseExp != NULL && regExpMatch(jobData->sparseExp, file->name)));
+
+        result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 // Callback to fetch restore jobs for the parallel executor
 static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientIdx)
 {
@@ -1975,52 +2177,56 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
         // Get a new job if there are any left
         RestoreJobData *jobData = data;
 
-        // Determine where to begin scanning the queue (we'll stop when we get back here)
-        int queueIdx = (int)(clientIdx % lstSize(jobData->queueList));
-        int queueEnd = queueIdx;
+        // Release paths and files waiting for clean jobs that have completed
+        restoreJobCleanComplete(jobData);
 
-        do
+        // Clean paths first since files cannot be restored into a path until it has been cleaned
+        if (lstSize(jobData->cleanQueue) > 0)
+        {
+            result = restoreJobClean(jobData, *(unsigned int *)lstGet(jobData->cleanQueue, 0));
+            lstRemoveIdx(jobData->cleanQueue, 0);
+        }
+        // Else restore files that were waiting for their path to be cleaned
+        else if (lstSize(jobData->fileReadyList) > 0)
+        {
+            result = restoreJobFile(jobData, *(ManifestFile **)lstGet(jobData->fileReadyList, 0));
+            lstRemoveIdx(jobData->fileReadyList, 0);
+        }
+        // Else restore files from the processing queues
+        else
         {
-            List *queue = *(List **)lstGet(jobData->queueList, (unsigned int)queueIdx);
+            // Determine where to begin scanning the queue (we'll stop when we get back here)
+            int queueIdx = (int)(clientIdx % lstSize(jobData->queueList));
+            int queueEnd = queueIdx;
 
-            if (lstSize(queue) > 0)
+            do
             {
-                const ManifestFile *file = *(ManifestFile **)lstGet(queue, 0);
-
-                // Create restore job
-                ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_RESTORE_FILE_STR);
-
-                protocolCommandParamAdd(command, VARSTR(file->name));
-                protocolCommandParamAdd(
-                    command, file->reference != NULL ?
-                        VARSTR(file->reference) : VARSTR(manifestData(jobData->manifest)->backupLabel));
-                protocolCommandParamAdd(command, VARUINT(manifestData(jobData->manifest)->backupOptionCompressType));
-                protocolCommandParamAdd(command, VARSTR(restoreFilePgPath(jobData->manifest, file->name)));
-                protocolCommandParamAdd(command, VARSTRZ(file->checksumSha1));
-                protocolCommandParamAdd(command, VARBOOL(restoreFileZeroed(file->name, jobData->zeroExp)));
-                protocolCommandParamAdd(command, VARUINT64(file->size));
-                protocolCommandParamAdd(command, VARUINT64((uint64_t)file->timestamp));
-                protocolCommandParamAdd(command, VARSTR(strNewFmt("%04o", file->mode)));
-                protocolCommandParamAdd(command, VARSTR(file->user));
-                protocolCommandParamAdd(command, VARSTR(file->group));
-                protocolCommandParamAdd(command, VARUINT64((uint64_t)manifestData(jobData->manifest)->backupTimestampCopyStart));
-                protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta)));
-                protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta) && cfgOptionBool(cfgOptForce)));
-                protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
-
-                // Remove job from the queue
-                lstRemoveIdx(queue, 0);
-
-                // Assign job to result
-                result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
+                List *queue = *(List **)lstGet(jobData->queueList, (unsigned int)queueIdx);
+
+                while (result == NULL && lstSize(queue) > 0)
+                {
+                    const unsigned int fileIdx = restoreJobQueueFileIdx(clientIdx, lstSize(queue));
+                    const ManifestFile *file = *(ManifestFile **)lstGet(queue, fileIdx);
+
+                    // Remove file from the queue
+                    lstRemoveIdx(queue, fileIdx);
+
+                    // Create restore job unless the file must wait for its path to be cleaned
+                    if (!restoreJobFileWait(jobData, file))
+                        result = restoreJobFile(jobData, file);
+                }
 
                 // Break out of the loop early since we found a job
-                break;
-            }
+                if (result != NULL)
+                    break;
 
-            queueIdx = restoreJobQueueNext(clientIdx, queueIdx, lstSize(jobData->queueList));
+                queueIdx = restoreJobQueueNext(clientIdx, queueIdx, lstSize(jobData->queueList));
+            }
+            while (queueIdx != queueEnd);
         }
-        while (queueIdx != queueEnd);
+
+        // Move job to the calling context
+        result = protocolParallelJobMove(result, memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -2065,7 +2271,8 @@ cmdRestore(void)
         // Validate manifest.  Don't use strict mode because we'd rather ignore problems that won't affect a restore.
         manifestValidate(jobData.manifest, false);
 
-        // Get the cipher subpass used to decrypt files in the backup
+        // Get the cipher type and subpass used to decrypt files in the backup
+        jobData.cipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType));
         jobData.cipherSubPass = manifestCipherSubPass(jobData.manifest);
 
         // Validate the manifest
@@ -2087,12 +2294,41 @@ cmdRestore(void)
         String *expression = restoreSelectiveExpression(jobData.manifest);
         jobData.zeroExp = expression == NULL ? NULL : regExpNew(expression);
 
-        // Clean the data directory and build path/link structure
-        restoreCleanBuild(jobData.manifest);
+        // Holes in a sparse file need space when PostgreSQL writes into them, which may fail on a full volume, so sparse restore
+        // must be enabled and only applies to relation files. WAL, pg_control, and other files are always fully allocated.
+        if (cfgOptionBool(cfgOptSparse))
+        {
+            jobData.sparseExp = regExpNew(
+                STRDEF(
+                    "^(" MANIFEST_TARGET_PGDATA "/(" PG_PATH_BASE "/[0-9]+|" PG_PATH_GLOBAL ")|" MANIFEST_TARGET_PGTBLSPC
+                    "/[0-9]+/([^/]+/){0,1}[0-9]+)/[0-9]+(\\.[0-9]+){0,1}$"));
+        }
+
+        // Check the targets and build the list of paths to clean. The paths are cleaned by the restore jobs.
+        jobData.cleanPathList = restoreCleanBuild(jobData.manifest);
+        jobData.cleanQueue = lstNewP(sizeof(unsigned int));
+        jobData.cleanJobList = lstNewP(sizeof(ProtocolParallelJob *));
+        jobData.fileReadyList = lstNewP(sizeof(ManifestFile *));
+
+        for (unsigned int cleanPathIdx = 0; cleanPathIdx < lstSize(jobData.cleanPathList); cleanPathIdx++)
+        {
+            if (((RestoreCleanPath *)lstGet(jobData.cleanPathList, cleanPathIdx))->parent == NULL)
+                lstAdd(jobData.cleanQueue, &cleanPathIdx);
+        }
 
         // Generate processing queues
         uint64_t sizeTotal = restoreProcessQueue(jobData.manifest, &jobData.queueList);
 
+        // Defer file syncs when sync-batch is enabled and each target filesystem can be synced in a single call. Otherwise files
+        // are synced by the restore jobs as they are written, which is faster than syncing them one at a time after the restore.
+        if (cfgOptionBool(cfgOptSyncBatch))
+        {
+            if (storageFeature(storageLocalWrite(), storageFeaturePathSyncFs))
+                jobData.syncBatch = true;
+            else
+                LOG_WARN("option sync-batch is enabled but filesystem sync is not supported - files will be synced as restored");
+        }
+
         // Save manifest to the data directory so we can restart a delta restore even if the PG_VERSION file is missing
         manifestSave(jobData.manifest, storageWriteIo(storageNewWriteP(storagePgWrite(), BACKUP_MANIFEST_FILE_STR)));
 
@@ -2105,6 +2341,8 @@ cmdRestore(void)
 
         // Process jobs
         uint64_t sizeRestored = 0;
+        TimeMSec progressTime = timeMSec();
+        uint64_t progressSize = 0;
 
         do
         {
@@ -2115,9 +2353,32 @@ cmdRestore(void)
                 sizeRestored = restoreJobResult(
                     jobData.manifest, protocolParallelResult(parallelExec), jobData.zeroExp, sizeTotal, sizeRestored);
             }
+
+            // Log throughput at a regular interval so stalls are visible in the log
+            TimeMSec timeCurrent = timeMSec();
+
+            if (timeCurrent - progressTime >= RESTORE_PROGRESS_INTERVAL)
+            {
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    LOG_DETAIL_FMT(
+                        "restored %s of %s (%" PRIu64 "%%) at %s/s", strZ(strSizeFormat(sizeRestored)),
+                        strZ(strSizeFormat(sizeTotal)), sizeTotal == 0 ? 100 : sizeRestored * 100 / sizeTotal,
+                        strZ(strSizeFormat((sizeRestored - progressSize) * MSEC_PER_SEC / (timeCurrent - progressTime))));
+                }
+                MEM_CONTEXT_TEMP_END();
+
+                progressTime = timeCurrent;
+                progressSize = sizeRestored;
+            }
         }
         while (!protocolParallelDone(parallelExec));
 
+        // Sync files if syncs were deferred. This must happen before recovery settings and pg_control are written so the cluster
+        // cannot be started with files that are not on disk.
+        if (jobData.syncBatch)
+            restoreSyncBatch(jobData.manifest);
+
         // Write recovery settings
         restoreRecoveryWrite(jobData.manifest);
 
@@ -0,0 +1,267 @@
+/***********************************************************************************************************************************
+Server Command
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <signal.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "command/remote/remote.h"
+#include "command/server/server.h"
+#include "common/debug.h"
+#include "common/io/io.h"
+#include "common/io/socket/server.h"
+#include "common/io/tls/server.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/time.h"
+#include "common/type/json.h"
+#include "config/config.h"
+#include "config/load.h"
+
+/***********************************************************************************************************************************
+Sleep after a failed accept or fork so the server does not spin when the error persists, e.g. when out of file descriptors or
+processes. The sleep doubles with each consecutive failure up to the maximum.
+***********************************************************************************************************************************/
+#define SERVER_ERROR_SLEEP_MIN                                      100
+#define SERVER_ERROR_SLEEP_MAX                                      10000
+
+/***********************************************************************************************************************************
+Options that a client is allowed to send. Everything else comes from the server configuration so a client cannot redirect the server
+to other paths or hosts.
+***********************************************************************************************************************************/
+static const char *const cmdServerOptionAllow[] =
+{
+    CFGOPT_PG,
+    CFGOPT_PROCESS,
+    CFGOPT_REMOTE_TYPE,
+    CFGOPT_REPO,
+    CFGOPT_STANZA,
+};
+
+/***********************************************************************************************************************************
+Build the parameters for a session from the server parameters and the parameters sent by the client
+***********************************************************************************************************************************/
+static StringList *
+cmdServerSessionParam(const StringList *paramServer, const StringList *paramClient)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, paramServer);
+        FUNCTION_LOG_PARAM(STRING_LIST, paramClient);
+    FUNCTION_LOG_END();
+
+    ASSERT(paramServer != NULL);
+    ASSERT(paramClient != NULL);
+
+    StringList *result = strLstDup(paramServer);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        bool command = false;
+
+        for (unsigned int paramIdx = 0; paramIdx < strLstSize(paramClient); paramIdx++)
+        {
+            const String *param = strLstGet(paramClient, paramIdx);
+
+            // Only allowed options may be set by the client
+            if (strBeginsWithZ(param, "--"))
+            {
+                const int valueIdx = strChr(param, '=');
+                const String *name = valueIdx == -1 ? strSub(param, 2) : strSubN(param, 2, (size_t)valueIdx - 2);
+                bool allow = false;
+
+                for (unsigned int allowIdx = 0; allowIdx < sizeof(cmdServerOptionAllow) / sizeof(char *); allowIdx++)
+                {
+                    if (strEqZ(name, cmdServerOptionAllow[allowIdx]))
+                    {
+                        allow = true;
+                        break;
+                    }
+                }
+
+                if (!allow)
+                    THROW_FMT(OptionInvalidError, "option '%s' cannot be set by the client", strZ(name));
+            }
+            // Else the parameter is the command, which may only be specified once and must run the remote role. This is checked
+            // before the configuration is loaded so no other command can be configured by the client.
+            else
+            {
+                if (command)
+                    THROW_FMT(ParamInvalidError, "command '%s' is not expected since a command was already sent", strZ(param));
+
+                const StringList *const commandPart = strLstNewSplit(param, COLON_STR);
+
+                if (strLstSize(commandPart) != 2 || cfgCommandId(strZ(strLstGet(commandPart, 0))) == cfgCmdNone ||
+                    !strEqZ(strLstGet(commandPart, 1), CONFIG_COMMAND_ROLE_REMOTE))
+                {
+                    THROW_FMT(CommandInvalidError, "server only runs the remote role but '%s' was requested", strZ(param));
+                }
+
+                command = true;
+            }
+
+            strLstAdd(result, param);
+        }
+
+        if (!command)
+            THROW(CommandRequiredError, "no command sent by the client");
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/***********************************************************************************************************************************
+Process a session in the child process
+
+The client sends the remote command and a few parameters that identify the stanza and repository as the first line of the session.
+The rest of the configuration is loaded from the server configuration.
+***********************************************************************************************************************************/
+static void
+cmdServerSession(IoServer *tlsServer, IoSession *socketSession, const StringList *paramServer)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_SERVER, tlsServer);
+        FUNCTION_LOG_PARAM(IO_SESSION, socketSession);
+        FUNCTION_LOG_PARAM(STRING_LIST, paramServer);
+    FUNCTION_LOG_END();
+
+    ASSERT(tlsServer != NULL);
+    ASSERT(socketSession != NULL);
+    ASSERT(paramServer != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Negotiate the TLS session and verify the client certificate
+        IoSession *tlsSession = ioServerAccept(tlsServer, socketSession);
+
+        // Load the server configuration with the parameters sent by the client
+        StringList *paramList = cmdServerSessionParam(
+            paramServer, strLstNewVarLst(jsonToVarLst(ioReadLine(ioSessionIoRead(tlsSession)))));
+
+        cfgLoad(strLstSize(paramList), strLstPtr(paramList));
+
+        // Run the remote
+        cmdRemoteSession(ioSessionIoRead(tlsSession), ioSessionIoWrite(tlsSession));
+
+        ioSessionClose(tlsSession);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the parameters that are used for every session. The configuration file options given to the server are passed on so sessions
+load the same configuration as the server. Console output is disabled since the server may be running in the background.
+***********************************************************************************************************************************/
+static StringList *
+cmdServerParam(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    StringList *result = strLstNew();
+    strLstAdd(result, cfgExe());
+
+    static const ConfigOption optionConfig[] = {cfgOptConfig, cfgOptConfigIncludePath, cfgOptConfigPath};
+
+    for (unsigned int optionIdx = 0; optionIdx < sizeof(optionConfig) / sizeof(ConfigOption); optionIdx++)
+    {
+        if (cfgOptionSource(optionConfig[optionIdx]) != cfgSourceDefault)
+        {
+            strLstAdd(
+                result,
+                strNewFmt("--%s=%s", cfgOptionName(optionConfig[optionIdx]), strZ(cfgOptionStr(optionConfig[optionIdx]))));
+        }
+    }
+
+    strLstAddZ(result, "--" CFGOPT_LOG_LEVEL_CONSOLE "=off");
+    strLstAddZ(result, "--" CFGOPT_LOG_LEVEL_STDERR "=error");
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/**********************************************************************************************************************************/
+void
+cmdServer(uint64_t connectionMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT64, connectionMax);
+    FUNCTION_LOG_END();
+
+    ASSERT(connectionMax > 0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *const address = cfgOptionStr(cfgOptTlsServerAddress);
+        const StringList *const paramServer = cmdServerParam();
+
+        IoServer *const tlsServer = tlsServerNew(
+            address, cfgOptionStr(cfgOptTlsServerCaFile), cfgOptionStr(cfgOptTlsServerKeyFile),
+            cfgOptionStr(cfgOptTlsServerCertFile), ioTimeoutMs());
+        IoServer *const socketServer = sckServerNew(address, cfgOptionUInt(cfgOptTlsServerPort), ioTimeoutMs());
+
+        // Do not wait for child processes. They will be reaped automatically so they do not become zombies.
+        THROW_ON_SYS_ERROR(signal(SIGCHLD, SIG_IGN) == SIG_ERR, KernelError, "unable to ignore SIGCHLD");
+
+        LOG_INFO_FMT("listening on '%s'", strZ(ioServerName(socketServer)));
+
+        // Accept connections and process each one in a child process
+        uint64_t connectionTotal = 0;
+        TimeMSec errorSleep = 0;
+        bool child = false;
+
+        do
+        {
+            IoSession *socketSession = NULL;
+            pid_t pid = -1;
+
+            // Errors accepting a connection or forking are logged so the server keeps running
+            TRY_BEGIN()
+            {
+                socketSession = ioServerAccept(socketServer, NULL);
+
+                pid = fork();
+                THROW_ON_SYS_ERROR(pid == -1, KernelError, "unable to fork");
+            }
+            CATCH_ANY()
+            {
+                LOG_WARN_FMT("unable to start session: %s", errorMessage());
+                ioSessionFree(socketSession);
+
+                // Back off before trying again
+                errorSleep = errorSleep == 0 ? SERVER_ERROR_SLEEP_MIN : errorSleep * 2;
+
+                if (errorSleep > SERVER_ERROR_SLEEP_MAX)
+                    errorSleep = SERVER_ERROR_SLEEP_MAX;
+
+                sleepMSec(errorSleep);
+            }
+            TRY_END();
+
+            if (pid == 0)
+            {
+                child = true;
+
+                // The remote may need to wait on processes it starts so restore the default handler. Close the listening socket
+                // since only the parent accepts connections.
+                signal(SIGCHLD, SIG_DFL);
+                ioServerFree(socketServer);
+
+                cmdServerSession(tlsServer, socketSession, paramServer);
+            }
+            else if (pid != -1)
+            {
+                // The socket is now owned by the child
+                ioSessionFree(socketSession);
+                connectionTotal++;
+                errorSleep = 0;
+            }
+        }
+        while (!child && connectionTotal < connectionMax);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
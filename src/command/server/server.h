@@ -0,0 +1,19 @@
+/***********************************************************************************************************************************
+Server Command
+
+Accept TLS connections from clients that present a certificate signed by the configured CA and run the remote command on each
+connection. This provides the same services as a remote started via ssh without the cost of ssh connection setup and encryption.
+***********************************************************************************************************************************/
+#ifndef COMMAND_SERVER_SERVER_H
+#define COMMAND_SERVER_SERVER_H
+
+#include <stdint.h>
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Server command. Connections are accepted until connectionMax is reached, which is only useful for testing since the server should
+// run until it is terminated.
+void cmdServer(uint64_t connectionMax);
+
+#endif
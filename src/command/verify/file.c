@@ -17,17 +17,19 @@ Verify File
 /**********************************************************************************************************************************/
 VerifyResult
 verifyFile(
-    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass)
+    const String *filePathName, const String *fileChecksum, uint64_t fileSize, CipherType cipherType, const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, filePathName);                   // Fully qualified file name
         FUNCTION_LOG_PARAM(STRING, fileChecksum);                   // Checksum for the file
         FUNCTION_LOG_PARAM(UINT64, fileSize);                       // Size of file
+        FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Repo cipher type
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
     FUNCTION_LOG_END();
 
     ASSERT(filePathName != NULL);
     ASSERT(fileChecksum != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
 
     // Is the file valid?
     VerifyResult result = verifyOk;
@@ -39,8 +41,8 @@ verifyFile(
         IoFilterGroup *filterGroup = ioReadFilterGroup(read);
 
         // Add decryption filter
-        if (cipherPass != NULL)
-            ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+        if (cipherType != cipherTypeNone)
+            ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherType, BUFSTR(cipherPass), NULL));
 
         // Add decompression filter
         if (compressTypeFromName(filePathName) != compressTypeNone)
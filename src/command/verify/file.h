@@ -30,6 +30,6 @@ typedef struct VerifyFileResult
 
 // Verify a file in the pgBackRest repository
 VerifyResult verifyFile(
-    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass);
+    const String *filePathName, const String *fileChecksum, uint64_t fileSize, CipherType cipherType, const String *cipherPass);
 
 #endif
@@ -0,0 +1,376 @@
+/***********************************************************************************************************************************
+Verify Ledger
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/verify/ledger.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/json.h"
+#include "common/type/list.h"
+#include "common/type/object.h"
+#include "info/info.h"
+
+/***********************************************************************************************************************************
+Internal constants
+***********************************************************************************************************************************/
+STRING_STATIC(VERIFY_LEDGER_SECTION_FILE_STR,                       "file");
+
+VARIANT_STRDEF_STATIC(VERIFY_LEDGER_KEY_CHECKSUM_VAR,               "checksum");
+VARIANT_STRDEF_STATIC(VERIFY_LEDGER_KEY_MODIFIED_VAR,               "modified");
+VARIANT_STRDEF_STATIC(VERIFY_LEDGER_KEY_SIZE_VAR,                   "size");
+VARIANT_STRDEF_STATIC(VERIFY_LEDGER_KEY_TIMESTAMP_VAR,              "timestamp");
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct VerifyLedger
+{
+    MemContext *memContext;                                         // Mem context
+    Info *info;                                                     // Base info file data
+    List *fileList;                                                 // List of verified files
+};
+
+OBJECT_DEFINE_MOVE(VERIFY_LEDGER);
+OBJECT_DEFINE_FREE(VERIFY_LEDGER);
+
+/***********************************************************************************************************************************
+Internal constructor
+***********************************************************************************************************************************/
+static VerifyLedger *
+verifyLedgerNewInternal(void)
+{
+    FUNCTION_TEST_VOID();
+
+    VerifyLedger *this = memNew(sizeof(VerifyLedger));
+
+    *this = (VerifyLedger)
+    {
+        .memContext = memContextCurrent(),
+        .fileList = lstNewP(sizeof(VerifyLedgerFile), .comparator = lstComparatorStr, .hash = lstHashStr),
+    };
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/**********************************************************************************************************************************/
+VerifyLedger *
+verifyLedgerNew(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    VerifyLedger *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("VerifyLedger")
+    {
+        this = verifyLedgerNewInternal();
+        this->info = infoNew(NULL);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(VERIFY_LEDGER, this);
+}
+
+/***********************************************************************************************************************************
+Callback for loading the ledger
+***********************************************************************************************************************************/
+static void
+verifyLedgerLoadCallback(void *data, const String *section, const String *key, const Variant *value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STRING, section);
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(VARIANT, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(section != NULL);
+    ASSERT(key != NULL);
+    ASSERT(value != NULL);
+
+    VerifyLedger *verifyLedger = (VerifyLedger *)data;
+
+    // Process file list
+    if (strEq(section, VERIFY_LEDGER_SECTION_FILE_STR))
+    {
+        const KeyValue *fileKv = varKv(value);
+
+        MEM_CONTEXT_BEGIN(lstMemContext(verifyLedger->fileList))
+        {
+            VerifyLedgerFile file =
+            {
+                .name = strDup(key),
+                .checksum = strDup(varStr(kvGet(fileKv, VERIFY_LEDGER_KEY_CHECKSUM_VAR))),
+                .size = varUInt64(kvGet(fileKv, VERIFY_LEDGER_KEY_SIZE_VAR)),
+                .timeModified = (time_t)varUInt64(kvGet(fileKv, VERIFY_LEDGER_KEY_MODIFIED_VAR)),
+                .timestamp = (time_t)varUInt64(kvGet(fileKv, VERIFY_LEDGER_KEY_TIMESTAMP_VAR)),
+            };
+
+            lstAdd(verifyLedger->fileList, &file);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+VerifyLedger *
+verifyLedgerNewLoad(IoRead *read)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+
+    VerifyLedger *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("VerifyLedger")
+    {
+        this = verifyLedgerNewInternal();
+        this->info = infoNewLoadP(read, verifyLedgerLoadCallback, this);
+
+        // Files are saved in sorted order but sort anyway so lookups can use a binary search
+        lstSort(this->fileList, sortOrderAsc);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(VERIFY_LEDGER, this);
+}
+
+/***********************************************************************************************************************************
+Callback for saving the ledger
+***********************************************************************************************************************************/
+static void
+verifyLedgerSaveCallback(void *data, const String *sectionNext, InfoSave *infoSaveData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STRING, sectionNext);
+        FUNCTION_TEST_PARAM(INFO_SAVE, infoSaveData);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(infoSaveData != NULL);
+
+    VerifyLedger *verifyLedger = (VerifyLedger *)data;
+
+    if (infoSaveSection(infoSaveData, VERIFY_LEDGER_SECTION_FILE_STR, sectionNext))
+    {
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            for (unsigned int fileIdx = 0; fileIdx < verifyLedgerFileTotal(verifyLedger); fileIdx++)
+            {
+                const VerifyLedgerFile *file = verifyLedgerFile(verifyLedger, fileIdx);
+
+                KeyValue *fileKv = kvNew();
+                kvPut(fileKv, VERIFY_LEDGER_KEY_CHECKSUM_VAR, VARSTR(file->checksum));
+                kvPut(fileKv, VERIFY_LEDGER_KEY_MODIFIED_VAR, VARUINT64((uint64_t)file->timeModified));
+                kvPut(fileKv, VERIFY_LEDGER_KEY_SIZE_VAR, VARUINT64(file->size));
+                kvPut(fileKv, VERIFY_LEDGER_KEY_TIMESTAMP_VAR, VARUINT64((uint64_t)file->timestamp));
+
+                infoSaveValue(infoSaveData, VERIFY_LEDGER_SECTION_FILE_STR, file->name, jsonFromKv(fileKv));
+
+                MEM_CONTEXT_TEMP_RESET(1000);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Save the ledger
+***********************************************************************************************************************************/
+static void
+verifyLedgerSave(VerifyLedger *this, IoWrite *write)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(VERIFY_LEDGER, this);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(write != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Files must be saved in sorted order
+        lstSort(this->fileList, sortOrderAsc);
+
+        infoSave(this->info, write, verifyLedgerSaveCallback, this);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+verifyLedgerFileAdd(VerifyLedger *this, const VerifyLedgerFile *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VERIFY_LEDGER, this);
+        FUNCTION_TEST_PARAM_P(VOID, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+    ASSERT(file->name != NULL);
+    ASSERT(file->checksum != NULL);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(this->fileList))
+    {
+        VerifyLedgerFile *fileFound = lstFind(this->fileList, &file->name);
+
+        // Replace the file if it already exists
+        if (fileFound != NULL)
+        {
+            if (!strEq(fileFound->checksum, file->checksum))
+                fileFound->checksum = strDup(file->checksum);
+
+            fileFound->size = file->size;
+            fileFound->timeModified = file->timeModified;
+            fileFound->timestamp = file->timestamp;
+        }
+        // Else add the file
+        else
+        {
+            VerifyLedgerFile fileAdd =
+            {
+                .name = strDup(file->name),
+                .checksum = strDup(file->checksum),
+                .size = file->size,
+                .timeModified = file->timeModified,
+                .timestamp = file->timestamp,
+            };
+
+            lstAdd(this->fileList, &fileAdd);
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+const VerifyLedgerFile *
+verifyLedgerFileFind(const VerifyLedger *this, const String *name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VERIFY_LEDGER, this);
+        FUNCTION_TEST_PARAM(STRING, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(name != NULL);
+
+    FUNCTION_TEST_RETURN(lstFind(this->fileList, &name));
+}
+
+/**********************************************************************************************************************************/
+const VerifyLedgerFile *
+verifyLedgerFile(const VerifyLedger *this, unsigned int fileIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VERIFY_LEDGER, this);
+        FUNCTION_TEST_PARAM(UINT, fileIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(lstGet(this->fileList, fileIdx));
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+verifyLedgerFileTotal(const VerifyLedger *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VERIFY_LEDGER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(lstSize(this->fileList));
+}
+
+/**********************************************************************************************************************************/
+VerifyLedger *
+verifyLedgerLoadFile(const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(fileName != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+
+    VerifyLedger *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TRY_BEGIN()
+        {
+            StorageRead *read = storageNewReadP(storage, fileName);
+            cipherBlockFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cipherType, cipherModeDecrypt, cipherPass);
+
+            result = verifyLedgerMove(verifyLedgerNewLoad(storageReadIo(read)), memContextPrior());
+        }
+        CATCH(FileMissingError)
+        {
+            // A missing ledger is not an error since the ledger is created by the first verify that uses it
+        }
+        CATCH_ANY()
+        {
+            LOG_WARN_FMT(
+                "unable to load verify ledger '%s', all files will be verified: %s", strZ(storagePathP(storage, fileName)),
+                errorMessage());
+        }
+        TRY_END();
+
+        if (result == NULL)
+            result = verifyLedgerMove(verifyLedgerNew(), memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(VERIFY_LEDGER, result);
+}
+
+/**********************************************************************************************************************************/
+void
+verifyLedgerSaveFile(
+    VerifyLedger *verifyLedger, const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(VERIFY_LEDGER, verifyLedger);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(verifyLedger != NULL);
+    ASSERT(storage != NULL);
+    ASSERT(fileName != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        IoWrite *write = storageWriteIo(storageNewWriteP(storage, fileName));
+        cipherBlockFilterGroupAdd(ioWriteFilterGroup(write), cipherType, cipherModeEncrypt, cipherPass);
+        verifyLedgerSave(verifyLedger, write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
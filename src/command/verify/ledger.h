@@ -0,0 +1,96 @@
+/***********************************************************************************************************************************
+Verify Ledger
+
+The ledger records repository files that have been successfully verified. Files in the repository are immutable once written so a
+file recorded in the ledger only needs to be verified again to detect corruption in the underlying storage, which allows verify to
+check new files on every run while checking only a sample of the files verified by prior runs.
+***********************************************************************************************************************************/
+#ifndef COMMAND_VERIFY_LEDGER_H
+#define COMMAND_VERIFY_LEDGER_H
+
+#include <time.h>
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define VERIFY_LEDGER_TYPE                                          VerifyLedger
+#define VERIFY_LEDGER_PREFIX                                        verifyLedger
+
+typedef struct VerifyLedger VerifyLedger;
+
+#include "common/crypto/common.h"
+#include "common/type/string.h"
+#include "storage/storage.h"
+
+/***********************************************************************************************************************************
+Ledger filename
+***********************************************************************************************************************************/
+#define VERIFY_LEDGER_FILE                                          "verify.ledger"
+
+/***********************************************************************************************************************************
+File data
+***********************************************************************************************************************************/
+typedef struct VerifyLedgerFile
+{
+    const String *name;                                             // File name relative to the ledger path
+    const String *checksum;                                         // Checksum of the file contents
+    uint64_t size;                                                  // Size of the file in the repository
+    time_t timeModified;                                            // Time the file was last modified in the repository
+    time_t timestamp;                                               // Time the file was last verified
+} VerifyLedgerFile;
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+VerifyLedger *verifyLedgerNew(void);
+
+// Create new object and load contents from IoRead
+VerifyLedger *verifyLedgerNewLoad(IoRead *read);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Add a file to the ledger or replace the file if it already exists
+void verifyLedgerFileAdd(VerifyLedger *this, const VerifyLedgerFile *file);
+
+// Find a file in the ledger. NULL if the file is not found.
+const VerifyLedgerFile *verifyLedgerFileFind(const VerifyLedger *this, const String *name);
+
+// Move to a new parent mem context
+VerifyLedger *verifyLedgerMove(VerifyLedger *this, MemContext *parentNew);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+// File data by index
+const VerifyLedgerFile *verifyLedgerFile(const VerifyLedger *this, unsigned int fileIdx);
+
+// Total files in the ledger
+unsigned int verifyLedgerFileTotal(const VerifyLedger *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void verifyLedgerFree(VerifyLedger *this);
+
+/***********************************************************************************************************************************
+Helper functions
+***********************************************************************************************************************************/
+// Load the ledger. A missing or invalid ledger results in an empty ledger since the only consequence is that all files are
+// verified.
+VerifyLedger *verifyLedgerLoadFile(
+    const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass);
+
+// Save the ledger
+void verifyLedgerSaveFile(
+    VerifyLedger *verifyLedger, const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_VERIFY_LEDGER_TYPE                                                                                            \
+    VerifyLedger *
+#define FUNCTION_LOG_VERIFY_LEDGER_FORMAT(value, buffer, bufferSize)                                                               \
+    objToLog(value, "VerifyLedger", buffer, bufferSize)
+
+#endif
@@ -41,7 +41,8 @@ verifyProtocol(const String *command, const VariantList *paramList, ProtocolServ
                 varStr(varLstGet(paramList, 0)),                                                    // Full filename
                 varStr(varLstGet(paramList, 1)),                                                    // Checksum
                 varUInt64(varLstGet(paramList, 2)),                                                 // File size
-                varStr(varLstGet(paramList, 3)));                                                   // Cipher pass
+                (CipherType)varUIntForce(varLstGet(paramList, 3)),                                  // Cipher type
+                varStr(varLstGet(paramList, 4)));                                                   // Cipher pass
 
             protocolServerResponse(server, VARUINT(result));
         }
@@ -11,12 +11,15 @@ Verify the contents of the repository.
 #include "command/archive/common.h"
 #include "command/check/common.h"
 #include "command/verify/file.h"
+#include "command/verify/ledger.h"
 #include "command/verify/protocol.h"
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
+#include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/io/fdWrite.h"
 #include "common/io/io.h"
+#include "common/lock.h"
 #include "common/log.h"
 #include "config/config.h"
 #include "info/infoArchive.h"
@@ -51,8 +54,12 @@ typedef struct VerifyArchiveResult
     String *archiveId;                                              // Archive Id (e.g. 9.6-1, 10-2)
     unsigned int totalWalFile;                                      // Total number of WAL files listed in directory on first read
     unsigned int totalValidWal;                                     // Total number of WAL that were verified and valid
+    unsigned int totalPriorWal;                                     // Total number of valid WAL verified by a prior run
     PgWal pgWalInfo;                                                // PG version, WAL size, system id
     List *walRangeList;                                             // List of WAL file ranges - new item is when WAL is missing
+    const VerifyLedger *ledgerPrior;                                // Ledger saved by the prior run, if the ledger is enabled
+    VerifyLedger *ledgerPending;                                    // Files sent to be verified, if the ledger is enabled
+    VerifyLedger *ledger;                                           // Ledger to be saved by this run, if the ledger is enabled
 } VerifyArchiveResult;
 
 // WAL range includes the start/stop of sequential WAL and start/stop includes the timeline (e.g. 000000020000000100000005)
@@ -70,6 +77,14 @@ typedef struct VerifyInvalidFile
     VerifyResult reason;                                            // Reason file is invalid (e.g. incorrect checksum)
 } VerifyInvalidFile;
 
+// Repository size and modification time of a WAL file, used to check that a file in the ledger has not changed
+typedef struct VerifyWalFile
+{
+    const String *name;                                             // File name
+    uint64_t size;                                                  // Size of the file in the repository
+    time_t timeModified;                                            // Time the file was last modified in the repository
+} VerifyWalFile;
+
 // Job data stucture for processing and results collection
 typedef struct VerifyJobData
 {
@@ -77,11 +92,15 @@ typedef struct VerifyJobData
     StringList *archiveIdList;                                      // List of archive ids to verify
     StringList *walPathList;                                        // WAL path list for a single archive id
     StringList *walFileList;                                        // WAL file list for a single WAL path
+    List *walFileInfoList;                                          // WAL file size/time for a single WAL path, if ledger enabled
     StringList *backupList;                                         // List of backups to verify
     String *currentBackup;                                          // In progress backup, if any
     const InfoPg *pgHistory;                                        // Database history list
     bool backupProcessing;                                          // Are we processing WAL or are we processing backup
+    CipherType walCipherType;                                       // Cipher type for reading WAL files
     const String *walCipherPass;                                    // Cipher pass for reading WAL files
+    bool ledger;                                                    // Skip files verified by a prior run?
+    unsigned int ledgerSample;                                      // Percentage of files verified by a prior run to verify again
     unsigned int jobErrorTotal;                                     // Total errors that occurred during the job execution
     List *archiveIdResultList;                                      // Archive results
 } VerifyJobData;
@@ -439,6 +458,64 @@ verifyCreateArchiveIdRange(VerifyArchiveResult *archiveIdResult, StringList *wal
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Randomly determine if a file verified by a prior run should be verified again
+***********************************************************************************************************************************/
+static bool
+verifyLedgerSample(unsigned int ledgerSample)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, ledgerSample);                    // Percentage of files to verify again
+    FUNCTION_TEST_END();
+
+    ASSERT(ledgerSample <= 100);
+
+    bool result = ledgerSample == 100;
+
+    if (ledgerSample > 0 && ledgerSample < 100)
+    {
+        unsigned int random;
+        cryptoRandomBytes((unsigned char *)&random, sizeof(random));
+
+        result = random % 100 < ledgerSample;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Callback to collect WAL file names along with the repository size and modification time needed to check the ledger
+***********************************************************************************************************************************/
+static void
+verifyWalFileInfoCallback(void *data, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, *info);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(info != NULL);
+
+    VerifyJobData *jobData = data;
+
+    MEM_CONTEXT_BEGIN(lstMemContext(jobData->walFileInfoList))
+    {
+        VerifyWalFile walFile =
+        {
+            .name = strDup(info->name),
+            .size = info->size,
+            .timeModified = info->timeModified,
+        };
+
+        lstAdd(jobData->walFileInfoList, &walFile);
+        strLstAdd(jobData->walFileList, walFile.name);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Return verify jobs for the archive
 ***********************************************************************************************************************************/
@@ -473,6 +550,17 @@ verifyArchive(void *data)
                     .walRangeList = lstNewP(sizeof(VerifyWalRange), .comparator =  lstComparatorStr),
                 };
 
+                // Load the ledger saved by the prior run so files it verified can be skipped. A new ledger is built by this run so
+                // files that no longer exist (e.g. expired) are dropped from the ledger.
+                if (jobData->ledger)
+                {
+                    archiveIdResult.ledgerPrior = verifyLedgerLoadFile(
+                        storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/" VERIFY_LEDGER_FILE, strZ(archiveId)),
+                        cipherType(cfgOptionStr(cfgOptRepoCipherType)), jobData->walCipherPass);
+                    archiveIdResult.ledgerPending = verifyLedgerNew();
+                    archiveIdResult.ledger = verifyLedgerNew();
+                }
+
                 lstAdd(jobData->archiveIdResultList, &archiveIdResult);
             }
             MEM_CONTEXT_END();
@@ -513,8 +601,27 @@ verifyArchive(void *data)
 
                     MEM_CONTEXT_BEGIN(jobData->memContext)
                     {
-                        jobData->walFileList = strLstSort(
-                            storageListP(storageRepo(), walFilePath, .expression = WAL_SEGMENT_FILE_REGEXP_STR), sortOrderAsc);
+                        // When the ledger is enabled also get the repository size and modification time of each file so files
+                        // that were rewritten or truncated since they were added to the ledger are verified again
+                        if (jobData->ledger)
+                        {
+                            lstFree(jobData->walFileInfoList);
+
+                            jobData->walFileList = strLstNew();
+                            jobData->walFileInfoList = lstNewP(
+                                sizeof(VerifyWalFile), .comparator = lstComparatorStr, .hash = lstHashStr);
+
+                            storageInfoListP(
+                                storageRepo(), walFilePath, verifyWalFileInfoCallback, jobData,
+                                .level = storageInfoLevelBasic, .expression = WAL_SEGMENT_FILE_REGEXP_STR);
+                            strLstSort(jobData->walFileList, sortOrderAsc);
+                        }
+                        else
+                        {
+                            jobData->walFileList = strLstSort(
+                                storageListP(storageRepo(), walFilePath, .expression = WAL_SEGMENT_FILE_REGEXP_STR),
+                                sortOrderAsc);
+                        }
                     }
                     MEM_CONTEXT_END();
 
@@ -554,15 +661,56 @@ verifyArchive(void *data)
                             STORAGE_REPO_ARCHIVE "/%s/%s/%s", strZ(archiveResult->archiveId), strZ(walPath), strZ(fileName));
                         String *checksum = strSubN(fileName, WAL_SEGMENT_NAME_SIZE + 1, HASH_TYPE_SHA1_SIZE_HEX);
 
-                        // Set up the job
-                        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_VERIFY_FILE_STR);
-                        protocolCommandParamAdd(command, VARSTR(filePathName));
-                        protocolCommandParamAdd(command, VARSTR(checksum));
-                        protocolCommandParamAdd(command, VARUINT64(archiveResult->pgWalInfo.size));
-                        protocolCommandParamAdd(command, VARSTR(jobData->walCipherPass));
+                        // Find the file in the prior ledger, if any
+                        const VerifyWalFile *walFile = NULL;
+                        const VerifyLedgerFile *ledgerFile = NULL;
+
+                        if (archiveResult->ledger != NULL)
+                        {
+                            walFile = lstFind(jobData->walFileInfoList, &fileName);
+                            ASSERT(walFile != NULL);
+
+                            ledgerFile = verifyLedgerFileFind(
+                                archiveResult->ledgerPrior, strNewFmt("%s/%s", strZ(walPath), strZ(fileName)));
+                        }
+
+                        // Skip the file if it was verified by a prior run, has not changed in the repository since, and has not
+                        // been selected to be verified again
+                        if (ledgerFile != NULL && strEq(ledgerFile->checksum, checksum) && ledgerFile->size == walFile->size &&
+                            ledgerFile->timeModified == walFile->timeModified && !verifyLedgerSample(jobData->ledgerSample))
+                        {
+                            verifyLedgerFileAdd(archiveResult->ledger, ledgerFile);
+
+                            archiveResult->totalValidWal++;
+                            archiveResult->totalPriorWal++;
+                        }
+                        else
+                        {
+                            // Set up the job
+                            ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_VERIFY_FILE_STR);
+                            protocolCommandParamAdd(command, VARSTR(filePathName));
+                            protocolCommandParamAdd(command, VARSTR(checksum));
+                            protocolCommandParamAdd(command, VARUINT64(archiveResult->pgWalInfo.size));
+                            protocolCommandParamAdd(command, VARUINT(jobData->walCipherType));
+                            protocolCommandParamAdd(command, VARSTR(jobData->walCipherPass));
+
+                            // Record the repository size and modification time so the file can be added to the ledger when valid
+                            if (archiveResult->ledger != NULL)
+                            {
+                                verifyLedgerFileAdd(
+                                    archiveResult->ledgerPending,
+                                    &(VerifyLedgerFile)
+                                    {
+                                        .name = strNewFmt("%s/%s", strZ(walPath), strZ(fileName)),
+                                        .checksum = checksum,
+                                        .size = walFile->size,
+                                        .timeModified = walFile->timeModified,
+                                    });
+                            }
 
-                        // Assign job to result
-                        result = protocolParallelJobNew(VARSTR(filePathName), command);
+                            // Assign job to result
+                            result = protocolParallelJobNew(VARSTR(filePathName), command);
+                        }
 
                         // Remove the file to process from the list
                         strLstRemoveIdx(jobData->walFileList, 0);
@@ -572,7 +720,8 @@ verifyArchive(void *data)
                             strLstRemoveIdx(jobData->walPathList, 0);
 
                         // Return to process the job found
-                        break;
+                        if (result != NULL)
+                            break;
                     }
                     while (strLstSize(jobData->walFileList) > 0);
                 }
@@ -831,6 +980,10 @@ verifyRender(List *archiveIdResultList)
             result, "%s  archiveId: %s, total WAL checked: %u, total valid WAL: %u", (archiveIdx > 0 ? "\n" : ""),
             strZ(archiveIdResult->archiveId), archiveIdResult->totalWalFile, archiveIdResult->totalValidWal);
 
+        // Report valid WAL that was skipped because it was verified by a prior run
+        if (archiveIdResult->totalPriorWal > 0)
+            strCatFmt(result, " (%u verified by prior run)", archiveIdResult->totalPriorWal);
+
         if (archiveIdResult->totalWalFile > 0)
         {
             unsigned int errMissing = 0;
@@ -940,7 +1093,10 @@ verifyProcess(unsigned int *errorTotal)
                 .walPathList = NULL,
                 .walFileList = strLstNew(),
                 .pgHistory = infoArchivePg(archiveInfo),
+                .walCipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType)),
                 .walCipherPass = infoPgCipherPass(infoArchivePg(archiveInfo)),
+                .ledger = cfgOptionBool(cfgOptVerifyLedger),
+                .ledgerSample = cfgOptionTest(cfgOptVerifySample) ? cfgOptionUInt(cfgOptVerifySample) : 0,
                 .archiveIdResultList = lstNewP(sizeof(VerifyArchiveResult), .comparator =  archiveIdComparator),
             };
 
@@ -1007,7 +1163,23 @@ verifyProcess(unsigned int *errorTotal)
                             const VerifyResult verifyResult = (VerifyResult)varUIntForce(protocolParallelJobResult(job));
 
                             if (verifyResult == verifyOk)
+                            {
                                 archiveIdResult->totalValidWal++;
+
+                                // Record the file in the ledger so the next run can skip it
+                                if (archiveIdResult->ledger != NULL)
+                                {
+                                    const VerifyLedgerFile *ledgerFile = verifyLedgerFileFind(
+                                        archiveIdResult->ledgerPending,
+                                        strNewFmt("%s/%s", strZ(strLstGet(filePathLst, 1)), strZ(strLstGet(filePathLst, 2))));
+                                    ASSERT(ledgerFile != NULL);
+
+                                    VerifyLedgerFile ledgerFileVerified = *ledgerFile;
+                                    ledgerFileVerified.timestamp = time(NULL);
+
+                                    verifyLedgerFileAdd(archiveIdResult->ledger, &ledgerFileVerified);
+                                }
+                            }
                             else
                             {
                                 jobData.jobErrorTotal += verifyLogInvalidResult(verifyResult, processId, filePathName);
@@ -1041,6 +1213,38 @@ verifyProcess(unsigned int *errorTotal)
                 }
                 while (!protocolParallelDone(parallelExec));
 
+                // Save the ledgers so the next run only needs to verify new files and a sample of the files verified so far. Hold
+                // the backup lock while saving so the ledgers are not written while expire (or another verify) is modifying the
+                // archive. If the lock is not available the ledgers are not saved and the next run verifies more files.
+                if (jobData.ledger)
+                {
+                    if (lockAcquire(
+                            cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgOptionStr(cfgOptExecId), lockTypeBackup, 0,
+                            false))
+                    {
+                        for (unsigned int archiveIdx = 0; archiveIdx < lstSize(jobData.archiveIdResultList); archiveIdx++)
+                        {
+                            VerifyArchiveResult *archiveIdResult = lstGet(jobData.archiveIdResultList, archiveIdx);
+                            const String *archiveIdPath = strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(archiveIdResult->archiveId));
+
+                            // Skip archive ids that were removed while verify was running
+                            if ((verifyLedgerFileTotal(archiveIdResult->ledger) > 0 ||
+                                 verifyLedgerFileTotal(archiveIdResult->ledgerPrior) > 0) &&
+                                storagePathExistsP(storageRepo(), archiveIdPath))
+                            {
+                                verifyLedgerSaveFile(
+                                    archiveIdResult->ledger, storageRepoWrite(),
+                                    strNewFmt("%s/" VERIFY_LEDGER_FILE, strZ(archiveIdPath)),
+                                    cipherType(cfgOptionStr(cfgOptRepoCipherType)), jobData.walCipherPass);
+                            }
+                        }
+
+                        lockRelease(true);
+                    }
+                    else
+                        LOG_WARN("unable to acquire backup lock, verify ledger not saved");
+                }
+
                 // ??? Need to do the final reconciliation - checking backup required WAL against, valid WAL
 
                 // Report results
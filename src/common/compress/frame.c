@@ -0,0 +1,417 @@
+/***********************************************************************************************************************************
+Compress Frames
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/compress/frame.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/list.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define COMPRESS_FRAME_TYPE                                         CompressFrame
+#define COMPRESS_FRAME_PREFIX                                       compressFrame
+
+typedef struct CompressFrameEntry
+{
+    uint32_t compressedSize;                                        // Compressed size of the frame
+    uint32_t size;                                                  // Uncompressed size of the frame
+} CompressFrameEntry;
+
+typedef struct CompressFrame
+{
+    MemContext *memContext;                                         // Context to store data
+    IoFilter *(*compressNew)(int);                                  // Constructor for the compression filter used for each frame
+    int level;                                                      // Compression level
+    size_t frameSize;                                               // Uncompressed size of each frame
+
+    IoFilter *compress;                                             // Compression filter for the current frame
+    size_t frameInput;                                              // Uncompressed bytes in the current frame
+    size_t frameOutput;                                             // Compressed bytes in the current frame
+    List *frameList;                                                // List of completed frames
+
+    Buffer *input;                                                  // Input that crosses a frame boundary
+    bool inputPartial;                                              // Is the current frame processing partial input?
+    size_t inputOffset;                                             // Offset of input not yet processed
+    Buffer *index;                                                  // Index written after the last frame
+    size_t indexOffset;                                             // Offset of index not yet written
+
+    bool inputSame;                                                 // Is the same input required on the next process call?
+    bool flushing;                                                  // Is input complete and flushing in progress?
+    bool done;                                                      // Is compression done?
+} CompressFrame;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+compressFrameToLog(const CompressFrame *this)
+{
+    return strNewFmt(
+        "{frameSize: %zu, frameTotal: %u, inputSame: %s, flushing: %s, done: %s}", this->frameSize, lstSize(this->frameList),
+        cvtBoolToConstZ(this->inputSame), cvtBoolToConstZ(this->flushing), cvtBoolToConstZ(this->done));
+}
+
+#define FUNCTION_LOG_COMPRESS_FRAME_TYPE                                                                                           \
+    CompressFrame *
+#define FUNCTION_LOG_COMPRESS_FRAME_FORMAT(value, buffer, bufferSize)                                                              \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, compressFrameToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Render the index in the zstd seekable format. All integers are little-endian.
+***********************************************************************************************************************************/
+static void
+compressFrameIndexPut(unsigned char *buffer, uint32_t value)
+{
+    buffer[0] = (unsigned char)value;
+    buffer[1] = (unsigned char)(value >> 8);
+    buffer[2] = (unsigned char)(value >> 16);
+    buffer[3] = (unsigned char)(value >> 24);
+}
+
+static uint32_t
+compressFrameIndexGet(const unsigned char *buffer)
+{
+    return (uint32_t)buffer[0] | (uint32_t)buffer[1] << 8 | (uint32_t)buffer[2] << 16 | (uint32_t)buffer[3] << 24;
+}
+
+static Buffer *
+compressFrameIndex(const CompressFrame *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(COMPRESS_FRAME, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    const unsigned int frameTotal = lstSize(this->frameList);
+    const size_t indexSize = frameTotal * COMPRESS_FRAME_ENTRY_SIZE + COMPRESS_FRAME_FOOTER_SIZE;
+    Buffer *result = bufNew(COMPRESS_FRAME_HEADER_SIZE + indexSize);
+    unsigned char *index = bufPtr(result);
+
+    // Skippable frame header
+    compressFrameIndexPut(index, COMPRESS_FRAME_SKIPPABLE_MAGIC);
+    compressFrameIndexPut(index + 4, (uint32_t)indexSize);
+    index += COMPRESS_FRAME_HEADER_SIZE;
+
+    // Frame entries
+    for (unsigned int frameIdx = 0; frameIdx < frameTotal; frameIdx++)
+    {
+        const CompressFrameEntry *frame = lstGet(this->frameList, frameIdx);
+
+        compressFrameIndexPut(index, frame->compressedSize);
+        compressFrameIndexPut(index + 4, frame->size);
+        index += COMPRESS_FRAME_ENTRY_SIZE;
+    }
+
+    // Footer with no checksums in the descriptor
+    compressFrameIndexPut(index, frameTotal);
+    index[4] = 0;
+    compressFrameIndexPut(index + 5, COMPRESS_FRAME_INDEX_MAGIC);
+
+    bufUsedSet(result, bufSize(result));
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/***********************************************************************************************************************************
+Compress data
+***********************************************************************************************************************************/
+static void
+compressFrameProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
+{
+    THIS(CompressFrame);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(COMPRESS_FRAME, this);
+        FUNCTION_LOG_PARAM(BUFFER, uncompressed);
+        FUNCTION_LOG_PARAM(BUFFER, compressed);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->done);
+    ASSERT(compressed != NULL);
+    ASSERT(!this->flushing || uncompressed == NULL);
+
+    // Flushing
+    if (uncompressed == NULL)
+        this->flushing = true;
+    // Start at the beginning of new input
+    else if (!this->inputSame)
+        this->inputOffset = 0;
+
+    while (!this->done && !bufFull(compressed))
+    {
+        // Write the index after the last frame
+        if (this->index != NULL)
+        {
+            size_t indexSize = bufUsed(this->index) - this->indexOffset;
+
+            if (indexSize > bufRemains(compressed))
+                indexSize = bufRemains(compressed);
+
+            bufCatSub(compressed, this->index, this->indexOffset, indexSize);
+            this->indexOffset += indexSize;
+            this->done = this->indexOffset == bufUsed(this->index);
+        }
+        // Else the index is written once all frames are complete. An empty frame is only written when there is no other output so
+        // the result is always valid compressed data.
+        else if (this->compress == NULL && this->flushing && lstSize(this->frameList) > 0)
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->index = compressFrameIndex(this);
+            }
+            MEM_CONTEXT_END();
+        }
+        else
+        {
+            const Buffer *input = NULL;
+
+            // Continue with partial input that the compression filter did not accept on the last call
+            if (this->inputPartial)
+            {
+                input = this->input;
+            }
+            // Else add input to the frame until it is full
+            else if (!this->flushing && this->frameInput < this->frameSize)
+            {
+                // Stop when more input is required
+                if (this->inputOffset == bufUsed(uncompressed))
+                    break;
+
+                size_t inputSize = bufUsed(uncompressed) - this->inputOffset;
+
+                // Use input directly when it is all part of this frame, otherwise copy the part that belongs to this frame
+                if (this->inputOffset == 0 && inputSize <= this->frameSize - this->frameInput)
+                    input = uncompressed;
+                else
+                {
+                    if (inputSize > this->frameSize - this->frameInput)
+                        inputSize = this->frameSize - this->frameInput;
+
+                    bufUsedZero(this->input);
+                    bufCatSub(this->input, uncompressed, this->inputOffset, inputSize);
+
+                    input = this->input;
+                    this->inputPartial = true;
+                }
+            }
+
+            // Start a new frame
+            if (this->compress == NULL)
+            {
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    this->compress = this->compressNew(this->level);
+                }
+                MEM_CONTEXT_END();
+            }
+
+            // Compress input or flush the frame when it is full or input is complete
+            const size_t compressedBegin = bufUsed(compressed);
+
+            ioFilterProcessInOut(this->compress, input, compressed);
+            this->frameOutput += bufUsed(compressed) - compressedBegin;
+
+            // Input was accepted by the compression filter
+            if (input != NULL && !ioFilterInputSame(this->compress))
+            {
+                this->inputOffset += bufUsed(input);
+                this->frameInput += bufUsed(input);
+                this->inputPartial = false;
+            }
+            // Else the frame is complete when the compression filter is done
+            else if (input == NULL && ioFilterDone(this->compress))
+            {
+                CHECK(this->frameOutput <= UINT32_MAX);
+
+                lstAdd(
+                    this->frameList,
+                    &(CompressFrameEntry){.compressedSize = (uint32_t)this->frameOutput, .size = (uint32_t)this->frameInput});
+
+                ioFilterFree(this->compress);
+                this->compress = NULL;
+                this->frameInput = 0;
+                this->frameOutput = 0;
+            }
+        }
+    }
+
+    // Can more input be provided on the next call?
+    this->inputSame = this->flushing ? !this->done : this->inputOffset < bufUsed(uncompressed);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is compress done?
+***********************************************************************************************************************************/
+static bool
+compressFrameDone(const THIS_VOID)
+{
+    THIS(const CompressFrame);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(COMPRESS_FRAME, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->done);
+}
+
+/***********************************************************************************************************************************
+Is the same input required on the next process call?
+***********************************************************************************************************************************/
+static bool
+compressFrameInputSame(const THIS_VOID)
+{
+    THIS(const CompressFrame);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(COMPRESS_FRAME, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+compressFrameNew(const String *type, IoFilter *(*compressNew)(int), int level, size_t frameSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STRING, type);
+        FUNCTION_LOG_PARAM(FUNCTIONP, compressNew);
+        FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(SIZE, frameSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(type != NULL);
+    ASSERT(compressNew != NULL);
+    ASSERT(frameSize > 0 && frameSize <= UINT32_MAX / 2);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("CompressFrame")
+    {
+        CompressFrame *driver = memNew(sizeof(CompressFrame));
+
+        *driver = (CompressFrame)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .compressNew = compressNew,
+            .level = level,
+            .frameSize = frameSize,
+            .frameList = lstNewP(sizeof(CompressFrameEntry)),
+            .input = bufNew(0),
+        };
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewInt(level));
+        varLstAdd(paramList, varNewUInt64(frameSize));
+
+        // Create filter interface
+        this = ioFilterNewP(
+            type, driver, paramList, .done = compressFrameDone, .inOut = compressFrameProcess, .inputSame = compressFrameInputSame);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+/**********************************************************************************************************************************/
+size_t
+compressFrameIndexSize(const Buffer *footer)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, footer);
+    FUNCTION_TEST_END();
+
+    ASSERT(footer != NULL);
+    ASSERT(bufUsed(footer) == COMPRESS_FRAME_FOOTER_SIZE);
+
+    size_t result = 0;
+
+    if (compressFrameIndexGet(bufPtrConst(footer) + 5) == COMPRESS_FRAME_INDEX_MAGIC)
+    {
+        // Entries are larger when the descriptor indicates that each entry has a checksum
+        const size_t entrySize = COMPRESS_FRAME_ENTRY_SIZE + (bufPtrConst(footer)[4] & COMPRESS_FRAME_DESCRIPTOR_CHECKSUM ? 4 : 0);
+
+        result =
+            COMPRESS_FRAME_HEADER_SIZE + compressFrameIndexGet(bufPtrConst(footer)) * entrySize + COMPRESS_FRAME_FOOTER_SIZE;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+CompressFrameRange
+compressFrameIndexRange(const Buffer *index, uint64_t offset, uint64_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, index);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+        FUNCTION_TEST_PARAM(UINT64, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(index != NULL);
+
+    const unsigned char *indexPtr = bufPtrConst(index);
+    const size_t indexSize = bufUsed(index);
+
+    // Check that the index is a skippable frame with a valid footer and at least one frame
+    if (indexSize < COMPRESS_FRAME_HEADER_SIZE + COMPRESS_FRAME_ENTRY_SIZE + COMPRESS_FRAME_FOOTER_SIZE ||
+        compressFrameIndexGet(indexPtr) != COMPRESS_FRAME_SKIPPABLE_MAGIC ||
+        compressFrameIndexGet(indexPtr + 4) != indexSize - COMPRESS_FRAME_HEADER_SIZE ||
+        compressFrameIndexSize(BUF(indexPtr + indexSize - COMPRESS_FRAME_FOOTER_SIZE, COMPRESS_FRAME_FOOTER_SIZE)) != indexSize)
+    {
+        THROW(FormatError, "invalid compress frame index");
+    }
+
+    // Find the frames that contain the range
+    const unsigned char *footer = indexPtr + indexSize - COMPRESS_FRAME_FOOTER_SIZE;
+    const unsigned int frameTotal = compressFrameIndexGet(footer);
+    const size_t entrySize = (indexSize - COMPRESS_FRAME_HEADER_SIZE - COMPRESS_FRAME_FOOTER_SIZE) / frameTotal;
+
+    CompressFrameRange result = {0};
+    uint64_t frameOffset = 0;
+    uint64_t frameBegin = 0;
+    bool found = false;
+    bool done = false;
+
+    for (unsigned int frameIdx = 0; frameIdx < frameTotal && !done; frameIdx++)
+    {
+        const unsigned char *entry = indexPtr + COMPRESS_FRAME_HEADER_SIZE + frameIdx * entrySize;
+        const uint32_t frameCompressedSize = compressFrameIndexGet(entry);
+        const uint64_t frameEnd = frameBegin + compressFrameIndexGet(entry + 4);
+
+        // The first frame contains the offset. If the offset is past the end of the data then use the last frame.
+        if (!found && (offset < frameEnd || frameIdx == frameTotal - 1))
+        {
+            result.offset = frameOffset;
+            result.skip = offset - frameBegin;
+            found = true;
+        }
+
+        // Add frames until the end of the range is reached
+        if (found)
+        {
+            result.size += frameCompressedSize;
+            done = frameEnd - offset >= size;
+        }
+
+        frameOffset += frameCompressedSize;
+        frameBegin = frameEnd;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
@@ -0,0 +1,68 @@
+/***********************************************************************************************************************************
+Compress Frames
+
+Compress IO in independently decodable frames of a fixed uncompressed size, followed by an index of the frames. Each frame is
+compressed with a new compression filter so any frame can be decompressed without decompressing the frames before it.
+
+The index is written in the zstd seekable format, i.e. a skippable frame containing the compressed and uncompressed size of each
+frame followed by a footer with the number of frames and a magic number. Skippable frames are ignored by the zstd and lz4
+decompressors so framed files can still be decompressed by the command-line tools or as a single stream. Only compression types
+with skippable frames (lz4, zst) support frames.
+
+Frames are decompressed sequentially. Restore does not yet decode the frames of a file in parallel but the index allows a range of
+frames to be read independently (see storage/range.h).
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_FRAME_H
+#define COMMON_COMPRESS_FRAME_H
+
+#include <stdint.h>
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Index constants
+***********************************************************************************************************************************/
+#define COMPRESS_FRAME_SKIPPABLE_MAGIC                              0x184D2A5E
+#define COMPRESS_FRAME_INDEX_MAGIC                                  0x8F92EAB1
+
+// Size of the skippable frame header (magic and size)
+#define COMPRESS_FRAME_HEADER_SIZE                                  8
+
+// Size of each index entry (compressed and uncompressed size)
+#define COMPRESS_FRAME_ENTRY_SIZE                                   8
+
+// Size of the index footer (number of frames, descriptor, and magic)
+#define COMPRESS_FRAME_FOOTER_SIZE                                  9
+
+// Descriptor flag indicating that each index entry includes a checksum. The checksum is not written or verified.
+#define COMPRESS_FRAME_DESCRIPTOR_CHECKSUM                          0x80
+
+/***********************************************************************************************************************************
+Frames required to read a range of uncompressed data
+***********************************************************************************************************************************/
+typedef struct CompressFrameRange
+{
+    uint64_t offset;                                                // Offset of the first frame in the compressed data
+    uint64_t size;                                                  // Compressed size of the frames
+    uint64_t skip;                                                  // Uncompressed bytes to skip in the first frame
+} CompressFrameRange;
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// Create a filter that compresses frames of frameSize uncompressed bytes using the specified compression filter constructor. The
+// filter type and level are used to create the param list so the filter can be recreated remotely with compressFilterVar().
+IoFilter *compressFrameNew(const String *type, IoFilter *(*compressNew)(int), int level, size_t frameSize);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Get the size of the index from the footer, i.e. the last COMPRESS_FRAME_FOOTER_SIZE bytes of the compressed data. Zero is
+// returned when there is no index, e.g. the data was not compressed in frames.
+size_t compressFrameIndexSize(const Buffer *footer);
+
+// Find the frames required to read an uncompressed range using the index, i.e. the last compressFrameIndexSize() bytes of the
+// compressed data. If the range extends past the end of the data then the range is reduced. At least one frame is always returned.
+CompressFrameRange compressFrameIndexRange(const Buffer *index, uint64_t offset, uint64_t size);
+
+#endif
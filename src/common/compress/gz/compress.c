@@ -6,6 +6,10 @@ Gz Compress
 #include <stdio.h>
 #include <zlib.h>
 
+#ifdef HAVE_LIBDEFLATE
+    #include <libdeflate.h>
+#endif
+
 #include "common/compress/gz/common.h"
 #include "common/compress/gz/compress.h"
 #include "common/debug.h"
@@ -30,6 +34,17 @@ typedef struct GzCompress
     MemContext *memContext;                                         // Context to store data
     z_stream stream;                                                // Compression stream state
 
+#ifdef HAVE_LIBDEFLATE
+    struct libdeflate_compressor *compressor;                       // Block compressor (NULL when streaming)
+    int level;                                                      // Compression level used when streaming
+    Buffer *block;                                                  // Uncompressed block
+    Buffer *output;                                                 // Compressed block
+    size_t outputPos;                                               // Position of compressed data not yet output
+    size_t inputPos;                                                // Position of input not yet copied to the block
+    bool blockStream;                                               // Is the block being streamed before the rest of the input?
+    bool flushed;                                                   // Has the block been compressed?
+#endif
+
     bool inputSame;                                                 // Is the same input required on the next process call?
     bool flushing;                                                  // Is input complete and flushing in progress?
     bool done;                                                      // Is compression done?
@@ -56,20 +71,30 @@ Compression constants
 ***********************************************************************************************************************************/
 #define MEM_LEVEL                                                   9
 
+// When libdeflate is enabled input up to the block size is compressed in a single call. Larger input is streamed with zlib so the
+// output is always a single gzip member, which is required by older versions of pgBackRest that stop reading at the end of the
+// first member. WAL segments and relation files are larger than the block so they are always compressed with zlib.
+#define GZ_COMPRESS_BLOCK_SIZE                                      ((size_t)1024 * 1024)
+
 /***********************************************************************************************************************************
 Free deflate stream
 ***********************************************************************************************************************************/
 OBJECT_DEFINE_FREE_RESOURCE_BEGIN(GZ_COMPRESS, LOG, logLevelTrace)
 {
+#ifdef HAVE_LIBDEFLATE
+    if (this->compressor != NULL)
+        libdeflate_free_compressor(this->compressor);
+#endif
+
     deflateEnd(&this->stream);
 }
 OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
 
 /***********************************************************************************************************************************
-Compress data
+Compress data with zlib streaming
 ***********************************************************************************************************************************/
 static void
-gzCompressProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
+gzCompressProcessStream(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
 {
     THIS(GzCompress);
 
@@ -124,6 +149,160 @@ gzCompressProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+#ifndef HAVE_LIBDEFLATE
+    #define gzCompressProcess                                       gzCompressProcessStream
+#else
+
+/***********************************************************************************************************************************
+Switch to zlib streaming when the input does not fit in the block or the block compressor cannot be created
+***********************************************************************************************************************************/
+static void
+gzCompressStreamInit(GzCompress *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(GZ_COMPRESS, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    gzError(deflateInit2(&this->stream, this->level, Z_DEFLATED, WANT_GZ | WINDOW_BITS, MEM_LEVEL, Z_DEFAULT_STRATEGY));
+
+    if (this->compressor != NULL)
+    {
+        libdeflate_free_compressor(this->compressor);
+        this->compressor = NULL;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Compress data with libdeflate when it fits in the block, else stream with zlib
+***********************************************************************************************************************************/
+static void
+gzCompressProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
+{
+    THIS(GzCompress);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(GZ_COMPRESS, this);
+        FUNCTION_LOG_PARAM(BUFFER, uncompressed);
+        FUNCTION_LOG_PARAM(BUFFER, compressed);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->done);
+    ASSERT(compressed != NULL);
+    ASSERT(!this->flushing || uncompressed == NULL);
+
+    // Copy input to the block and compress the block when input is complete
+    if (this->compressor != NULL)
+    {
+        // Flushing
+        if (uncompressed == NULL)
+            this->flushing = true;
+        // Start at the beginning of new input
+        else if (!this->inputSame)
+            this->inputPos = 0;
+
+        while (!bufFull(compressed))
+        {
+            // Output compressed data left over from the block
+            if (this->output != NULL && this->outputPos < bufUsed(this->output))
+            {
+                size_t outputSize = bufUsed(this->output) - this->outputPos;
+
+                if (outputSize > bufRemains(compressed))
+                    outputSize = bufRemains(compressed);
+
+                bufCatSub(compressed, this->output, this->outputPos, outputSize);
+                this->outputPos += outputSize;
+            }
+            // Else copy input into the block
+            else if (uncompressed != NULL && this->inputPos < bufUsed(uncompressed))
+            {
+                // If the block is full then stream the block followed by the rest of the input
+                if (bufFull(this->block))
+                {
+                    gzCompressStreamInit(this);
+
+                    this->stream.avail_in = (unsigned int)bufUsed(this->block);
+                    this->stream.next_in = bufPtr(this->block);
+                    this->blockStream = true;
+
+                    break;
+                }
+
+                size_t inputSize = bufUsed(uncompressed) - this->inputPos;
+
+                if (inputSize > bufRemains(this->block))
+                    inputSize = bufRemains(this->block);
+
+                bufCatSub(this->block, uncompressed, this->inputPos, inputSize);
+                this->inputPos += inputSize;
+            }
+            // Else compress the block in a single call when input is complete
+            else if (this->flushing && !this->flushed)
+            {
+                this->output = bufNew(libdeflate_gzip_compress_bound(this->compressor, bufUsed(this->block)));
+
+                size_t outputSize = libdeflate_gzip_compress(
+                    this->compressor, bufPtr(this->block), bufUsed(this->block), bufPtr(this->output), bufSize(this->output));
+
+                // The output buffer is allocated using the compress bound so the compressed block must fit
+                CHECK(outputSize != 0);
+
+                bufUsedSet(this->output, outputSize);
+                this->flushed = true;
+            }
+            else
+                break;
+        }
+
+        if (!this->blockStream)
+        {
+            // Is compression done?
+            this->done = this->flushed && this->outputPos == bufUsed(this->output);
+
+            // Can more input be provided on the next call?
+            this->inputSame = this->flushing ? !this->done : this->inputPos < bufUsed(uncompressed);
+        }
+    }
+
+    // Stream the block before the rest of the input
+    if (this->blockStream)
+    {
+        ASSERT(uncompressed != NULL);
+
+        this->stream.avail_out = (unsigned int)bufRemains(compressed);
+        this->stream.next_out = bufPtr(compressed) + bufUsed(compressed);
+
+        gzError(deflate(&this->stream, Z_NO_FLUSH));
+
+        bufUsedSet(compressed, bufSize(compressed) - (size_t)this->stream.avail_out);
+
+        // When the block is done continue with the input that was not copied to the block
+        if (this->stream.avail_in == 0)
+        {
+            this->stream.avail_in = (unsigned int)(bufUsed(uncompressed) - this->inputPos);
+            this->stream.next_in = UNCONSTIFY(unsigned char *, bufPtrConst(uncompressed)) + this->inputPos;
+            this->blockStream = false;
+        }
+
+        // The rest of the input is still required
+        this->inputSame = true;
+    }
+
+    // Stream input that did not fit in the block
+    if (this->compressor == NULL && !this->blockStream && !bufFull(compressed))
+        gzCompressProcessStream(this, uncompressed, compressed);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+#endif // HAVE_LIBDEFLATE
+
+
 /***********************************************************************************************************************************
 Is compress done?
 ***********************************************************************************************************************************/
@@ -180,12 +359,24 @@ gzCompressNew(int level)
             .stream = {.zalloc = NULL},
         };
 
-        // Create gz stream
-        gzError(deflateInit2(&driver->stream, level, Z_DEFLATED, WANT_GZ | WINDOW_BITS, MEM_LEVEL, Z_DEFAULT_STRATEGY));
-
         // Set free callback to ensure gz context is freed
         memContextCallbackSet(driver->memContext, gzCompressFreeResource, driver);
 
+#ifdef HAVE_LIBDEFLATE
+        // Create block compressor. The zlib default level is the same as the libdeflate default level. Older versions of libdeflate
+        // do not support level 0 so stream with zlib when the compressor cannot be created.
+        driver->level = level;
+        driver->compressor = libdeflate_alloc_compressor(level == -1 ? 6 : level);
+
+        if (driver->compressor != NULL)
+            driver->block = bufNew(GZ_COMPRESS_BLOCK_SIZE);
+        else
+            gzCompressStreamInit(driver);
+#else
+        // Create gz stream
+        gzError(deflateInit2(&driver->stream, level, Z_DEFLATED, WANT_GZ | WINDOW_BITS, MEM_LEVEL, Z_DEFAULT_STRATEGY));
+#endif
+
         // Create param list
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewInt(level));
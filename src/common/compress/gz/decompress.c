@@ -51,6 +51,12 @@ gzDecompressToLog(const GzDecompress *this)
 #define FUNCTION_LOG_GZ_DECOMPRESS_FORMAT(value, buffer, bufferSize)                                                               \
     FUNCTION_LOG_STRING_OBJECT_FORMAT(value, gzDecompressToLog, buffer, bufferSize)
 
+/***********************************************************************************************************************************
+First two bytes of a gzip member (RFC 1952)
+***********************************************************************************************************************************/
+#define GZ_MAGIC_1                                                  0x1f
+#define GZ_MAGIC_2                                                  0x8b
+
 /***********************************************************************************************************************************
 Free inflate stream
 ***********************************************************************************************************************************/
@@ -77,32 +83,51 @@ gzDecompressProcess(THIS_VOID, const Buffer *compressed, Buffer *uncompressed)
     ASSERT(this != NULL);
     ASSERT(uncompressed != NULL);
 
-    // There should never be a flush because in a valid compressed stream the end of data can be determined and done will be set.
-    // If a flush is received it means the compressed stream terminated early, e.g. a zero-length or truncated file.
+    // A flush is only valid after a complete gzip member. Otherwise the compressed stream terminated early, e.g. a zero-length or
+    // truncated file.
     if (compressed == NULL)
-        THROW(FormatError, "unexpected eof in compressed data");
-
-    if (!this->inputSame)
     {
-        this->stream.avail_in = (unsigned int)bufUsed(compressed);
+        if (this->result != Z_STREAM_END)
+            THROW(FormatError, "unexpected eof in compressed data");
 
-        // Not all versions of zlib (and none by default) will accept const input buffers
-        this->stream.next_in = UNCONSTIFY(unsigned char *, bufPtrConst(compressed));
+        this->done = true;
     }
+    else
+    {
+        if (!this->inputSame)
+        {
+            this->stream.avail_in = (unsigned int)bufUsed(compressed);
 
-    this->stream.avail_out = (unsigned int)bufRemains(uncompressed);
-    this->stream.next_out = bufPtr(uncompressed) + bufUsed(uncompressed);
+            // Not all versions of zlib (and none by default) will accept const input buffers
+            this->stream.next_in = UNCONSTIFY(unsigned char *, bufPtrConst(compressed));
+        }
 
-    this->result = gzError(inflate(&this->stream, Z_NO_FLUSH));
+        // Concatenated gzip members are valid gzip (e.g. written by the gzip command-line tool) so start a new member when a gzip
+        // header follows the end of the prior member. Any other data after a member is ignored, as it was by prior versions and is
+        // by the gzip command-line tool, so decompression is done.
+        if (this->result == Z_STREAM_END && this->stream.avail_in != 0)
+        {
+            if (this->stream.next_in[0] != GZ_MAGIC_1 || (this->stream.avail_in > 1 && this->stream.next_in[1] != GZ_MAGIC_2))
+                this->done = true;
+            else
+                gzError(inflateReset(&this->stream));
+        }
+
+        // Inflate unless the member is complete and there is no more input or decompression is done
+        if (this->result != Z_STREAM_END || (this->stream.avail_in != 0 && !this->done))
+        {
+            this->stream.avail_out = (unsigned int)bufRemains(uncompressed);
+            this->stream.next_out = bufPtr(uncompressed) + bufUsed(uncompressed);
 
-    // Set buffer used space
-    bufUsedSet(uncompressed, bufSize(uncompressed) - (size_t)this->stream.avail_out);
+            this->result = gzError(inflate(&this->stream, Z_NO_FLUSH));
 
-    // Is decompression done?
-    this->done = this->result == Z_STREAM_END;
+            // Set buffer used space
+            bufUsedSet(uncompressed, bufSize(uncompressed) - (size_t)this->stream.avail_out);
+        }
 
-    // Is the same input expected on the next call?
-    this->inputSame = this->done ? false : this->stream.avail_in != 0;
+        // Is the same input expected on the next call?
+        this->inputSame = this->done ? false : this->stream.avail_in != 0;
+    }
 
     FUNCTION_LOG_RETURN_VOID();
 }
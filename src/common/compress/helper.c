@@ -6,6 +6,7 @@ Compression Helper
 #include <string.h>
 
 #include "common/compress/helper.h"
+#include "common/compress/frame.h"
 #include "common/compress/bz2/common.h"
 #include "common/compress/bz2/compress.h"
 #include "common/compress/bz2/decompress.h"
@@ -39,6 +40,7 @@ static const struct CompressHelperLocal
     const String *const ext;                                        // File extension with period prefixed
     const char *compressType;                                       // Type of the compression filter
     IoFilter *(*compressNew)(int);                                  // Function to create new compression filter
+    bool frame;                                                     // Does the type support independent frames?
     const char *decompressType;                                     // Type of the decompression filter
     IoFilter *(*decompressNew)(void);                               // Function to create new decompression filter
     int levelDefault;                                               // Default compression level
@@ -72,6 +74,7 @@ static const struct CompressHelperLocal
 #ifdef HAVE_LIBLZ4
         .compressType = LZ4_COMPRESS_FILTER_TYPE,
         .compressNew = lz4CompressNew,
+        .frame = true,
         .decompressType = LZ4_DECOMPRESS_FILTER_TYPE,
         .decompressNew = lz4DecompressNew,
         .levelDefault = 1,
@@ -83,6 +86,7 @@ static const struct CompressHelperLocal
 #ifdef HAVE_LIBZST
         .compressType = ZST_COMPRESS_FILTER_TYPE,
         .compressNew = zstCompressNew,
+        .frame = true,
         .decompressType = ZST_DECOMPRESS_FILTER_TYPE,
         .decompressNew = zstDecompressNew,
         .levelDefault = 3,
@@ -206,6 +210,40 @@ compressFilter(CompressType type, int level)
     FUNCTION_TEST_RETURN(compressHelperLocal[type].compressNew(level));
 }
 
+/**********************************************************************************************************************************/
+bool
+compressTypeFrame(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+
+    FUNCTION_TEST_RETURN(compressHelperLocal[type].frame);
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+compressFilterFrame(CompressType type, int level, size_t frameSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(INT, level);
+        FUNCTION_TEST_PARAM(SIZE, frameSize);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+    ASSERT(type != compressTypeNone);
+    compressTypePresent(type);
+
+    const struct CompressHelperLocal *compress = &compressHelperLocal[type];
+
+    FUNCTION_TEST_RETURN(
+        compress->frame && frameSize > 0 ?
+            compressFrameNew(STR(compress->compressType), compress->compressNew, level, frameSize) : compress->compressNew(level));
+}
+
 /**********************************************************************************************************************************/
 IoFilter *
 compressFilterVar(const String *filterType, const VariantList *filterParamList)
@@ -225,7 +263,13 @@ compressFilterVar(const String *filterType, const VariantList *filterParamList)
 
         if (compress->compressType != NULL && strEqZ(filterType, compress->compressType))
         {
-            result = compress->compressNew(varIntForce(varLstGet(filterParamList, 0)));
+            // A frame size is only included in the param list when frames are enabled
+            result =
+                varLstSize(filterParamList) > 1 ?
+                    compressFrameNew(
+                        filterType, compress->compressNew, varIntForce(varLstGet(filterParamList, 0)),
+                        (size_t)varUInt64Force(varLstGet(filterParamList, 1))) :
+                    compress->compressNew(varIntForce(varLstGet(filterParamList, 0)));
             break;
         }
         else if (compress->decompressType != NULL && strEqZ(filterType, compress->decompressType))
@@ -55,6 +55,13 @@ CompressType compressTypeFromName(const String *name);
 // Compression filter for the specified type.  Error when compress type is none or invalid.
 IoFilter *compressFilter(CompressType type, int level);
 
+// Does the compression type support independently decodable frames?
+bool compressTypeFrame(CompressType type);
+
+// Compression filter that writes independently decodable frames of frameSize uncompressed bytes followed by a frame index. When the
+// compression type does not support frames or frameSize is zero this is the same as compressFilter().
+IoFilter *compressFilterFrame(CompressType type, int level, size_t frameSize);
+
 // Compression/decompression filter based on string type and a parameter list.  This is useful when a filter must be created on a
 // remote system since the filter type and parameters can be passed through a protocol.
 IoFilter *compressFilterVar(const String *filterType, const VariantList *filterParamList);
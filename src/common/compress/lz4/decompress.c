@@ -93,21 +93,26 @@ lz4DecompressProcess(THIS_VOID, const Buffer *compressed, Buffer *decompressed)
     }
     else
     {
-        // Decompress as much data as possible
-        size_t srcSize = bufUsed(compressed) - this->inputOffset;
-        size_t dstSize = bufRemains(decompressed);
+        // Decompress as much data as possible. Decompression stops at the end of each frame so continue with the next frame when
+        // there is more compressed data and space for output.
+        do
+        {
+            size_t srcSize = bufUsed(compressed) - this->inputOffset;
+            size_t dstSize = bufRemains(decompressed);
 
-        this->frameDone = lz4Error(
-            LZ4F_decompress(
-                this->context, bufRemainsPtr(decompressed), &dstSize, bufPtrConst(compressed) + this->inputOffset, &srcSize,
-                NULL)) == 0;
+            this->frameDone = lz4Error(
+                LZ4F_decompress(
+                    this->context, bufRemainsPtr(decompressed), &dstSize, bufPtrConst(compressed) + this->inputOffset, &srcSize,
+                    NULL)) == 0;
 
-        bufUsedInc(decompressed, dstSize);
+            bufUsedInc(decompressed, dstSize);
+            this->inputOffset += srcSize;
+        }
+        while (this->inputOffset < bufUsed(compressed) && !bufFull(decompressed));
 
-        // If the compressed data was not fully processed then update the offset and set inputSame
-        if (srcSize < bufUsed(compressed) - this->inputOffset)
+        // If the compressed data was not fully processed then set inputSame
+        if (this->inputOffset < bufUsed(compressed))
         {
-            this->inputOffset += srcSize;
             this->inputSame = true;
         }
         // Else all compressed data was processed
@@ -92,22 +92,29 @@ zstDecompressProcess(THIS_VOID, const Buffer *compressed, Buffer *decompressed)
     }
     else
     {
-        // Initialize input/output buffer
-        ZSTD_inBuffer in = {.src = bufPtrConst(compressed) + this->inputOffset, .size = bufUsed(compressed) - this->inputOffset};
-        ZSTD_outBuffer out = {.dst = bufRemainsPtr(decompressed), .size = bufRemains(decompressed)};
-
-        // Perform decompression. Track frame done so we can detect unexpected EOF.
-        this->frameDone = zstError(ZSTD_decompressStream(this->context, &out, &in)) == 0;
-        bufUsedInc(decompressed, out.pos);
-
-        // If the input buffer was not entirely consumed then set inputSame and store the offset where processing will restart
-        if (in.pos < in.size)
+        // Perform decompression. Decompression stops at the end of each frame so continue with the next frame when there is more
+        // compressed data and space for output.
+        do
         {
-            // Output buffer should be completely full
-            ASSERT(out.pos == out.size);
+            // Initialize input/output buffer
+            ZSTD_inBuffer in =
+            {
+                .src = bufPtrConst(compressed) + this->inputOffset,
+                .size = bufUsed(compressed) - this->inputOffset,
+            };
+            ZSTD_outBuffer out = {.dst = bufRemainsPtr(decompressed), .size = bufRemains(decompressed)};
+
+            // Track frame done so we can detect unexpected EOF
+            this->frameDone = zstError(ZSTD_decompressStream(this->context, &out, &in)) == 0;
+            bufUsedInc(decompressed, out.pos);
+            this->inputOffset += in.pos;
+        }
+        while (this->inputOffset < bufUsed(compressed) && !bufFull(decompressed));
 
+        // If the input buffer was not entirely consumed then set inputSame so processing will restart at the offset
+        if (this->inputOffset < bufUsed(compressed))
+        {
             this->inputSame = true;
-            this->inputOffset += in.pos;
         }
         // Else ready for more input
         else
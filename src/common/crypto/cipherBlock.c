@@ -29,8 +29,23 @@ Header constants and sizes
 #define CIPHER_BLOCK_MAGIC                                          "Salted__"
 #define CIPHER_BLOCK_MAGIC_SIZE                                     (sizeof(CIPHER_BLOCK_MAGIC) - 1)
 
-// Total length of cipher header
-#define CIPHER_BLOCK_HEADER_SIZE                                    (CIPHER_BLOCK_MAGIC_SIZE + PKCS5_SALT_LEN)
+// Magic constant for the chunked authenticated format. The format is not compatible with the openssl command-line tool so a
+// different magic is used, which also allows decrypt to determine the format from the header.
+#define CIPHER_BLOCK_MAGIC_AEAD                                     "SaltGcm1"
+
+// Plaintext size of each authenticated chunk. Each chunk is encrypted with its own nonce (the initialization vector xor'd with the
+// chunk number) and followed by a tag, so chunks can be encrypted, decrypted, and verified independently of each other. The last
+// chunk is authenticated as final so truncation at a chunk boundary is detected.
+#define CIPHER_BLOCK_AEAD_CHUNK_SIZE                                ((size_t)64 * 1024)
+
+// Size of a chunk in the file
+#define CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE                           (CIPHER_BLOCK_AEAD_CHUNK_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE)
+
+/***********************************************************************************************************************************
+Allow files in the unauthenticated format to be decrypted when the authenticated format is configured. This is off by default so
+that a file replaced with one in the unauthenticated format cannot be used to bypass authentication.
+***********************************************************************************************************************************/
+static bool cipherBlockCompat = false;
 
 /***********************************************************************************************************************************
 Object type
@@ -52,6 +67,13 @@ typedef struct CipherBlock
     const EVP_MD *digest;                                           // Message digest object
     EVP_CIPHER_CTX *cipherContext;                                  // Encrypt/decrypt context
 
+    bool aead;                                                      // Use the chunked authenticated format?
+    bool compat;                                                    // Decrypt unauthenticated format when authenticated configured?
+    unsigned char initVector[EVP_MAX_IV_LENGTH];                    // Initialization vector used to generate chunk nonces
+    uint64_t chunkNo;                                               // Number of the next chunk to process
+    bool final;                                                     // Is the last chunk processed the final chunk in the file?
+    Buffer *chunk;                                                  // Partial chunk waiting to be processed
+
     Buffer *buffer;                                                 // Internal buffer in case destination buffer isn't large enough
     bool inputSame;                                                 // Is the same input required on next process call?
     bool done;                                                      // Is processing done?
@@ -97,6 +119,13 @@ cipherBlockProcessSize(CipherBlock *this, size_t sourceSize)
     // Destination size is source size plus one extra block
     size_t destinationSize = sourceSize + EVP_MAX_BLOCK_LENGTH;
 
+    // The authenticated format may also output the partial chunk plus a tag for each chunk
+    if (this->aead)
+    {
+        size_t chunkSize = sourceSize + (this->chunk == NULL ? 0 : bufUsed(this->chunk));
+        destinationSize += chunkSize - sourceSize + (chunkSize / CIPHER_BLOCK_AEAD_CHUNK_SIZE + 1) * CIPHER_BLOCK_AEAD_TAG_SIZE;
+    }
+
     // On encrypt the header size must be included before the first block
     if (this->mode == cipherModeEncrypt && !this->saltDone)
         destinationSize += CIPHER_BLOCK_MAGIC_SIZE + PKCS5_SALT_LEN;
@@ -104,6 +133,128 @@ cipherBlockProcessSize(CipherBlock *this, size_t sourceSize)
     FUNCTION_LOG_RETURN(SIZE, destinationSize);
 }
 
+/***********************************************************************************************************************************
+Encrypt/decrypt the buffered chunk using the authenticated format
+***********************************************************************************************************************************/
+static size_t
+cipherBlockChunk(CipherBlock *this, bool final, unsigned char *destination)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(CIPHER_BLOCK, this);
+        FUNCTION_LOG_PARAM(BOOL, final);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->aead);
+    ASSERT(destination != NULL);
+
+    unsigned char *source = bufPtr(this->chunk);
+    size_t sourceSize = bufUsed(this->chunk);
+
+    // On decrypt the tag follows the data
+    if (this->mode == cipherModeDecrypt)
+    {
+        if (sourceSize < CIPHER_BLOCK_AEAD_TAG_SIZE)
+            THROW(CryptoError, "cipher data truncated");
+
+        sourceSize -= CIPHER_BLOCK_AEAD_TAG_SIZE;
+    }
+
+    // Generate the nonce for this chunk by xor'ing the chunk number into the end of the initialization vector
+    unsigned char nonce[EVP_MAX_IV_LENGTH];
+    int nonceSize = EVP_CIPHER_iv_length(this->cipher);
+
+    memcpy(nonce, this->initVector, (size_t)nonceSize);
+
+    for (int byteIdx = 0; byteIdx < 8; byteIdx++)
+        nonce[nonceSize - 1 - byteIdx] ^= (unsigned char)(this->chunkNo >> (byteIdx * 8));
+
+    cryptoError(!EVP_CipherInit_ex(this->cipherContext, NULL, NULL, NULL, nonce, -1), "unable to initialize cipher chunk");
+
+    // Authenticate whether this is the final chunk so truncation can be detected
+    const unsigned char finalData = final;
+    int destinationUpdateSize = 0;
+
+    cryptoError(
+        !EVP_CipherUpdate(this->cipherContext, NULL, &destinationUpdateSize, &finalData, 1), "unable to process cipher chunk");
+
+    // Process the data
+    cryptoError(
+        !EVP_CipherUpdate(this->cipherContext, destination, &destinationUpdateSize, source, (int)sourceSize),
+        "unable to process cipher chunk");
+
+    size_t destinationSize = (size_t)destinationUpdateSize;
+
+    // Set the expected tag on decrypt so it is verified when the chunk is finalized
+    if (this->mode == cipherModeDecrypt)
+    {
+        cryptoError(
+            !EVP_CIPHER_CTX_ctrl(this->cipherContext, EVP_CTRL_GCM_SET_TAG, CIPHER_BLOCK_AEAD_TAG_SIZE, source + sourceSize),
+            "unable to set cipher tag");
+    }
+
+    if (!EVP_CipherFinal_ex(this->cipherContext, destination + destinationSize, &destinationUpdateSize))
+        THROW(CryptoError, "cipher authentication failed");
+
+    destinationSize += (size_t)destinationUpdateSize;
+
+    // Append the tag on encrypt
+    if (this->mode == cipherModeEncrypt)
+    {
+        cryptoError(
+            !EVP_CIPHER_CTX_ctrl(
+                this->cipherContext, EVP_CTRL_GCM_GET_TAG, CIPHER_BLOCK_AEAD_TAG_SIZE, destination + destinationSize),
+            "unable to get cipher tag");
+
+        destinationSize += CIPHER_BLOCK_AEAD_TAG_SIZE;
+    }
+
+    this->chunkNo++;
+    bufUsedZero(this->chunk);
+
+    FUNCTION_LOG_RETURN(SIZE, destinationSize);
+}
+
+/***********************************************************************************************************************************
+Buffer data into chunks for the authenticated format. A full chunk is not processed until more data arrives since the last chunk
+must be marked as final.
+***********************************************************************************************************************************/
+static size_t
+cipherBlockProcessAead(CipherBlock *this, const unsigned char *source, size_t sourceSize, unsigned char *destination)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(CIPHER_BLOCK, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, source);
+        FUNCTION_LOG_PARAM(SIZE, sourceSize);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(source != NULL);
+    ASSERT(destination != NULL);
+
+    const size_t chunkSizeMax =
+        CIPHER_BLOCK_AEAD_CHUNK_SIZE + (this->mode == cipherModeDecrypt ? CIPHER_BLOCK_AEAD_TAG_SIZE : 0);
+    size_t destinationSize = 0;
+
+    while (sourceSize > 0)
+    {
+        if (bufUsed(this->chunk) == chunkSizeMax)
+            destinationSize += cipherBlockChunk(this, false, destination + destinationSize);
+
+        size_t copySize = chunkSizeMax - bufUsed(this->chunk) < sourceSize ? chunkSizeMax - bufUsed(this->chunk) : sourceSize;
+
+        memcpy(bufRemainsPtr(this->chunk), source, copySize);
+        bufUsedInc(this->chunk, copySize);
+
+        source += copySize;
+        sourceSize -= copySize;
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, destinationSize);
+}
+
 /***********************************************************************************************************************************
 Encrypt/decrypt data
 ***********************************************************************************************************************************/
@@ -133,7 +284,7 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
         if (this->mode == cipherModeEncrypt)
         {
             // Add magic to the destination buffer so openssl knows the file is salted
-            memcpy(destination, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE);
+            memcpy(destination, this->aead ? CIPHER_BLOCK_MAGIC_AEAD : CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE);
             destination += CIPHER_BLOCK_MAGIC_SIZE;
             destinationSize += CIPHER_BLOCK_MAGIC_SIZE;
 
@@ -158,8 +309,24 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
                 sourceSize -= CIPHER_BLOCK_HEADER_SIZE - this->headerSize;
 
                 // The first bytes of the file to decrypt should be equal to the magic.  If not then this is not an
-                // encrypted file, or at least not in a format we recognize.
-                if (memcmp(this->header, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) != 0)
+                // encrypted file, or at least not in a format we recognize. The magic determines the format so files written with
+                // the authenticated format can be decrypted when the unauthenticated format is configured, but not the reverse
+                // unless compatibility is enabled.
+                if (memcmp(this->header, CIPHER_BLOCK_MAGIC_AEAD, CIPHER_BLOCK_MAGIC_SIZE) == 0)
+                {
+                    this->aead = true;
+                    this->cipher = EVP_aes_256_gcm();
+                }
+                else if (memcmp(this->header, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) == 0)
+                {
+                    // Do not allow a downgrade to the unauthenticated format unless compatibility is enabled
+                    if (this->aead && !this->compat)
+                        THROW(CryptoError, "cipher header is aes-256-cbc but aes-256-gcm is required");
+
+                    this->aead = false;
+                    this->cipher = EVP_aes_256_cbc();
+                }
+                else
                     THROW(CryptoError, "cipher header invalid");
             }
             // Else copy what was provided into the header buffer and return 0
@@ -183,6 +350,18 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
             EVP_BytesToKey(
                 this->cipher, this->digest, salt, (unsigned char *)this->pass, (int)this->passSize, 1, key, initVector);
 
+            // The authenticated format generates a nonce for each chunk from the initialization vector
+            if (this->aead)
+            {
+                memcpy(this->initVector, initVector, sizeof(this->initVector));
+
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    this->chunk = bufNew(CIPHER_BLOCK_AEAD_CHUNK_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE);
+                }
+                MEM_CONTEXT_END();
+            }
+
             // Create context to track cipher
             cryptoError(!(this->cipherContext = EVP_CIPHER_CTX_new()), "unable to create context");
 
@@ -203,13 +382,18 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
     if (sourceSize > 0)
     {
         // Process the data
-        int destinationUpdateSize = 0;
+        if (this->aead)
+            destinationSize += cipherBlockProcessAead(this, source, sourceSize, destination);
+        else
+        {
+            int destinationUpdateSize = 0;
 
-        cryptoError(
-            !EVP_CipherUpdate(this->cipherContext, destination, &destinationUpdateSize, source, (int)sourceSize),
-            "unable to process cipher");
+            cryptoError(
+                !EVP_CipherUpdate(this->cipherContext, destination, &destinationUpdateSize, source, (int)sourceSize),
+                "unable to process cipher");
 
-        destinationSize += (size_t)destinationUpdateSize;
+            destinationSize += (size_t)destinationUpdateSize;
+        }
 
         // Note that data has been processed so flush is valid
         this->processDone = true;
@@ -234,18 +418,28 @@ cipherBlockFlush(CipherBlock *this, Buffer *destination)
     ASSERT(destination != NULL);
 
     // Actual destination size
-    int destinationSize = 0;
+    size_t destinationSize = 0;
 
     // If no header was processed then error
     if (!this->saltDone)
         THROW(CryptoError, "cipher header missing");
 
-    // Only flush remaining data if some data was processed
-    if (!EVP_CipherFinal(this->cipherContext, bufRemainsPtr(destination), &destinationSize))
-        THROW(CryptoError, "unable to flush");
+    // The authenticated format processes the remaining data as the final chunk unless only a range of chunks was read
+    if (this->aead)
+        destinationSize = cipherBlockChunk(this, this->final, bufRemainsPtr(destination));
+    // Else only flush remaining data if some data was processed
+    else
+    {
+        int destinationFinalSize = 0;
+
+        if (!EVP_CipherFinal(this->cipherContext, bufRemainsPtr(destination), &destinationFinalSize))
+            THROW(CryptoError, "unable to flush");
+
+        destinationSize = (size_t)destinationFinalSize;
+    }
 
     // Return actual destination size
-    FUNCTION_LOG_RETURN(SIZE, (size_t)destinationSize);
+    FUNCTION_LOG_RETURN(SIZE, destinationSize);
 }
 
 /***********************************************************************************************************************************
@@ -381,18 +575,23 @@ cipherBlockInputSame(const THIS_VOID)
 }
 
 /**********************************************************************************************************************************/
-IoFilter *
-cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const String *digestName)
+static IoFilter *
+cipherBlockNewInternal(
+    CipherMode mode, CipherType cipherType, const Buffer *pass, const String *digestName, bool compat, uint64_t chunkNo, bool final)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(ENUM, mode);
         FUNCTION_LOG_PARAM(ENUM, cipherType);
         FUNCTION_TEST_PARAM(BUFFER, pass);                          // Use FUNCTION_TEST so passphrase is not logged
         FUNCTION_LOG_PARAM(STRING, digestName);
+        FUNCTION_LOG_PARAM(BOOL, compat);
+        FUNCTION_LOG_PARAM(UINT64, chunkNo);
+        FUNCTION_LOG_PARAM(BOOL, final);
     FUNCTION_LOG_END();
 
     ASSERT(pass != NULL);
     ASSERT(bufUsed(pass) > 0);
+    ASSERT((chunkNo == 0 && final) || (mode == cipherModeDecrypt && cipherType == cipherTypeAes256Gcm && !compat));
 
     // Init crypto subsystem
     cryptoInit();
@@ -429,6 +628,10 @@ cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const
             .cipher = cipher,
             .digest = digest,
             .passSize = bufUsed(pass),
+            .aead = cipherType == cipherTypeAes256Gcm,
+            .compat = compat,
+            .chunkNo = chunkNo,
+            .final = final,
         };
 
         // Store the passphrase
@@ -443,6 +646,9 @@ cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const
         // However, since strings are used to hold the passphrase in the rest of the code this is currently valid.
         varLstAdd(paramList, varNewStr(strNewBuf(pass)));
         varLstAdd(paramList, digestName ? varNewStr(digestName) : NULL);
+        varLstAdd(paramList, varNewBool(compat));
+        varLstAdd(paramList, varNewUInt64(chunkNo));
+        varLstAdd(paramList, varNewBool(final));
 
         // Create filter interface
         this = ioFilterNewP(
@@ -454,12 +660,109 @@ cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const
     FUNCTION_LOG_RETURN(IO_FILTER, this);
 }
 
+IoFilter *
+cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const String *digestName)
+{
+    return cipherBlockNewInternal(mode, cipherType, pass, digestName, cipherBlockCompat, 0, true);
+}
+
+IoFilter *
+cipherBlockNewRange(const Buffer *pass, const String *digestName, uint64_t chunkNo, bool final)
+{
+    return cipherBlockNewInternal(cipherModeDecrypt, cipherTypeAes256Gcm, pass, digestName, false, chunkNo, final);
+}
+
 IoFilter *
 cipherBlockNewVar(const VariantList *paramList)
 {
-    return cipherBlockNew(
+    return cipherBlockNewInternal(
         (CipherMode)varUIntForce(varLstGet(paramList, 0)), (CipherType)varUIntForce(varLstGet(paramList, 1)),
-        BUFSTR(varStr(varLstGet(paramList, 2))), varLstGet(paramList, 3) == NULL ? NULL : varStr(varLstGet(paramList, 3)));
+        BUFSTR(varStr(varLstGet(paramList, 2))), varLstGet(paramList, 3) == NULL ? NULL : varStr(varLstGet(paramList, 3)),
+        varBool(varLstGet(paramList, 4)), varUInt64(varLstGet(paramList, 5)), varBool(varLstGet(paramList, 6)));
+}
+
+/**********************************************************************************************************************************/
+bool
+cipherBlockHeaderAead(const Buffer *header)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, header);
+    FUNCTION_TEST_END();
+
+    ASSERT(header != NULL);
+
+    FUNCTION_TEST_RETURN(
+        bufUsed(header) == CIPHER_BLOCK_HEADER_SIZE &&
+        memcmp(bufPtrConst(header), CIPHER_BLOCK_MAGIC_AEAD, CIPHER_BLOCK_MAGIC_SIZE) == 0);
+}
+
+/**********************************************************************************************************************************/
+uint64_t
+cipherBlockAeadSize(uint64_t fileSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, fileSize);
+    FUNCTION_TEST_END();
+
+    ASSERT(fileSize >= CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE);
+
+    // Every chunk has a tag, including the empty chunk written for empty data
+    const uint64_t chunkFileSize = fileSize - CIPHER_BLOCK_HEADER_SIZE;
+    const uint64_t chunkTotal = (chunkFileSize + CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE - 1) / CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE;
+
+    FUNCTION_TEST_RETURN(chunkFileSize - chunkTotal * CIPHER_BLOCK_AEAD_TAG_SIZE);
+}
+
+/**********************************************************************************************************************************/
+CipherBlockRange
+cipherBlockAeadRange(uint64_t fileSize, uint64_t offset, uint64_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, fileSize);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+        FUNCTION_TEST_PARAM(UINT64, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(fileSize >= CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE);
+
+    // Reduce the range when it extends past the end of the plaintext
+    const uint64_t plainSize = cipherBlockAeadSize(fileSize);
+    const uint64_t chunkLastFile = plainSize == 0 ? 0 : (plainSize - 1) / CIPHER_BLOCK_AEAD_CHUNK_SIZE;
+    const uint64_t end = offset + size > plainSize ? plainSize : offset + size;
+
+    // Find the chunks that contain the range. The first chunk is the last chunk in the file when the range starts past the end.
+    uint64_t chunkFirst = offset / CIPHER_BLOCK_AEAD_CHUNK_SIZE;
+    const uint64_t chunkLast = end == 0 ? 0 : (end - 1) / CIPHER_BLOCK_AEAD_CHUNK_SIZE;
+
+    if (chunkFirst > chunkLastFile)
+        chunkFirst = chunkLastFile;
+
+    // Read to the end of the last chunk, which is the end of the file for the final chunk
+    CipherBlockRange result =
+    {
+        .chunkNo = chunkFirst,
+        .offset = CIPHER_BLOCK_HEADER_SIZE + chunkFirst * CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE,
+        .skip = offset - chunkFirst * CIPHER_BLOCK_AEAD_CHUNK_SIZE,
+        .final = chunkLast == chunkLastFile,
+    };
+
+    const uint64_t readEnd = CIPHER_BLOCK_HEADER_SIZE + (chunkLast + 1) * CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE;
+    result.size = (readEnd > fileSize ? fileSize : readEnd) - result.offset;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+cipherBlockCompatSet(bool compat)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BOOL, compat);
+    FUNCTION_TEST_END();
+
+    cipherBlockCompat = compat;
+
+    FUNCTION_TEST_RETURN_VOID();
 }
 
 /**********************************************************************************************************************************/
@@ -13,12 +13,51 @@ Filter type constant
 #define CIPHER_BLOCK_FILTER_TYPE                                   "cipherBlock"
     STRING_DECLARE(CIPHER_BLOCK_FILTER_TYPE_STR);
 
+/***********************************************************************************************************************************
+Sizes of the header at the start of an encrypted file (magic and salt) and of the tag after each chunk in the authenticated format
+***********************************************************************************************************************************/
+#define CIPHER_BLOCK_HEADER_SIZE                                    16
+#define CIPHER_BLOCK_AEAD_TAG_SIZE                                  16
+
+/***********************************************************************************************************************************
+Part of a file in the authenticated format that must be read to decrypt a range of the plaintext
+***********************************************************************************************************************************/
+typedef struct CipherBlockRange
+{
+    uint64_t chunkNo;                                               // Number of the first chunk to read
+    uint64_t offset;                                                // Offset in the file of the first chunk
+    uint64_t size;                                                  // Size of the chunks to read
+    uint64_t skip;                                                  // Plaintext to skip in the first chunk to reach the range
+    bool final;                                                     // Is the final chunk in the file read?
+} CipherBlockRange;
+
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
 IoFilter *cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const String *digestName);
 IoFilter *cipherBlockNewVar(const VariantList *paramList);
 
+// Decrypt chunks of a file in the authenticated format starting at chunkNo. The input is the header followed by the chunks, which
+// may stop before the end of the file when final is false.
+IoFilter *cipherBlockNewRange(const Buffer *pass, const String *digestName, uint64_t chunkNo, bool final);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Allow files encrypted with aes-256-cbc to be decrypted by filters created for aes-256-gcm. Filters created afterward use the new
+// setting, including filters created from their parameters in another process.
+void cipherBlockCompatSet(bool compat);
+
+// Is the header for the authenticated format? Only files in this format can be decrypted starting at a chunk.
+bool cipherBlockHeaderAead(const Buffer *header);
+
+// Size of the plaintext in a file of fileSize bytes in the authenticated format
+uint64_t cipherBlockAeadSize(uint64_t fileSize);
+
+// Get the chunks of a file of fileSize bytes in the authenticated format that contain size bytes of plaintext starting at offset.
+// The range is reduced if it extends past the end of the plaintext.
+CipherBlockRange cipherBlockAeadRange(uint64_t fileSize, uint64_t offset, uint64_t size);
+
 /***********************************************************************************************************************************
 Helper functions
 ***********************************************************************************************************************************/
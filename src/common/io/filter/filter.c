@@ -7,6 +7,7 @@ IO Filter Interface
 #include "common/io/filter/filter.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/type/object.h"
 
 /***********************************************************************************************************************************
@@ -79,7 +80,11 @@ ioFilterProcessIn(IoFilter *this, const Buffer *input)
     if (input == NULL)
         this->flushing = true;
     else
+    {
+        TimeUSec timeBegin = statProfileBegin();
         this->interface.in(this->driver, input);
+        statProfileEnd(timeBegin, "filter.%s.usec", strZ(this->type));
+    }
 
     FUNCTION_TEST_RETURN_VOID();
 }
@@ -104,7 +109,11 @@ ioFilterProcessInOut(IoFilter *this, const Buffer *input, Buffer *output)
         this->flushing = true;
 
     if (!ioFilterDone(this))
+    {
+        TimeUSec timeBegin = statProfileBegin();
         this->interface.inOut(this->driver, input, output);
+        statProfileEnd(timeBegin, "filter.%s.usec", strZ(this->type));
+    }
 
     CHECK(!ioFilterInputSame(this) || bufUsed(output) > 0);
     FUNCTION_TEST_RETURN_VOID();
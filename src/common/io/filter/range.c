@@ -0,0 +1,177 @@
+/***********************************************************************************************************************************
+IO Range Filter
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <stdio.h>
+
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/io/filter/range.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(RANGE_FILTER_TYPE_STR,                                RANGE_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct IoRange
+{
+    MemContext *memContext;                                         // Mem context of filter
+
+    uint64_t offset;                                                // Offset where the range begins
+    uint64_t size;                                                  // Size of the range
+    uint64_t current;                                               // Total bytes of input processed
+
+    size_t inputPos;                                                // Position in input buffer
+    bool inputSame;                                                 // Is the same input required again?
+} IoRange;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+ioRangeToLog(const IoRange *this)
+{
+    return strNewFmt(
+        "{offset: %" PRIu64 ", size: %" PRIu64 ", current: %" PRIu64 ", inputSame: %s}", this->offset, this->size, this->current,
+        cvtBoolToConstZ(this->inputSame));
+}
+
+#define FUNCTION_LOG_IO_RANGE_TYPE                                                                                                 \
+    IoRange *
+#define FUNCTION_LOG_IO_RANGE_FORMAT(value, buffer, bufferSize)                                                                    \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, ioRangeToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Copy the part of the input that is in the range to the output buffer
+***********************************************************************************************************************************/
+static void
+ioRangeProcess(THIS_VOID, const Buffer *input, Buffer *output)
+{
+    THIS(IoRange);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_RANGE, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+        FUNCTION_LOG_PARAM(BUFFER, output);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    // Skip input before the range
+    size_t inputSize = bufUsed(input) - this->inputPos;
+
+    if (this->current < this->offset)
+    {
+        size_t skipSize = inputSize;
+
+        if (this->current + skipSize > this->offset)
+            skipSize = (size_t)(this->offset - this->current);
+
+        this->current += skipSize;
+        this->inputPos += skipSize;
+        inputSize -= skipSize;
+    }
+
+    // Copy input in the range to the output and reduce if there is not enough space in the output
+    if (this->current >= this->offset && this->current - this->offset < this->size)
+    {
+        size_t copySize = inputSize;
+
+        if (copySize > this->size - (this->current - this->offset))
+            copySize = (size_t)(this->size - (this->current - this->offset));
+
+        if (copySize > bufRemains(output))
+            copySize = bufRemains(output);
+
+        bufCatSub(output, input, this->inputPos, copySize);
+        this->current += copySize;
+        this->inputPos += copySize;
+        inputSize -= copySize;
+    }
+
+    // Discard input after the range and allow new input when all input has been processed
+    if (inputSize == 0 || this->current - this->offset >= this->size)
+    {
+        this->current += inputSize;
+        this->inputPos = 0;
+        this->inputSame = false;
+    }
+    // Else the same input is required to copy the rest of the range
+    else
+        this->inputSame = true;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is the same input required again?
+***********************************************************************************************************************************/
+static bool
+ioRangeInputSame(const THIS_VOID)
+{
+    THIS(const IoRange);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_RANGE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+ioRangeNew(uint64_t offset, uint64_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+    FUNCTION_LOG_END();
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("IoRange")
+    {
+        IoRange *driver = memNew(sizeof(IoRange));
+
+        *driver = (IoRange)
+        {
+            .memContext = memContextCurrent(),
+            .offset = offset,
+            .size = size,
+        };
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewUInt64(offset));
+        varLstAdd(paramList, varNewUInt64(size));
+
+        this = ioFilterNewP(RANGE_FILTER_TYPE_STR, driver, paramList, .inOut = ioRangeProcess, .inputSame = ioRangeInputSame);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+ioRangeNewVar(const VariantList *paramList)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, paramList);
+    FUNCTION_LOG_END();
+
+    ASSERT(paramList != NULL);
+
+    FUNCTION_LOG_RETURN(
+        IO_FILTER, ioRangeNew(varUInt64Force(varLstGet(paramList, 0)), varUInt64Force(varLstGet(paramList, 1))));
+}
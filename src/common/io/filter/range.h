@@ -0,0 +1,24 @@
+/***********************************************************************************************************************************
+IO Range Filter
+
+Pass a range of the input to the output, i.e. skip the bytes before the offset and discard the bytes after offset + size.  Useful
+for reading part of a file when the range cannot be read directly, e.g. from the output of a decompression filter.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_FILTER_RANGE_H
+#define COMMON_IO_FILTER_RANGE_H
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define RANGE_FILTER_TYPE                                           "range"
+    STRING_DECLARE(RANGE_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+IoFilter *ioRangeNew(uint64_t offset, uint64_t size);
+IoFilter *ioRangeNewVar(const VariantList *paramList);
+
+#endif
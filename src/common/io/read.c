@@ -10,6 +10,7 @@ IO Read Interface
 #include "common/io/read.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/type/object.h"
 
 /***********************************************************************************************************************************
@@ -24,6 +25,7 @@ struct IoRead
     Buffer *input;                                                  // Input buffer
     Buffer *output;                                                 // Internal output buffer (extra output from buffered reads)
     size_t outputPos;                                               // Current position in the internal output buffer
+    const String *profile;                                          // Profiling stat key prefix (NULL when not profiling)
 
     bool eofAll;                                                    // Is the read done (read and filters complete)?
 
@@ -80,8 +82,12 @@ ioReadOpen(IoRead *this)
     ASSERT(ioFilterGroupSize(this->filterGroup) == 0 || !ioReadBlock(this));
 
     // Open if the driver has an open function
+    TimeUSec timeBegin = this->profile != NULL ? statProfileBegin() : 0;
     bool result = this->interface.open != NULL ? this->interface.open(this->driver) : true;
 
+    if (timeBegin != 0)
+        statProfileEnd(timeBegin, "%s.open.usec", strZ(this->profile));
+
     // Only open the filter group if the read was opened
     if (result)
         ioFilterGroupOpen(this->filterGroup);
@@ -149,8 +155,12 @@ ioReadInternal(IoRead *this, Buffer *buffer, bool block)
                     if (ioReadBlock(this) && bufRemains(this->input) > bufRemains(buffer))
                         bufLimitSet(this->input, bufRemains(buffer));
 
+                    TimeUSec timeBegin = this->profile != NULL ? statProfileBegin() : 0;
                     this->interface.read(this->driver, this->input, block);
                     bufLimitClear(this->input);
+
+                    if (timeBegin != 0)
+                        statProfileEnd(timeBegin, "%s.usec", strZ(this->profile));
                 }
                 // Set input to NULL and flush (no need to actually free the buffer here as it will be freed with the mem context)
                 else
@@ -487,6 +497,27 @@ ioReadFd(const IoRead *this)
     FUNCTION_LOG_RETURN(INT, this->interface.fd == NULL ? -1 : this->interface.fd(this->driver));
 }
 
+/**********************************************************************************************************************************/
+void
+ioReadProfileSet(IoRead *this, const String *profile)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, this);
+        FUNCTION_TEST_PARAM(STRING, profile);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->opened);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->profile = strDup(profile);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 const IoReadInterface *
 ioReadInterface(const IoRead *this)
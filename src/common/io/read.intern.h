@@ -41,6 +41,9 @@ void *ioReadDriver(IoRead *this);
 // Interface for the read object
 const IoReadInterface *ioReadInterface(const IoRead *this);
 
+// Set the stat key prefix used to profile driver open/read when profiling is enabled
+void ioReadProfileSet(IoRead *this, const String *profile);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
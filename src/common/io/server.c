@@ -0,0 +1,85 @@
+/***********************************************************************************************************************************
+Io Server Interface
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/debug.h"
+#include "common/io/server.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct IoServer
+{
+    MemContext *memContext;                                         // Mem context
+    void *driver;                                                   // Driver object
+    const IoServerInterface *interface;                             // Driver interface
+};
+
+OBJECT_DEFINE_MOVE(IO_SERVER);
+OBJECT_DEFINE_FREE(IO_SERVER);
+
+/**********************************************************************************************************************************/
+IoServer *
+ioServerNew(void *driver, const IoServerInterface *interface)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM_P(VOID, driver);
+        FUNCTION_LOG_PARAM(IO_SERVER_INTERFACE, interface);
+    FUNCTION_LOG_END();
+
+    ASSERT(driver != NULL);
+    ASSERT(interface != NULL);
+    ASSERT(interface->type != NULL);
+    ASSERT(interface->name != NULL);
+    ASSERT(interface->accept != NULL);
+    ASSERT(interface->toLog != NULL);
+
+    IoServer *this = memNew(sizeof(IoServer));
+
+    *this = (IoServer)
+    {
+        .memContext = memContextCurrent(),
+        .driver = driver,
+        .interface = interface,
+    };
+
+    FUNCTION_LOG_RETURN(IO_SERVER, this);
+}
+
+/**********************************************************************************************************************************/
+IoSession *
+ioServerAccept(IoServer *this, IoSession *session)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_SERVER, this);
+        FUNCTION_LOG_PARAM(IO_SESSION, session);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(IO_SESSION, this->interface->accept(this->driver, session));
+}
+
+/**********************************************************************************************************************************/
+const String *
+ioServerName(IoServer *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_SERVER, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN_CONST(STRING, this->interface->name(this->driver));
+}
+
+/**********************************************************************************************************************************/
+String *
+ioServerToLog(const IoServer *this)
+{
+    return strNewFmt("{type: %s, driver: %s}", strZ(*this->interface->type), strZ(this->interface->toLog(this->driver)));
+}
@@ -0,0 +1,51 @@
+/***********************************************************************************************************************************
+Io Server Interface
+
+Create sessions for protocol servers. For example, a socket server can be created with sckServerNew() and then new socket sessions
+can be accepted with ioServerAccept(). A TLS server wraps sessions accepted by another server, e.g. a socket server, so the session
+to wrap is passed to ioServerAccept().
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_SERVER_H
+#define COMMON_IO_SERVER_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define IO_SERVER_TYPE                                             IoServer
+#define IO_SERVER_PREFIX                                           ioServer
+
+typedef struct IoServer IoServer;
+
+#include "common/io/session.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Accept a new session. The session parameter is required when the server wraps an existing session, otherwise it must be NULL.
+IoSession *ioServerAccept(IoServer *this, IoSession *session);
+
+// Move to a new parent mem context
+IoServer *ioServerMove(IoServer *this, MemContext *parentNew);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+// Name that identifies the server
+const String *ioServerName(IoServer *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void ioServerFree(IoServer *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+String *ioServerToLog(const IoServer *this);
+
+#define FUNCTION_LOG_IO_SERVER_TYPE                                                                                                \
+    IoServer *
+#define FUNCTION_LOG_IO_SERVER_FORMAT(value, buffer, bufferSize)                                                                   \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, ioServerToLog, buffer, bufferSize)
+
+#endif
@@ -0,0 +1,234 @@
+/***********************************************************************************************************************************
+Socket Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <netinet/in.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/io/server.intern.h"
+#include "common/io/socket/client.h"
+#include "common/io/socket/common.h"
+#include "common/io/socket/server.h"
+#include "common/io/socket/session.h"
+#include "common/memContext.h"
+#include "common/stat.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Io server type
+***********************************************************************************************************************************/
+STRING_EXTERN(IO_SERVER_SOCKET_TYPE_STR,                            IO_SERVER_SOCKET_TYPE);
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+STRING_EXTERN(SOCKET_STAT_SERVER_STR,                               SOCKET_STAT_SERVER);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define SOCKET_SERVER_TYPE                                          SocketServer
+#define SOCKET_SERVER_PREFIX                                        sckServer
+
+typedef struct SocketServer
+{
+    MemContext *memContext;                                         // Mem context
+    String *address;                                                // Address to listen on
+    unsigned int port;                                              // Port to listen on
+    String *name;                                                   // Socket name (address:port)
+    int socket;                                                     // Listening socket
+    TimeMSec timeout;                                               // Timeout for any i/o operation on accepted sessions
+} SocketServer;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+sckServerToLog(const THIS_VOID)
+{
+    THIS(const SocketServer);
+
+    return strNewFmt("{address: %s, port: %u, timeout: %" PRIu64 "}", strZ(this->address), this->port, this->timeout);
+}
+
+#define FUNCTION_LOG_SOCKET_SERVER_TYPE                                                                                            \
+    SocketServer *
+#define FUNCTION_LOG_SOCKET_SERVER_FORMAT(value, buffer, bufferSize)                                                               \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, sckServerToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free server
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(SOCKET_SERVER, LOG, logLevelTrace)
+{
+    close(this->socket);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/**********************************************************************************************************************************/
+static IoSession *
+sckServerAccept(THIS_VOID, IoSession *session)
+{
+    THIS(SocketServer);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SOCKET_SERVER, this);
+        FUNCTION_LOG_PARAM(IO_SESSION, session);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(session == NULL);
+
+    IoSession *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Accept the connection
+        struct sockaddr_storage addressClient;
+        socklen_t addressClientSize = sizeof(addressClient);
+
+        int fd = accept(this->socket, (struct sockaddr *)&addressClient, &addressClientSize);
+        THROW_ON_SYS_ERROR_FMT(fd == -1, HostConnectError, "unable to accept connection on '%s'", strZ(this->name));
+
+        // Create the session
+        TRY_BEGIN()
+        {
+            sckOptionSet(fd);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = sckSessionNew(ioSessionRoleServer, fd, this->address, this->port, this->timeout);
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+        CATCH_ANY()
+        {
+            close(fd);
+            RETHROW();
+        }
+        TRY_END();
+
+        statInc(SOCKET_STAT_SESSION_STR);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(IO_SESSION, result);
+}
+
+/**********************************************************************************************************************************/
+static const String *
+sckServerName(THIS_VOID)
+{
+    THIS(SocketServer);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SERVER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->name);
+}
+
+/**********************************************************************************************************************************/
+static const IoServerInterface sckServerInterface =
+{
+    .type = &IO_SERVER_SOCKET_TYPE_STR,
+    .name = sckServerName,
+    .accept = sckServerAccept,
+    .toLog = sckServerToLog,
+};
+
+IoServer *
+sckServerNew(const String *address, unsigned int port, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, address);
+        FUNCTION_LOG_PARAM(UINT, port);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(address != NULL);
+    ASSERT(port > 0);
+
+    IoServer *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("SocketServer")
+    {
+        SocketServer *driver = memNew(sizeof(SocketServer));
+
+        *driver = (SocketServer)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .address = strDup(address),
+            .port = port,
+            .name = strNewFmt("%s:%u", strZ(address), port),
+            .timeout = timeout,
+        };
+
+        // Set hints that narrow the type of address we are looking for -- we'll take ipv4 or ipv6
+        struct addrinfo hints = (struct addrinfo)
+        {
+            .ai_family = AF_UNSPEC,
+            .ai_flags = AI_PASSIVE,
+            .ai_socktype = SOCK_STREAM,
+            .ai_protocol = IPPROTO_TCP,
+        };
+
+        // Convert the port to a zero-terminated string for use with getaddrinfo()
+        char portZ[CVT_BASE10_BUFFER_SIZE];
+        cvtUIntToZ(port, portZ, sizeof(portZ));
+
+        // Get an address to listen on. We are only going to try the first address returned.
+        struct addrinfo *serverAddress;
+        int resultAddr;
+
+        if ((resultAddr = getaddrinfo(strZ(address), portZ, &hints, &serverAddress)) != 0)
+        {
+            THROW_FMT(
+                HostConnectError, "unable to get address for '%s': [%d] %s", strZ(address), resultAddr, gai_strerror(resultAddr));
+        }
+
+        TRY_BEGIN()
+        {
+            // Create the socket
+            driver->socket = socket(serverAddress->ai_family, serverAddress->ai_socktype, serverAddress->ai_protocol);
+            THROW_ON_SYS_ERROR(driver->socket == -1, HostConnectError, "unable to create socket");
+
+            // Ensure the socket is closed when the server is freed
+            memContextCallbackSet(driver->memContext, sckServerFreeResource, driver);
+
+            // Allow the address to be reused so the server can be restarted while old connections are in TIME_WAIT
+            int socketValue = 1;
+
+            THROW_ON_SYS_ERROR(
+                setsockopt(driver->socket, SOL_SOCKET, SO_REUSEADDR, &socketValue, sizeof(int)) == -1, HostConnectError,
+                "unable to set SO_REUSEADDR");
+
+            // Bind and listen
+            THROW_ON_SYS_ERROR_FMT(
+                bind(driver->socket, serverAddress->ai_addr, serverAddress->ai_addrlen) == -1, HostConnectError,
+                "unable to bind '%s'", strZ(driver->name));
+
+            THROW_ON_SYS_ERROR_FMT(
+                listen(driver->socket, SOMAXCONN) == -1, HostConnectError, "unable to listen on '%s'", strZ(driver->name));
+        }
+        FINALLY()
+        {
+            freeaddrinfo(serverAddress);
+        }
+        TRY_END();
+
+        statInc(SOCKET_STAT_SERVER_STR);
+
+        this = ioServerNew(driver, &sckServerInterface);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_SERVER, this);
+}
@@ -336,7 +336,9 @@ static const IoClientInterface tlsClientInterface =
 };
 
 IoClient *
-tlsClientNew(IoClient *ioClient, const String *host, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+tlsClientNew(
+    IoClient *ioClient, const String *host, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath,
+    const String *certFile, const String *keyFile)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug)
         FUNCTION_LOG_PARAM(IO_CLIENT, ioClient);
@@ -345,9 +347,12 @@ tlsClientNew(IoClient *ioClient, const String *host, TimeMSec timeout, bool veri
         FUNCTION_LOG_PARAM(BOOL, verifyPeer);
         FUNCTION_LOG_PARAM(STRING, caFile);
         FUNCTION_LOG_PARAM(STRING, caPath);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
     FUNCTION_LOG_END();
 
     ASSERT(ioClient != NULL);
+    ASSERT((certFile == NULL && keyFile == NULL) || (certFile != NULL && keyFile != NULL));
 
     IoClient *this = NULL;
 
@@ -404,6 +409,19 @@ tlsClientNew(IoClient *ioClient, const String *host, TimeMSec timeout, bool veri
             }
         }
 
+        // Load the client certificate and key when the server requires a client certificate
+        // -------------------------------------------------------------------------------------------------------------------------
+        if (certFile != NULL)
+        {
+            if (SSL_CTX_use_certificate_chain_file(driver->context, strZ(certFile)) != 1)
+                cryptoError(true, strZ(strNewFmt("unable to load client certificate file '%s'", strZ(certFile))));
+
+            if (SSL_CTX_use_PrivateKey_file(driver->context, strZ(keyFile), SSL_FILETYPE_PEM) != 1)
+                cryptoError(true, strZ(strNewFmt("unable to load client key file '%s'", strZ(keyFile))));
+
+            cryptoError(SSL_CTX_check_private_key(driver->context) != 1, "client key does not match client certificate");
+        }
+
         statInc(TLS_STAT_CLIENT_STR);
 
         // Create client interface
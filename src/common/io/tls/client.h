@@ -10,6 +10,7 @@ This object is intended to be used for multiple TLS sessions so ioClientOpen() c
 #define COMMON_IO_TLS_CLIENT_H
 
 #include "common/io/client.h"
+#include "common/time.h"
 
 /***********************************************************************************************************************************
 Io client type
@@ -30,8 +31,10 @@ Statistics constants
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
+// The certificate and key files are only required when the server requires a client certificate
 IoClient *tlsClientNew(
-    IoClient *ioClient, const String *host, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+    IoClient *ioClient, const String *host, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath,
+    const String *certFile, const String *keyFile);
 
 /***********************************************************************************************************************************
 Functions
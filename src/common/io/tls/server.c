@@ -0,0 +1,217 @@
+/***********************************************************************************************************************************
+TLS Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <openssl/x509v3.h>
+
+#include "common/crypto/common.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/io/server.intern.h"
+#include "common/io/tls/client.h"
+#include "common/io/tls/server.h"
+#include "common/io/tls/session.h"
+#include "common/memContext.h"
+#include "common/stat.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Io server type
+***********************************************************************************************************************************/
+STRING_EXTERN(IO_SERVER_TLS_TYPE_STR,                               IO_SERVER_TLS_TYPE);
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+STRING_EXTERN(TLS_STAT_SERVER_STR,                                  TLS_STAT_SERVER);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define TLS_SERVER_TYPE                                             TlsServer
+#define TLS_SERVER_PREFIX                                           tlsServer
+
+typedef struct TlsServer
+{
+    MemContext *memContext;                                         // Mem context
+    String *host;                                                   // Host name used for logging
+    TimeMSec timeout;                                               // Timeout for any i/o operation (connect, read, etc.)
+
+    SSL_CTX *context;                                               // TLS context
+} TlsServer;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+tlsServerToLog(const THIS_VOID)
+{
+    THIS(const TlsServer);
+
+    return strNewFmt("{host: %s, timeout: %" PRIu64 "}", strZ(this->host), this->timeout);
+}
+
+#define FUNCTION_LOG_TLS_SERVER_TYPE                                                                                               \
+    TlsServer *
+#define FUNCTION_LOG_TLS_SERVER_FORMAT(value, buffer, bufferSize)                                                                  \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, tlsServerToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free context
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(TLS_SERVER, LOG, logLevelTrace)
+{
+    SSL_CTX_free(this->context);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Accept a TLS session on an existing session, usually a socket session
+***********************************************************************************************************************************/
+static IoSession *
+tlsServerAccept(THIS_VOID, IoSession *ioSession)
+{
+    THIS(TlsServer);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SERVER, this);
+        FUNCTION_LOG_PARAM(IO_SESSION, ioSession);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(ioSession != NULL);
+    ASSERT(ioSessionRole(ioSession) == ioSessionRoleServer);
+
+    IoSession *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Create internal TLS session. If there is a failure before the TlsSession object is created there may be a leak of the TLS
+        // session but this is likely to result in program termination so it doesn't seem worth coding for.
+        SSL *session = SSL_new(this->context);
+        cryptoError(session == NULL, "unable to create TLS session");
+
+        // Negotiate the TLS session. The client certificate is required and verified during the handshake so the handshake fails
+        // when the client does not present a certificate signed by the CA.
+        result = tlsSessionNew(session, ioSession, this->timeout);
+
+        // Check the verify result. This should always be ok if the handshake succeeded but it does not hurt to be sure.
+        long int verifyResult = SSL_get_verify_result(session);
+
+        if (verifyResult != X509_V_OK)                                                                              // {vm_covered}
+        {
+            THROW_FMT(                                                                                              // {vm_covered}
+                CryptoError, "unable to verify certificate presented by client: [%ld] %s", verifyResult,            // {vm_covered}
+                X509_verify_cert_error_string(verifyResult));                                                       // {vm_covered}
+        }
+
+        ioSessionMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    statInc(TLS_STAT_SESSION_STR);
+
+    FUNCTION_LOG_RETURN(IO_SESSION, result);
+}
+
+/**********************************************************************************************************************************/
+static const String *
+tlsServerName(THIS_VOID)
+{
+    THIS(TlsServer);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SERVER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->host);
+}
+
+/**********************************************************************************************************************************/
+static const IoServerInterface tlsServerInterface =
+{
+    .type = &IO_SERVER_TLS_TYPE_STR,
+    .name = tlsServerName,
+    .accept = tlsServerAccept,
+    .toLog = tlsServerToLog,
+};
+
+IoServer *
+tlsServerNew(const String *host, const String *caFile, const String *keyFile, const String *certFile, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, host);
+        FUNCTION_LOG_PARAM(STRING, caFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(host != NULL);
+    ASSERT(caFile != NULL);
+    ASSERT(keyFile != NULL);
+    ASSERT(certFile != NULL);
+
+    IoServer *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("TlsServer")
+    {
+        TlsServer *driver = memNew(sizeof(TlsServer));
+
+        *driver = (TlsServer)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .host = strDup(host),
+            .timeout = timeout,
+        };
+
+        // Setup TLS context
+        // -------------------------------------------------------------------------------------------------------------------------
+        cryptoInit();
+
+        // Select the TLS method to use. To maintain compatibility with older versions of OpenSSL we need to use an SSL method, but
+        // SSL versions will be excluded in SSL_CTX_set_options().
+        const SSL_METHOD *method = SSLv23_method();
+        cryptoError(method == NULL, "unable to load TLS method");
+
+        // Create the TLS context
+        driver->context = SSL_CTX_new(method);
+        cryptoError(driver->context == NULL, "unable to create TLS context");
+
+        memContextCallbackSet(driver->memContext, tlsServerFreeResource, driver);
+
+        // Exclude SSL versions to only allow TLS and also disable compression
+        SSL_CTX_set_options(driver->context, (long)(SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_COMPRESSION));
+
+        // Disable auto-retry to prevent SSL_read() from hanging
+        SSL_CTX_clear_mode(driver->context, SSL_MODE_AUTO_RETRY);
+
+        // Load the server certificate and key
+        // -------------------------------------------------------------------------------------------------------------------------
+        if (SSL_CTX_use_certificate_chain_file(driver->context, strZ(certFile)) != 1)
+            cryptoError(true, strZ(strNewFmt("unable to load server certificate file '%s'", strZ(certFile))));
+
+        if (SSL_CTX_use_PrivateKey_file(driver->context, strZ(keyFile), SSL_FILETYPE_PEM) != 1)
+            cryptoError(true, strZ(strNewFmt("unable to load server key file '%s'", strZ(keyFile))));
+
+        cryptoError(SSL_CTX_check_private_key(driver->context) != 1, "server key does not match server certificate");
+
+        // Require a client certificate signed by the CA
+        // -------------------------------------------------------------------------------------------------------------------------
+        if (SSL_CTX_load_verify_locations(driver->context, strZ(caFile), NULL) != 1)
+            cryptoError(true, strZ(strNewFmt("unable to load client CA file '%s'", strZ(caFile))));
+
+        SSL_CTX_set_verify(driver->context, SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT, NULL);
+
+        statInc(TLS_STAT_SERVER_STR);
+
+        // Create server interface
+        this = ioServerNew(driver, &tlsServerInterface);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_SERVER, this);
+}
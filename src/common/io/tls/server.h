@@ -0,0 +1,31 @@
+/***********************************************************************************************************************************
+TLS Server
+
+A TLS server that wraps sessions accepted by another server, usually a SocketServer. Clients must present a certificate signed by
+the configured CA so only authorized clients are able to establish a session.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_TLS_SERVER_H
+#define COMMON_IO_TLS_SERVER_H
+
+#include "common/io/server.h"
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+Io server type
+***********************************************************************************************************************************/
+#define IO_SERVER_TLS_TYPE                                          "tls"
+    STRING_DECLARE(IO_SERVER_TLS_TYPE_STR);
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+#define TLS_STAT_SERVER                                             "tls.server"        // Servers created
+    STRING_DECLARE(TLS_STAT_SERVER_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+IoServer *tlsServerNew(
+    const String *host, const String *caFile, const String *keyFile, const String *certFile, TimeMSec timeout);
+
+#endif
@@ -10,6 +10,7 @@ IO Write Interface
 #include "common/io/write.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/type/object.h"
 
 /***********************************************************************************************************************************
@@ -22,6 +23,7 @@ struct IoWrite
     IoWriteInterface interface;                                     // Driver interface
     IoFilterGroup *filterGroup;                                     // IO filters
     Buffer *output;                                                 // Output buffer
+    const String *profile;                                          // Profiling stat key prefix (NULL when not profiling)
 
 #ifdef DEBUG
     bool filterGroupSet;                                            // Were filters set?
@@ -76,8 +78,14 @@ ioWriteOpen(IoWrite *this)
     ASSERT(!this->opened && !this->closed);
 
     if (this->interface.open != NULL)
+    {
+        TimeUSec timeBegin = this->profile != NULL ? statProfileBegin() : 0;
         this->interface.open(this->driver);
 
+        if (timeBegin != 0)
+            statProfileEnd(timeBegin, "%s.open.usec", strZ(this->profile));
+    }
+
     // Track whether filters were added to prevent flush() from being called later since flush() won't work with most filters
 #ifdef DEBUG
     this->filterGroupSet = ioFilterGroupSize(this->filterGroup) > 0;
@@ -93,6 +101,28 @@ ioWriteOpen(IoWrite *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Write the output buffer to the driver
+***********************************************************************************************************************************/
+static void
+ioWriteInternal(IoWrite *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_WRITE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    TimeUSec timeBegin = this->profile != NULL ? statProfileBegin() : 0;
+    this->interface.write(this->driver, this->output);
+    bufUsedZero(this->output);
+
+    if (timeBegin != 0)
+        statProfileEnd(timeBegin, "%s.usec", strZ(this->profile));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 ioWrite(IoWrite *this, const Buffer *buffer)
@@ -114,10 +144,7 @@ ioWrite(IoWrite *this, const Buffer *buffer)
 
             // Write data if the buffer is full
             if (bufRemains(this->output) == 0)
-            {
-                this->interface.write(this->driver, this->output);
-                bufUsedZero(this->output);
-            }
+                ioWriteInternal(this);
         }
         while (ioFilterGroupInputSame(this->filterGroup));
     }
@@ -210,10 +237,7 @@ ioWriteFlush(IoWrite *this)
     ASSERT(!this->filterGroupSet);
 
     if (bufUsed(this->output) > 0)
-    {
-        this->interface.write(this->driver, this->output);
-        bufUsedZero(this->output);
-    }
+        ioWriteInternal(this);
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -236,10 +260,7 @@ ioWriteClose(IoWrite *this)
 
         // Write data if the buffer is full or if this is the last buffer to be written
         if (bufRemains(this->output) == 0 || (ioFilterGroupDone(this->filterGroup) && bufUsed(this->output) > 0))
-        {
-            this->interface.write(this->driver, this->output);
-            bufUsedZero(this->output);
-        }
+            ioWriteInternal(this);
     }
     while (!ioFilterGroupDone(this->filterGroup));
 
@@ -248,8 +269,14 @@ ioWriteClose(IoWrite *this)
 
     // Close the driver if there is a close function
     if (this->interface.close != NULL)
+    {
+        TimeUSec timeBegin = this->profile != NULL ? statProfileBegin() : 0;
         this->interface.close(this->driver);
 
+        if (timeBegin != 0)
+            statProfileEnd(timeBegin, "%s.close.usec", strZ(this->profile));
+    }
+
 #ifdef DEBUG
     this->closed = true;
 #endif
@@ -282,3 +309,24 @@ ioWriteFd(const IoWrite *this)
 
     FUNCTION_LOG_RETURN(INT, this->interface.fd == NULL ? -1 : this->interface.fd(this->driver));
 }
+
+/**********************************************************************************************************************************/
+void
+ioWriteProfileSet(IoWrite *this, const String *profile)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_WRITE, this);
+        FUNCTION_TEST_PARAM(STRING, profile);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->opened);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->profile = strDup(profile);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
@@ -27,6 +27,12 @@ typedef struct IoWriteInterface
 
 IoWrite *ioWriteNew(void *driver, IoWriteInterface interface);
 
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+// Set the stat key prefix used to profile driver open/write/close when profiling is enabled
+void ioWriteProfileSet(IoWrite *this, const String *profile);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
@@ -3,15 +3,37 @@ Statistics Collector
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <ctype.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
 #include "common/debug.h"
 #include "common/memContext.h"
 #include "common/stat.h"
 #include "common/type/list.h"
+#include "version.h"
 
 /***********************************************************************************************************************************
 Stat output constants
 ***********************************************************************************************************************************/
 VARIANT_STRDEF_EXTERN(STAT_VALUE_TOTAL_VAR,                         STAT_VALUE_TOTAL);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_SUM_VAR,                           STAT_VALUE_SUM);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_MIN_VAR,                           STAT_VALUE_MIN);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_MAX_VAR,                           STAT_VALUE_MAX);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_BUCKET_VAR,                        STAT_VALUE_BUCKET);
+VARIANT_STRDEF_EXTERN(STAT_VALUE_GAUGE_VAR,                         STAT_VALUE_GAUGE);
+
+/***********************************************************************************************************************************
+Stat types
+***********************************************************************************************************************************/
+typedef enum
+{
+    statTypeCounter,                                                // Monotonic counter
+    statTypeHistogram,                                              // Measurements with sum, min, max, and histogram
+    statTypeGauge,                                                  // Last value set
+} StatType;
 
 /***********************************************************************************************************************************
 Cumulative statistics
@@ -19,7 +41,13 @@ Cumulative statistics
 typedef struct Stat
 {
     const String *key;
-    uint64_t total;
+    StatType type;                                                  // Stat type
+    uint64_t total;                                                 // Counter or number of measurements
+    int64_t gauge;                                                  // Gauge value
+    uint64_t sum;                                                   // Sum of measurements
+    uint64_t min;                                                   // Smallest measurement
+    uint64_t max;                                                   // Largest measurement
+    uint64_t bucket[STAT_BUCKET_TOTAL];                             // Histogram of measurements
 } Stat;
 
 /***********************************************************************************************************************************
@@ -29,6 +57,7 @@ struct
 {
     MemContext *memContext;                                         // Mem context to store data in this struct
     List *stat;                                                     // Cumulative stats
+    bool profile;                                                   // Is profiling enabled?
 } statLocalData;
 
 /**********************************************************************************************************************************/
@@ -57,10 +86,11 @@ statInit(void)
 Get the specified stat. If it doesn't already exist it will be created.
 ***********************************************************************************************************************************/
 static Stat *
-statGetOrCreate(const String *key)
+statGetOrCreate(const String *key, StatType type)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(ENUM, type);
     FUNCTION_TEST_END();
 
     ASSERT(key != NULL);
@@ -74,7 +104,7 @@ statGetOrCreate(const String *key)
         // Add the new stat
         MEM_CONTEXT_BEGIN(lstMemContext(statLocalData.stat))
         {
-            lstAdd(statLocalData.stat, &(Stat){.key = strDup(key)});
+            lstAdd(statLocalData.stat, &(Stat){.key = strDup(key), .type = type});
         }
         MEM_CONTEXT_END();
 
@@ -86,6 +116,9 @@ statGetOrCreate(const String *key)
         ASSERT(stat != NULL);
     }
 
+    // A stat cannot change type once it has been created
+    CHECK(stat->type == type);
+
     FUNCTION_TEST_RETURN(stat);
 }
 
@@ -100,11 +133,179 @@ statInc(const String *key)
     ASSERT(statLocalData.memContext != NULL);
     ASSERT(key != NULL);
 
-    statGetOrCreate(key)->total++;
+    statGetOrCreate(key, statTypeCounter)->total++;
 
     FUNCTION_TEST_RETURN();
 }
 
+/***********************************************************************************************************************************
+Get the histogram bucket for a measurement, i.e. the smallest n where value <= 2^n
+***********************************************************************************************************************************/
+static unsigned int
+statBucket(uint64_t value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, value);
+    FUNCTION_TEST_END();
+
+    unsigned int result = value <= 1 ? 0 : (unsigned int)(64 - __builtin_clzll(value - 1));
+
+    FUNCTION_TEST_RETURN(result < STAT_BUCKET_TOTAL ? result : STAT_BUCKET_TOTAL - 1);
+}
+
+/**********************************************************************************************************************************/
+void
+statAdd(const String *key, uint64_t value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(UINT64, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(statLocalData.memContext != NULL);
+    ASSERT(key != NULL);
+
+    Stat *stat = statGetOrCreate(key, statTypeHistogram);
+
+    if (stat->total == 0 || value < stat->min)
+        stat->min = value;
+
+    if (stat->total == 0 || value > stat->max)
+        stat->max = value;
+
+    stat->total++;
+    stat->sum += value;
+    stat->bucket[statBucket(value)]++;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+statGaugeSet(const String *key, int64_t value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(INT64, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(statLocalData.memContext != NULL);
+    ASSERT(key != NULL);
+
+    statGetOrCreate(key, statTypeGauge)->gauge = value;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+statMerge(const KeyValue *statKv)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(KEY_VALUE, statKv);
+    FUNCTION_TEST_END();
+
+    ASSERT(statLocalData.memContext != NULL);
+    ASSERT(statKv != NULL);
+
+    const VariantList *keyList = kvKeyList(statKv);
+
+    for (unsigned int keyIdx = 0; keyIdx < varLstSize(keyList); keyIdx++)
+    {
+        const String *key = varStr(varLstGet(keyList, keyIdx));
+        const KeyValue *valueKv = varKv(kvGet(statKv, varLstGet(keyList, keyIdx)));
+
+        // Gauge
+        if (kvKeyExists(valueKv, STAT_VALUE_GAUGE_VAR))
+        {
+            statGetOrCreate(key, statTypeGauge)->gauge = varInt64Force(kvGet(valueKv, STAT_VALUE_GAUGE_VAR));
+        }
+        // Histogram
+        else if (kvKeyExists(valueKv, STAT_VALUE_BUCKET_VAR))
+        {
+            Stat *stat = statGetOrCreate(key, statTypeHistogram);
+            uint64_t min = varUInt64Force(kvGet(valueKv, STAT_VALUE_MIN_VAR));
+            uint64_t max = varUInt64Force(kvGet(valueKv, STAT_VALUE_MAX_VAR));
+
+            if (stat->total == 0 || min < stat->min)
+                stat->min = min;
+
+            if (stat->total == 0 || max > stat->max)
+                stat->max = max;
+
+            stat->total += varUInt64Force(kvGet(valueKv, STAT_VALUE_TOTAL_VAR));
+            stat->sum += varUInt64Force(kvGet(valueKv, STAT_VALUE_SUM_VAR));
+
+            const VariantList *bucketList = varVarLst(kvGet(valueKv, STAT_VALUE_BUCKET_VAR));
+            CHECK(varLstSize(bucketList) <= STAT_BUCKET_TOTAL);
+
+            for (unsigned int bucketIdx = 0; bucketIdx < varLstSize(bucketList); bucketIdx++)
+                stat->bucket[bucketIdx] += varUInt64Force(varLstGet(bucketList, bucketIdx));
+        }
+        // Counter
+        else
+            statGetOrCreate(key, statTypeCounter)->total += varUInt64Force(kvGet(valueKv, STAT_VALUE_TOTAL_VAR));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+bool
+statProfile(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(statLocalData.profile);
+}
+
+void
+statProfileSet(bool profile)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BOOL, profile);
+    FUNCTION_TEST_END();
+
+    statLocalData.profile = profile;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+TimeUSec
+statProfileBegin(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(statLocalData.profile ? timeUSec() : 0);
+}
+
+void
+statProfileEnd(TimeUSec timeBegin, const char *format, ...)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, timeBegin);
+        FUNCTION_TEST_PARAM(STRINGZ, format);
+    FUNCTION_TEST_END();
+
+    ASSERT(format != NULL);
+
+    // Skip the measurement if profiling was not enabled when the operation began
+    if (timeBegin != 0)
+    {
+        TimeUSec elapsed = timeUSec() - timeBegin;
+
+        // Construct the key on the stack since this may be called often
+        char key[256];
+        va_list argumentList;
+        va_start(argumentList, format);
+        vsnprintf(key, sizeof(key), format, argumentList);
+        va_end(argumentList);
+
+        statAdd(STR(key), elapsed);
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 KeyValue *
 statToKv(void)
@@ -120,8 +321,122 @@ statToKv(void)
         Stat *stat = lstGet(statLocalData.stat, statIdx);
 
         KeyValue *statKv = kvPutKv(result, VARSTR(stat->key));
+
+        if (stat->type == statTypeGauge)
+        {
+            kvAdd(statKv, STAT_VALUE_GAUGE_VAR, VARINT64(stat->gauge));
+            continue;
+        }
+
         kvAdd(statKv, STAT_VALUE_TOTAL_VAR, VARUINT64(stat->total));
+
+        // Output measurements. The histogram is truncated after the last bucket that has measurements.
+        if (stat->type == statTypeHistogram)
+        {
+            kvAdd(statKv, STAT_VALUE_SUM_VAR, VARUINT64(stat->sum));
+            kvAdd(statKv, STAT_VALUE_MIN_VAR, VARUINT64(stat->min));
+            kvAdd(statKv, STAT_VALUE_MAX_VAR, VARUINT64(stat->max));
+
+            VariantList *bucketList = varLstNew();
+            unsigned int bucketMax = statBucket(stat->max);
+
+            for (unsigned int bucketIdx = 0; bucketIdx <= bucketMax; bucketIdx++)
+                varLstAdd(bucketList, varNewUInt64(stat->bucket[bucketIdx]));
+
+            kvAdd(statKv, STAT_VALUE_BUCKET_VAR, varNewVarLst(bucketList));
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Convert a stat key to a Prometheus metric name, e.g. storage.posix.info.usec => pgbackrest_storage_posix_info_usec
+***********************************************************************************************************************************/
+static String *
+statPrometheusName(const String *key)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+    FUNCTION_TEST_END();
+
+    ASSERT(key != NULL);
+
+    String *result = strNew(PROJECT_BIN "_");
+
+    for (size_t keyIdx = 0; keyIdx < strSize(key); keyIdx++)
+    {
+        const char keyChr = strZ(key)[keyIdx];
+        strCatChr(result, isalnum((unsigned char)keyChr) ? keyChr : '_');
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+String *
+statToPrometheus(const String *label)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, label);
+    FUNCTION_TEST_END();
+
+    ASSERT(statLocalData.memContext != NULL);
+    ASSERT(label != NULL);
+
+    String *result = strNew("");
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        for (unsigned int statIdx = 0; statIdx < lstSize(statLocalData.stat); statIdx++)
+        {
+            const Stat *stat = lstGet(statLocalData.stat, statIdx);
+            const String *name = statPrometheusName(stat->key);
+
+            switch (stat->type)
+            {
+                case statTypeCounter:
+                {
+                    strCatFmt(
+                        result, "# TYPE %s_total counter\n%s_total{%s} %" PRIu64 "\n", strZ(name), strZ(name), strZ(label),
+                        stat->total);
+                    break;
+                }
+
+                case statTypeGauge:
+                {
+                    strCatFmt(
+                        result, "# TYPE %s gauge\n%s{%s} %" PRId64 "\n", strZ(name), strZ(name), strZ(label), stat->gauge);
+                    break;
+                }
+
+                case statTypeHistogram:
+                {
+                    strCatFmt(result, "# TYPE %s histogram\n", strZ(name));
+
+                    // Buckets are cumulative in Prometheus. Output buckets up to the largest measurement, then the +Inf bucket.
+                    unsigned int bucketMax = statBucket(stat->max);
+                    uint64_t bucketTotal = 0;
+
+                    for (unsigned int bucketIdx = 0; bucketIdx <= bucketMax && bucketIdx < STAT_BUCKET_TOTAL - 1; bucketIdx++)
+                    {
+                        bucketTotal += stat->bucket[bucketIdx];
+
+                        strCatFmt(
+                            result, "%s_bucket{%s,le=\"%" PRIu64 "\"} %" PRIu64 "\n", strZ(name), strZ(label),
+                            (uint64_t)1 << bucketIdx, bucketTotal);
+                    }
+
+                    strCatFmt(
+                        result,
+                        "%s_bucket{%s,le=\"+Inf\"} %" PRIu64 "\n%s_sum{%s} %" PRIu64 "\n%s_count{%s} %" PRIu64 "\n", strZ(name),
+                        strZ(label), stat->total, strZ(name), strZ(label), stat->sum, strZ(name), strZ(label), stat->total);
+                    break;
+                }
+            }
+        }
     }
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_TEST_RETURN(result);
 }
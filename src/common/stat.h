@@ -8,10 +8,21 @@ needed at runtime. However, statInit() must be called before any other stat*() f
 NOTE: Statistics are held in a sorted list so there is some cost involved in each lookup. In general, statistics should be used for
 relatively important or high-latency operations where measurements are critical. For instance, using statistics to count the
 iterations of a loop would likely be a bad idea.
+
+Profiling stats are measurements (e.g. elapsed microseconds or bytes) added with statAdd(). In addition to the total number of
+measurements they record the sum, min, max, and a histogram of the measurements where each bucket holds values up to and including
+the next power of two. Instrumentation in hot paths should use statProfile() or statProfileBegin() so nothing is measured (and no
+keys are constructed) unless profiling has been enabled with statProfileSet().
+
+Gauges hold the last value set with statGaugeSet().
+
+Stats collected by local and remote processes can be merged into the main process with statMerge() using the output of statToKv().
+Stats can also be output in the Prometheus text format with statToPrometheus().
 ***********************************************************************************************************************************/
 #ifndef COMMON_STAT_H
 #define COMMON_STAT_H
 
+#include "common/time.h"
 #include "common/type/variant.h"
 
 /***********************************************************************************************************************************
@@ -19,6 +30,21 @@ Statistics output constants
 ***********************************************************************************************************************************/
 #define STAT_VALUE_TOTAL                                            "total"
     VARIANT_DECLARE(STAT_VALUE_TOTAL_VAR);
+#define STAT_VALUE_SUM                                              "sum"
+    VARIANT_DECLARE(STAT_VALUE_SUM_VAR);
+#define STAT_VALUE_MIN                                              "min"
+    VARIANT_DECLARE(STAT_VALUE_MIN_VAR);
+#define STAT_VALUE_MAX                                              "max"
+    VARIANT_DECLARE(STAT_VALUE_MAX_VAR);
+#define STAT_VALUE_BUCKET                                           "bucket"
+    VARIANT_DECLARE(STAT_VALUE_BUCKET_VAR);
+#define STAT_VALUE_GAUGE                                            "gauge"
+    VARIANT_DECLARE(STAT_VALUE_GAUGE_VAR);
+
+/***********************************************************************************************************************************
+Number of histogram buckets. Bucket n holds measurements <= 2^n except for the last bucket which holds all larger measurements.
+***********************************************************************************************************************************/
+#define STAT_BUCKET_TOTAL                                           40
 
 /***********************************************************************************************************************************
 Functions
@@ -29,7 +55,31 @@ void statInit(void);
 // Increment stat by one
 void statInc(const String *key);
 
+// Add a measurement to the stat
+void statAdd(const String *key, uint64_t value);
+
+// Set gauge value
+void statGaugeSet(const String *key, int64_t value);
+
+// Merge stats output by statToKv() in another process. Counters and measurements are added and gauges are replaced.
+void statMerge(const KeyValue *statKv);
+
+// Is profiling enabled?
+bool statProfile(void);
+
+// Enable/disable profiling
+void statProfileSet(bool profile);
+
+// Begin timing an operation. Returns zero when profiling is disabled so statProfileEnd() will skip the measurement.
+TimeUSec statProfileBegin(void);
+
+// End timing an operation and add the elapsed microseconds to the stat identified by the format string
+void statProfileEnd(TimeUSec timeBegin, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
 // Output stats to a KeyValue
 KeyValue *statToKv(void);
 
+// Output stats in the Prometheus text format. The label (e.g. stanza="db",command="backup") is added to each metric.
+String *statToPrometheus(const String *label);
+
 #endif
@@ -26,6 +26,18 @@ timeMSec(void)
     FUNCTION_TEST_RETURN(((TimeMSec)currentTime.tv_sec * MSEC_PER_SEC) + (TimeMSec)currentTime.tv_usec / MSEC_PER_USEC);
 }
 
+/**********************************************************************************************************************************/
+TimeUSec
+timeUSec(void)
+{
+    FUNCTION_TEST_VOID();
+
+    struct timeval currentTime;
+    gettimeofday(&currentTime, NULL);
+
+    FUNCTION_TEST_RETURN(((TimeUSec)currentTime.tv_sec * MSEC_PER_SEC * MSEC_PER_USEC) + (TimeUSec)currentTime.tv_usec);
+}
+
 /**********************************************************************************************************************************/
 void
 sleepMSec(TimeMSec sleepMSec)
@@ -11,6 +11,7 @@ Time Management
 Time types
 ***********************************************************************************************************************************/
 typedef uint64_t TimeMSec;
+typedef uint64_t TimeUSec;
 
 /***********************************************************************************************************************************
 Constants describing number of sub-units in an interval
@@ -27,6 +28,9 @@ void sleepMSec(TimeMSec sleepMSec);
 // Epoch time in milliseconds
 TimeMSec timeMSec(void);
 
+// Epoch time in microseconds
+TimeUSec timeUSec(void);
+
 // Are the date parts valid? (year >= 1970, month 1-12, day 1-31)
 void datePartsValid(int year, int month, int day);
 
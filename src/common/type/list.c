@@ -12,9 +12,28 @@ List Handler
 #include "common/type/list.h"
 #include "common/type/object.h"
 
+/***********************************************************************************************************************************
+Hash index constants
+
+The index is only built when the list has at least LIST_INDEX_SIZE_MIN items since a search on smaller lists is already fast.
+Appends update the index but any other modification frees it. The index is not (re)built until enough lookups have been done
+without a modification in between to pay for the build, i.e. LIST_INDEX_FIND_MIN iterative searches when the list is unsorted or
+listSize / LIST_INDEX_REBUILD_DIVISOR binary searches when the list is sorted. Loops that interleave lookups with removes or inserts
+never build the index, so they cost no more than they would without it.
+***********************************************************************************************************************************/
+#define LIST_INDEX_SIZE_MIN                                         64
+#define LIST_INDEX_FIND_MIN                                         4
+#define LIST_INDEX_REBUILD_DIVISOR                                  16
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
+typedef struct ListIndexSlot
+{
+    unsigned int hash;                                              // Hash of the item
+    unsigned int listIdx;                                           // Index of the item in the list + 1 (0 when slot is empty)
+} ListIndexSlot;
+
 struct List
 {
     MemContext *memContext;
@@ -25,6 +44,10 @@ struct List
     unsigned char *listAlloc;                                       // Pointer to memory allocated for the list
     unsigned char *list;                                            // Pointer to the current start of the list
     ListComparator *comparator;
+    ListHash *hash;                                                 // Hash function used to index the list
+    ListIndexSlot *index;                                           // Hash index (NULL when not built)
+    unsigned int indexSize;                                         // Number of slots in the hash index (always a power of 2)
+    unsigned int indexFindTotal;                                    // Lookups without the index since the last modification
 };
 
 OBJECT_DEFINE_MOVE(LIST);
@@ -37,8 +60,11 @@ lstNew(size_t itemSize, ListParam param)
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(SIZE, itemSize);
         FUNCTION_TEST_PARAM(FUNCTIONP, param.comparator);
+        FUNCTION_TEST_PARAM(FUNCTIONP, param.hash);
     FUNCTION_TEST_END();
 
+    ASSERT(param.hash == NULL || param.comparator != NULL);
+
     List *this = NULL;
 
     MEM_CONTEXT_NEW_BEGIN("List")
@@ -52,6 +78,7 @@ lstNew(size_t itemSize, ListParam param)
             .itemSize = itemSize,
             .sortOrder = param.sortOrder,
             .comparator = param.comparator,
+            .hash = param.hash,
         };
     }
     MEM_CONTEXT_NEW_END();
@@ -59,6 +86,143 @@ lstNew(size_t itemSize, ListParam param)
     FUNCTION_TEST_RETURN(this);
 }
 
+/***********************************************************************************************************************************
+Free the hash index. It will be rebuilt when needed by lstFind().
+***********************************************************************************************************************************/
+static void
+lstIndexFree(List *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    if (this->index != NULL)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            memFree(this->index);
+        }
+        MEM_CONTEXT_END();
+
+        this->index = NULL;
+        this->indexSize = 0;
+    }
+
+    this->indexFindTotal = 0;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Add an item to the hash index. If an equal item is already indexed then the index is not changed so lookups return the first item
+in the list, which matches the behavior of an iterative search.
+***********************************************************************************************************************************/
+static void
+lstIndexAdd(List *this, unsigned int listIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, this);
+        FUNCTION_TEST_PARAM(UINT, listIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->index != NULL);
+    ASSERT(listIdx < this->listSize);
+
+    const void *item = this->list + (listIdx * this->itemSize);
+    const unsigned int hash = this->hash(item);
+    unsigned int slotIdx = hash & (this->indexSize - 1);
+
+    // Probe until an empty slot or an equal item is found
+    bool found = false;
+
+    while (this->index[slotIdx].listIdx != 0)
+    {
+        if (this->index[slotIdx].hash == hash &&
+            this->comparator(item, this->list + ((this->index[slotIdx].listIdx - 1) * this->itemSize)) == 0)
+        {
+            found = true;
+            break;
+        }
+
+        slotIdx = (slotIdx + 1) & (this->indexSize - 1);
+    }
+
+    if (!found)
+        this->index[slotIdx] = (ListIndexSlot){.hash = hash, .listIdx = listIdx + 1};
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Build the hash index for all items in the list
+***********************************************************************************************************************************/
+static void
+lstIndexBuild(List *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->hash != NULL);
+
+    lstIndexFree(this);
+
+    // Size the index to be at least twice the size of the list (and the max size of the list to allow appends) so probes are short
+    unsigned int indexSize = LIST_INDEX_SIZE_MIN * 2;
+
+    while (indexSize < this->listSizeMax * 2)
+        indexSize *= 2;
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->index = memNew(indexSize * sizeof(ListIndexSlot));
+        memset(this->index, 0, indexSize * sizeof(ListIndexSlot));
+        this->indexSize = indexSize;
+    }
+    MEM_CONTEXT_END();
+
+    for (unsigned int listIdx = 0; listIdx < this->listSize; listIdx++)
+        lstIndexAdd(this, listIdx);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Find an item using the hash index
+***********************************************************************************************************************************/
+static void *
+lstIndexFind(const List *this, const void *item)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, this);
+        FUNCTION_TEST_PARAM_P(VOID, item);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->index != NULL);
+    ASSERT(item != NULL);
+
+    const unsigned int hash = this->hash(item);
+    unsigned int slotIdx = hash & (this->indexSize - 1);
+
+    // Probe until an empty slot or an equal item is found
+    while (this->index[slotIdx].listIdx != 0)
+    {
+        void *itemFound = this->list + ((this->index[slotIdx].listIdx - 1) * this->itemSize);
+
+        if (this->index[slotIdx].hash == hash && this->comparator(item, itemFound) == 0)
+            FUNCTION_TEST_RETURN(itemFound);
+
+        slotIdx = (slotIdx + 1) & (this->indexSize - 1);
+    }
+
+    FUNCTION_TEST_RETURN(NULL);
+}
+
 /**********************************************************************************************************************************/
 void *
 lstAdd(List *this, const void *item)
@@ -86,16 +250,21 @@ lstClear(List *this)
 
     if (this->list != NULL)
     {
+        // Free the original allocation since the list may have been moved forward when items were removed from the beginning
         MEM_CONTEXT_BEGIN(this->memContext)
         {
-            memFree(this->list);
+            memFree(this->listAlloc);
         }
         MEM_CONTEXT_END();
 
+        this->list = NULL;
+        this->listAlloc = NULL;
         this->listSize = 0;
         this->listSizeMax = 0;
     }
 
+    lstIndexFree(this);
+
     FUNCTION_TEST_RETURN(this);
 }
 
@@ -114,6 +283,47 @@ lstComparatorStr(const void *item1, const void *item2)
     FUNCTION_TEST_RETURN(strCmp(*(String **)item1, *(String **)item2));
 }
 
+/**********************************************************************************************************************************/
+int
+lstComparatorZ(const void *item1, const void *item2)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, item1);
+        FUNCTION_TEST_PARAM_P(VOID, item2);
+    FUNCTION_TEST_END();
+
+    ASSERT(item1 != NULL);
+    ASSERT(item2 != NULL);
+
+    FUNCTION_TEST_RETURN(strcmp((const char *)item1, (const char *)item2));
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+lstHashStr(const void *item)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, item);
+    FUNCTION_TEST_END();
+
+    ASSERT(item != NULL);
+
+    const String *const string = *(String **)item;
+    const unsigned char *const buffer = (const unsigned char *)strZ(string);
+    const size_t size = strSize(string);
+
+    // FNV-1a hash
+    unsigned int result = 2166136261U;
+
+    for (size_t bufferIdx = 0; bufferIdx < size; bufferIdx++)
+    {
+        result ^= buffer[bufferIdx];
+        result *= 16777619U;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 General function for a descending comparator that simply switches the parameters on the main comparator (which should be asc)
 ***********************************************************************************************************************************/
@@ -189,6 +399,27 @@ lstFind(const List *this, const void *item)
     ASSERT(this->comparator != NULL);
     ASSERT(item != NULL);
 
+    // Use the hash index when the list is large enough
+    if (this->hash != NULL && this->listSize >= LIST_INDEX_SIZE_MIN)
+    {
+        if (this->index == NULL)
+        {
+            // The index is a cache so it is safe to build it on a const list. Wait until enough lookups have been done since the
+            // last modification to pay for the build.
+            List *const thisCache = (List *)this;
+            const unsigned int findMin =
+                this->sortOrder == sortOrderNone ? LIST_INDEX_FIND_MIN : this->listSize / LIST_INDEX_REBUILD_DIVISOR;
+
+            if (thisCache->indexFindTotal >= findMin)
+                lstIndexBuild(thisCache);
+            else
+                thisCache->indexFindTotal++;
+        }
+
+        if (this->index != NULL)
+            FUNCTION_TEST_RETURN(lstIndexFind(this, item));
+    }
+
     if (this->sortOrder == sortOrderAsc)
         FUNCTION_TEST_RETURN(bsearch(item, this->list, this->listSize, this->itemSize, this->comparator));
     else if (this->sortOrder == sortOrderDesc)
@@ -321,6 +552,21 @@ lstInsert(List *this, unsigned int listIdx, const void *item)
     memcpy(itemPtr, item, this->itemSize);
     this->listSize++;
 
+    // Add the item to the hash index if it was appended. The index is rebuilt when it needs to grow, which is rare since the size
+    // doubles each time. Otherwise the indexes of existing items have changed so free the index.
+    if (listIdx == this->listSize - 1)
+    {
+        if (this->index != NULL)
+        {
+            if (this->listSize * 2 <= this->indexSize)
+                lstIndexAdd(this, listIdx);
+            else
+                lstIndexBuild(this);
+        }
+    }
+    else
+        lstIndexFree(this);
+
     FUNCTION_TEST_RETURN(itemPtr);
 }
 
@@ -339,6 +585,9 @@ lstRemoveIdx(List *this, unsigned int listIdx)
     // Decrement the list size
     this->listSize--;
 
+    // Free the hash index since the indexes of items after the removed item have changed
+    lstIndexFree(this);
+
     // If this is the first item then move the list pointer up to avoid moving all the items
     if (listIdx == 0)
     {
@@ -451,6 +700,10 @@ lstSort(List *this, SortOrder sortOrder)
             break;
     }
 
+    // Free the hash index since the items have moved
+    if (sortOrder != sortOrderNone)
+        lstIndexFree(this);
+
     this->sortOrder = sortOrder;
 
     FUNCTION_TEST_RETURN(this);
@@ -470,6 +723,10 @@ lstComparatorSet(List *this, ListComparator *comparator)
     this->comparator = comparator;
     this->sortOrder = sortOrderNone;
 
+    // Disable the hash index since the hash may not be consistent with the new comparator
+    lstIndexFree(this);
+    this->hash = NULL;
+
     FUNCTION_TEST_RETURN(this);
 }
 
@@ -48,6 +48,20 @@ typedef int ListComparator(const void *item1, const void *item2);
 // General purpose list comparator for Strings or structs with a String as the first member
 int lstComparatorStr(const void *item1, const void *item2);
 
+// General purpose list comparator for zero-terminated strings or structs with a char array as the first member
+int lstComparatorZ(const void *item1, const void *item2);
+
+/***********************************************************************************************************************************
+Function type for hashing items in the list
+
+When a hash function is set the list maintains a hash index that is used by lstFind() once the list is large enough for the index to
+be worth the memory. Items that are equal according to the comparator must have the same hash.
+***********************************************************************************************************************************/
+typedef unsigned int ListHash(const void *item);
+
+// General purpose list hash for Strings or structs with a String as the first member
+unsigned int lstHashStr(const void *item);
+
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
@@ -56,6 +70,7 @@ typedef struct ListParam
     VAR_PARAM_HEADER;
     SortOrder sortOrder;
     ListComparator *comparator;
+    ListHash *hash;
 } ListParam;
 
 #define lstNewP(itemSize, ...)                                                                                                     \
@@ -7,6 +7,7 @@ Xml Handler
 
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/xmlreader.h>
 
 #include "common/debug.h"
 #include "common/log.h"
@@ -40,6 +41,18 @@ struct XmlDocument
 
 OBJECT_DEFINE_FREE(XML_DOCUMENT);
 
+/***********************************************************************************************************************************
+Reader type
+***********************************************************************************************************************************/
+struct XmlReader
+{
+    MemContext *memContext;
+    xmlTextReaderPtr reader;
+    XmlNode *node;                                                  // Current child of the root node
+};
+
+OBJECT_DEFINE_FREE(XML_READER);
+
 /***********************************************************************************************************************************
 Error handler
 
@@ -249,6 +262,19 @@ xmlNodeContentSet(XmlNode *this, const String *content)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+String *
+xmlNodeName(const XmlNode *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_NODE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(strNew((const char *)this->node->name));
+}
+
 /**********************************************************************************************************************************/
 XmlNodeList *
 xmlNodeChildList(const XmlNode *this, const String *name)
@@ -502,3 +528,102 @@ xmlDocumentRoot(const XmlDocument *this)
 
     FUNCTION_TEST_RETURN(this->root);
 }
+
+/***********************************************************************************************************************************
+Free reader
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(XML_READER, LOG, logLevelTrace)
+{
+    xmlFreeTextReader(this->reader);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/**********************************************************************************************************************************/
+XmlReader *
+xmlReaderNewBuf(const Buffer *buffer)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+    FUNCTION_TEST_END();
+
+    ASSERT(buffer != NULL);
+    ASSERT(bufUsed(buffer) > 0);
+
+    xmlInit();
+
+    // Create object
+    XmlReader *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("XmlReader")
+    {
+        this = memNew(sizeof(XmlReader));
+
+        *this = (XmlReader)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+        };
+
+        if ((this->reader = xmlReaderForMemory(
+                (const char *)bufPtrConst(buffer), (int)bufUsed(buffer), "noname.xml", NULL, 0)) == NULL)
+        {
+            THROW_FMT(FormatError, "invalid xml");                  // {uncoverable - only fails on allocation error}
+        }
+
+        // Set callback to ensure xml reader is freed
+        memContextCallbackSet(this->memContext, xmlReaderFreeResource, this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/**********************************************************************************************************************************/
+const XmlNode *
+xmlReaderNext(XmlReader *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(XML_READER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    XmlNode *result = NULL;
+
+    // Skip the subtree of the prior child, if any, since the reader frees it once the reader moves past it. Otherwise start reading
+    // the document.
+    int readResult = this->node == NULL ? xmlTextReaderRead(this->reader) : xmlTextReaderNext(this->reader);
+
+    while (readResult == 1)
+    {
+        // Expand the next child of the root node so it can be accessed like a document node
+        if (xmlTextReaderDepth(this->reader) == 1 && xmlTextReaderNodeType(this->reader) == XML_READER_TYPE_ELEMENT)
+        {
+            xmlNodePtr node = xmlTextReaderExpand(this->reader);
+
+            if (node == NULL)
+                break;
+
+            if (this->node == NULL)
+            {
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    this->node = xmlNodeNew(node);
+                }
+                MEM_CONTEXT_END();
+            }
+            else
+                this->node->node = node;
+
+            result = this->node;
+            break;
+        }
+
+        readResult = xmlTextReaderRead(this->reader);
+    }
+
+    // Error on invalid xml. This includes truncated documents so a partial result cannot be mistaken for a complete one.
+    if (result == NULL && readResult != 0)
+        THROW_FMT(FormatError, "invalid xml");
+
+    FUNCTION_TEST_RETURN(result);
+}
@@ -18,6 +18,11 @@ typedef struct XmlDocument XmlDocument;
 typedef struct XmlNode XmlNode;
 typedef struct XmlNodeList XmlNodeList;
 
+#define XML_READER_TYPE                                             XmlReader
+#define XML_READER_PREFIX                                           xmlReader
+
+typedef struct XmlReader XmlReader;
+
 #include "common/memContext.h"
 #include "common/type/string.h"
 
@@ -76,6 +81,9 @@ unsigned int xmlNodeChildTotal(const XmlNode *this, const String *name);
 String *xmlNodeContent(const XmlNode *this);
 void xmlNodeContentSet(XmlNode *this, const String *content);
 
+// Node name
+String *xmlNodeName(const XmlNode *this);
+
 /***********************************************************************************************************************************
 Node Destructor
 ***********************************************************************************************************************************/
@@ -95,6 +103,27 @@ Node List Destructor
 ***********************************************************************************************************************************/
 void xmlNodeLstFree(XmlNodeList *this);
 
+/***********************************************************************************************************************************
+Reader Constructors
+
+The reader parses a document one child of the root node at a time rather than building the entire document in memory, which is
+more efficient for large documents where each child is processed once, e.g. S3 list results.
+***********************************************************************************************************************************/
+// Reader from Buffer
+XmlReader *xmlReaderNewBuf(const Buffer *buffer);
+
+/***********************************************************************************************************************************
+Reader Functions
+***********************************************************************************************************************************/
+// Get the next child of the root node. The node is only valid until the next call and NULL is returned when there are no more
+// children.
+const XmlNode *xmlReaderNext(XmlReader *this);
+
+/***********************************************************************************************************************************
+Reader Destructor
+***********************************************************************************************************************************/
+void xmlReaderFree(XmlReader *this);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
@@ -113,4 +142,9 @@ Macros for function logging
 #define FUNCTION_LOG_XML_NODE_LIST_FORMAT(value, buffer, bufferSize)                                                               \
     objToLog(value, "XmlNodeList", buffer, bufferSize)
 
+#define FUNCTION_LOG_XML_READER_TYPE                                                                                               \
+    XmlReader *
+#define FUNCTION_LOG_XML_READER_FORMAT(value, buffer, bufferSize)                                                                  \
+    objToLog(value, "XmlReader", buffer, bufferSize)
+
 #endif
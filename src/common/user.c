@@ -26,6 +26,58 @@ struct
     const String *groupName;                                        // Group name if it exists
 } userLocalData;
 
+/***********************************************************************************************************************************
+Cache of the last user/group looked up by name. Restore looks up the same few names for every file and each lookup may require a
+request to a directory service, e.g. LDAP.
+***********************************************************************************************************************************/
+static struct
+{
+    MemContext *memContext;                                         // Mem context to store cached names
+
+    String *userName;                                               // Last user name looked up
+    uid_t userId;                                                   // Id of the last user name looked up
+
+    String *groupName;                                              // Last group name looked up
+    gid_t groupId;                                                  // Id of the last group name looked up
+} userNameCache;
+
+// Replace a cached name
+static String *
+userNameCacheSet(String *cacheName, const String *name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, cacheName);
+        FUNCTION_TEST_PARAM(STRING, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(name != NULL);
+
+    if (userNameCache.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("UserNameCache")
+            {
+                userNameCache.memContext = MEM_CONTEXT_NEW();
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    strFree(cacheName);
+
+    String *result = NULL;
+
+    MEM_CONTEXT_BEGIN(userNameCache.memContext)
+    {
+        result = strDup(name);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 static void
 userInitInternal(void)
@@ -81,10 +133,19 @@ groupIdFromName(const String *groupName)
 
     if (groupName != NULL)
     {
-        struct group *groupData = getgrnam(strZ(groupName));
+        if (!strEq(groupName, userNameCache.groupName))
+        {
+            struct group *groupData = getgrnam(strZ(groupName));
+
+            // Do not cache a missing name since it may be created later
+            if (groupData == NULL)
+                FUNCTION_TEST_RETURN((gid_t)-1);
+
+            userNameCache.groupName = userNameCacheSet(userNameCache.groupName, groupName);
+            userNameCache.groupId = groupData->gr_gid;
+        }
 
-        if (groupData != NULL)
-            FUNCTION_TEST_RETURN(groupData->gr_gid);
+        FUNCTION_TEST_RETURN(userNameCache.groupId);
     }
 
     FUNCTION_TEST_RETURN((gid_t)-1);
@@ -132,10 +193,19 @@ userIdFromName(const String *userName)
 
     if (userName != NULL)
     {
-        struct passwd *userData = getpwnam(strZ(userName));
+        if (!strEq(userName, userNameCache.userName))
+        {
+            struct passwd *userData = getpwnam(strZ(userName));
+
+            // Do not cache a missing name since it may be created later
+            if (userData == NULL)
+                FUNCTION_TEST_RETURN((uid_t)-1);
+
+            userNameCache.userName = userNameCacheSet(userNameCache.userName, userName);
+            userNameCache.userId = userData->pw_uid;
+        }
 
-        if (userData != NULL)
-            FUNCTION_TEST_RETURN(userData->pw_uid);
+        FUNCTION_TEST_RETURN(userNameCache.userId);
     }
 
     FUNCTION_TEST_RETURN((uid_t)-1);
@@ -17,7 +17,7 @@ void userInit(void);
 // Get the primary group id of the current user
 gid_t groupId(void);
 
-// Get the id of the specified group.  Returns (gid_t)-1 if not found.
+// Get the id of the specified group.  Returns (gid_t)-1 if not found. The last group looked up is cached.
 gid_t groupIdFromName(const String *groupName);
 
 // Get the primary group name of the current user.  Returns NULL if there is no mapping.
@@ -29,7 +29,7 @@ String *groupNameFromId(gid_t groupId);
 // Get the id of the current user
 uid_t userId(void);
 
-// Get the id of the specified user.  Returns (uid_t)-1 if not found.
+// Get the id of the specified user.  Returns (uid_t)-1 if not found. The last user looked up is cached.
 uid_t userIdFromName(const String *userName);
 
 // Get the name of the current user.  Returns NULL if there is no mapping.
@@ -14,12 +14,14 @@ STRING_EXTERN(CFGCMD_CHECK_STR,                                     CFGCMD_CHECK
 STRING_EXTERN(CFGCMD_EXPIRE_STR,                                    CFGCMD_EXPIRE);
 STRING_EXTERN(CFGCMD_HELP_STR,                                      CFGCMD_HELP);
 STRING_EXTERN(CFGCMD_INFO_STR,                                      CFGCMD_INFO);
+STRING_EXTERN(CFGCMD_RELATION_RESTORE_STR,                          CFGCMD_RELATION_RESTORE);
 STRING_EXTERN(CFGCMD_REPO_CREATE_STR,                               CFGCMD_REPO_CREATE);
 STRING_EXTERN(CFGCMD_REPO_GET_STR,                                  CFGCMD_REPO_GET);
 STRING_EXTERN(CFGCMD_REPO_LS_STR,                                   CFGCMD_REPO_LS);
 STRING_EXTERN(CFGCMD_REPO_PUT_STR,                                  CFGCMD_REPO_PUT);
 STRING_EXTERN(CFGCMD_REPO_RM_STR,                                   CFGCMD_REPO_RM);
 STRING_EXTERN(CFGCMD_RESTORE_STR,                                   CFGCMD_RESTORE);
+STRING_EXTERN(CFGCMD_SERVER_STR,                                    CFGCMD_SERVER);
 STRING_EXTERN(CFGCMD_STANZA_CREATE_STR,                             CFGCMD_STANZA_CREATE);
 STRING_EXTERN(CFGCMD_STANZA_DELETE_STR,                             CFGCMD_STANZA_DELETE);
 STRING_EXTERN(CFGCMD_STANZA_UPGRADE_STR,                            CFGCMD_STANZA_UPGRADE);
@@ -110,6 +112,17 @@ static const ConfigCommandData configCommandData[CFG_COMMAND_TOTAL] = CONFIG_COM
         CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
     )
 
+    CONFIG_COMMAND
+    (
+        CONFIG_COMMAND_NAME(CFGCMD_RELATION_RESTORE)
+
+        CONFIG_COMMAND_LOG_FILE(true)
+        CONFIG_COMMAND_LOG_LEVEL_DEFAULT(logLevelInfo)
+        CONFIG_COMMAND_LOCK_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_REMOTE_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
+    )
+
     CONFIG_COMMAND
     (
         CONFIG_COMMAND_NAME(CFGCMD_REPO_CREATE)
@@ -176,6 +189,17 @@ static const ConfigCommandData configCommandData[CFG_COMMAND_TOTAL] = CONFIG_COM
         CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
     )
 
+    CONFIG_COMMAND
+    (
+        CONFIG_COMMAND_NAME(CFGCMD_SERVER)
+
+        CONFIG_COMMAND_LOG_FILE(true)
+        CONFIG_COMMAND_LOG_LEVEL_DEFAULT(logLevelInfo)
+        CONFIG_COMMAND_LOCK_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_REMOTE_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
+    )
+
     CONFIG_COMMAND
     (
         CONFIG_COMMAND_NAME(CFGCMD_STANZA_CREATE)
@@ -262,14 +286,22 @@ STRING_EXTERN(CFGOPT_ARCHIVE_CHECK_STR,                             CFGOPT_ARCHI
 STRING_EXTERN(CFGOPT_ARCHIVE_COPY_STR,                              CFGOPT_ARCHIVE_COPY);
 STRING_EXTERN(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR,                     CFGOPT_ARCHIVE_GET_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_ARCHIVE_MODE_STR,                              CFGOPT_ARCHIVE_MODE);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_BUFFER_MAX_STR,                   CFGOPT_ARCHIVE_PUSH_BUFFER_MAX);
 STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR,                    CFGOPT_ARCHIVE_PUSH_QUEUE_MAX);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_REPO_QUEUE_STR,                   CFGOPT_ARCHIVE_PUSH_REPO_QUEUE);
+STRING_EXTERN(CFGOPT_ARCHIVE_SERVER_STR,                            CFGOPT_ARCHIVE_SERVER);
 STRING_EXTERN(CFGOPT_ARCHIVE_TIMEOUT_STR,                           CFGOPT_ARCHIVE_TIMEOUT);
+STRING_EXTERN(CFGOPT_BACKUP_DEDUP_STR,                              CFGOPT_BACKUP_DEDUP);
+STRING_EXTERN(CFGOPT_BACKUP_PRECOPY_STR,                            CFGOPT_BACKUP_PRECOPY);
 STRING_EXTERN(CFGOPT_BACKUP_STANDBY_STR,                            CFGOPT_BACKUP_STANDBY);
 STRING_EXTERN(CFGOPT_BUFFER_SIZE_STR,                               CFGOPT_BUFFER_SIZE);
 STRING_EXTERN(CFGOPT_CHECKSUM_PAGE_STR,                             CFGOPT_CHECKSUM_PAGE);
+STRING_EXTERN(CFGOPT_CIPHER_COMPAT_STR,                             CFGOPT_CIPHER_COMPAT);
 STRING_EXTERN(CFGOPT_CIPHER_PASS_STR,                               CFGOPT_CIPHER_PASS);
 STRING_EXTERN(CFGOPT_CMD_SSH_STR,                                   CFGOPT_CMD_SSH);
+STRING_EXTERN(CFGOPT_CMD_SSH_CONTROL_PATH_STR,                      CFGOPT_CMD_SSH_CONTROL_PATH);
 STRING_EXTERN(CFGOPT_COMPRESS_STR,                                  CFGOPT_COMPRESS);
+STRING_EXTERN(CFGOPT_COMPRESS_FRAME_SIZE_STR,                       CFGOPT_COMPRESS_FRAME_SIZE);
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_STR,                            CFGOPT_COMPRESS_LEVEL);
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_NETWORK_STR,                    CFGOPT_COMPRESS_LEVEL_NETWORK);
 STRING_EXTERN(CFGOPT_COMPRESS_TYPE_STR,                             CFGOPT_COMPRESS_TYPE);
@@ -299,16 +331,19 @@ STRING_EXTERN(CFGOPT_LOG_PATH_STR,                                  CFGOPT_LOG_P
 STRING_EXTERN(CFGOPT_LOG_SUBPROCESS_STR,                            CFGOPT_LOG_SUBPROCESS);
 STRING_EXTERN(CFGOPT_LOG_TIMESTAMP_STR,                             CFGOPT_LOG_TIMESTAMP);
 STRING_EXTERN(CFGOPT_MANIFEST_SAVE_THRESHOLD_STR,                   CFGOPT_MANIFEST_SAVE_THRESHOLD);
+STRING_EXTERN(CFGOPT_METRIC_PATH_STR,                               CFGOPT_METRIC_PATH);
 STRING_EXTERN(CFGOPT_NEUTRAL_UMASK_STR,                             CFGOPT_NEUTRAL_UMASK);
 STRING_EXTERN(CFGOPT_ONLINE_STR,                                    CFGOPT_ONLINE);
 STRING_EXTERN(CFGOPT_OUTPUT_STR,                                    CFGOPT_OUTPUT);
 STRING_EXTERN(CFGOPT_PG_STR,                                        CFGOPT_PG);
 STRING_EXTERN(CFGOPT_PROCESS_STR,                                   CFGOPT_PROCESS);
 STRING_EXTERN(CFGOPT_PROCESS_MAX_STR,                               CFGOPT_PROCESS_MAX);
+STRING_EXTERN(CFGOPT_PROFILE_STR,                                   CFGOPT_PROFILE);
 STRING_EXTERN(CFGOPT_PROTOCOL_TIMEOUT_STR,                          CFGOPT_PROTOCOL_TIMEOUT);
 STRING_EXTERN(CFGOPT_RAW_STR,                                       CFGOPT_RAW);
 STRING_EXTERN(CFGOPT_RECOVERY_OPTION_STR,                           CFGOPT_RECOVERY_OPTION);
 STRING_EXTERN(CFGOPT_RECURSE_STR,                                   CFGOPT_RECURSE);
+STRING_EXTERN(CFGOPT_RELATION_PATH_STR,                             CFGOPT_RELATION_PATH);
 STRING_EXTERN(CFGOPT_REMOTE_TYPE_STR,                               CFGOPT_REMOTE_TYPE);
 STRING_EXTERN(CFGOPT_REPO_STR,                                      CFGOPT_REPO);
 STRING_EXTERN(CFGOPT_RESUME_STR,                                    CFGOPT_RESUME);
@@ -316,10 +351,12 @@ STRING_EXTERN(CFGOPT_SCK_BLOCK_STR,                                 CFGOPT_SCK_B
 STRING_EXTERN(CFGOPT_SCK_KEEP_ALIVE_STR,                            CFGOPT_SCK_KEEP_ALIVE);
 STRING_EXTERN(CFGOPT_SET_STR,                                       CFGOPT_SET);
 STRING_EXTERN(CFGOPT_SORT_STR,                                      CFGOPT_SORT);
+STRING_EXTERN(CFGOPT_SPARSE_STR,                                    CFGOPT_SPARSE);
 STRING_EXTERN(CFGOPT_SPOOL_PATH_STR,                                CFGOPT_SPOOL_PATH);
 STRING_EXTERN(CFGOPT_STANZA_STR,                                    CFGOPT_STANZA);
 STRING_EXTERN(CFGOPT_START_FAST_STR,                                CFGOPT_START_FAST);
 STRING_EXTERN(CFGOPT_STOP_AUTO_STR,                                 CFGOPT_STOP_AUTO);
+STRING_EXTERN(CFGOPT_SYNC_BATCH_STR,                                CFGOPT_SYNC_BATCH);
 STRING_EXTERN(CFGOPT_TABLESPACE_MAP_STR,                            CFGOPT_TABLESPACE_MAP);
 STRING_EXTERN(CFGOPT_TABLESPACE_MAP_ALL_STR,                        CFGOPT_TABLESPACE_MAP_ALL);
 STRING_EXTERN(CFGOPT_TARGET_STR,                                    CFGOPT_TARGET);
@@ -329,4 +366,11 @@ STRING_EXTERN(CFGOPT_TARGET_TIMELINE_STR,                           CFGOPT_TARGE
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_COUNT_STR,                      CFGOPT_TCP_KEEP_ALIVE_COUNT);
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_IDLE_STR,                       CFGOPT_TCP_KEEP_ALIVE_IDLE);
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_INTERVAL_STR,                   CFGOPT_TCP_KEEP_ALIVE_INTERVAL);
+STRING_EXTERN(CFGOPT_TLS_SERVER_ADDRESS_STR,                        CFGOPT_TLS_SERVER_ADDRESS);
+STRING_EXTERN(CFGOPT_TLS_SERVER_CA_FILE_STR,                        CFGOPT_TLS_SERVER_CA_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_CERT_FILE_STR,                      CFGOPT_TLS_SERVER_CERT_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_KEY_FILE_STR,                       CFGOPT_TLS_SERVER_KEY_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_PORT_STR,                           CFGOPT_TLS_SERVER_PORT);
 STRING_EXTERN(CFGOPT_TYPE_STR,                                      CFGOPT_TYPE);
+STRING_EXTERN(CFGOPT_VERIFY_LEDGER_STR,                             CFGOPT_VERIFY_LEDGER);
+STRING_EXTERN(CFGOPT_VERIFY_SAMPLE_STR,                             CFGOPT_VERIFY_SAMPLE);
@@ -23,6 +23,8 @@ Command constants
     STRING_DECLARE(CFGCMD_HELP_STR);
 #define CFGCMD_INFO                                                 "info"
     STRING_DECLARE(CFGCMD_INFO_STR);
+#define CFGCMD_RELATION_RESTORE                                     "relation-restore"
+    STRING_DECLARE(CFGCMD_RELATION_RESTORE_STR);
 #define CFGCMD_REPO_CREATE                                          "repo-create"
     STRING_DECLARE(CFGCMD_REPO_CREATE_STR);
 #define CFGCMD_REPO_GET                                             "repo-get"
@@ -35,6 +37,8 @@ Command constants
     STRING_DECLARE(CFGCMD_REPO_RM_STR);
 #define CFGCMD_RESTORE                                              "restore"
     STRING_DECLARE(CFGCMD_RESTORE_STR);
+#define CFGCMD_SERVER                                               "server"
+    STRING_DECLARE(CFGCMD_SERVER_STR);
 #define CFGCMD_STANZA_CREATE                                        "stanza-create"
     STRING_DECLARE(CFGCMD_STANZA_CREATE_STR);
 #define CFGCMD_STANZA_DELETE                                        "stanza-delete"
@@ -50,7 +54,7 @@ Command constants
 #define CFGCMD_VERSION                                              "version"
     STRING_DECLARE(CFGCMD_VERSION_STR);
 
-#define CFG_COMMAND_TOTAL                                           20
+#define CFG_COMMAND_TOTAL                                           22
 
 /***********************************************************************************************************************************
 Option group constants
@@ -70,22 +74,38 @@ Option constants
     STRING_DECLARE(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR);
 #define CFGOPT_ARCHIVE_MODE                                         "archive-mode"
     STRING_DECLARE(CFGOPT_ARCHIVE_MODE_STR);
+#define CFGOPT_ARCHIVE_PUSH_BUFFER_MAX                              "archive-push-buffer-max"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_BUFFER_MAX_STR);
 #define CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                               "archive-push-queue-max"
     STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR);
+#define CFGOPT_ARCHIVE_PUSH_REPO_QUEUE                              "archive-push-repo-queue"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_REPO_QUEUE_STR);
+#define CFGOPT_ARCHIVE_SERVER                                       "archive-server"
+    STRING_DECLARE(CFGOPT_ARCHIVE_SERVER_STR);
 #define CFGOPT_ARCHIVE_TIMEOUT                                      "archive-timeout"
     STRING_DECLARE(CFGOPT_ARCHIVE_TIMEOUT_STR);
+#define CFGOPT_BACKUP_DEDUP                                         "backup-dedup"
+    STRING_DECLARE(CFGOPT_BACKUP_DEDUP_STR);
+#define CFGOPT_BACKUP_PRECOPY                                       "backup-precopy"
+    STRING_DECLARE(CFGOPT_BACKUP_PRECOPY_STR);
 #define CFGOPT_BACKUP_STANDBY                                       "backup-standby"
     STRING_DECLARE(CFGOPT_BACKUP_STANDBY_STR);
 #define CFGOPT_BUFFER_SIZE                                          "buffer-size"
     STRING_DECLARE(CFGOPT_BUFFER_SIZE_STR);
 #define CFGOPT_CHECKSUM_PAGE                                        "checksum-page"
     STRING_DECLARE(CFGOPT_CHECKSUM_PAGE_STR);
+#define CFGOPT_CIPHER_COMPAT                                        "cipher-compat"
+    STRING_DECLARE(CFGOPT_CIPHER_COMPAT_STR);
 #define CFGOPT_CIPHER_PASS                                          "cipher-pass"
     STRING_DECLARE(CFGOPT_CIPHER_PASS_STR);
 #define CFGOPT_CMD_SSH                                              "cmd-ssh"
     STRING_DECLARE(CFGOPT_CMD_SSH_STR);
+#define CFGOPT_CMD_SSH_CONTROL_PATH                                 "cmd-ssh-control-path"
+    STRING_DECLARE(CFGOPT_CMD_SSH_CONTROL_PATH_STR);
 #define CFGOPT_COMPRESS                                             "compress"
     STRING_DECLARE(CFGOPT_COMPRESS_STR);
+#define CFGOPT_COMPRESS_FRAME_SIZE                                  "compress-frame-size"
+    STRING_DECLARE(CFGOPT_COMPRESS_FRAME_SIZE_STR);
 #define CFGOPT_COMPRESS_LEVEL                                       "compress-level"
     STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_STR);
 #define CFGOPT_COMPRESS_LEVEL_NETWORK                               "compress-level-network"
@@ -144,6 +164,8 @@ Option constants
     STRING_DECLARE(CFGOPT_LOG_TIMESTAMP_STR);
 #define CFGOPT_MANIFEST_SAVE_THRESHOLD                              "manifest-save-threshold"
     STRING_DECLARE(CFGOPT_MANIFEST_SAVE_THRESHOLD_STR);
+#define CFGOPT_METRIC_PATH                                          "metric-path"
+    STRING_DECLARE(CFGOPT_METRIC_PATH_STR);
 #define CFGOPT_NEUTRAL_UMASK                                        "neutral-umask"
     STRING_DECLARE(CFGOPT_NEUTRAL_UMASK_STR);
 #define CFGOPT_ONLINE                                               "online"
@@ -156,6 +178,8 @@ Option constants
     STRING_DECLARE(CFGOPT_PROCESS_STR);
 #define CFGOPT_PROCESS_MAX                                          "process-max"
     STRING_DECLARE(CFGOPT_PROCESS_MAX_STR);
+#define CFGOPT_PROFILE                                              "profile"
+    STRING_DECLARE(CFGOPT_PROFILE_STR);
 #define CFGOPT_PROTOCOL_TIMEOUT                                     "protocol-timeout"
     STRING_DECLARE(CFGOPT_PROTOCOL_TIMEOUT_STR);
 #define CFGOPT_RAW                                                  "raw"
@@ -164,6 +188,8 @@ Option constants
     STRING_DECLARE(CFGOPT_RECOVERY_OPTION_STR);
 #define CFGOPT_RECURSE                                              "recurse"
     STRING_DECLARE(CFGOPT_RECURSE_STR);
+#define CFGOPT_RELATION_PATH                                        "relation-path"
+    STRING_DECLARE(CFGOPT_RELATION_PATH_STR);
 #define CFGOPT_REMOTE_TYPE                                          "remote-type"
     STRING_DECLARE(CFGOPT_REMOTE_TYPE_STR);
 #define CFGOPT_REPO                                                 "repo"
@@ -178,6 +204,8 @@ Option constants
     STRING_DECLARE(CFGOPT_SET_STR);
 #define CFGOPT_SORT                                                 "sort"
     STRING_DECLARE(CFGOPT_SORT_STR);
+#define CFGOPT_SPARSE                                               "sparse"
+    STRING_DECLARE(CFGOPT_SPARSE_STR);
 #define CFGOPT_SPOOL_PATH                                           "spool-path"
     STRING_DECLARE(CFGOPT_SPOOL_PATH_STR);
 #define CFGOPT_STANZA                                               "stanza"
@@ -186,6 +214,8 @@ Option constants
     STRING_DECLARE(CFGOPT_START_FAST_STR);
 #define CFGOPT_STOP_AUTO                                            "stop-auto"
     STRING_DECLARE(CFGOPT_STOP_AUTO_STR);
+#define CFGOPT_SYNC_BATCH                                           "sync-batch"
+    STRING_DECLARE(CFGOPT_SYNC_BATCH_STR);
 #define CFGOPT_TABLESPACE_MAP                                       "tablespace-map"
     STRING_DECLARE(CFGOPT_TABLESPACE_MAP_STR);
 #define CFGOPT_TABLESPACE_MAP_ALL                                   "tablespace-map-all"
@@ -204,10 +234,24 @@ Option constants
     STRING_DECLARE(CFGOPT_TCP_KEEP_ALIVE_IDLE_STR);
 #define CFGOPT_TCP_KEEP_ALIVE_INTERVAL                              "tcp-keep-alive-interval"
     STRING_DECLARE(CFGOPT_TCP_KEEP_ALIVE_INTERVAL_STR);
+#define CFGOPT_TLS_SERVER_ADDRESS                                   "tls-server-address"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_ADDRESS_STR);
+#define CFGOPT_TLS_SERVER_CA_FILE                                   "tls-server-ca-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_CA_FILE_STR);
+#define CFGOPT_TLS_SERVER_CERT_FILE                                 "tls-server-cert-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_CERT_FILE_STR);
+#define CFGOPT_TLS_SERVER_KEY_FILE                                  "tls-server-key-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_KEY_FILE_STR);
+#define CFGOPT_TLS_SERVER_PORT                                      "tls-server-port"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_PORT_STR);
 #define CFGOPT_TYPE                                                 "type"
     STRING_DECLARE(CFGOPT_TYPE_STR);
+#define CFGOPT_VERIFY_LEDGER                                        "verify-ledger"
+    STRING_DECLARE(CFGOPT_VERIFY_LEDGER_STR);
+#define CFGOPT_VERIFY_SAMPLE                                        "verify-sample"
+    STRING_DECLARE(CFGOPT_VERIFY_SAMPLE_STR);
 
-#define CFG_OPTION_TOTAL                                            128
+#define CFG_OPTION_TOTAL                                            152
 
 /***********************************************************************************************************************************
 Command enum
@@ -221,12 +265,14 @@ typedef enum
     cfgCmdExpire,
     cfgCmdHelp,
     cfgCmdInfo,
+    cfgCmdRelationRestore,
     cfgCmdRepoCreate,
     cfgCmdRepoGet,
     cfgCmdRepoLs,
     cfgCmdRepoPut,
     cfgCmdRepoRm,
     cfgCmdRestore,
+    cfgCmdServer,
     cfgCmdStanzaCreate,
     cfgCmdStanzaDelete,
     cfgCmdStanzaUpgrade,
@@ -256,14 +302,22 @@ typedef enum
     cfgOptArchiveCopy,
     cfgOptArchiveGetQueueMax,
     cfgOptArchiveMode,
+    cfgOptArchivePushBufferMax,
     cfgOptArchivePushQueueMax,
+    cfgOptArchivePushRepoQueue,
+    cfgOptArchiveServer,
     cfgOptArchiveTimeout,
+    cfgOptBackupDedup,
+    cfgOptBackupPrecopy,
     cfgOptBackupStandby,
     cfgOptBufferSize,
     cfgOptChecksumPage,
+    cfgOptCipherCompat,
     cfgOptCipherPass,
     cfgOptCmdSsh,
+    cfgOptCmdSshControlPath,
     cfgOptCompress,
+    cfgOptCompressFrameSize,
     cfgOptCompressLevel,
     cfgOptCompressLevelNetwork,
     cfgOptCompressType,
@@ -293,6 +347,7 @@ typedef enum
     cfgOptLogSubprocess,
     cfgOptLogTimestamp,
     cfgOptManifestSaveThreshold,
+    cfgOptMetricPath,
     cfgOptNeutralUmask,
     cfgOptOnline,
     cfgOptOutput,
@@ -312,10 +367,12 @@ typedef enum
     cfgOptPgUser,
     cfgOptProcess,
     cfgOptProcessMax,
+    cfgOptProfile,
     cfgOptProtocolTimeout,
     cfgOptRaw,
     cfgOptRecoveryOption,
     cfgOptRecurse,
+    cfgOptRelationPath,
     cfgOptRemoteType,
     cfgOptRepo,
     cfgOptRepoAzureAccount,
@@ -332,11 +389,15 @@ typedef enum
     cfgOptRepoCipherType,
     cfgOptRepoHardlink,
     cfgOptRepoHost,
+    cfgOptRepoHostCaFile,
+    cfgOptRepoHostCertFile,
     cfgOptRepoHostCmd,
     cfgOptRepoHostConfig,
     cfgOptRepoHostConfigIncludePath,
     cfgOptRepoHostConfigPath,
+    cfgOptRepoHostKeyFile,
     cfgOptRepoHostPort,
+    cfgOptRepoHostType,
     cfgOptRepoHostUser,
     cfgOptRepoLocal,
     cfgOptRepoPath,
@@ -365,10 +426,12 @@ typedef enum
     cfgOptSckKeepAlive,
     cfgOptSet,
     cfgOptSort,
+    cfgOptSparse,
     cfgOptSpoolPath,
     cfgOptStanza,
     cfgOptStartFast,
     cfgOptStopAuto,
+    cfgOptSyncBatch,
     cfgOptTablespaceMap,
     cfgOptTablespaceMapAll,
     cfgOptTarget,
@@ -378,7 +441,14 @@ typedef enum
     cfgOptTcpKeepAliveCount,
     cfgOptTcpKeepAliveIdle,
     cfgOptTcpKeepAliveInterval,
+    cfgOptTlsServerAddress,
+    cfgOptTlsServerCaFile,
+    cfgOptTlsServerCertFile,
+    cfgOptTlsServerKeyFile,
+    cfgOptTlsServerPort,
     cfgOptType,
+    cfgOptVerifyLedger,
+    cfgOptVerifySample,
 } ConfigOption;
 
 #endif
@@ -9,6 +9,7 @@ Configuration Load
 
 #include "command/command.h"
 #include "common/compress/helper.intern.h"
+#include "common/crypto/cipherBlock.h"
 #include "common/crypto/common.h"
 #include "common/memContext.h"
 #include "common/debug.h"
@@ -16,6 +17,7 @@ Configuration Load
 #include "common/io/socket/common.h"
 #include "common/lock.h"
 #include "common/log.h"
+#include "common/stat.h"
 #include "config/config.intern.h"
 #include "config/load.h"
 #include "config/parse.h"
@@ -323,14 +325,18 @@ cfgLoadUpdateOption(void)
 void
 cfgLoadLogFile(void)
 {
-    if (cfgLogFile() && !cfgCommandHelp())
+    // Profiling stats are written next to the log file and metrics are written to the metric path using the same name, so the name
+    // is constructed even when file logging is disabled
+    const bool profile = cfgOptionValid(cfgOptProfile) && cfgOptionBool(cfgOptProfile);
+    const bool metric = cfgOptionValid(cfgOptMetricPath) && cfgOptionTest(cfgOptMetricPath);
+
+    if ((cfgLogFile() || profile || metric) && !cfgCommandHelp())
     {
         MEM_CONTEXT_TEMP_BEGIN()
         {
             // Construct log filename prefix
             String *logFile = strNewFmt(
-                "%s/%s-%s", strZ(cfgOptionStr(cfgOptLogPath)),
-                cfgOptionTest(cfgOptStanza) ? strZ(cfgOptionStr(cfgOptStanza)): "all", cfgCommandName(cfgCommand()));
+                "%s-%s", cfgOptionTest(cfgOptStanza) ? strZ(cfgOptionStr(cfgOptStanza)): "all", cfgCommandName(cfgCommand()));
 
             // ??? Append async for local/remote archive async commands.  It would be good to find a more generic way to do this in
             // case the async role is added to more commands.
@@ -348,11 +354,20 @@ cfgLoadLogFile(void)
             if (cfgCommandRole() == cfgCmdRoleLocal || cfgCommandRole() == cfgCmdRoleRemote)
                 strCatFmt(logFile, "-%03u", cfgOptionUInt(cfgOptProcess));
 
-            // Add extension
-            strCatZ(logFile, ".log");
+            // Enable profiling. Local and remote processes collect stats when metrics are enabled so they can be merged into the
+            // main process, which writes the metrics.
+            if (profile || metric)
+            {
+                statProfileSet(true);
+
+                cmdStatFileSet(
+                    profile ? strNewFmt("%s/%s.profile.json", strZ(cfgOptionStr(cfgOptLogPath)), strZ(logFile)) : NULL,
+                    metric && cfgCommandRole() != cfgCmdRoleLocal && cfgCommandRole() != cfgCmdRoleRemote ?
+                        strNewFmt("%s/%s.prom", strZ(cfgOptionStr(cfgOptMetricPath)), strZ(logFile)) : NULL);
+            }
 
             // Attempt to open log file
-            if (!logFileSet(strZ(logFile)))
+            if (cfgLogFile() && !logFileSet(strZ(strNewFmt("%s/%s.log", strZ(cfgOptionStr(cfgOptLogPath)), strZ(logFile)))))
                 cfgOptionSet(cfgOptLogLevelFile, cfgSourceParam, varNewStrZ("off"));
         }
         MEM_CONTEXT_TEMP_END();
@@ -412,6 +427,10 @@ cfgLoad(unsigned int argListSize, const char *argList[])
             if (cfgOptionValid(cfgOptIoTimeout))
                 ioTimeoutMsSet(cfgOptionUInt64(cfgOptIoTimeout));
 
+            // Allow aes-256-cbc files to be decrypted when aes-256-gcm is configured
+            if (cfgOptionValid(cfgOptCipherCompat))
+                cipherBlockCompatSet(cfgOptionBool(cfgOptCipherCompat));
+
             // Open the log file if this command logs to a file
             cfgLoadLogFile();
 
@@ -4,10 +4,11 @@ Database Client
 #include "build.auto.h"
 
 #include "common/debug.h"
+#include "common/io/fd.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/time.h"
 #include "common/type/object.h"
-#include "common/wait.h"
 #include "db/db.h"
 #include "db/protocol.h"
 #include "postgres/interface.h"
@@ -23,6 +24,17 @@ Constants
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
+typedef struct DbReplayWait
+{
+    String *targetLsn;                                              // Lsn the standby must replay past
+    String *replayLsn;                                              // Last lsn replayed by the standby
+    String *replayLsnFunction;                                      // Function used to get the replay lsn
+    TimeMSec timeout;                                               // Time to wait without progress before timing out
+    TimeMSec progressTime;                                          // Time when the wait began or progress was last made
+    unsigned int retry;                                             // Retries for the next query to wait on the standby
+    bool targetReached;                                             // Has the target lsn been reached?
+} DbReplayWait;
+
 struct Db
 {
     MemContext *memContext;
@@ -35,6 +47,8 @@ struct Db
     const String *pgDataPath;                                       // Data directory reported by the database
     const String *archiveMode;                                      // The archive_mode reported by the database
     const String *archiveCommand;                                   // The archive_command reported by the database
+
+    DbReplayWait replayWait;                                        // Replay wait state
 };
 
 OBJECT_DEFINE_MOVE(DB);
@@ -86,10 +100,10 @@ dbNew(PgClient *client, ProtocolClient *remoteClient, const String *applicationN
 }
 
 /***********************************************************************************************************************************
-Execute a query
+Send a query without waiting for the result
 ***********************************************************************************************************************************/
-static VariantList *
-dbQuery(Db *this, const String *query)
+static void
+dbQuerySend(Db *this, const String *query)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(DB, this);
@@ -99,24 +113,93 @@ dbQuery(Db *this, const String *query)
     ASSERT(this != NULL);
     ASSERT(query != NULL);
 
-    VariantList *result = NULL;
-
     // Query remotely
     if (this->remoteClient != NULL)
     {
-        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_DB_QUERY_STR);
-        protocolCommandParamAdd(command, VARUINT(this->remoteIdx));
-        protocolCommandParamAdd(command, VARSTR(query));
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_DB_QUERY_STR);
+            protocolCommandParamAdd(command, VARUINT(this->remoteIdx));
+            protocolCommandParamAdd(command, VARSTR(query));
 
-        result = varVarLst(protocolClientExecute(this->remoteClient, command, true));
+            protocolClientWriteCommand(this->remoteClient, command);
+        }
+        MEM_CONTEXT_TEMP_END();
     }
     // Else locally
     else
-        result = pgClientQuery(this->client, query);
+        pgClientQuerySend(this->client, query);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is the result of the query ready?
+***********************************************************************************************************************************/
+static bool
+dbQueryReady(Db *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    bool result = false;
+
+    // The remote writes the result when the query completes so check if there is anything to read
+    if (this->remoteClient != NULL)
+        result = fdReadyRead(ioReadFd(protocolClientIoRead(this->remoteClient)), 0);
+    // Else locally
+    else
+        result = pgClientQueryReady(this->client);
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/***********************************************************************************************************************************
+Wait for the result of the query
+***********************************************************************************************************************************/
+static VariantList *
+dbQueryResult(Db *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    VariantList *result = NULL;
+
+    // Query remotely
+    if (this->remoteClient != NULL)
+        result = varVarLst(protocolClientReadOutput(this->remoteClient, true));
+    // Else locally
+    else
+        result = pgClientQueryResult(this->client);
 
     FUNCTION_LOG_RETURN(VARIANT_LIST, result);
 }
 
+/***********************************************************************************************************************************
+Execute a query
+***********************************************************************************************************************************/
+static VariantList *
+dbQuery(Db *this, const String *query)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+        FUNCTION_LOG_PARAM(STRING, query);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(query != NULL);
+
+    dbQuerySend(this, query);
+
+    FUNCTION_LOG_RETURN(VARIANT_LIST, dbQueryResult(this));
+}
+
 /***********************************************************************************************************************************
 Execute a command that expects no output
 ***********************************************************************************************************************************/
@@ -296,8 +379,8 @@ dbBackupStartQuery(unsigned int pgVersion, bool startFast)
     FUNCTION_TEST_RETURN(result);
 }
 
-DbBackupStartResult
-dbBackupStart(Db *this, bool startFast, bool stopAuto)
+void
+dbBackupStartBegin(Db *this, bool startFast, bool stopAuto)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(DB, this);
@@ -307,8 +390,6 @@ dbBackupStart(Db *this, bool startFast, bool stopAuto)
 
     ASSERT(this != NULL);
 
-    DbBackupStartResult result = {.lsn = NULL};
-
     MEM_CONTEXT_TEMP_BEGIN()
     {
         // Acquire the backup advisory lock to make sure that backups are not running from multiple backup servers against the same
@@ -341,8 +422,44 @@ dbBackupStart(Db *this, bool startFast, bool stopAuto)
             }
         }
 
-        // Start backup
-        VariantList *row = dbQueryRow(this, dbBackupStartQuery(dbPgVersion(this), startFast));
+        // Start backup without waiting for the checkpoint to complete
+        dbQuerySend(this, dbBackupStartQuery(dbPgVersion(this), startFast));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+bool
+dbBackupStartReady(Db *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(BOOL, dbQueryReady(this));
+}
+
+DbBackupStartResult
+dbBackupStartEnd(Db *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    DbBackupStartResult result = {.lsn = NULL};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Wait for the backup to start
+        VariantList *resultList = dbQueryResult(this);
+
+        CHECK(varLstSize(resultList) == 1);
+        VariantList *row = varVarLst(varLstGet(resultList, 0));
 
         // Return results
         MEM_CONTEXT_PRIOR_BEGIN()
@@ -356,6 +473,23 @@ dbBackupStart(Db *this, bool startFast, bool stopAuto)
 
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
+
+DbBackupStartResult
+dbBackupStart(Db *this, bool startFast, bool stopAuto)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+        FUNCTION_LOG_PARAM(BOOL, startFast);
+        FUNCTION_LOG_PARAM(BOOL, stopAuto);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    dbBackupStartBegin(this, startFast, stopAuto);
+
+    FUNCTION_LOG_RETURN_STRUCT(dbBackupStartEnd(this));
+}
+
 /**********************************************************************************************************************************/
 // Helper to build stop backup query
 static String *
@@ -477,85 +611,208 @@ dbList(Db *this)
         VARIANT_LIST, dbQuery(this, STRDEF("select oid::oid, datname::text, datlastsysoid::oid from pg_catalog.pg_database")));
 }
 
-/**********************************************************************************************************************************/
-void
-dbReplayWait(Db *this, const String *targetLsn, TimeMSec timeout)
+/***********************************************************************************************************************************
+Wait for replay on the standby to reach the target lsn
+
+Each query waits on the standby for up to the specified number of retries, sleeping between retries, and returns as soon as the
+target lsn has been replayed. This is faster and less chatty than sleeping between queries on the client since the wait ends as soon
+as the target is reached. The number of retries starts at one (no wait) so the first query returns immediately and then doubles with
+each query up to a maximum, which limits the number of queries on a lagging standby while keeping queries short enough to send
+keep-alives to the remotes in between.
+***********************************************************************************************************************************/
+#define DB_REPLAY_WAIT_SLEEP                                        100
+#define DB_REPLAY_WAIT_SLEEP_Z                                      "0.1"
+#define DB_REPLAY_WAIT_RETRY_MAX                                    50
+
+// Send the next replay query
+static void
+dbReplayWaitQuery(Db *this)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(DB, this);
-        FUNCTION_LOG_PARAM(STRING, targetLsn);
-        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(targetLsn != NULL);
-    ASSERT(timeout > 0);
+    ASSERT(this->replayWait.targetLsn != NULL);
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Loop until lsn has been reached or timeout
-        Wait *wait = waitNew(timeout);
-        bool targetReached = false;
-        const char *lsnName = strZ(pgLsnName(dbPgVersion(this)));
-        const String *replayLsnFunction = strNewFmt(
-            "pg_catalog.pg_last_%s_replay_%s()", strZ(pgWalName(dbPgVersion(this))), lsnName);
-        const String *replayLsn = NULL;
-
-        do
+        // Don't wait on the standby past the timeout
+        const TimeMSec elapsed = timeMSec() - this->replayWait.progressTime;
+        const unsigned int retryRemaining = elapsed < this->replayWait.timeout ?
+            (unsigned int)((this->replayWait.timeout - elapsed) / DB_REPLAY_WAIT_SLEEP) + 1 : 1;
+        const unsigned int retry = this->replayWait.retry < retryRemaining ? this->replayWait.retry : retryRemaining;
+        const char *const targetLsn = strZ(this->replayWait.targetLsn);
+        const char *const replayLsnFunction = strZ(this->replayWait.replayLsnFunction);
+
+        // Build the query
+        String *query = strNewFmt(
+            "select replayLsn::text,\n"
+            "       (replayLsn > '%s')::bool as targetReached",
+            targetLsn);
+
+        if (this->replayWait.replayLsn != NULL)
         {
-            // Build the query
-            String *query = strNewFmt(
-                "select replayLsn::text,\n"
-                "       (replayLsn > '%s')::bool as targetReached",
-                strZ(targetLsn));
-
-            if (replayLsn != NULL)
-            {
-                strCatFmt(
-                    query,
-                    ",\n"
-                    "       (replayLsn > '%s')::bool as replayProgress",
-                    strZ(replayLsn));
-            }
-
             strCatFmt(
                 query,
-                "\n"
-                "  from %s as replayLsn",
-                strZ(replayLsnFunction));
+                ",\n"
+                "       (replayLsn > '%s')::bool as replayProgress",
+                strZ(this->replayWait.replayLsn));
+        }
 
-            // Execute the query and get replayLsn
-            VariantList *row = dbQueryRow(this, query);
-            replayLsn = varStr(varLstGet(row, 0));
+        strCatFmt(
+            query,
+            "\n"
+            "  from (select %s as replayLsn\n"
+            "          from pg_catalog.generate_series(1, %u) as retry\n"
+            "         where retry = %u or %s is null or %s > '%s' or pg_catalog.pg_sleep(" DB_REPLAY_WAIT_SLEEP_Z ") is null\n"
+            "         limit 1) as replay",
+            replayLsnFunction, retry, retry, replayLsnFunction, replayLsnFunction, targetLsn);
+
+        dbQuerySend(this, query);
+
+        // Wait longer on the next query
+        this->replayWait.retry = this->replayWait.retry * 2 > DB_REPLAY_WAIT_RETRY_MAX ?
+            DB_REPLAY_WAIT_RETRY_MAX : this->replayWait.retry * 2;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
 
-            // Error when replayLsn is null which indicates that this is not a standby.  This should have been sorted out before we
-            // connected but it's possible that the standy was promoted in the meantime.
-            if (replayLsn == NULL)
+// Read the result of the replay query and send another query if the target has not been reached
+static void
+dbReplayWaitResult(Db *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->replayWait.targetLsn != NULL);
+    ASSERT(!this->replayWait.targetReached);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        VariantList *result = dbQueryResult(this);
+
+        CHECK(varLstSize(result) == 1);
+        VariantList *row = varVarLst(varLstGet(result, 0));
+
+        // Error when replayLsn is null which indicates that this is not a standby.  This should have been sorted out before we
+        // connected but it's possible that the standy was promoted in the meantime.
+        if (varStr(varLstGet(row, 0)) == NULL)
+        {
+            THROW_FMT(
+                ArchiveTimeoutError,
+                "unable to query replay lsn on the standby using '%s'\n"
+                "HINT: Is this a standby?",
+                strZ(this->replayWait.replayLsnFunction));
+        }
+
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            strFree(this->replayWait.replayLsn);
+            this->replayWait.replayLsn = strDup(varStr(varLstGet(row, 0)));
+        }
+        MEM_CONTEXT_END();
+
+        this->replayWait.targetReached = varBool(varLstGet(row, 1));
+
+        if (!this->replayWait.targetReached)
+        {
+            // If progress is being made then reset the timeout
+            if (varLstSize(row) > 2 && varBool(varLstGet(row, 2)))
+                this->replayWait.progressTime = timeMSec();
+
+            // Error if a timeout occurred before the target lsn was reached
+            if (timeMSec() - this->replayWait.progressTime >= this->replayWait.timeout)
             {
                 THROW_FMT(
-                    ArchiveTimeoutError,
-                    "unable to query replay lsn on the standby using '%s'\n"
-                    "HINT: Is this a standby?",
-                    strZ(replayLsnFunction));
+                    ArchiveTimeoutError, "timeout before standby replayed to %s - only reached %s",
+                    strZ(this->replayWait.targetLsn), strZ(this->replayWait.replayLsn));
             }
 
-            targetReached = varBool(varLstGet(row, 1));
-
-            // If the target has not been reached but progress is being made then reset the timer
-            if (!targetReached && varLstSize(row) > 2 && varBool(varLstGet(row, 2)))
-                wait = waitNew(timeout);
-
+            // A keep-alive is required here for the remote holding open the backup connection. No query is running on the standby
+            // at this point so it is safe to send a keep-alive to all remotes.
             protocolKeepAlive();
+
+            dbReplayWaitQuery(this);
         }
-        while (!targetReached && waitMore(wait));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+void
+dbReplayWaitBegin(Db *this, const String *targetLsn, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+        FUNCTION_LOG_PARAM(STRING, targetLsn);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
 
-        // Error if a timeout occurred before the target lsn was reached
-        if (!targetReached)
+    ASSERT(this != NULL);
+    ASSERT(targetLsn != NULL);
+    ASSERT(timeout > 0);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        strFree(this->replayWait.targetLsn);
+        strFree(this->replayWait.replayLsn);
+        strFree(this->replayWait.replayLsnFunction);
+
+        this->replayWait = (DbReplayWait)
         {
-            THROW_FMT(
-                ArchiveTimeoutError, "timeout before standby replayed to %s - only reached %s", strZ(targetLsn),
-                strZ(replayLsn));
-        }
+            .targetLsn = strDup(targetLsn),
+            .replayLsnFunction = strNewFmt(
+                "pg_catalog.pg_last_%s_replay_%s()", strZ(pgWalName(dbPgVersion(this))), strZ(pgLsnName(dbPgVersion(this)))),
+            .timeout = timeout,
+            .progressTime = timeMSec(),
+            .retry = 1,
+        };
+    }
+    MEM_CONTEXT_END();
+
+    dbReplayWaitQuery(this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+bool
+dbReplayWaitReady(Db *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->replayWait.targetLsn != NULL);
+
+    // Read the result if it is ready. If the target has not been reached another query will be sent.
+    if (!this->replayWait.targetReached && dbQueryReady(this))
+        dbReplayWaitResult(this);
+
+    FUNCTION_LOG_RETURN(BOOL, this->replayWait.targetReached);
+}
+
+void
+dbReplayWaitEnd(Db *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->replayWait.targetLsn != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Loop until lsn has been reached or timeout
+        while (!this->replayWait.targetReached)
+            dbReplayWaitResult(this);
 
         // Perform a checkpoint
         dbExec(this, STRDEF("checkpoint"));
@@ -568,11 +825,12 @@ dbReplayWait(Db *this, const String *targetLsn, TimeMSec timeout)
         if (dbPgVersion(this) >= PG_VERSION_96)
         {
             // Build the query
+            const char *lsnName = strZ(pgLsnName(dbPgVersion(this)));
             const String *query = strNewFmt(
                 "select (checkpoint_%s > '%s')::bool as targetReached,\n"
                 "       checkpoint_%s::text as checkpointLsn\n"
                 "  from pg_catalog.pg_control_checkpoint()",
-                lsnName, strZ(targetLsn), lsnName);
+                lsnName, strZ(this->replayWait.targetLsn), lsnName);
 
             // Execute query
             VariantList *row = dbQueryRow(this, query);
@@ -583,7 +841,7 @@ dbReplayWait(Db *this, const String *targetLsn, TimeMSec timeout)
                 THROW_FMT(
                     ArchiveTimeoutError,
                     "the checkpoint lsn %s is less than the target lsn %s even though the replay lsn is %s",
-                    strZ(varStr(varLstGet(row, 1))), strZ(targetLsn), strZ(replayLsn));
+                    strZ(varStr(varLstGet(row, 1))), strZ(this->replayWait.targetLsn), strZ(this->replayWait.replayLsn));
             }
         }
     }
@@ -592,6 +850,25 @@ dbReplayWait(Db *this, const String *targetLsn, TimeMSec timeout)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+void
+dbReplayWait(Db *this, const String *targetLsn, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(DB, this);
+        FUNCTION_LOG_PARAM(STRING, targetLsn);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(targetLsn != NULL);
+    ASSERT(timeout > 0);
+
+    dbReplayWaitBegin(this, targetLsn, timeout);
+    dbReplayWaitEnd(this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 VariantList *
 dbTablespaceList(Db *this)
@@ -38,6 +38,12 @@ typedef struct DbBackupStartResult
 
 DbBackupStartResult dbBackupStart(Db *this, bool startFast, bool stopAuto);
 
+// Begin starting the backup without waiting for the checkpoint. dbBackupStartReady() can be polled while doing other work and
+// dbBackupStartEnd() waits for the backup to start and returns the result. No other queries may be run in the meantime.
+void dbBackupStartBegin(Db *this, bool startFast, bool stopAuto);
+bool dbBackupStartReady(Db *this);
+DbBackupStartResult dbBackupStartEnd(Db *this);
+
 // Stop backup and return starting lsn, wal segment name, backup label, and tablspace map
 typedef struct DbBackupStopResult
 {
@@ -58,6 +64,12 @@ VariantList *dbList(Db *this);
 // Waits for replay on the standby to equal the target LSN
 void dbReplayWait(Db *this, const String *targetLsn, TimeMSec timeout);
 
+// Begin waiting for replay on the standby without blocking. dbReplayWaitReady() can be polled while doing other work and
+// dbReplayWaitEnd() waits for the target LSN to be reached and performs a checkpoint. No other queries may be run in the meantime.
+void dbReplayWaitBegin(Db *this, const String *targetLsn, TimeMSec timeout);
+bool dbReplayWaitReady(Db *this);
+void dbReplayWaitEnd(Db *this);
+
 // Epoch time on the PostgreSQL host in ms
 TimeMSec dbTimeMSec(Db *this);
 
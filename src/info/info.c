@@ -41,6 +41,7 @@ struct Info
 {
     MemContext *memContext;                                         // Mem context
     const String *backrestVersion;                                  // pgBackRest version
+    unsigned int format;                                            // Repository format
     const String *cipherPass;                                       // Cipher passphrase if set
 };
 
@@ -122,6 +123,7 @@ infoNewInternal(void)
     *this = (Info)
     {
         .memContext = memContextCurrent(),
+        .format = REPOSITORY_FORMAT,
     };
 
     FUNCTION_TEST_RETURN(this);
@@ -158,6 +160,7 @@ typedef struct InfoLoadData
     MemContext *memContext;                                         // Mem context to use for storing data in this structure
     InfoLoadNewCallback *callbackFunction;                          // Callback function for child object
     void *callbackData;                                             // Callback data for child object
+    bool formatReferenceName;                                       // Accept REPOSITORY_FORMAT_REFERENCE_NAME?
     Info *info;                                                     // Info object
     String *sectionLast;                                            // The last section seen during load
     IoFilter *checksumActual;                                       // Checksum calculated from the file
@@ -209,11 +212,23 @@ infoLoadCallback(void *data, const String *section, const String *key, const Str
     {
         ASSERT(valueVar != NULL);
 
-        // Validate format
+        // Validate and store format
         if (strEq(key, INFO_KEY_FORMAT_STR))
         {
-            if (varUInt64(valueVar) != REPOSITORY_FORMAT)
+            // Only manifests may use the format for files that reference a file with a different name
+            if (loadData->formatReferenceName)
+            {
+                if (varUInt64(valueVar) != REPOSITORY_FORMAT && varUInt64(valueVar) != REPOSITORY_FORMAT_REFERENCE_NAME)
+                {
+                    THROW_FMT(
+                        FormatError, "expected format %d or %d but found %" PRIu64, REPOSITORY_FORMAT,
+                        REPOSITORY_FORMAT_REFERENCE_NAME, varUInt64(valueVar));
+                }
+            }
+            else if (varUInt64(valueVar) != REPOSITORY_FORMAT)
                 THROW_FMT(FormatError, "expected format %d but found %" PRIu64, REPOSITORY_FORMAT, varUInt64(valueVar));
+
+            loadData->info->format = (unsigned int)varUInt64(valueVar);
         }
         // Store pgBackRest version
         else if (strEq(key, INFO_KEY_VERSION_STR))
@@ -258,12 +273,13 @@ infoLoadCallback(void *data, const String *section, const String *key, const Str
 
 /**********************************************************************************************************************************/
 Info *
-infoNewLoad(IoRead *read, InfoLoadNewCallback *callbackFunction, void *callbackData)
+infoNewLoad(IoRead *read, InfoLoadNewCallback *callbackFunction, void *callbackData, InfoNewLoadParam param)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(IO_READ, read);
         FUNCTION_LOG_PARAM(FUNCTIONP, callbackFunction);
         FUNCTION_LOG_PARAM_P(VOID, callbackData);
+        FUNCTION_LOG_PARAM(BOOL, param.formatReferenceName);
     FUNCTION_LOG_END();
 
     ASSERT(read != NULL);
@@ -284,6 +300,7 @@ infoNewLoad(IoRead *read, InfoLoadNewCallback *callbackFunction, void *callbackD
                 .memContext = MEM_CONTEXT_TEMP(),
                 .callbackFunction = callbackFunction,
                 .callbackData = callbackData,
+                .formatReferenceName = param.formatReferenceName,
                 .info = this,
                 .checksumActual = cryptoHashNew(HASH_TYPE_SHA1_STR),
             };
@@ -421,7 +438,7 @@ infoSave(Info *this, IoWrite *write, InfoSaveCallback *callbackFunction, void *c
 
         // Add version and format
         callbackFunction(callbackData, INFO_SECTION_BACKREST_STR, &data);
-        infoSaveValue(&data, INFO_SECTION_BACKREST_STR, INFO_KEY_FORMAT_STR, jsonFromUInt(REPOSITORY_FORMAT));
+        infoSaveValue(&data, INFO_SECTION_BACKREST_STR, INFO_KEY_FORMAT_STR, jsonFromUInt(this->format));
         infoSaveValue(&data, INFO_SECTION_BACKREST_STR, INFO_KEY_VERSION_STR, jsonFromStr(STRDEF(PROJECT_VERSION)));
 
         // Add cipher passphrase if defined
@@ -494,6 +511,34 @@ infoBackrestVersion(const Info *this)
     FUNCTION_TEST_RETURN(this->backrestVersion);
 }
 
+unsigned int
+infoFormat(const Info *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INFO, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->format);
+}
+
+void
+infoFormatSet(Info *this, unsigned int format)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INFO, this);
+        FUNCTION_TEST_PARAM(UINT, format);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(format == REPOSITORY_FORMAT || format == REPOSITORY_FORMAT_REFERENCE_NAME);
+
+    this->format = format;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 infoLoad(const String *error, InfoLoadCallback *callbackFunction, void *callbackData)
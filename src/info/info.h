@@ -43,7 +43,16 @@ Constructors
 Info *infoNew(const String *cipherPassSub);
 
 // Create new object and load contents from a file
-Info *infoNewLoad(IoRead *read, InfoLoadNewCallback *callbackFunction, void *callbackData);
+typedef struct InfoNewLoadParam
+{
+    VAR_PARAM_HEADER;
+    bool formatReferenceName;                                       // Also accept REPOSITORY_FORMAT_REFERENCE_NAME (manifests only)
+} InfoNewLoadParam;
+
+#define infoNewLoadP(read, callbackFunction, callbackData, ...)                                                                    \
+    infoNewLoad(read, callbackFunction, callbackData, (InfoNewLoadParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+Info *infoNewLoad(IoRead *read, InfoLoadNewCallback *callbackFunction, void *callbackData, InfoNewLoadParam param);
 
 /***********************************************************************************************************************************
 Functions
@@ -64,6 +73,10 @@ const String *infoCipherPass(const Info *this);
 void infoCipherPassSet(Info *this, const String *cipherPass);
 const String *infoBackrestVersion(const Info *this);
 
+// Repository format. Manifests use REPOSITORY_FORMAT_REFERENCE_NAME when a file references a file with a different name.
+unsigned int infoFormat(const Info *this);
+void infoFormatSet(Info *this, unsigned int format);
+
 /***********************************************************************************************************************************
 Helper functions
 ***********************************************************************************************************************************/
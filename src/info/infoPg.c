@@ -182,7 +182,7 @@ infoPgNewLoad(IoRead *read, InfoPgType type, InfoLoadNewCallback *callbackFuncti
             .infoPg = this,
         };
 
-        this->info = infoNewLoad(read, infoPgLoadCallback, &loadData);
+        this->info = infoNewLoadP(read, infoPgLoadCallback, &loadData);
 
         // History must include at least one item or the file is corrupt
         CHECK(lstSize(this->history) > 0);
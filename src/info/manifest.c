@@ -103,6 +103,8 @@ STRING_STATIC(MANIFEST_SECTION_TARGET_PATH_DEFAULT_STR,             "target:path
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_PATH_VAR,                    MANIFEST_KEY_PATH);
 #define MANIFEST_KEY_REFERENCE                                      "reference"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_REFERENCE_VAR,               MANIFEST_KEY_REFERENCE);
+#define MANIFEST_KEY_REFERENCE_NAME                                 "reference-name"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_REFERENCE_NAME_VAR,          MANIFEST_KEY_REFERENCE_NAME);
 #define MANIFEST_KEY_SIZE                                           "size"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_SIZE_VAR,                    MANIFEST_KEY_SIZE);
 #define MANIFEST_KEY_SIZE_REPO                                      "repo-size"
@@ -239,6 +241,7 @@ manifestFileAdd(Manifest *this, const ManifestFile *file)
             .mode = file->mode,
             .name = strDup(file->name),
             .primary = file->primary,
+            .referenceName = strDup(file->referenceName),
             .size = file->size,
             .sizeRepo = file->sizeRepo,
             .timestamp = file->timestamp,
@@ -381,9 +384,9 @@ manifestNewInternal(void)
     {
         .memContext = memContextCurrent(),
         .dbList = lstNewP(sizeof(ManifestDb), .comparator = lstComparatorStr),
-        .fileList = lstNewP(sizeof(ManifestFile), .comparator =  lstComparatorStr),
-        .linkList = lstNewP(sizeof(ManifestLink), .comparator =  lstComparatorStr),
-        .pathList = lstNewP(sizeof(ManifestPath), .comparator =  lstComparatorStr),
+        .fileList = lstNewP(sizeof(ManifestFile), .comparator =  lstComparatorStr, .hash = lstHashStr),
+        .linkList = lstNewP(sizeof(ManifestLink), .comparator =  lstComparatorStr, .hash = lstHashStr),
+        .pathList = lstNewP(sizeof(ManifestPath), .comparator =  lstComparatorStr, .hash = lstHashStr),
         .ownerList = strLstNew(),
         .referenceList = strLstNew(),
         .targetList = lstNewP(sizeof(ManifestTarget), .comparator =  lstComparatorStr),
@@ -1223,7 +1226,8 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
                 manifestFileUpdate(
                     this, file->name, file->size, filePrior->sizeRepo, filePrior->checksumSha1,
                     VARSTR(filePrior->reference != NULL ? filePrior->reference : manifestPrior->data.backupLabel),
-                    filePrior->checksumPage, filePrior->checksumPageError, filePrior->checksumPageErrorList);
+                    filePrior->referenceName, filePrior->checksumPage, filePrior->checksumPageError,
+                    filePrior->checksumPageErrorList);
             }
         }
     }
@@ -1232,6 +1236,177 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+// Max prior files with distinct checksums that a file is checked against. All the checksums are sent with the backup job so this
+// limits the job size for common sizes, e.g. small relations.
+#define MANIFEST_DEDUP_PRIOR_MAX                                    256
+
+// Prior files indexed by a key
+typedef struct ManifestBuildDedupIndex
+{
+    const String *key;                                              // Key (must be first member)
+    List *filePriorList;                                            // Prior files
+    List *priorList;                                                // Prior files with distinct checksums for the result
+} ManifestBuildDedupIndex;
+
+// Add a prior file to an index
+static void
+manifestBuildDedupIndexAdd(List *indexList, const String *key, const ManifestFile *filePrior)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, indexList);
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM_P(VOID, filePrior);
+    FUNCTION_TEST_END();
+
+    ManifestBuildDedupIndex *index = lstFind(indexList, &key);
+
+    if (index == NULL)
+    {
+        MEM_CONTEXT_BEGIN(lstMemContext(indexList))
+        {
+            index = lstAdd(
+                indexList, &(ManifestBuildDedupIndex){.key = key, .filePriorList = lstNewP(sizeof(const ManifestFile *))});
+        }
+        MEM_CONTEXT_END();
+    }
+
+    lstAdd(index->filePriorList, &filePrior);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Add prior files from an index entry to a list of prior files with distinct checksums
+static void
+manifestBuildDedupPriorAdd(List *priorList, const ManifestBuildDedupIndex *index, const Manifest *manifestPrior)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, priorList);
+        FUNCTION_TEST_PARAM_P(VOID, index);
+        FUNCTION_TEST_PARAM(MANIFEST, manifestPrior);
+    FUNCTION_TEST_END();
+
+    for (unsigned int filePriorIdx = 0;
+         index != NULL && filePriorIdx < lstSize(index->filePriorList) && lstSize(priorList) < MANIFEST_DEDUP_PRIOR_MAX;
+         filePriorIdx++)
+    {
+        const ManifestFile *filePrior = *(const ManifestFile **)lstGet(index->filePriorList, filePriorIdx);
+
+        if (lstExists(priorList, filePrior->checksumSha1))
+            continue;
+
+        MEM_CONTEXT_BEGIN(lstMemContext(priorList))
+        {
+            ManifestFileDedupPrior prior =
+            {
+                .checksumPage = filePrior->checksumPage,
+                .checksumPageError = filePrior->checksumPageError,
+                .checksumPageErrorList = varLstDup(filePrior->checksumPageErrorList),
+                .reference = strDup(filePrior->reference != NULL ? filePrior->reference : manifestPrior->data.backupLabel),
+                .referenceName = strDup(filePrior->referenceName != NULL ? filePrior->referenceName : filePrior->name),
+                .sizeRepo = filePrior->sizeRepo,
+            };
+
+            memcpy(prior.checksumSha1, filePrior->checksumSha1, HASH_TYPE_SHA1_SIZE_HEX + 1);
+
+            lstAdd(priorList, &prior);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+List *
+manifestBuildDedup(const Manifest *this, const Manifest *manifestPrior)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, this);
+        FUNCTION_LOG_PARAM(MANIFEST, manifestPrior);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(manifestPrior != NULL);
+
+    List *result = lstNewP(sizeof(ManifestFileDedup), .comparator = lstComparatorStr, .hash = lstHashStr);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Index prior files by size and base name, e.g. a relation copied to a new database, and index prior files that are not
+        // in the current manifest by size, e.g. a relation rewritten with a new relfilenode by VACUUM FULL, CLUSTER, or pg_repack.
+        // Prior files that still exist are not indexed by size alone since they would rarely match and a file that does not match
+        // is read a second time to copy it. Zero-length files and files without a checksum (which should not happen in a complete
+        // backup) are skipped since there is nothing to gain by referencing them.
+        List *indexNameList = lstNewP(sizeof(ManifestBuildDedupIndex), .comparator = lstComparatorStr, .hash = lstHashStr);
+        List *indexSizeList = lstNewP(sizeof(ManifestBuildDedupIndex), .comparator = lstComparatorStr, .hash = lstHashStr);
+
+        for (unsigned int filePriorIdx = 0; filePriorIdx < manifestFileTotal(manifestPrior); filePriorIdx++)
+        {
+            const ManifestFile *filePrior = manifestFile(manifestPrior, filePriorIdx);
+
+            if (filePrior->size == 0 || filePrior->checksumSha1[0] == '\0')
+                continue;
+
+            manifestBuildDedupIndexAdd(
+                indexNameList, strNewFmt("%" PRIu64 "/%s", filePrior->size, strZ(strBase(filePrior->name))), filePrior);
+
+            if (manifestFileFindDefault(this, filePrior->name, NULL) == NULL)
+                manifestBuildDedupIndexAdd(indexSizeList, strNewFmt("%" PRIu64, filePrior->size), filePrior);
+        }
+
+        // Find prior files for each file that does not exist in the prior manifest
+        for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(this); fileIdx++)
+        {
+            const ManifestFile *file = manifestFile(this, fileIdx);
+
+            if (file->reference != NULL || file->size == 0 || manifestFileFindDefault(manifestPrior, file->name, NULL) != NULL)
+                continue;
+
+            const String *keyName = strNewFmt("%" PRIu64 "/%s", file->size, strZ(strBase(file->name)));
+            const ManifestBuildDedupIndex *indexName = lstFind(indexNameList, &keyName);
+            const String *keySize = strNewFmt("%" PRIu64, file->size);
+            ManifestBuildDedupIndex *indexSize = lstFind(indexSizeList, &keySize);
+
+            if (indexName == NULL && indexSize == NULL)
+                continue;
+
+            MEM_CONTEXT_BEGIN(lstMemContext(result))
+            {
+                // Prior files with the same base name are checked first. Files with only the same size share a list since there may
+                // be many of them.
+                const List *priorList = NULL;
+
+                if (indexName != NULL)
+                {
+                    List *priorNameList = lstNewP(sizeof(ManifestFileDedupPrior), .comparator = lstComparatorZ);
+
+                    manifestBuildDedupPriorAdd(priorNameList, indexName, manifestPrior);
+                    manifestBuildDedupPriorAdd(priorNameList, indexSize, manifestPrior);
+
+                    priorList = priorNameList;
+                }
+                else
+                {
+                    if (indexSize->priorList == NULL)
+                    {
+                        indexSize->priorList = lstNewP(sizeof(ManifestFileDedupPrior), .comparator = lstComparatorZ);
+
+                        manifestBuildDedupPriorAdd(indexSize->priorList, indexSize, manifestPrior);
+                    }
+
+                    priorList = indexSize->priorList;
+                }
+
+                lstAdd(result, &(ManifestFileDedup){.name = strDup(file->name), .priorList = priorList});
+            }
+            MEM_CONTEXT_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
 /**********************************************************************************************************************************/
 void
 manifestBuildComplete(
@@ -1414,6 +1589,7 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
             {
                 .name = key,
                 .reference = varStr(kvGetDefault(fileKv, MANIFEST_KEY_REFERENCE_VAR, NULL)),
+                .referenceName = varStr(kvGetDefault(fileKv, MANIFEST_KEY_REFERENCE_NAME_VAR, NULL)),
             };
 
             // Timestamp is required so error if it is not present
@@ -1763,7 +1939,7 @@ manifestNewLoad(IoRead *read)
         }
         MEM_CONTEXT_END();
 
-        this->info = infoNewLoad(read, manifestLoadCallback, &loadData);
+        this->info = infoNewLoadP(read, manifestLoadCallback, &loadData, .formatReferenceName = true);
         this->data.backrestVersion = infoBackrestVersion(this->info);
 
         // Process file defaults
@@ -2124,6 +2300,9 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                 if (file->reference != NULL)
                     kvPut(fileKv, MANIFEST_KEY_REFERENCE_VAR, VARSTR(file->reference));
 
+                if (file->referenceName != NULL)
+                    kvPut(fileKv, MANIFEST_KEY_REFERENCE_NAME_VAR, VARSTR(file->referenceName));
+
                 if (file->sizeRepo != file->size)
                     kvPut(fileKv, MANIFEST_KEY_SIZE_REPO_VAR, varNewUInt64(file->sizeRepo));
 
@@ -2269,6 +2448,7 @@ manifestSave(Manifest *this, IoWrite *write)
         MostCommonValue *fileModeMcv = mcvNew();
         MostCommonValue *filePrimaryMcv = mcvNew();
         MostCommonValue *fileUserMcv = mcvNew();
+        bool referenceName = false;
 
         ASSERT(manifestFileTotal(this) > 0);
 
@@ -2280,8 +2460,15 @@ manifestSave(Manifest *this, IoWrite *write)
             mcvUpdate(fileModeMcv, VARUINT(file->mode));
             mcvUpdate(filePrimaryMcv, VARBOOL(file->primary));
             mcvUpdate(fileUserMcv, VARSTR(file->user));
+
+            if (file->referenceName != NULL)
+                referenceName = true;
         }
 
+        // Files that reference a file with a different name require a format that older versions will not load. Otherwise they
+        // would look for the file under its own name in the prior backup, where it was never written.
+        infoFormatSet(this->info, referenceName ? REPOSITORY_FORMAT_REFERENCE_NAME : REPOSITORY_FORMAT);
+
         saveData.fileGroupDefault = manifestOwnerVar(varStr(mcvResult(fileGroupMcv)));
         saveData.fileModeDefault = (mode_t)varUInt(mcvResult(fileModeMcv));
         saveData.filePrimaryDefault = varBool(mcvResult(filePrimaryMcv));
@@ -2588,7 +2775,7 @@ manifestFileTotal(const Manifest *this)
 void
 manifestFileUpdate(
     Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
-    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList)
+    const String *referenceName, bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(MANIFEST, this);
@@ -2597,6 +2784,7 @@ manifestFileUpdate(
         FUNCTION_TEST_PARAM(UINT64, sizeRepo);
         FUNCTION_TEST_PARAM(STRINGZ, checksumSha1);
         FUNCTION_TEST_PARAM(VARIANT, reference);
+        FUNCTION_TEST_PARAM(STRING, referenceName);
         FUNCTION_TEST_PARAM(BOOL, checksumPage);
         FUNCTION_TEST_PARAM(BOOL, checksumPageError);
         FUNCTION_TEST_PARAM(VARIANT_LIST, checksumPageErrorList);
@@ -2604,6 +2792,7 @@ manifestFileUpdate(
 
     ASSERT(this != NULL);
     ASSERT(name != NULL);
+    ASSERT(referenceName == NULL || (reference != NULL && varStr(reference) != NULL));
     ASSERT(
         (!checksumPage && !checksumPageError && checksumPageErrorList == NULL) ||
         (checksumPage && !checksumPageError && checksumPageErrorList == NULL) || (checksumPage && checksumPageError));
@@ -2619,6 +2808,8 @@ manifestFileUpdate(
                 file->reference = NULL;
             else
                 file->reference = strLstAddIfMissing(this->referenceList, varStr(reference));
+
+            file->referenceName = strDup(referenceName);
         }
 
         // Update checksum if set
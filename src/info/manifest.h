@@ -102,11 +102,32 @@ typedef struct ManifestFile
     const String *user;                                             // User name
     const String *group;                                            // Group name
     const String *reference;                                        // Reference to a prior backup
+    const String *referenceName;                                    // Name in the prior backup when different from name
     uint64_t size;                                                  // Original size
     uint64_t sizeRepo;                                              // Size in repo
     time_t timestamp;                                               // Original timestamp
 } ManifestFile;
 
+/***********************************************************************************************************************************
+File that may have the same content as a file with a different name in a prior backup
+***********************************************************************************************************************************/
+typedef struct ManifestFileDedupPrior
+{
+    char checksumSha1[HASH_TYPE_SHA1_SIZE_HEX + 1];                 // SHA1 checksum (must be first member in struct)
+    bool checksumPage:1;                                            // Does the prior file have page checksums?
+    bool checksumPageError:1;                                       // Is there an error in the prior file page checksum?
+    const VariantList *checksumPageErrorList;                       // List of page checksum errors in the prior file
+    const String *reference;                                        // Backup where the prior file is stored
+    const String *referenceName;                                    // Name of the prior file in the referenced backup
+    uint64_t sizeRepo;                                              // Size of the prior file in repo
+} ManifestFileDedupPrior;
+
+typedef struct ManifestFileDedup
+{
+    const String *name;                                             // File name (must be first member in struct)
+    const List *priorList;                                          // Prior files with the same size and distinct checksums
+} ManifestFileDedup;
+
 /***********************************************************************************************************************************
 Link type
 ***********************************************************************************************************************************/
@@ -168,6 +189,11 @@ void manifestBuildValidate(Manifest *this, bool delta, time_t copyStart, Compres
 // Create a diff/incr backup by comparing to a previous backup manifest
 void manifestBuildIncr(Manifest *this, const Manifest *prior, BackupType type, const String *archiveStart);
 
+// Find files that were not referenced by manifestBuildIncr() but have the same size as files in the prior manifest, e.g. a relation
+// copied to a new database or rewritten with a new relfilenode. The content must be checked against the prior checksums before a
+// prior file is referenced. Returns a list of ManifestFileDedup.
+List *manifestBuildDedup(const Manifest *this, const Manifest *prior);
+
 // Set remaining values before the final save
 void manifestBuildComplete(
     Manifest *this, time_t timestampStart, const String *lsnStart, const String *archiveStart, time_t timestampStop,
@@ -208,10 +234,10 @@ const ManifestFile *manifestFileFindDefault(const Manifest *this, const String *
 void manifestFileRemove(const Manifest *this, const String *name);
 unsigned int manifestFileTotal(const Manifest *this);
 
-// Update a file with new data
+// Update a file with new data. The reference name is only updated when the reference is updated.
 void manifestFileUpdate(
     Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
-    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList);
+    const String *referenceName, bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList);
 
 /***********************************************************************************************************************************
 Link functions and getters/setters
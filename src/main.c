@@ -9,6 +9,7 @@ Main
 
 #include "command/archive/get/get.h"
 #include "command/archive/push/push.h"
+#include "command/archive/server.h"
 #include "command/backup/backup.h"
 #include "command/check/check.h"
 #include "command/command.h"
@@ -24,7 +25,9 @@ Main
 #include "command/repo/ls.h"
 #include "command/repo/put.h"
 #include "command/repo/rm.h"
+#include "command/restore/relation.h"
 #include "command/restore/restore.h"
+#include "command/server/server.h"
 #include "command/stanza/create.h"
 #include "command/stanza/delete.h"
 #include "command/stanza/upgrade.h"
@@ -97,7 +100,12 @@ main(int argListSize, const char *argList[])
                 case cfgCmdArchiveGet:
                 {
                     if (commandRole == cfgCmdRoleAsync)
-                        cmdArchiveGetAsync();
+                    {
+                        if (cfgOptionBool(cfgOptArchiveServer))
+                            cmdArchiveServer(archiveModeGet, UINT64_MAX);
+                        else
+                            cmdArchiveGetAsync();
+                    }
                     else
                         result = cmdArchiveGet();
 
@@ -109,7 +117,12 @@ main(int argListSize, const char *argList[])
                 case cfgCmdArchivePush:
                 {
                     if (commandRole == cfgCmdRoleAsync)
-                        cmdArchivePushAsync();
+                    {
+                        if (cfgOptionBool(cfgOptArchiveServer))
+                            cmdArchiveServer(archiveModePush, UINT64_MAX);
+                        else
+                            cmdArchivePushAsync();
+                    }
                     else
                         cmdArchivePush();
 
@@ -170,6 +183,14 @@ main(int argListSize, const char *argList[])
                     break;
                 }
 
+                // Relation restore command
+                // -----------------------------------------------------------------------------------------------------------------
+                case cfgCmdRelationRestore:
+                {
+                    cmdRelationRestore();
+                    break;
+                }
+
                 // Repository create command
                 // -----------------------------------------------------------------------------------------------------------------
                 case cfgCmdRepoCreate:
@@ -218,6 +239,14 @@ main(int argListSize, const char *argList[])
                     break;
                 }
 
+                // Server command
+                // -----------------------------------------------------------------------------------------------------------------
+                case cfgCmdServer:
+                {
+                    cmdServer(UINT64_MAX);
+                    break;
+                }
+
                 // Stanza create command
                 // -----------------------------------------------------------------------------------------------------------------
                 case cfgCmdStanzaCreate:
@@ -26,6 +26,8 @@ struct PgClient
     TimeMSec queryTimeout;
 
     PGconn *connection;
+    String *query;                                                  // Query sent when the result has not been read yet
+    TimeMSec queryBegin;                                            // Time when the query was sent
 };
 
 OBJECT_DEFINE_MOVE(PG_CLIENT);
@@ -164,8 +166,8 @@ pgClientOpen(PgClient *this)
 }
 
 /**********************************************************************************************************************************/
-VariantList *
-pgClientQuery(PgClient *this, const String *query)
+void
+pgClientQuerySend(PgClient *this, const String *query)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(PG_CLIENT, this);
@@ -174,22 +176,65 @@ pgClientQuery(PgClient *this, const String *query)
 
     ASSERT(this != NULL);
     CHECK(this->connection != NULL);
+    CHECK(this->query == NULL);
     ASSERT(query != NULL);
 
+    // Send the query without waiting for results so we can timeout if needed
+    if (!PQsendQuery(this->connection, strZ(query)))
+    {
+        THROW_FMT(
+            DbQueryError, "unable to send query '%s': %s", strZ(query), strZ(strTrim(strNew(PQerrorMessage(this->connection)))));
+    }
+
+    // Store the query until the result is read
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->query = strDup(query);
+        this->queryBegin = timeMSec();
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+bool
+pgClientQueryReady(PgClient *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PG_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    CHECK(this->query != NULL);
+
+    PQconsumeInput(this->connection);
+
+    FUNCTION_LOG_RETURN(BOOL, !PQisBusy(this->connection));
+}
+
+/**********************************************************************************************************************************/
+VariantList *
+pgClientQueryResult(PgClient *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PG_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    CHECK(this->query != NULL);
+
     VariantList *result = NULL;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Send the query without waiting for results so we can timeout if needed
-        if (!PQsendQuery(this->connection, strZ(query)))
-        {
-            THROW_FMT(
-                DbQueryError, "unable to send query '%s': %s", strZ(query),
-                strZ(strTrim(strNew(PQerrorMessage(this->connection)))));
-        }
+        // The query is freed once the result has been read
+        String *const query = this->query;
+        this->query = NULL;
 
-        // Wait for a result
-        Wait *wait = waitNew(this->queryTimeout);
+        // Wait for a result for the remainder of the timeout, which started when the query was sent
+        const TimeMSec queryElapsed = timeMSec() - this->queryBegin;
+        Wait *wait = waitNew(queryElapsed < this->queryTimeout ? this->queryTimeout - queryElapsed : 0);
         bool busy = false;
 
         do
@@ -325,6 +370,9 @@ pgClientQuery(PgClient *this, const String *query)
             // Free the result
             PQclear(pgResult);
 
+            // Free the query
+            strFree(query);
+
             // Need to get a NULL result to complete the request
             CHECK(PQgetResult(this->connection) == NULL);
         }
@@ -337,6 +385,23 @@ pgClientQuery(PgClient *this, const String *query)
     FUNCTION_LOG_RETURN(VARIANT_LIST, result);
 }
 
+/**********************************************************************************************************************************/
+VariantList *
+pgClientQuery(PgClient *this, const String *query)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PG_CLIENT, this);
+        FUNCTION_LOG_PARAM(STRING, query);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(query != NULL);
+
+    pgClientQuerySend(this, query);
+
+    FUNCTION_LOG_RETURN(VARIANT_LIST, pgClientQueryResult(this));
+}
+
 /**********************************************************************************************************************************/
 void
 pgClientClose(PgClient *this)
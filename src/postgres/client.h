@@ -38,6 +38,16 @@ PgClient *pgClientMove(PgClient *this, MemContext *parentNew);
 // Execute a query and return results
 VariantList *pgClientQuery(PgClient *this, const String *query);
 
+// Send a query without waiting for the result so other work can be done while the query runs. pgClientQueryResult() must be called
+// before another query is sent.
+void pgClientQuerySend(PgClient *this, const String *query);
+
+// Is the result of the query sent with pgClientQuerySend() ready? If so, pgClientQueryResult() will not wait.
+bool pgClientQueryReady(PgClient *this);
+
+// Wait for and return results of the query sent with pgClientQuerySend(). The query timeout starts when the query is sent.
+VariantList *pgClientQueryResult(PgClient *this);
+
 // Close connection to PostgreSQL
 void pgClientClose(PgClient *this);
 
@@ -6,6 +6,7 @@ Protocol Client
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/time.h"
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
@@ -21,6 +22,7 @@ STRING_EXTERN(PROTOCOL_GREETING_SERVICE_STR,                        PROTOCOL_GRE
 STRING_EXTERN(PROTOCOL_GREETING_VERSION_STR,                        PROTOCOL_GREETING_VERSION);
 
 STRING_EXTERN(PROTOCOL_COMMAND_NOOP_STR,                            PROTOCOL_COMMAND_NOOP);
+STRING_EXTERN(PROTOCOL_COMMAND_STAT_STR,                            PROTOCOL_COMMAND_STAT);
 STRING_EXTERN(PROTOCOL_COMMAND_EXIT_STR,                            PROTOCOL_COMMAND_EXIT);
 
 STRING_EXTERN(PROTOCOL_ERROR_STR,                                   PROTOCOL_ERROR);
@@ -35,10 +37,13 @@ struct ProtocolClient
 {
     MemContext *memContext;
     const String *name;
+    const String *service;                                          // Service name used for profiling stats
     const String *errorPrefix;
     IoRead *read;
     IoWrite *write;
     TimeMSec keepAliveTime;
+    TimeUSec commandTimeBegin;                                      // When the last command was sent (zero when not profiling)
+    bool commandPending;                                            // Has a command been sent without reading the output?
 };
 
 OBJECT_DEFINE_MOVE(PROTOCOL_CLIENT);
@@ -83,6 +88,7 @@ protocolClientNew(const String *name, const String *service, IoRead *read, IoWri
         {
             .memContext = memContextCurrent(),
             .name = strDup(name),
+            .service = strDup(service),
             .errorPrefix = strNewFmt("raised from %s", strZ(name)),
             .read = read,
             .write = write,
@@ -200,6 +206,16 @@ protocolClientReadOutput(ProtocolClient *this, bool outputRequired)
         String *response = ioReadLine(this->read);
         KeyValue *responseKv = varKv(jsonToVar(response));
 
+        // The command is complete once the response has been read, even if it is an error
+        this->commandPending = false;
+
+        // Profile bytes read and the round trip time of the command
+        if (statProfile())
+            statAdd(strNewFmt("protocol.%s.read.bytes", strZ(this->service)), strSize(response) + 1);
+
+        statProfileEnd(this->commandTimeBegin, "protocol.%s.usec", strZ(this->service));
+        this->commandTimeBegin = 0;
+
         // Process error if any
         protocolClientProcessError(this, responseKv);
 
@@ -235,9 +251,23 @@ protocolClientWriteCommand(ProtocolClient *this, const ProtocolCommand *command)
     ASSERT(this != NULL);
     ASSERT(command != NULL);
 
-    // Write out the command
-    ioWriteStrLine(this->write, protocolCommandJson(command));
-    ioWriteFlush(this->write);
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Write out the command
+        const String *commandJson = protocolCommandJson(command);
+
+        ioWriteStrLine(this->write, commandJson);
+        ioWriteFlush(this->write);
+
+        // Profile bytes written and start timing the round trip
+        if (statProfile())
+            statAdd(strNewFmt("protocol.%s.write.bytes", strZ(this->service)), strSize(commandJson) + 1);
+
+        this->commandTimeBegin = statProfileBegin();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    this->commandPending = true;
 
     // Reset the keep alive time
     this->keepAliveTime = timeMSec();
@@ -282,6 +312,25 @@ protocolClientNoOp(ProtocolClient *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+protocolClientStatMerge(ProtocolClient *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        statMerge(varKv(protocolClientExecute(this, protocolCommandNew(PROTOCOL_COMMAND_STAT_STR), true)));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 String *
 protocolClientReadLine(ProtocolClient *this)
@@ -326,6 +375,19 @@ protocolClientReadLine(ProtocolClient *this)
     FUNCTION_LOG_RETURN(STRING, result);
 }
 
+/**********************************************************************************************************************************/
+bool
+protocolClientCommandPending(const ProtocolClient *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_CLIENT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->commandPending);
+}
+
 /**********************************************************************************************************************************/
 IoRead *
 protocolClientIoRead(const ProtocolClient *this)
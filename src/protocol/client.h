@@ -30,6 +30,8 @@ Constants
     STRING_DECLARE(PROTOCOL_COMMAND_EXIT_STR);
 #define PROTOCOL_COMMAND_NOOP                                       "noop"
     STRING_DECLARE(PROTOCOL_COMMAND_NOOP_STR);
+#define PROTOCOL_COMMAND_STAT                                       "stat"
+    STRING_DECLARE(PROTOCOL_COMMAND_STAT_STR);
 
 #define PROTOCOL_ERROR                                              "err"
     STRING_DECLARE(PROTOCOL_ERROR_STR);
@@ -54,6 +56,10 @@ ProtocolClient *protocolClientMove(ProtocolClient *this, MemContext *parentNew);
 // Send noop to test connection or keep it alive
 void protocolClientNoOp(ProtocolClient *this);
 
+// Merge stats from the server process into this process. This should be called immediately before the client is freed since the
+// server also frees its own clients to merge their stats.
+void protocolClientStatMerge(ProtocolClient *this);
+
 // Read a line
 String *protocolClientReadLine(ProtocolClient *this);
 
@@ -66,6 +72,9 @@ void protocolClientWriteCommand(ProtocolClient *this, const ProtocolCommand *com
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
+// Has a command been sent without reading the output? The server is busy with the command so no other command can be sent.
+bool protocolClientCommandPending(const ProtocolClient *this);
+
 // Read interface
 IoRead *protocolClientIoRead(const ProtocolClient *this);
 
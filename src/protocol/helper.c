@@ -8,7 +8,13 @@ Protocol Helper
 #include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/exec.h"
+#include "common/io/io.h"
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
 #include "common/memContext.h"
+#include "common/stat.h"
+#include "common/type/convert.h"
+#include "common/type/json.h"
 #include "config/config.intern.h"
 #include "config/exec.h"
 #include "config/parse.h"
@@ -26,12 +32,19 @@ STRING_EXTERN(PROTOCOL_SERVICE_REMOTE_STR,                          PROTOCOL_SER
 STRING_STATIC(PROTOCOL_REMOTE_TYPE_PG_STR,                          PROTOCOL_REMOTE_TYPE_PG);
 STRING_STATIC(PROTOCOL_REMOTE_TYPE_REPO_STR,                        PROTOCOL_REMOTE_TYPE_REPO);
 
+// Seconds that a shared ssh connection stays open after the last session using it has closed
+#define PROTOCOL_SSH_CONTROL_PERSIST                                60
+
+// Remote host types
+STRING_STATIC(PROTOCOL_REMOTE_HOST_TYPE_TLS_STR,                    "tls");
+
 /***********************************************************************************************************************************
 Local variables
 ***********************************************************************************************************************************/
 typedef struct ProtocolHelperClient
 {
     Exec *exec;                                                     // Executed client
+    IoSession *session;                                             // TLS session when the remote is a server
     ProtocolClient *client;                                         // Protocol client
 } ProtocolHelperClient;
 
@@ -219,6 +232,7 @@ protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int hostIdx,
                 strNewFmt(PROTOCOL_SERVICE_LOCAL "-%u protocol", processId),
                 PROTOCOL_SERVICE_LOCAL_STR, execIoRead(protocolHelperClient->exec), execIoWrite(protocolHelperClient->exec));
 
+            // Move the protocol client to the exec mem context so it is freed with the process
             protocolClientMove(protocolHelperClient->client, execMemContext(protocolHelperClient->exec));
         }
         MEM_CONTEXT_END();
@@ -243,6 +257,10 @@ protocolHelperClientFree(ProtocolHelperClient *protocolHelperClient)
         // Try to shutdown the protocol but only warn on error
         TRY_BEGIN()
         {
+            // Merge stats collected by the process
+            if (statProfile())
+                protocolClientStatMerge(protocolHelperClient->client);
+
             protocolClientFree(protocolHelperClient->client);
         }
         CATCH_ANY()
@@ -251,10 +269,11 @@ protocolHelperClientFree(ProtocolHelperClient *protocolHelperClient)
         }
         TRY_END();
 
-        // Try to end the child process but only warn on error
+        // Try to end the child process or close the session but only warn on error
         TRY_BEGIN()
         {
             execFree(protocolHelperClient->exec);
+            ioSessionFree(protocolHelperClient->session);
         }
         CATCH_ANY()
         {
@@ -264,6 +283,7 @@ protocolHelperClientFree(ProtocolHelperClient *protocolHelperClient)
 
         protocolHelperClient->client = NULL;
         protocolHelperClient->exec = NULL;
+        protocolHelperClient->session = NULL;
     }
 
     FUNCTION_LOG_RETURN_VOID();
@@ -309,6 +329,18 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int hostId
     strLstAddZ(result, "-o");
     strLstAddZ(result, "PasswordAuthentication=no");
 
+    // Share a single connection between all ssh processes to the same host when a control path is specified. The master is put in
+    // the background so each ssh process exits as soon as its own session is done.
+    if (cfgOptionTest(cfgOptCmdSshControlPath))
+    {
+        strLstAddZ(result, "-o");
+        strLstAddZ(result, "ControlMaster=auto");
+        strLstAddZ(result, "-o");
+        strLstAdd(result, strNewFmt("ControlPath=%s/%%C", strZ(cfgOptionStr(cfgOptCmdSshControlPath))));
+        strLstAddZ(result, "-o");
+        strLstAdd(result, strNewFmt("ControlPersist=%u", PROTOCOL_SSH_CONTROL_PERSIST));
+    }
+
     // Append port if specified
     ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort;
 
@@ -348,6 +380,9 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int hostId
         optionReplace, VARSTR(CFGOPT_CONFIG_PATH_STR),
         cfgOptionIdxSource(optConfigPath, hostIdx) != cfgSourceDefault ? VARSTR(cfgOptionIdxStr(optConfigPath, hostIdx)) : NULL);
 
+    // The remote does not start ssh connections so the control path is not needed
+    kvPut(optionReplace, VARSTR(CFGOPT_CMD_SSH_CONTROL_PATH_STR), NULL);
+
     // Update/remove repo/pg options that are sent to the remote
     for (ConfigOption optionId = 0; optionId < CFG_OPTION_TOTAL; optionId++)
     {
@@ -435,6 +470,32 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int hostId
     FUNCTION_LOG_RETURN(STRING_LIST, result);
 }
 
+/***********************************************************************************************************************************
+Get the parameters sent to a TLS server. The server loads its own configuration so only the parameters it accepts are sent.
+***********************************************************************************************************************************/
+static StringList *
+protocolRemoteServerParam(ProtocolStorageType protocolStorageType, unsigned int hostIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(protocolStorageType == protocolStorageTypeRepo);
+
+    StringList *result = strLstNew();
+
+    if (cfgOptionTest(cfgOptStanza))
+        strLstAdd(result, strNewFmt("--" CFGOPT_STANZA "=%s", strZ(cfgOptionStr(cfgOptStanza))));
+
+    strLstAdd(result, strNewFmt("--" CFGOPT_PROCESS "=%u", cfgOptionTest(cfgOptProcess) ? cfgOptionUInt(cfgOptProcess) : 0));
+    strLstAdd(result, strNewFmt("--" CFGOPT_REMOTE_TYPE "=%s", strZ(protocolStorageTypeStr(protocolStorageType))));
+    strLstAdd(result, strNewFmt("--" CFGOPT_REPO "=%u", cfgOptionGroupIdxToKey(cfgOptGrpRepo, hostIdx)));
+    strLstAdd(result, cfgCommandRoleNameParam(cfgCommand(), cfgCmdRoleRemote, COLON_STR));
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
 /**********************************************************************************************************************************/
 ProtocolClient *
 protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostIdx)
@@ -481,18 +542,58 @@ protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostIdx)
         MEM_CONTEXT_BEGIN(protocolHelper.memContext)
         {
             unsigned int optHost = isRepo ? cfgOptRepoHost : cfgOptPgHost;
+            const String *host = cfgOptionIdxStr(optHost, hostIdx);
+            IoRead *read;
+            IoWrite *write;
 
-            // Execute the protocol command
-            protocolHelperClient->exec = execNew(
-                cfgOptionStr(cfgOptCmdSsh), protocolRemoteParam(protocolStorageType, hostIdx),
-                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", processId, strZ(cfgOptionIdxStr(optHost, hostIdx))),
-                cfgOptionUInt64(cfgOptProtocolTimeout));
-            execOpen(protocolHelperClient->exec);
+            // Connect to a TLS server
+            if (isRepo && strEq(cfgOptionIdxStr(cfgOptRepoHostType, hostIdx), PROTOCOL_REMOTE_HOST_TYPE_TLS_STR))
+            {
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    // Use the default server port unless a port is specified
+                    unsigned int port = cfgOptionIdxTest(cfgOptRepoHostPort, hostIdx) ?
+                        cfgOptionIdxUInt(cfgOptRepoHostPort, hostIdx) :
+                        cvtZToUInt(cfgParseOptionDefault(cfgCmdServer, cfgOptTlsServerPort));
+
+                    IoClient *tlsClient = tlsClientNew(
+                        sckClientNew(host, port, ioTimeoutMs()), host, ioTimeoutMs(), true,
+                        cfgOptionIdxStrNull(cfgOptRepoHostCaFile, hostIdx), NULL, cfgOptionIdxStr(cfgOptRepoHostCertFile, hostIdx),
+                        cfgOptionIdxStr(cfgOptRepoHostKeyFile, hostIdx));
+
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        protocolHelperClient->session = ioClientOpen(tlsClient);
+                    }
+                    MEM_CONTEXT_PRIOR_END();
+                }
+                MEM_CONTEXT_TEMP_END();
+
+                read = ioSessionIoRead(protocolHelperClient->session);
+                write = ioSessionIoWrite(protocolHelperClient->session);
+
+                // Send the remote command parameters so the server can load the configuration
+                ioWriteStrLine(
+                    write, jsonFromVar(varNewVarLst(varLstNewStrLst(protocolRemoteServerParam(protocolStorageType, hostIdx)))));
+                ioWriteFlush(write);
+            }
+            // Else execute the protocol command via ssh
+            else
+            {
+                protocolHelperClient->exec = execNew(
+                    cfgOptionStr(cfgOptCmdSsh), protocolRemoteParam(protocolStorageType, hostIdx),
+                    strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", processId, strZ(host)),
+                    cfgOptionUInt64(cfgOptProtocolTimeout));
+                execOpen(protocolHelperClient->exec);
+
+                read = execIoRead(protocolHelperClient->exec);
+                write = execIoWrite(protocolHelperClient->exec);
+            }
 
             // Create protocol object
             protocolHelperClient->client = protocolClientNew(
-                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", processId, strZ(cfgOptionIdxStr(optHost, hostIdx))),
-                PROTOCOL_SERVICE_REMOTE_STR, execIoRead(protocolHelperClient->exec), execIoWrite(protocolHelperClient->exec));
+                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", processId, strZ(host)), PROTOCOL_SERVICE_REMOTE_STR, read,
+                write);
 
             // Get cipher options from the remote if none are locally configured
             if (isRepo && strEq(cfgOptionIdxStr(cfgOptRepoCipherType, hostIdx), CIPHER_TYPE_NONE_STR))
@@ -511,7 +612,9 @@ protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostIdx)
                 }
             }
 
-            protocolClientMove(protocolHelperClient->client, execMemContext(protocolHelperClient->exec));
+            // Move the protocol client to the exec mem context so it is freed with the process
+            if (protocolHelperClient->exec != NULL)
+                protocolClientMove(protocolHelperClient->client, execMemContext(protocolHelperClient->exec));
         }
         MEM_CONTEXT_END();
     }
@@ -541,10 +644,24 @@ protocolKeepAlive(void)
 
     if (protocolHelper.memContext != NULL)
     {
+        // Skip clients that are waiting on a command since a noop cannot be sent until the output has been read. The server is busy
+        // processing the command so it will not timeout.
         for (unsigned int clientIdx  = 0; clientIdx < protocolHelper.clientRemoteSize; clientIdx++)
         {
-            if (protocolHelper.clientRemote[clientIdx].client != NULL)
-                protocolClientNoOp(protocolHelper.clientRemote[clientIdx].client);
+            ProtocolClient *const client = protocolHelper.clientRemote[clientIdx].client;
+
+            if (client != NULL && !protocolClientCommandPending(client))
+                protocolClientNoOp(client);
+        }
+
+        // Idle locals also need keep-alives, e.g. when the main process is waiting on a query. A noop also causes the local to send
+        // keep-alives to its own remotes.
+        for (unsigned int clientIdx  = 0; clientIdx < protocolHelper.clientLocalSize; clientIdx++)
+        {
+            ProtocolClient *const client = protocolHelper.clientLocal[clientIdx].client;
+
+            if (client != NULL && !protocolClientCommandPending(client))
+                protocolClientNoOp(client);
         }
     }
 
@@ -29,7 +29,7 @@ Constants
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
-// Send keepalives to all remotes
+// Send keepalives to all remotes and locals that are not waiting on a command
 void protocolKeepAlive(void);
 
 // Local protocol client
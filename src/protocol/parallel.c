@@ -189,6 +189,8 @@ protocolParallelProcess(ProtocolParallel *this)
     }
 
     // Find new jobs to be run
+    bool clientRunning = false;
+
     for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
     {
         // If nothing is running for this client
@@ -218,10 +220,18 @@ protocolParallelProcess(ProtocolParallel *this)
                 protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
                 this->clientJobList[clientIdx] = job;
             }
-            // Else no more jobs for this client so free it
-            else
-                protocolLocalFree(clientIdx + 1);
         }
+
+        if (this->clientJobList[clientIdx] != NULL)
+            clientRunning = true;
+    }
+
+    // If no clients are running then there are no more jobs so free the clients. Clients are not freed while other clients are
+    // running because the callback may have more jobs when the running jobs complete.
+    if (!clientRunning)
+    {
+        for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+            protocolLocalFree(clientIdx + 1);
     }
 
     FUNCTION_LOG_RETURN(UINT, result);
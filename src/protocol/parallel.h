@@ -21,6 +21,9 @@ Job request callback
 
 Called whenever a new job is required for processing.  If no more jobs are available then NULL is returned.  Note that NULL must be
 returned to each clientIdx in case job distribution varies by clientIdx.
+
+The callback is called again for idle clients while other clients are running jobs, so a job may be returned after NULL, e.g. when
+a job that was waiting on a running job can be started.
 ***********************************************************************************************************************************/
 typedef ProtocolParallelJob *ParallelJobCallback(void *data, unsigned int clientIdx);
 
@@ -8,6 +8,7 @@ Protocol Server
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/time.h"
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
@@ -214,6 +215,12 @@ protocolServerProcess(ProtocolServer *this, const VariantList *retryInterval)
                 {
                     if (strEq(command, PROTOCOL_COMMAND_NOOP_STR))
                         protocolServerResponse(this, NULL);
+                    else if (strEq(command, PROTOCOL_COMMAND_STAT_STR))
+                    {
+                        // The client is about to exit this process so free clients held by this process first to merge their stats
+                        protocolFree();
+                        protocolServerResponse(this, varNewKv(statToKv()));
+                    }
                     else if (strEq(command, PROTOCOL_COMMAND_EXIT_STR))
                         exit = true;
                     else
@@ -58,8 +58,24 @@ storageReadAzureOpen(THIS_VOID)
     // Request the file
     MEM_CONTEXT_BEGIN(this->memContext)
     {
+        HttpHeader *header = NULL;
+
+        // Request a range when reading starts at an offset or is limited
+        if (this->interface.offset != 0 || this->interface.limit != NULL)
+        {
+            header = httpHeaderNew(NULL);
+
+            String *range = strNewFmt(HTTP_HEADER_RANGE_BYTES "=%" PRIu64 "-", this->interface.offset);
+
+            if (this->interface.limit != NULL)
+                strCatFmt(range, "%" PRIu64, this->interface.offset + varUInt64(this->interface.limit) - 1);
+
+            httpHeaderAdd(header, HTTP_HEADER_RANGE_STR, range);
+        }
+
         this->httpResponse = storageAzureRequestP(
-            this->storage, HTTP_VERB_GET_STR, .uri = this->interface.name, .allowMissing = true, .contentIo = true);
+            this->storage, HTTP_VERB_GET_STR, .uri = this->interface.name, .header = header, .allowMissing = true,
+            .contentIo = true);
     }
     MEM_CONTEXT_END();
 
@@ -115,16 +131,19 @@ storageReadAzureEof(THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissing)
+storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_AZURE, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(limit == NULL || varUInt64(limit) > 0);                  // An empty range cannot be requested
 
     StorageRead *this = NULL;
 
@@ -142,6 +161,8 @@ storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissin
                 .type = STORAGE_AZURE_TYPE_STR,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
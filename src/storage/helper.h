@@ -13,6 +13,8 @@ Storage path constants
     STRING_DECLARE(STORAGE_SPOOL_ARCHIVE_IN_STR);
 #define STORAGE_SPOOL_ARCHIVE_OUT                                   "<SPOOL:ARCHIVE:OUT>"
     STRING_DECLARE(STORAGE_SPOOL_ARCHIVE_OUT_STR);
+#define STORAGE_SPOOL_ARCHIVE_QUEUE                                 "<SPOOL:ARCHIVE:QUEUE>"
+    STRING_DECLARE(STORAGE_SPOOL_ARCHIVE_QUEUE_STR);
 
 #define STORAGE_REPO_ARCHIVE                                        "<REPO:ARCHIVE>"
     STRING_DECLARE(STORAGE_REPO_ARCHIVE_STR);
@@ -3,6 +3,11 @@ Posix Storage
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+// syncfs() is declared by unistd.h only when _GNU_SOURCE is defined
+#if defined(HAVE_SYNCFS) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -10,6 +15,7 @@ Posix Storage
 #include <stdio.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/utsname.h>
 #include <unistd.h>
 
 #include "common/debug.h"
@@ -33,6 +39,13 @@ Define PATH_MAX if it is not defined
     #define PATH_MAX                                                (4 * 1024)
 #endif
 
+/***********************************************************************************************************************************
+Minimum Linux kernel version where syncfs() reports writeback errors. Earlier kernels return success even when data could not be
+written so syncfs() cannot be used to make files durable.
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_SYNCFS_KERNEL_MAJOR                           5
+#define STORAGE_POSIX_SYNCFS_KERNEL_MINOR                           8
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -315,13 +328,14 @@ storagePosixNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageIn
         FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadPosixNew(this, file, ignoreMissing, param.limit));
+    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadPosixNew(this, file, ignoreMissing, param.offset, param.limit));
 }
 
 /**********************************************************************************************************************************/
@@ -342,6 +356,7 @@ storagePosixNewWrite(THIS_VOID, const String *file, StorageInterfaceNewWritePara
         FUNCTION_LOG_PARAM(BOOL, param.syncFile);
         FUNCTION_LOG_PARAM(BOOL, param.syncPath);
         FUNCTION_LOG_PARAM(BOOL, param.atomic);
+        FUNCTION_LOG_PARAM(BOOL, param.sparse);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
@@ -351,7 +366,7 @@ storagePosixNewWrite(THIS_VOID, const String *file, StorageInterfaceNewWritePara
         STORAGE_WRITE,
         storageWritePosixNew(
             this, file, param.modeFile, param.modePath, param.user, param.group, param.timeModified, param.createPath,
-            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic));
+            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic, param.sparse));
 }
 
 /**********************************************************************************************************************************/
@@ -486,7 +501,7 @@ storagePosixPathSync(THIS_VOID, const String *path, StorageInterfacePathSyncPara
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
         FUNCTION_LOG_PARAM(STRING, path);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(BOOL, param.fileSystem);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
@@ -505,8 +520,14 @@ storagePosixPathSync(THIS_VOID, const String *path, StorageInterfacePathSyncPara
     }
     else
     {
-        // Attempt to sync the directory
+        // Attempt to sync the directory, or all files on the filesystem containing the directory
+#ifdef HAVE_SYNCFS
+        if ((param.fileSystem ? syncfs(fd) : fsync(fd)) == -1)
+#else
+        ASSERT(!param.fileSystem);
+
         if (fsync(fd) == -1)
+#endif
         {
             int errNo = errno;
 
@@ -547,6 +568,36 @@ storagePosixRemove(THIS_VOID, const String *file, StorageInterfaceRemoveParam pa
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Does syncfs() report writeback errors on the kernel release? Releases that cannot be parsed are assumed not to.
+***********************************************************************************************************************************/
+#ifdef HAVE_SYNCFS
+
+static bool
+storagePosixSyncFsErrorReported(const char *release)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRINGZ, release);
+    FUNCTION_TEST_END();
+
+    ASSERT(release != NULL);
+
+    unsigned int major = 0;
+    unsigned int minor = 0;
+    bool result = false;
+
+    if (sscanf(release, "%u.%u", &major, &minor) == 2)
+    {
+        result =
+            major > STORAGE_POSIX_SYNCFS_KERNEL_MAJOR ||
+            (major == STORAGE_POSIX_SYNCFS_KERNEL_MAJOR && minor >= STORAGE_POSIX_SYNCFS_KERNEL_MINOR);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+#endif // HAVE_SYNCFS
+
 /**********************************************************************************************************************************/
 static const StorageInterface storageInterfacePosix =
 {
@@ -605,10 +656,20 @@ storagePosixNewInternal(
 
         // If this is a posix driver then add link features
         if (strEq(type, STORAGE_POSIX_TYPE_STR))
+        {
             driver->interface.feature |=
                 1 << storageFeatureHardLink | 1 << storageFeatureSymLink | 1 << storageFeaturePathSync |
                 1 << storageFeatureInfoDetail;
 
+#ifdef HAVE_SYNCFS
+            // Filesystem sync is only safe when syncfs() reports writeback errors, otherwise files must be synced individually
+            struct utsname kernel;
+
+            if (uname(&kernel) == 0 && storagePosixSyncFsErrorReported(kernel.release))
+                driver->interface.feature |= 1 << storageFeaturePathSyncFs;
+#endif
+        }
+
         this = storageNew(type, path, modeFile, modePath, write, pathExpressionFunction, driver, driver->interface);
     }
     MEM_CONTEXT_NEW_END();
@@ -5,6 +5,7 @@ Posix Storage File write
 
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <utime.h>
 
@@ -33,6 +34,10 @@ typedef struct StorageWritePosix
     const String *nameTmp;
     const String *path;
     int fd;                                                         // File descriptor
+
+    bool sparse;                                                    // Skip zero-filled blocks to create a sparse file?
+    uint64_t size;                                                  // Total bytes written (including skipped blocks)
+    bool holeEnd;                                                   // Was the last block written skipped?
 } StorageWritePosix;
 
 /***********************************************************************************************************************************
@@ -51,6 +56,12 @@ Since open is called more than once use constants to make sure these parameters
 #define FILE_OPEN_FLAGS                                             (O_CREAT | O_TRUNC | O_WRONLY)
 #define FILE_OPEN_PURPOSE                                           "write"
 
+/***********************************************************************************************************************************
+Block size used to find zero-filled regions when writing sparse files. This matches the most common file system block size, which
+is the smallest region that can be left as a hole, and evenly divides the PostgreSQL page size.
+***********************************************************************************************************************************/
+#define STORAGE_WRITE_POSIX_SPARSE_BLOCK_SIZE                       ((size_t)4096)
+
 /***********************************************************************************************************************************
 Close file descriptor
 ***********************************************************************************************************************************/
@@ -139,8 +150,58 @@ storageWritePosix(THIS_VOID, const Buffer *buffer)
     ASSERT(this->fd != -1);
 
     // Write the data
-    if (write(this->fd, bufPtrConst(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
-        THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+    if (!this->sparse)
+    {
+        if (write(this->fd, bufPtrConst(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
+            THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+    }
+    // Else skip zero-filled blocks so they are left as holes in the file. Blocks are aligned to the file offset rather than the
+    // buffer so holes line up with file system blocks no matter how the data was buffered.
+    else
+    {
+        const unsigned char *data = bufPtrConst(buffer);
+        size_t dataSize = bufUsed(buffer);
+        size_t dataIdx = 0;
+
+        while (dataIdx < dataSize)
+        {
+            // Find the end of the next run of blocks that are all zero or all non-zero
+            size_t runEnd = dataIdx;
+            bool runZero = false;
+
+            do
+            {
+                const uint64_t offset = this->size + (runEnd - dataIdx);
+                size_t blockSize = STORAGE_WRITE_POSIX_SPARSE_BLOCK_SIZE - (size_t)(offset % STORAGE_WRITE_POSIX_SPARSE_BLOCK_SIZE);
+
+                if (blockSize > dataSize - runEnd)
+                    blockSize = dataSize - runEnd;
+
+                // A block is zero-filled when the first byte is zero and every byte matches the byte after it
+                const bool blockZero =
+                    data[runEnd] == 0 && (blockSize == 1 || memcmp(data + runEnd, data + runEnd + 1, blockSize - 1) == 0);
+
+                if (runEnd == dataIdx)
+                    runZero = blockZero;
+                else if (blockZero != runZero)
+                    break;
+
+                runEnd += blockSize;
+            }
+            while (runEnd < dataSize);
+
+            // Write non-zero runs at their offset in the file
+            if (!runZero)
+            {
+                if (pwrite(this->fd, data + dataIdx, runEnd - dataIdx, (off_t)this->size) != (ssize_t)(runEnd - dataIdx))
+                    THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+            }
+
+            this->size += runEnd - dataIdx;
+            this->holeEnd = runZero;
+            dataIdx = runEnd;
+        }
+    }
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -162,6 +223,13 @@ storageWritePosixClose(THIS_VOID)
     // Close if the file has not already been closed
     if (this->fd != -1)
     {
+        // Set the file size when trailing zero-filled blocks were skipped
+        if (this->holeEnd)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                ftruncate(this->fd, (off_t)this->size) == -1, FileWriteError, "unable to truncate '%s'", strZ(this->nameTmp));
+        }
+
         // Sync the file
         if (this->interface.syncFile)
             THROW_ON_SYS_ERROR_FMT(fsync(this->fd) == -1, FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
@@ -217,7 +285,7 @@ storageWritePosixFd(const THIS_VOID)
 StorageWrite *
 storageWritePosixNew(
     StoragePosix *storage, const String *name, mode_t modeFile, mode_t modePath, const String *user, const String *group,
-    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic)
+    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool sparse)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_POSIX, storage);
@@ -231,6 +299,7 @@ storageWritePosixNew(
         FUNCTION_LOG_PARAM(BOOL, syncFile);
         FUNCTION_LOG_PARAM(BOOL, syncPath);
         FUNCTION_LOG_PARAM(BOOL, atomic);
+        FUNCTION_LOG_PARAM(BOOL, sparse);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
@@ -250,6 +319,7 @@ storageWritePosixNew(
             .storage = storage,
             .path = strPath(name),
             .fd = -1,
+            .sparse = sparse,
 
             .interface = (StorageWriteInterface)
             {
@@ -0,0 +1,380 @@
+/***********************************************************************************************************************************
+Storage Range Read
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/compress/frame.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/debug.h"
+#include "common/io/filter/range.h"
+#include "common/io/io.h"
+#include "common/io/read.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+#include "storage/range.h"
+#include "storage/read.intern.h"
+
+/***********************************************************************************************************************************
+Object type
+
+Returns the header (if any) followed by the data read from the source until size bytes have been returned. The source is not read to
+eof so filters on the source are not flushed, which allows a range to end before the end of the compressed or encrypted data.
+***********************************************************************************************************************************/
+typedef struct StorageReadRange
+{
+    MemContext *memContext;                                         // Object mem context
+    StorageReadInterface interface;                                 // Interface
+    StorageRead *read;                                              // Storage read interface
+
+    StorageRead *source;                                            // Read that provides the data
+    Buffer *header;                                                 // Data to return before the source data
+    size_t headerPos;                                               // Position in the header
+    uint64_t remains;                                               // Bytes remaining to be returned
+} StorageReadRange;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_READ_RANGE_TYPE                                                                                       \
+    StorageReadRange *
+#define FUNCTION_LOG_STORAGE_READ_RANGE_FORMAT(value, buffer, bufferSize)                                                          \
+    objToLog(value, "StorageReadRange", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Open the source
+***********************************************************************************************************************************/
+static bool
+storageReadRangeOpen(THIS_VOID)
+{
+    THIS(StorageReadRange);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_RANGE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(BOOL, ioReadOpen(storageReadIo(this->source)));
+}
+
+/***********************************************************************************************************************************
+Read the header and then the source
+***********************************************************************************************************************************/
+static size_t
+storageReadRange(THIS_VOID, Buffer *buffer, bool block)
+{
+    THIS(StorageReadRange);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_RANGE, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+        FUNCTION_LOG_PARAM(BOOL, block);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL && !bufFull(buffer));
+    ASSERT(this->remains > 0);
+
+    const size_t bufferUsedBegin = bufUsed(buffer);
+
+    // Copy the header
+    if (this->header != NULL && this->headerPos < bufUsed(this->header))
+    {
+        size_t copySize = bufUsed(this->header) - this->headerPos;
+
+        if (copySize > bufRemains(buffer))
+            copySize = bufRemains(buffer);
+
+        bufCatSub(buffer, this->header, this->headerPos, copySize);
+        this->headerPos += copySize;
+        this->remains -= copySize;
+    }
+
+    // Read from the source when the header is done but do not read past the end of the range
+    if (!bufFull(buffer) && this->remains > 0)
+    {
+        const bool limit = bufRemains(buffer) > this->remains;
+
+        if (limit)
+            bufLimitSet(buffer, bufUsed(buffer) + (size_t)this->remains);
+
+        this->remains -= ioRead(storageReadIo(this->source), buffer);
+
+        if (limit)
+            bufLimitClear(buffer);
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, bufUsed(buffer) - bufferUsedBegin);
+}
+
+/***********************************************************************************************************************************
+Has the end of the range or the source been reached?
+***********************************************************************************************************************************/
+static bool
+storageReadRangeEof(THIS_VOID)
+{
+    THIS(StorageReadRange);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_READ_RANGE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->remains == 0 || ioReadEof(storageReadIo(this->source)));
+}
+
+/***********************************************************************************************************************************
+Close the source, which may not have reached eof
+***********************************************************************************************************************************/
+static void
+storageReadRangeClose(THIS_VOID)
+{
+    THIS(StorageReadRange);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_RANGE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    ioReadClose(storageReadIo(this->source));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Create a read that returns size bytes made up of the header (if not NULL) and the source
+***********************************************************************************************************************************/
+static StorageRead *
+storageReadRangeNew(StorageRead *source, const Buffer *header, uint64_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ, source);
+        FUNCTION_LOG_PARAM(BUFFER, header);
+        FUNCTION_LOG_PARAM(UINT64, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(source != NULL);
+    ASSERT(size > 0);
+
+    StorageReadRange *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("StorageReadRange")
+    {
+        this = memNew(sizeof(StorageReadRange));
+
+        *this = (StorageReadRange)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .source = storageReadMove(source, MEM_CONTEXT_NEW()),
+            .header = header == NULL ? NULL : bufDup(header),
+            .remains = size,
+
+            .interface = (StorageReadInterface)
+            {
+                .type = storageReadType(source),
+                .name = strDup(storageReadName(source)),
+                .ignoreMissing = storageReadIgnoreMissing(source),
+                .offset = storageReadOffset(source),
+                .limit = varDup(storageReadLimit(source)),
+
+                .ioInterface = (IoReadInterface)
+                {
+                    .close = storageReadRangeClose,
+                    .eof = storageReadRangeEof,
+                    .open = storageReadRangeOpen,
+                    .read = storageReadRange,
+                },
+            },
+        };
+
+        this->read = storageReadNew(this, &this->interface);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    ASSERT(this != NULL);
+    FUNCTION_LOG_RETURN(STORAGE_READ, this->read);
+}
+
+/***********************************************************************************************************************************
+Read size bytes of the data starting at offset. When a header in the authenticated cipher format is passed the data is the plaintext
+and only the chunks that contain the range are read and decrypted.
+***********************************************************************************************************************************/
+static StorageRead *
+storageNewReadRangeData(
+    const Storage *this, const String *fileExp, uint64_t offset, uint64_t size, const Buffer *header, uint64_t fileSize,
+    const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE, this);
+        FUNCTION_LOG_PARAM(STRING, fileExp);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+        FUNCTION_LOG_PARAM(BUFFER, header);
+        FUNCTION_LOG_PARAM(UINT64, fileSize);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(fileExp != NULL);
+    ASSERT(header == NULL || cipherPass != NULL);
+
+    StorageRead *result = NULL;
+
+    if (header == NULL)
+        result = storageNewReadP(this, fileExp, .offset = offset, .limit = VARUINT64(size));
+    else
+    {
+        const CipherBlockRange range = cipherBlockAeadRange(fileSize, offset, size);
+
+        // The header is returned before the chunks so the salt is available to decrypt them
+        result = storageReadRangeNew(
+            storageNewReadP(this, fileExp, .offset = range.offset, .limit = VARUINT64(range.size)), header,
+            CIPHER_BLOCK_HEADER_SIZE + range.size);
+
+        IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(result));
+        ioFilterGroupAdd(filterGroup, cipherBlockNewRange(BUFSTR(cipherPass), NULL, range.chunkNo, range.final));
+        ioFilterGroupAdd(filterGroup, ioRangeNew(range.skip, size));
+    }
+
+    FUNCTION_LOG_RETURN(STORAGE_READ, result);
+}
+
+/**********************************************************************************************************************************/
+StorageRead *
+storageNewReadRange(const Storage *this, const String *fileExp, uint64_t offset, uint64_t size, StorageNewReadRangeParam param)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, this);
+        FUNCTION_LOG_PARAM(STRING, fileExp);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+        FUNCTION_LOG_PARAM(ENUM, param.compressType);
+        FUNCTION_LOG_PARAM(ENUM, param.cipherType);
+        FUNCTION_TEST_PARAM(STRING, param.cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(fileExp != NULL);
+    ASSERT(size > 0);
+    ASSERT(
+        (param.cipherType == cipherTypeNone && param.cipherPass == NULL) ||
+        (param.cipherType != cipherTypeNone && param.cipherPass != NULL));
+
+    StorageRead *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // A range can only be read directly when the storage supports reading a range
+        const bool rangeRead = storageFeature(this, storageFeatureLimitRead);
+
+        // Read the range directly when the file is not compressed or encrypted
+        if (rangeRead && param.compressType == compressTypeNone && param.cipherType == cipherTypeNone)
+        {
+            result = storageNewReadP(this, fileExp, .offset = offset, .limit = VARUINT64(size));
+        }
+        else
+        {
+            // Files in the authenticated cipher format can be decrypted starting at any chunk, but the header is required for the
+            // salt and the file size is required to find the final chunk. The format is determined by the header since files in the
+            // unauthenticated format may be decrypted in compatibility mode.
+            const Buffer *header = NULL;
+            uint64_t fileSize = 0;
+
+            if (rangeRead && param.cipherType == cipherTypeAes256Gcm)
+            {
+                fileSize = storageInfoP(this, fileExp).size;
+
+                if (fileSize >= CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE)
+                {
+                    header = storageGetP(storageNewReadP(this, fileExp, .limit = VARUINT64(CIPHER_BLOCK_HEADER_SIZE)));
+
+                    if (!cipherBlockHeaderAead(header))
+                        header = NULL;
+                }
+            }
+
+            // Range of the data (the plaintext when the file is encrypted) to read. The read is not limited when the range cannot
+            // be located in the data.
+            const bool dataRead = rangeRead && (param.cipherType == cipherTypeNone || header != NULL);
+            uint64_t readOffset = 0;
+            Variant *readLimit = NULL;
+            uint64_t skip = offset;
+
+            if (dataRead && param.compressType == compressTypeNone)
+            {
+                readOffset = offset;
+                readLimit = varNewUInt64(size);
+                skip = 0;
+            }
+            // Read only the frames that contain the range when the file was compressed in frames
+            else if (dataRead && compressTypeFrame(param.compressType))
+            {
+                const uint64_t dataSize = header != NULL ? cipherBlockAeadSize(fileSize) : storageInfoP(this, fileExp).size;
+
+                if (dataSize >= COMPRESS_FRAME_FOOTER_SIZE)
+                {
+                    const size_t indexSize = compressFrameIndexSize(
+                        storageGetP(
+                            storageNewReadRangeData(
+                                this, fileExp, dataSize - COMPRESS_FRAME_FOOTER_SIZE, COMPRESS_FRAME_FOOTER_SIZE, header, fileSize,
+                                param.cipherPass)));
+
+                    if (indexSize > 0 && indexSize <= dataSize)
+                    {
+                        const CompressFrameRange frameRange = compressFrameIndexRange(
+                            storageGetP(
+                                storageNewReadRangeData(
+                                    this, fileExp, dataSize - indexSize, indexSize, header, fileSize, param.cipherPass)),
+                            offset, size);
+
+                        readOffset = frameRange.offset;
+                        readLimit = varNewUInt64(frameRange.size);
+                        skip = frameRange.skip;
+                    }
+                }
+            }
+
+            // Read only the data that contains the range
+            if (readLimit != NULL)
+            {
+                result = storageNewReadRangeData(
+                    this, fileExp, readOffset, varUInt64(readLimit), header, fileSize, param.cipherPass);
+
+                if (param.compressType != compressTypeNone)
+                {
+                    IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(result));
+
+                    ioFilterGroupAdd(filterGroup, decompressFilter(param.compressType));
+                    ioFilterGroupAdd(filterGroup, ioRangeNew(skip, size));
+                }
+            }
+            // Else read the file from the beginning, discard data before the range, and stop reading at the end of the range
+            else
+            {
+                result = storageNewReadP(this, fileExp);
+                IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(result));
+
+                if (param.cipherType != cipherTypeNone)
+                {
+                    ioFilterGroupAdd(
+                        filterGroup, cipherBlockNew(cipherModeDecrypt, param.cipherType, BUFSTR(param.cipherPass), NULL));
+                }
+
+                if (param.compressType != compressTypeNone)
+                    ioFilterGroupAdd(filterGroup, decompressFilter(param.compressType));
+
+                ioFilterGroupAdd(filterGroup, ioRangeNew(skip, size));
+
+                result = storageReadRangeNew(result, NULL, size);
+            }
+        }
+
+        storageReadMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_READ, result);
+}
@@ -0,0 +1,37 @@
+/***********************************************************************************************************************************
+Storage Range Read
+
+Read a range of the uncompressed and decrypted content of a file. When possible only the part of the file that contains the range is
+read. Uncompressed files are read directly at the offset and files compressed in frames (see common/compress/frame.h) are read
+starting at the frame that contains the offset. Files encrypted with aes-256-gcm are decrypted starting at the chunk that contains
+the offset (see common/crypto/cipherBlock.h). Otherwise, e.g. when the file is encrypted with aes-256-cbc, the file is read from the
+beginning and data before the range is discarded. In all cases reading stops at the end of the range.
+***********************************************************************************************************************************/
+#ifndef STORAGE_RANGE_H
+#define STORAGE_RANGE_H
+
+#include "common/compress/helper.h"
+#include "common/crypto/common.h"
+#include "storage/storage.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+typedef struct StorageNewReadRangeParam
+{
+    VAR_PARAM_HEADER;
+    CompressType compressType;                                      // Compression type of the file
+    CipherType cipherType;                                          // Cipher type of the file
+    const String *cipherPass;                                       // Cipher passphrase when the file is encrypted
+} StorageNewReadRangeParam;
+
+#define storageNewReadRangeP(this, pathExp, offset, size, ...)                                                                     \
+    storageNewReadRange(this, pathExp, offset, size, (StorageNewReadRangeParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+// Create a read object for size bytes starting at offset in the content of the file. The range is reduced if it extends past the
+// end of the content, but the offset should be within the content since object stores return an error for a range that starts past
+// the end of the file.
+StorageRead *storageNewReadRange(
+    const Storage *this, const String *fileExp, uint64_t offset, uint64_t size, StorageNewReadRangeParam param);
+
+#endif
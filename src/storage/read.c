@@ -6,6 +6,7 @@ Storage Read Interface
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/type/object.h"
 #include "storage/read.intern.h"
 
@@ -55,6 +56,14 @@ storageReadNew(void *driver, const StorageReadInterface *interface)
         .io = ioReadNew(driver, interface->ioInterface),
     };
 
+    // Profile driver io by storage type
+    if (statProfile())
+    {
+        String *profile = strNewFmt("storage.%s.read", strZ(interface->type));
+        ioReadProfileSet(this->io, profile);
+        strFree(profile);
+    }
+
     FUNCTION_LOG_RETURN(STORAGE_READ, this);
 }
 
@@ -84,6 +93,19 @@ storageReadLimit(const StorageRead *this)
     FUNCTION_TEST_RETURN(this->interface->limit);
 }
 
+/**********************************************************************************************************************************/
+uint64_t
+storageReadOffset(const StorageRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->interface->offset);
+}
+
 /**********************************************************************************************************************************/
 IoRead *
 storageReadIo(const StorageRead *this)
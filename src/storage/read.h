@@ -31,6 +31,9 @@ IoRead *storageReadIo(const StorageRead *this);
 // Is there a read limit? NULL for no limit.
 const Variant *storageReadLimit(const StorageRead *this);
 
+// Offset where reading starts in the file
+uint64_t storageReadOffset(const StorageRead *this);
+
 // File name
 const String *storageReadName(const StorageRead *this);
 
@@ -8,6 +8,7 @@ Remote Storage Protocol Handler
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
 #include "common/debug.h"
+#include "common/io/filter/range.h"
 #include "common/io/filter/sink.h"
 #include "common/io/filter/size.h"
 #include "common/io/io.h"
@@ -78,6 +79,8 @@ storageRemoteFilterGroup(IoFilterGroup *filterGroup, const Variant *filterList)
             ioFilterGroupAdd(filterGroup, cryptoHashNewVar(filterParam));
         else if (strEq(filterKey, PAGE_CHECKSUM_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, pageChecksumNewVar(filterParam));
+        else if (strEq(filterKey, RANGE_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, ioRangeNewVar(filterParam));
         else if (strEq(filterKey, SINK_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, ioSinkNew());
         else if (strEq(filterKey, SIZE_FILTER_TYPE_STR))
@@ -195,10 +198,11 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
             // Create the read object
             IoRead *fileRead = storageReadIo(
                 storageInterfaceNewReadP(
-                    driver, varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)), .limit = varLstGet(paramList, 2)));
+                    driver, varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)),
+                    .offset = varUInt64(varLstGet(paramList, 2)), .limit = varLstGet(paramList, 3)));
 
             // Set filter group based on passed filters
-            storageRemoteFilterGroup(ioReadFilterGroup(fileRead), varLstGet(paramList, 3));
+            storageRemoteFilterGroup(ioReadFilterGroup(fileRead), varLstGet(paramList, 4));
 
             // Check if the file exists
             bool exists = ioReadOpen(fileRead);
@@ -313,7 +317,7 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
         }
         else if (strEq(command, PROTOCOL_COMMAND_STORAGE_PATH_SYNC_STR))
         {
-            storageInterfacePathSyncP(driver, varStr(varLstGet(paramList, 0)));
+            storageInterfacePathSyncP(driver, varStr(varLstGet(paramList, 0)), .fileSystem = varBool(varLstGet(paramList, 1)));
 
             protocolServerResponse(server, NULL);
         }
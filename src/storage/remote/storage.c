@@ -177,6 +177,7 @@ storageRemoteNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageI
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
@@ -187,7 +188,7 @@ storageRemoteNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageI
         STORAGE_READ,
         storageReadRemoteNew(
             this, this->client, file, ignoreMissing, this->compressLevel > 0 ? param.compressible : false, this->compressLevel,
-            param.limit));
+            param.offset, param.limit));
 }
 
 /**********************************************************************************************************************************/
@@ -297,7 +298,7 @@ storageRemotePathSync(THIS_VOID, const String *path, StorageInterfacePathSyncPar
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_REMOTE, this);
         FUNCTION_LOG_PARAM(STRING, path);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(BOOL, param.fileSystem);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
@@ -307,6 +308,7 @@ storageRemotePathSync(THIS_VOID, const String *path, StorageInterfacePathSyncPar
     {
         ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_STORAGE_PATH_SYNC_STR);
         protocolCommandParamAdd(command, VARSTR(path));
+        protocolCommandParamAdd(command, VARBOOL(param.fileSystem));
 
         protocolClientExecute(this->client, command, false);
     }
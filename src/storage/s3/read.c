@@ -58,8 +58,23 @@ storageReadS3Open(THIS_VOID)
     // Request the file
     MEM_CONTEXT_BEGIN(this->memContext)
     {
+        HttpHeader *header = NULL;
+
+        // Request a range when reading starts at an offset or is limited
+        if (this->interface.offset != 0 || this->interface.limit != NULL)
+        {
+            header = httpHeaderNew(NULL);
+
+            String *range = strNewFmt(HTTP_HEADER_RANGE_BYTES "=%" PRIu64 "-", this->interface.offset);
+
+            if (this->interface.limit != NULL)
+                strCatFmt(range, "%" PRIu64, this->interface.offset + varUInt64(this->interface.limit) - 1);
+
+            httpHeaderAdd(header, HTTP_HEADER_RANGE_STR, range);
+        }
+
         this->httpResponse = storageS3RequestP(
-            this->storage, HTTP_VERB_GET_STR, this->interface.name, .allowMissing = true, .contentIo = true);
+            this->storage, HTTP_VERB_GET_STR, this->interface.name, .header = header, .allowMissing = true, .contentIo = true);
     }
     MEM_CONTEXT_END();
 
@@ -115,16 +130,19 @@ storageReadS3Eof(THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadS3New(StorageS3 *storage, const String *name, bool ignoreMissing)
+storageReadS3New(StorageS3 *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_S3, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(limit == NULL || varUInt64(limit) > 0);                  // An empty range cannot be requested
 
     StorageRead *this = NULL;
 
@@ -142,6 +160,8 @@ storageReadS3New(StorageS3 *storage, const String *name, bool ignoreMissing)
                 .type = STORAGE_S3_TYPE_STR,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
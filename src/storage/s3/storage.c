@@ -285,6 +285,7 @@ storageS3RequestAsync(StorageS3 *this, const String *verb, const String *uri, St
         FUNCTION_LOG_PARAM(STRING, verb);
         FUNCTION_LOG_PARAM(STRING, uri);
         FUNCTION_LOG_PARAM(HTTP_QUERY, param.query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, param.header);
         FUNCTION_LOG_PARAM(BUFFER, param.content);
     FUNCTION_LOG_END();
 
@@ -296,7 +297,8 @@ storageS3RequestAsync(StorageS3 *this, const String *verb, const String *uri, St
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        HttpHeader *requestHeader = httpHeaderNew(this->headerRedactList);
+        HttpHeader *requestHeader = param.header == NULL ?
+            httpHeaderNew(this->headerRedactList) : httpHeaderDup(param.header, this->headerRedactList);
 
         // Set content length
         httpHeaderAdd(
@@ -464,6 +466,7 @@ storageS3Request(StorageS3 *this, const String *verb, const String *uri, Storage
         FUNCTION_LOG_PARAM(STRING, verb);
         FUNCTION_LOG_PARAM(STRING, uri);
         FUNCTION_LOG_PARAM(HTTP_QUERY, param.query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, param.header);
         FUNCTION_LOG_PARAM(BUFFER, param.content);
         FUNCTION_LOG_PARAM(BOOL, param.allowMissing);
         FUNCTION_LOG_PARAM(BOOL, param.contentIo);
@@ -472,7 +475,7 @@ storageS3Request(StorageS3 *this, const String *verb, const String *uri, Storage
     FUNCTION_LOG_RETURN(
         HTTP_RESPONSE,
         storageS3ResponseP(
-            storageS3RequestAsyncP(this, verb, uri, .query = param.query, .content = param.content),
+            storageS3RequestAsyncP(this, verb, uri, .query = param.query, .header = param.header, .content = param.content),
             .allowMissing = param.allowMissing, .contentIo = param.contentIo));
 }
 
@@ -560,56 +563,51 @@ storageS3ListInternal(
                 else
                     response = storageS3RequestP(this, HTTP_VERB_GET_STR, FSLASH_STR, query);
 
-                XmlNode *xmlRoot = xmlDocumentRoot(xmlDocumentNewBuf(httpResponseContent(response)));
+                // Read the response one node at a time rather than building the entire document in memory
+                XmlReader *reader = xmlReaderNewBuf(httpResponseContent(response));
+                const XmlNode *node;
 
-                // If a continuation token exists then send an async request to get more data
-                const String *continuationToken = xmlNodeContent(
-                    xmlNodeChild(xmlRoot, S3_XML_TAG_NEXT_CONTINUATION_TOKEN_STR, false));
-
-                if (continuationToken != NULL)
+                while ((node = xmlReaderNext(reader)) != NULL)
                 {
-                    httpQueryPut(query, S3_QUERY_CONTINUATION_TOKEN_STR, continuationToken);
+                    const String *name = xmlNodeName(node);
 
-                    // Store request in the outer temp context
-                    MEM_CONTEXT_PRIOR_BEGIN()
+                    // If a continuation token exists then send an async request to get more data. The token is generally near the
+                    // start of the response so the request can run while the rest of the response is being processed.
+                    if (strEq(name, S3_XML_TAG_NEXT_CONTINUATION_TOKEN_STR))
                     {
-                        request = storageS3RequestAsyncP(this, HTTP_VERB_GET_STR, FSLASH_STR, query);
+                        httpQueryPut(query, S3_QUERY_CONTINUATION_TOKEN_STR, xmlNodeContent(node));
+
+                        // Store request in the outer temp context
+                        MEM_CONTEXT_PRIOR_BEGIN()
+                        {
+                            request = storageS3RequestAsyncP(this, HTTP_VERB_GET_STR, FSLASH_STR, query);
+                        }
+                        MEM_CONTEXT_PRIOR_END();
                     }
-                    MEM_CONTEXT_PRIOR_END();
-                }
-
-                // Get subpath list
-                XmlNodeList *subPathList = xmlNodeChildList(xmlRoot, S3_XML_TAG_COMMON_PREFIXES_STR);
-
-                for (unsigned int subPathIdx = 0; subPathIdx < xmlNodeLstSize(subPathList); subPathIdx++)
-                {
-                    const XmlNode *subPathNode = xmlNodeLstGet(subPathList, subPathIdx);
-
-                    // Get subpath name
-                    const String *subPath = xmlNodeContent(xmlNodeChild(subPathNode, S3_XML_TAG_PREFIX_STR, true));
-
-                    // Strip off base prefix and final /
-                    subPath = strSubN(subPath, strSize(basePrefix), strSize(subPath) - strSize(basePrefix) - 1);
-
-                    // Add to list
-                    callback(this, callbackData, subPath, storageTypePath, NULL);
-                }
-
-                // Get file list
-                XmlNodeList *fileList = xmlNodeChildList(xmlRoot, S3_XML_TAG_CONTENTS_STR);
+                    // Else add subpath
+                    else if (strEq(name, S3_XML_TAG_COMMON_PREFIXES_STR))
+                    {
+                        // Get subpath name
+                        const String *subPath = xmlNodeContent(xmlNodeChild(node, S3_XML_TAG_PREFIX_STR, true));
 
-                for (unsigned int fileIdx = 0; fileIdx < xmlNodeLstSize(fileList); fileIdx++)
-                {
-                    const XmlNode *fileNode = xmlNodeLstGet(fileList, fileIdx);
+                        // Strip off base prefix and final /
+                        subPath = strSubN(subPath, strSize(basePrefix), strSize(subPath) - strSize(basePrefix) - 1);
 
-                    // Get file name
-                    const String *file = xmlNodeContent(xmlNodeChild(fileNode, S3_XML_TAG_KEY_STR, true));
+                        // Add to list
+                        callback(this, callbackData, subPath, storageTypePath, NULL);
+                    }
+                    // Else add file
+                    else if (strEq(name, S3_XML_TAG_CONTENTS_STR))
+                    {
+                        // Get file name
+                        const String *file = xmlNodeContent(xmlNodeChild(node, S3_XML_TAG_KEY_STR, true));
 
-                    // Strip off the base prefix when present
-                    file = strEmpty(basePrefix) ? file : strSub(file, strSize(basePrefix));
+                        // Strip off the base prefix when present
+                        file = strEmpty(basePrefix) ? file : strSub(file, strSize(basePrefix));
 
-                    // Add to list
-                    callback(this, callbackData, file, storageTypeFile, fileNode);
+                        // Add to list
+                        callback(this, callbackData, file, storageTypeFile, node);
+                    }
                 }
             }
             MEM_CONTEXT_TEMP_END();
@@ -747,13 +745,14 @@ storageS3NewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageInter
         FUNCTION_LOG_PARAM(STORAGE_S3, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
+        FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadS3New(this, file, ignoreMissing));
+    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadS3New(this, file, ignoreMissing, param.offset, param.limit));
 }
 
 /**********************************************************************************************************************************/
@@ -948,6 +947,8 @@ storageS3Remove(THIS_VOID, const String *file, StorageInterfaceRemoveParam param
 /**********************************************************************************************************************************/
 static const StorageInterface storageInterfaceS3 =
 {
+    .feature = 1 << storageFeatureLimitRead,
+
     .info = storageS3Info,
     .infoList = storageS3InfoList,
     .newRead = storageS3NewRead,
@@ -1027,7 +1028,7 @@ storageS3New(
             host = driver->bucketEndpoint;
 
         driver->httpClient = httpClientNew(
-            tlsClientNew(sckClientNew(host, port, timeout), host, timeout, verifyPeer, caFile, caPath), timeout);
+            tlsClientNew(sckClientNew(host, port, timeout), host, timeout, verifyPeer, caFile, caPath, NULL, NULL), timeout);
 
         // Create the HTTP client used to retreive temporary security credentials
         if (driver->keyType == storageS3KeyTypeAuto)
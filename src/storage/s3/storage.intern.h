@@ -20,6 +20,7 @@ typedef struct StorageS3RequestAsyncParam
 {
     VAR_PARAM_HEADER;
     const HttpQuery *query;                                         // Query parameters
+    const HttpHeader *header;                                       // Request headers
     const Buffer *content;                                          // Request content
 } StorageS3RequestAsyncParam;
 
@@ -46,6 +47,7 @@ typedef struct StorageS3RequestParam
 {
     VAR_PARAM_HEADER;
     const HttpQuery *query;                                         // Query parameters
+    const HttpHeader *header;                                       // Request headers
     const Buffer *content;                                          // Request content
     bool allowMissing;                                              // Allow missing files (caller can check response code)
     bool contentIo;                                                 // Is IoRead interface required to read content?
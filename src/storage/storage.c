@@ -13,6 +13,7 @@ Storage Interface
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "common/regExp.h"
+#include "common/stat.h"
 #include "common/wait.h"
 #include "storage/storage.intern.h"
 
@@ -86,6 +87,9 @@ storageNew(
     // If symlink feature is enabled then path feature must be enabled
     CHECK(!storageFeature(this, storageFeatureSymLink) || storageFeature(this, storageFeaturePath));
 
+    // If filesystem sync feature is enabled then path sync feature must be enabled
+    CHECK(!storageFeature(this, storageFeaturePathSyncFs) || storageFeature(this, storageFeaturePathSync));
+
     FUNCTION_LOG_RETURN(STORAGE, this);
 }
 
@@ -255,9 +259,13 @@ storageInfo(const Storage *this, const String *fileExp, StorageInfoParam param)
         if (param.level == storageInfoLevelDefault)
             param.level = storageFeature(this, storageFeatureInfoDetail) ? storageInfoLevelDetail : storageInfoLevelBasic;
 
+        TimeUSec timeBegin = statProfileBegin();
+
         result = storageInterfaceInfoP(
             this->driver, file, param.level, .followLink = param.followLink);
 
+        statProfileEnd(timeBegin, "storage.%s.info.usec", strZ(this->type));
+
         // Error if the file missing and not ignoring
         if (!result.exists && !param.ignoreMissing)
             THROW_SYS_ERROR_FMT(FileOpenError, STORAGE_ERROR_INFO_MISSING, strZ(file));
@@ -332,10 +340,12 @@ storageInfoListSort(
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // If no sorting then use the callback directly
+        // If no sorting then use the callback directly. Note that the time spent in the callback will be included in the profile.
         if (sortOrder == sortOrderNone)
         {
+            TimeUSec timeBegin = statProfileBegin();
             result = storageInterfaceInfoListP(this->driver, path, level, callback, callbackData, .expression = expression);
+            statProfileEnd(timeBegin, "storage.%s.list.usec", strZ(this->type));
         }
         // Else sort the info before sending it to the callback
         else
@@ -347,8 +357,11 @@ storageInfoListSort(
                 .infoList = lstNewP(sizeof(StorageInfo), .comparator = lstComparatorStr),
             };
 
+            TimeUSec timeBegin = statProfileBegin();
             result = storageInterfaceInfoListP(
                 this->driver, path, level, storageInfoListSortCallback, &data, .expression = expression);
+            statProfileEnd(timeBegin, "storage.%s.list.usec", strZ(this->type));
+
             lstSort(data.infoList, sortOrder);
 
             MEM_CONTEXT_TEMP_RESET_BEGIN()
@@ -577,7 +590,11 @@ storageMove(const Storage *this, StorageRead *source, StorageWrite *destination)
     MEM_CONTEXT_TEMP_BEGIN()
     {
         // If the file can't be moved it will need to be copied
-        if (!storageInterfaceMoveP(this->driver, source, destination))
+        TimeUSec timeBegin = statProfileBegin();
+        bool moved = storageInterfaceMoveP(this->driver, source, destination);
+        statProfileEnd(timeBegin, "storage.%s.move.usec", strZ(this->type));
+
+        if (!moved)
         {
             // Perform the copy
             storageCopyP(source, destination);
@@ -606,11 +623,12 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         FUNCTION_LOG_PARAM(STRING, fileExp);
         FUNCTION_LOG_PARAM(BOOL, param.ignoreMissing);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(storageFeature(this, storageFeatureLimitRead) || param.limit == NULL);
+    ASSERT(storageFeature(this, storageFeatureLimitRead) || (param.offset == 0 && param.limit == NULL));
     ASSERT(param.limit == NULL || varType(param.limit) == varTypeUInt64);
 
     StorageRead *result = NULL;
@@ -620,7 +638,7 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         result = storageReadMove(
             storageInterfaceNewReadP(
                 this->driver, storagePathP(this, fileExp), param.ignoreMissing, .compressible = param.compressible,
-                .limit = param.limit),
+                .offset = param.offset, .limit = param.limit),
             memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
@@ -645,6 +663,7 @@ storageNewWrite(const Storage *this, const String *fileExp, StorageNewWriteParam
         FUNCTION_LOG_PARAM(BOOL, param.noSyncPath);
         FUNCTION_LOG_PARAM(BOOL, param.noAtomic);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(BOOL, param.sparse);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
@@ -659,7 +678,8 @@ storageNewWrite(const Storage *this, const String *fileExp, StorageNewWriteParam
                 this->driver, storagePathP(this, fileExp), .modeFile = param.modeFile != 0 ? param.modeFile : this->modeFile,
                 .modePath = param.modePath != 0 ? param.modePath : this->modePath, .user = param.user, .group = param.group,
                 .timeModified = param.timeModified, .createPath = !param.noCreatePath, .syncFile = !param.noSyncFile,
-                .syncPath = !param.noSyncPath, .atomic = !param.noAtomic, .compressible = param.compressible),
+                .syncPath = !param.noSyncPath, .atomic = !param.noAtomic, .compressible = param.compressible,
+                .sparse = param.sparse),
             memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
@@ -790,8 +810,12 @@ storagePathCreate(const Storage *this, const String *pathExp, StoragePathCreateP
         String *path = storagePathP(this, pathExp);
 
         // Call driver function
+        TimeUSec timeBegin = statProfileBegin();
+
         storageInterfacePathCreateP(
             this->driver, path, param.errorOnExists, param.noParentCreate, param.mode != 0 ? param.mode : this->modePath);
+
+        statProfileEnd(timeBegin, "storage.%s.pathCreate.usec", strZ(this->type));
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -839,10 +863,12 @@ storagePathRemove(const Storage *this, const String *pathExp, StoragePathRemoveP
         String *path = storagePathP(this, pathExp);
 
         // Call driver function
-        if (!storageInterfacePathRemoveP(this->driver, path, param.recurse) && param.errorOnMissing)
-        {
+        TimeUSec timeBegin = statProfileBegin();
+        bool removed = storageInterfacePathRemoveP(this->driver, path, param.recurse);
+        statProfileEnd(timeBegin, "storage.%s.pathRemove.usec", strZ(this->type));
+
+        if (!removed && param.errorOnMissing)
             THROW_FMT(PathRemoveError, STORAGE_ERROR_PATH_REMOVE_MISSING, strZ(path));
-        }
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -850,22 +876,26 @@ storagePathRemove(const Storage *this, const String *pathExp, StoragePathRemoveP
 }
 
 /**********************************************************************************************************************************/
-void storagePathSync(const Storage *this, const String *pathExp)
+void storagePathSync(const Storage *this, const String *pathExp, StoragePathSyncParam param)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STORAGE, this);
         FUNCTION_LOG_PARAM(STRING, pathExp);
+        FUNCTION_LOG_PARAM(BOOL, param.fileSystem);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(this->write);
+    ASSERT(!param.fileSystem || storageFeature(this, storageFeaturePathSyncFs));
 
     // Not all storage requires path sync so just do nothing if the function is not implemented
     if (this->interface.pathSync != NULL)
     {
         MEM_CONTEXT_TEMP_BEGIN()
         {
-            storageInterfacePathSyncP(this->driver, storagePathP(this, pathExp));
+            TimeUSec timeBegin = statProfileBegin();
+            storageInterfacePathSyncP(this->driver, storagePathP(this, pathExp), .fileSystem = param.fileSystem);
+            statProfileEnd(timeBegin, "storage.%s.pathSync.usec", strZ(this->type));
         }
         MEM_CONTEXT_TEMP_END();
     }
@@ -910,7 +940,9 @@ storageRemove(const Storage *this, const String *fileExp, StorageRemoveParam par
         String *file = storagePathP(this, fileExp);
 
         // Call driver function
+        TimeUSec timeBegin = statProfileBegin();
         storageInterfaceRemoveP(this->driver, file, .errorOnMissing = param.errorOnMissing);
+        statProfileEnd(timeBegin, "storage.%s.remove.usec", strZ(this->type));
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -45,7 +45,7 @@ typedef enum
     // Does the storage support hardlinks?  Hardlinks allow the same file to be linked into multiple paths to save space.
     storageFeatureHardLink,
 
-    // Can the storage limit the amount of data read from a file?
+    // Can the storage read a range of a file, i.e. start reading at an offset and limit the amount of data read?
     storageFeatureLimitRead,
 
     // Does the storage support symlinks?  Symlinks allow paths/files/links to be accessed from another path.
@@ -53,6 +53,9 @@ typedef enum
 
     // Does the storage support detailed info, i.e. user, group, mode, link destination, etc.
     storageFeatureInfoDetail,
+
+    // Can all files on the filesystem containing a path be synced at once?  storageFeaturePathSync must also be enabled.
+    storageFeaturePathSyncFs,
 } StorageFeature;
 
 /***********************************************************************************************************************************
@@ -149,6 +152,9 @@ typedef struct StorageNewReadParam
     bool ignoreMissing;
     bool compressible;
 
+    // Where to start reading in the file
+    uint64_t offset;
+
     // Limit bytes to read from the file (must be varTypeUInt64). NULL for no limit.
     const Variant *limit;
 } StorageNewReadParam;
@@ -167,6 +173,7 @@ typedef struct StorageNewWriteParam
     bool noSyncPath;
     bool noAtomic;
     bool compressible;
+    bool sparse;
     mode_t modeFile;
     mode_t modePath;
     time_t timeModified;
@@ -225,10 +232,16 @@ typedef struct StoragePathRemoveParam
 void storagePathRemove(const Storage *this, const String *pathExp, StoragePathRemoveParam param);
 
 // Sync a path
-#define storagePathSyncP(this, pathExp)                                                                                            \
-    storagePathSync(this, pathExp)
+typedef struct StoragePathSyncParam
+{
+    VAR_PARAM_HEADER;
+    bool fileSystem;                                                // Sync all files on the filesystem containing the path
+} StoragePathSyncParam;
+
+#define storagePathSyncP(this, pathExp, ...)                                                                                       \
+    storagePathSync(this, pathExp, (StoragePathSyncParam){VAR_PARAM_INIT, __VA_ARGS__})
 
-void storagePathSync(const Storage *this, const String *pathExp);
+void storagePathSync(const Storage *this, const String *pathExp, StoragePathSyncParam param);
 
 // Write a buffer to storage
 #define storagePutP(file, buffer)                                                                                                  \
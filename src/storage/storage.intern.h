@@ -30,6 +30,7 @@ Error messages
 #define STORAGE_ERROR_READ_CLOSE                                    "unable to close file '%s' after read"
 #define STORAGE_ERROR_READ_OPEN                                     "unable to open file '%s' for read"
 #define STORAGE_ERROR_READ_MISSING                                  "unable to open missing file '%s' for read"
+#define STORAGE_ERROR_READ_SEEK                                     "unable to seek to %" PRIu64 " in file '%s'"
 
 #define STORAGE_ERROR_INFO                                          "unable to get info for path/file '%s'"
 #define STORAGE_ERROR_INFO_MISSING                                  "unable to get info for missing path/file '%s'"
@@ -89,6 +90,9 @@ typedef struct StorageInterfaceNewReadParam
     // Is the file compressible? This is used when the file must be moved across a network and temporary compression is helpful.
     bool compressible;
 
+    // Where to start reading in the file
+    uint64_t offset;
+
     // Limit bytes read from the file. NULL for no limit.
     const Variant *limit;
 } StorageInterfaceNewReadParam;
@@ -131,6 +135,10 @@ typedef struct StorageInterfaceNewWriteParam
 
     // Is the file compressible?  This is used when the file must be moved across a network and temporary compression is helpful.
     bool compressible;
+
+    // Can zero-filled blocks be skipped to create a sparse file?  This is a hint that storage which does not support sparse files
+    // is free to ignore.
+    bool sparse;
 } StorageInterfaceNewWriteParam;
 
 typedef StorageWrite *StorageInterfaceNewWrite(void *thisVoid, const String *file, StorageInterfaceNewWriteParam param);
@@ -227,6 +235,9 @@ typedef void StorageInterfacePathCreate(
 typedef struct StorageInterfacePathSyncParam
 {
     VAR_PARAM_HEADER;
+
+    // Sync all files on the filesystem containing the path. Only valid when the driver has the storageFeaturePathSyncFs feature.
+    bool fileSystem;
 } StorageInterfacePathSyncParam;
 
 typedef void StorageInterfacePathSync(void *thisVoid, const String *path, StorageInterfacePathSyncParam param);
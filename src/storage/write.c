@@ -6,6 +6,7 @@ Storage Write Interface
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/stat.h"
 #include "common/type/object.h"
 #include "storage/write.intern.h"
 
@@ -56,6 +57,14 @@ storageWriteNew(void *driver, const StorageWriteInterface *interface)
         .io = ioWriteNew(driver, interface->ioInterface),
     };
 
+    // Profile driver io by storage type
+    if (statProfile())
+    {
+        String *profile = strNewFmt("storage.%s.write", strZ(interface->type));
+        ioWriteProfileSet(this->io, profile);
+        strFree(profile);
+    }
+
     FUNCTION_LOG_RETURN(STORAGE_WRITE, this);
 }
 
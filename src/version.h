@@ -20,6 +20,12 @@ repository will be invalid unless migration functions are written.
 ***********************************************************************************************************************************/
 #define REPOSITORY_FORMAT                                           5
 
+/***********************************************************************************************************************************
+Format Number for manifests that have files referencing a file with a different name in a prior backup.  Versions that only know
+REPOSITORY_FORMAT will refuse to load these manifests rather than look for files in the prior backup that were never written.
+***********************************************************************************************************************************/
+#define REPOSITORY_FORMAT_REFERENCE_NAME                            6
+
 /***********************************************************************************************************************************
 Software version.  Currently this value is maintained in Version.pm and updated by test.pl.
 ***********************************************************************************************************************************/
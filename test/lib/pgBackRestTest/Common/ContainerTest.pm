@@ -378,6 +378,12 @@ sub containerBuild
             }
         }
 
+        # Add deflate development libs when available
+        if (vmWithDeflate($strOS))
+        {
+            $strScript .= $oVm->{$strOS}{&VM_OS_BASE} eq VM_OS_BASE_RHEL ? ' libdeflate-devel' : ' libdeflate-dev';
+        }
+
         # Add zst command-line tool and development libs when available
         if (vmWithZst($strOS))
         {
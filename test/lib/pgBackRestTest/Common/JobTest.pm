@@ -450,6 +450,8 @@ sub run
                 my $strBuildAutoH =
                     "#define HAVE_STATIC_ASSERT\n" .
                     "#define HAVE_BUILTIN_TYPES_COMPATIBLE_P\n" .
+                    "#define HAVE_SYNCFS\n" .
+                    (vmWithDeflate($self->{oTest}->{&TEST_VM}) ? '#define HAVE_LIBDEFLATE' : '') . "\n" .
                     (vmWithLz4($self->{oTest}->{&TEST_VM}) ? '#define HAVE_LIBLZ4' : '') . "\n" .
                     (vmWithZst($self->{oTest}->{&TEST_VM}) ? '#define HAVE_LIBZST' : '') . "\n";
 
@@ -531,6 +533,7 @@ sub run
                     "HARNESSFLAGS=${strHarnessFlags}\n" .
                     "TESTFLAGS=${strTestFlags}\n" .
                     "LDFLAGS=-lcrypto -lssl -lxml2 -lz -lbz2" .
+                        (vmWithDeflate($self->{oTest}->{&TEST_VM}) ? ' -ldeflate' : '') .
                         (vmWithLz4($self->{oTest}->{&TEST_VM}) ? ' -llz4' : '') .
                         (vmWithZst($self->{oTest}->{&TEST_VM}) ? ' -lzstd' : '') .
                         (vmCoverageC($self->{oTest}->{&TEST_VM}) && $self->{bCoverageUnit} ? " -lgcov" : '') .
@@ -49,6 +49,8 @@ use constant VMDEF_LCOV_VERSION                                     => 'lcov-ver
     push @EXPORT, qw(VMDEF_LCOV_VERSION);
 use constant VMDEF_WITH_BACKTRACE                                   => 'with-backtrace';
     push @EXPORT, qw(VMDEF_WITH_BACKTRACE);
+use constant VMDEF_WITH_DEFLATE                                     => 'with-deflate';
+    push @EXPORT, qw(VMDEF_WITH_DEFLATE);
 use constant VMDEF_WITH_LZ4                                         => 'with-lz4';
     push @EXPORT, qw(VMDEF_WITH_LZ4);
 use constant VMDEF_WITH_ZST                                         => 'with-zst';
@@ -191,6 +193,7 @@ my $oyVm =
         &VMDEF_COVERAGE_C => true,
 
         &VMDEF_DEBUG_INTEGRATION => false,
+        &VMDEF_WITH_DEFLATE => true,
         &VMDEF_WITH_ZST => true,
 
         &VM_DB =>
@@ -550,6 +553,18 @@ sub vmWithBackTrace
 
 push @EXPORT, qw(vmWithBackTrace);
 
+####################################################################################################################################
+# Does the VM support libdeflate?
+####################################################################################################################################
+sub vmWithDeflate
+{
+    my $strVm = shift;
+
+    return (defined($oyVm->{$strVm}{&VMDEF_WITH_DEFLATE}) ? $oyVm->{$strVm}{&VMDEF_WITH_DEFLATE} : false);
+}
+
+push @EXPORT, qw(vmWithDeflate);
+
 ####################################################################################################################################
 # Does the VM support liblz4?
 ####################################################################################################################################
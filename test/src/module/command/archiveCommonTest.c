@@ -274,6 +274,9 @@ testRun(void)
                 strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz")),
             NULL);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("uncached find lists only the segment");
+
         TEST_ERROR(
             walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678"), 0),
             ArchiveDuplicateError,
@@ -281,10 +284,120 @@ testRun(void)
                 " 123456781234567812345678-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
                 ", 123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz"
                 "\nHINT: are multiple primaries archiving to this stanza?");
+        TEST_RESULT_PTR(walSegmentCache.pathList, NULL, "cache not used");
 
         TEST_RESULT_STR(
             walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678.partial"), 0), NULL,
             "did not find partial segment");
+
+        storageRemoveP(
+            storageTest,
+            strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz"),
+            .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("cached listing is used until the cache is cleared");
+
+        TEST_RESULT_STR_Z(
+            walSegmentCacheFind(0, strNew("9.6-2"), strNew("123456781234567812345678"), 0),
+            "123456781234567812345678-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "found segment");
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz")),
+            NULL);
+
+        TEST_RESULT_STR_Z(
+            walSegmentCacheFind(0, strNew("9.6-2"), strNew("123456781234567812345678"), 0),
+            "123456781234567812345678-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "found cached segment");
+
+        walSegmentCacheAdd(0, strNew("9.6-2"), strNew("123456781234567812345679-cccccccccccccccccccccccccccccccccccccccc"));
+        walSegmentCacheAdd(0, strNew("9.6-2"), strNew("123456781234567812345679-cccccccccccccccccccccccccccccccccccccccc"));
+        walSegmentCacheAdd(0, strNew("9.6-3"), strNew("123456781234567812345679-cccccccccccccccccccccccccccccccccccccccc"));
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/123456781234567812345679-cccccccccccccccccccccccccccccccccccccccc")),
+            NULL);
+
+        TEST_RESULT_STRLST_Z(
+            walSegmentCacheFindList(0, strNew("9.6-2"), strNew("123456781234567812345679")),
+            "123456781234567812345679-cccccccccccccccccccccccccccccccccccccccc\n", "found segment added to cache");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("cached segment is not checked for existence");
+
+        storageRemoveP(
+            storageTest,
+            strNew("archive/db/9.6-2/1234567812345678/123456781234567812345679-cccccccccccccccccccccccccccccccccccccccc"),
+            .errorOnMissing = true);
+
+        TEST_RESULT_STRLST_Z(
+            walSegmentCacheFindList(0, strNew("9.6-2"), strNew("123456781234567812345679")),
+            "123456781234567812345679-cccccccccccccccccccccccccccccccccccccccc\n", "removed segment found in cache");
+
+        walSegmentCacheAdd(0, strNew("9.6-2"), strNew("123456781234567812345679-eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee.gz"));
+
+        TEST_RESULT_STRLST_Z(
+            walSegmentCacheFindList(0, strNew("9.6-2"), strNew("123456781234567812345679")),
+            "123456781234567812345679-eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee.gz\n", "added segment replaces removed segment");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("segment missing from the cached listing is listed and added to the cache");
+
+        TEST_RESULT_STRLST_Z(
+            walSegmentCacheFindList(0, strNew("9.6-2"), strNew("12345678123456781234567A")), NULL, "segment not found");
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/12345678123456781234567A-dddddddddddddddddddddddddddddddddddddddd.gz")),
+            NULL);
+
+        TEST_RESULT_STRLST_Z(
+            walSegmentCacheFindList(0, strNew("9.6-2"), strNew("12345678123456781234567A")),
+            "12345678123456781234567A-dddddddddddddddddddddddddddddddddddddddd.gz\n", "segment found");
+        TEST_RESULT_BOOL(
+            strLstExists(
+                ((WalSegmentCachePath *)lstGetLast(walSegmentCache.pathList))->fileList,
+                STRDEF("12345678123456781234567A-dddddddddddddddddddddddddddddddddddddddd.gz")),
+            true, "segment added to cache");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("listing is reloaded after the cache is cleared");
+
+        walSegmentCacheClear();
+
+        TEST_ERROR(
+            walSegmentCacheFind(0, strNew("9.6-2"), strNew("123456781234567812345678"), 0),
+            ArchiveDuplicateError,
+            "duplicates found in archive for WAL segment 123456781234567812345678:"
+                " 123456781234567812345678-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+                ", 123456781234567812345678-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz"
+                "\nHINT: are multiple primaries archiving to this stanza?");
+
+        TEST_RESULT_STR(
+            walSegmentCacheFind(0, strNew("9.6-2"), strNew("123456781234567812345678.partial"), 0), NULL,
+            "did not find partial segment");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("least recently used path is removed when the cache is full");
+
+        for (unsigned int pathIdx = 1; pathIdx < WAL_SEGMENT_CACHE_MAX; pathIdx++)
+            walSegmentCacheFind(0, strNew("9.6-2"), strNewFmt("12345678%08X12345678", pathIdx), 0);
+
+        // Search the first path again so it is not the least recently used
+        walSegmentCacheFindList(0, strNew("9.6-2"), strNew("123456781234567812345679"));
+        walSegmentCacheFind(0, strNew("9.6-2"), strNewFmt("12345678%08X12345678", WAL_SEGMENT_CACHE_MAX), 0);
+
+        TEST_RESULT_UINT(lstSize(walSegmentCache.pathList), WAL_SEGMENT_CACHE_MAX, "cache is full");
+        TEST_RESULT_STR_Z(
+            ((WalSegmentCachePath *)lstGet(walSegmentCache.pathList, 0))->path, "9.6-2/1234567800000002", "oldest path");
+
+        walSegmentCacheClear();
+        walSegmentCacheClear();
     }
 
     // *****************************************************************************************************************************
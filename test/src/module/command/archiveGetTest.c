@@ -488,6 +488,21 @@ testRun(void)
             storageInfoP(storageTest, STRDEF(TEST_PATH_PG "/pg_wal/RECOVERYXLOG")).size, 16 * 1024 * 1024, "check size");
         TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("get WAL segment for the archive server");
+
+        TEST_RESULT_BOOL(
+            archiveGetServerFile(STRDEF("01ABCDEF01ABCDEF01ABCDEF"), STRDEF(TEST_PATH_PG "/pg_wal/RECOVERYXLOG")), true, "get");
+        TEST_RESULT_BOOL(
+            archiveGetServerFile(STRDEF("01ABCDEF01ABCDEF01ABCDEF"), STRDEF(TEST_PATH_PG "/pg_wal/RECOVERYXLOG")), true,
+            "get with cached archive info");
+
+        harnessLogResult(
+            "P00   INFO: found 01ABCDEF01ABCDEF01ABCDEF in the repo1:10-1 archive\n"
+            "P00   INFO: found 01ABCDEF01ABCDEF01ABCDEF in the repo1:10-1 archive");
+
+        TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("error on duplicate WAL segment");
 
@@ -501,6 +516,15 @@ testRun(void)
                 " 01ABCDEF01ABCDEF01ABCDEF-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\n"
             "HINT: are multiple primaries archiving to this stanza?");
 
+        // Archive info cached by the archive server is freed on error
+        TEST_ERROR(
+            archiveGetServerFile(STRDEF("01ABCDEF01ABCDEF01ABCDEF"), STRDEF(TEST_PATH_PG "/pg_wal/RECOVERYXLOG")),
+            ArchiveDuplicateError,
+            "duplicates found in the repo1:10-1 archive for WAL segment 01ABCDEF01ABCDEF01ABCDEF:"
+                " 01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa,"
+                " 01ABCDEF01ABCDEF01ABCDEF-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\n"
+            "HINT: are multiple primaries archiving to this stanza?");
+
         TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", NULL);
         TEST_STORAGE_REMOVE(
             storageRepoWrite(), STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF01ABCDEF-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb");
@@ -6,6 +6,7 @@ Test Archive Push Command
 #include "common/io/fdRead.h"
 #include "common/io/fdWrite.h"
 #include "common/time.h"
+#include "common/wait.h"
 #include "postgres/version.h"
 #include "storage/posix/storage.h"
 
@@ -60,6 +61,8 @@ testRun(void)
             storageNewWriteP(storageSpoolWrite(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000006.error")), NULL);
         storagePutP(
             storageNewWriteP(storageSpoolWrite(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/global.error")), NULL);
+        storagePutP(
+            storageNewWriteP(storageSpoolWrite(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/repo2.lag")), NULL);
 
         // Create ready files for wal that still needs to be archived
         storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/archive_status/000000010000000100000002.ready")), NULL);
@@ -73,7 +76,7 @@ testRun(void)
 
         TEST_RESULT_STRLST_Z(
             strLstSort(storageListP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc),
-            "000000010000000100000003.ok\n", "remaining status list");
+            "000000010000000100000003.ok\nrepo2.lag\n", "remaining status list");
 
         // Test drop
         // -------------------------------------------------------------------------------------------------------------------------
@@ -441,9 +444,11 @@ testRun(void)
         varLstAdd(paramList, varNewStrZ("000000010000000100000002"));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewInt(6));
+        varLstAdd(paramList, varNewUInt64(16 * 1024 * 1024));
         varLstAdd(paramList, varNewStrZ("11-1"));
         varLstAdd(paramList, varNewUInt64(cipherTypeNone));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewBool(false));
 
         TEST_RESULT_BOOL(
             archivePushProtocol(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR, paramList, server), true, "protocol archive put");
@@ -548,6 +553,167 @@ testRun(void)
             "            WAL file '000000010000000100000002' already exists in the repo3 archive with the same checksum\n"
             "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
             "P00   INFO: pushed WAL file '000000010000000100000002' to the archive");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL to repo2 and queue it for repo3");
+
+        hrnCfgArgRawBool(argListTemp, cfgOptArchiveAsync, true);
+        hrnCfgArgRawFmt(argListTemp, cfgOptSpoolPath, "%s/spool", testPath());
+        hrnCfgEnvKeyRawZ(cfgOptRepoCipherPass, 2, "badpassphrase");
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+        hrnCfgEnvKeyRemoveRaw(cfgOptRepoCipherPass, 2);
+
+        const String *walQueueFile = strNewFmt("000000010000000100000002-%s", walBuffer2Sha1);
+        const String *walRepo2File = strNewFmt("repo2/archive/test/11-1/0000000100000001/%s", strZ(walQueueFile));
+        const String *walRepo3File = strNewFmt("repo3/archive/test/11-1/0000000100000001/%s", strZ(walQueueFile));
+
+        storageRemoveP(storageTest, walRepo2File, .errorOnMissing = true);
+        storageRemoveP(storageTest, walRepo3File, .errorOnMissing = true);
+
+        ArchivePushFileRepoData repoData[] =
+        {
+            {.archiveId = STRDEF("11-1"), .cipherType = cipherTypeAes256Cbc, .cipherPass = STRDEF("badsubpassphrase")},
+            {.archiveId = STRDEF("11-1"), .cipherType = cipherTypeNone, .queue = true},
+        };
+
+        TEST_RESULT_STR(
+            archivePushFile(
+                strNewFmt("%s/pg/pg_wal/000000010000000100000002", testPath()), PG_VERSION_11, 0xFACEFACEFACEFACE,
+                STRDEF("000000010000000100000002"), compressTypeNone, 0, 0, repoData, false),
+            NULL, "push WAL");
+
+        TEST_RESULT_BOOL(storageExistsP(storageTest, walRepo2File), true, "check repo2 for WAL file");
+        TEST_RESULT_BOOL(storageExistsP(storageTest, walRepo3File), false, "check repo3 for no WAL file");
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadP(storageSpool(), strNewFmt(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3/%s", strZ(walQueueFile)))),
+                walBuffer2),
+            true, "check queued WAL file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push queued WAL to repo3");
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(walQueueFile));
+        varLstAdd(paramList, varNewUInt(1));
+        varLstAdd(paramList, varNewStrZ("11-1"));
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));
+
+        TEST_RESULT_BOOL(
+            archivePushProtocol(PROTOCOL_COMMAND_ARCHIVE_PUSH_QUEUE_STR, paramList, server), true, "protocol archive push queue");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":null}\n", "check result");
+
+        bufUsedSet(serverWrite, 0);
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, walRepo3File)), walBuffer2), true, "check repo3 WAL file");
+        TEST_RESULT_STRLST_Z(storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3")), NULL, "queue is empty");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queued WAL already exists in repo3");
+
+        TEST_RESULT_STR_Z(
+            archivePushFile(
+                strNewFmt("%s/pg/pg_wal/000000010000000100000002", testPath()), PG_VERSION_11, 0xFACEFACEFACEFACE,
+                STRDEF("000000010000000100000002"), compressTypeNone, 0, 16 * 1024 * 1024, repoData, true),
+            "WAL file '000000010000000100000002' already exists in the repo2 archive with the same checksum\n"
+                "HINT: this is valid in some recovery scenarios but may also indicate a problem.",
+            "push WAL");
+
+        TEST_RESULT_STR_Z(
+            archivePushQueueFile(walQueueFile, 1, STRDEF("11-1"), cipherTypeNone),
+            "WAL file '000000010000000100000002' already exists in the repo3 archive with the same checksum\n"
+                "HINT: this is valid in some recovery scenarios but may also indicate a problem.",
+            "push queued WAL");
+        TEST_RESULT_STRLST_Z(storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3")), NULL, "queue is empty");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queued WAL exists in repo3 with a different checksum");
+
+        const String *walQueueFileBad = STRDEF("000000010000000100000002-" "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+
+        storagePutP(
+            storageNewWriteP(storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3/%s", strZ(walQueueFileBad))),
+            walBuffer2);
+
+        TEST_ERROR(
+            archivePushQueueFile(walQueueFileBad, 1, STRDEF("11-1"), cipherTypeNone), ArchiveDuplicateError,
+            "WAL file '000000010000000100000002' already exists in the repo3 archive with a different checksum");
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3")), "000000010000000100000002-"
+                "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\n", "queued WAL is kept");
+
+        storagePathRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3"), .recurse = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("WAL larger than buffer max is streamed");
+
+        TEST_RESULT_STR_Z(
+            archivePushFile(
+                strNewFmt("%s/pg/pg_wal/000000010000000100000002", testPath()), PG_VERSION_11, 0xFACEFACEFACEFACE,
+                STRDEF("000000010000000100000002"), compressTypeNone, 0, 1, repoData, true),
+            "WAL file '000000010000000100000002' already exists in the repo2 archive with the same checksum\n"
+                "HINT: this is valid in some recovery scenarios but may also indicate a problem.",
+            "push WAL");
+
+        storagePathRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3"), .recurse = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("buffered WAL is smaller than the header");
+
+        const String *walShort = strNewFmt("%s/pg/pg_wal/000000010000000100000003", testPath());
+        storagePutP(storageNewWriteP(storageTest, walShort), BUFSTRDEF("BOGUS"));
+
+        TEST_ERROR_FMT(
+            archivePushFile(
+                walShort, PG_VERSION_11, 0xFACEFACEFACEFACE, STRDEF("000000010000000100000003"), compressTypeNone, 0,
+                16 * 1024 * 1024, repoData, true),
+            FileReadError, "unable to read 512 byte(s) from '%s'", strZ(walShort));
+
+        storageRemoveP(storageTest, walShort, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queue history file for encrypted repo2 and push it");
+
+        storagePutP(storageNewWriteP(storageTest, STRDEF("pg/pg_wal/00000002.history")), BUFSTRDEF("HISTORY"));
+
+        ArchivePushFileRepoData repoDataQueue[] =
+        {
+            {
+                .archiveId = STRDEF("11-1"), .cipherType = cipherTypeAes256Cbc, .cipherPass = STRDEF("badsubpassphrase"),
+                .queue = true,
+            },
+            {.archiveId = NULL},
+        };
+
+        TEST_RESULT_STR(
+            archivePushFile(
+                strNewFmt("%s/pg/pg_wal/00000002.history", testPath()), PG_VERSION_11, 0xFACEFACEFACEFACE,
+                STRDEF("00000002.history"), compressTypeNone, 0, 0, repoDataQueue, true),
+            NULL, "queue history file");
+
+        StorageRead *historyQueueRead = storageNewReadP(
+            storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo2/00000002.history"));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(historyQueueRead)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("badsubpassphrase"), NULL));
+
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(historyQueueRead)), "HISTORY", "queued history file is encrypted");
+        TEST_RESULT_BOOL(
+            storageExistsP(storageTest, STRDEF("repo2/archive/test/11-1/00000002.history")), false,
+            "history file is not in repo2");
+
+        TEST_RESULT_STR(
+            archivePushQueueFile(STRDEF("00000002.history"), 0, STRDEF("11-1"), cipherTypeAes256Cbc), NULL,
+            "push queued history file");
+        TEST_RESULT_STRLST_Z(storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo2")), NULL, "queue is empty");
+
+        StorageRead *historyRead = storageNewReadP(storageTest, STRDEF("repo2/archive/test/11-1/00000002.history"));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(historyRead)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("badsubpassphrase"), NULL));
+
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(historyRead)), "HISTORY", "check repo2 history file");
     }
 
     // *****************************************************************************************************************************
@@ -756,8 +922,10 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("add repo, push already pushed WAL and new WAL");
 
-        // Add repo3
+        // Add repo3 and queue WAL for it. Keep an argument list without the queue for a later test.
         hrnCfgArgKeyRawFmt(argList, cfgOptRepoPath, 3, "%s/repo3", testPath());
+        StringList *argListNoQueue = strLstDup(argList);
+        hrnCfgArgRawBool(argList, cfgOptArchivePushRepoQueue, true);
         harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argList);
 
         storagePutP(
@@ -794,20 +962,23 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             storageExistsP(
-                storageTest, strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s", walBuffer1Sha1)),
-            true, "check repo1 for WAL 1 file");
-
-        TEST_RESULT_BOOL(
-            storageExistsP(
-                storageTest, strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s", walBuffer1Sha1)),
-            true, "check repo3 for WAL 1 file");
+                storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s", walBuffer1Sha1)),
+            false, "WAL 1 file is not in repo3 because queued files are not pushed after a WAL error");
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3")),
+            strZ(strNewFmt("000000010000000100000001-%s\n", walBuffer1Sha1)), "WAL 1 file is queued for repo3");
 
         TEST_RESULT_STRLST_Z(
             strLstSort(storageListP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc),
-            "000000010000000100000001.ok\n000000010000000100000002.error\n", "check status files");
+            "000000010000000100000001.ok\n000000010000000100000002.error\nrepo3.lag\n", "check status files");
+
+        TEST_RESULT_BOOL(
+            strBeginsWithZ(
+                strNewBuf(storageGetP(storageNewReadP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/repo3.lag")))), "1\n"),
+            true, "check repo3 lag");
 
         // -------------------------------------------------------------------------------------------------------------------------
-        TEST_TITLE("create and push previously missing WAL");
+        TEST_TITLE("create and push previously missing WAL and queued WAL");
 
         // Create WAL 2 segment
         Buffer *walBuffer2 = bufNew((size_t)16 * 1024 * 1024);
@@ -825,20 +996,31 @@ testRun(void)
         TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
         harnessLogResult(
             "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000002\n"
-            "P01 DETAIL: pushed WAL file '000000010000000100000002' to the archive");
+            "P01 DETAIL: pushed WAL file '000000010000000100000002' to the archive\n"
+            "P02 DETAIL: pushed queued WAL file '000000010000000100000001' to the repo3 archive\n"
+            "P02 DETAIL: pushed queued WAL file '000000010000000100000002' to the repo3 archive");
 
         TEST_RESULT_BOOL(
             storageExistsP(
                 storageTest, strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1)),
             true, "check repo1 for WAL 2 file");
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s", walBuffer1Sha1)),
+            true, "check repo3 for WAL 1 file");
         TEST_RESULT_BOOL(
             storageExistsP(
                 storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1)),
             true, "check repo3 for WAL 2 file");
+        TEST_RESULT_STRLST_Z(storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3")), NULL, "queue is empty");
 
         TEST_RESULT_STRLST_Z(
             strLstSort(storageListP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc),
-            "000000010000000100000001.ok\n000000010000000100000002.ok\n", "check status files");
+            "000000010000000100000001.ok\n000000010000000100000002.ok\nrepo3.lag\n", "check status files");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/repo3.lag")))), "0\n0",
+            "check repo3 lag");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("push wal 2 again to get warnings from both repos");
@@ -851,12 +1033,20 @@ testRun(void)
             "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000002\n"
             "P01   WARN: WAL file '000000010000000100000002' already exists in the repo1 archive with the same checksum\n"
             "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
-            "            WAL file '000000010000000100000002' already exists in the repo3 archive with the same checksum\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000002' to the archive\n"
+            "P02   WARN: WAL file '000000010000000100000002' already exists in the repo3 archive with the same checksum\n"
             "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
-            "P01 DETAIL: pushed WAL file '000000010000000100000002' to the archive");
+            "P02 DETAIL: pushed queued WAL file '000000010000000100000002' to the repo3 archive");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                storageGetP(storageNewReadP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000002.ok")))),
+            "0\nWAL file '000000010000000100000002' already exists in the repo1 archive with the same checksum\n"
+                "HINT: this is valid in some recovery scenarios but may also indicate a problem.",
+            "only the first repo gates the status");
 
         // -------------------------------------------------------------------------------------------------------------------------
-        TEST_TITLE("create and push WAL 3 to both repos");
+        TEST_TITLE("failing repo does not hold up the first repo");
 
         // Create WAL 3 segment
         Buffer *walBuffer3 = bufNew((size_t)16 * 1024 * 1024);
@@ -870,19 +1060,105 @@ testRun(void)
         // Create ready file
         storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000003.ready")), NULL);
 
+        // Put WAL 3 with a different checksum in repo3 so the queued push fails
+        const String *walRepo3Bad = STRDEF(
+            "repo3/archive/test/9.4-1/0000000100000001/000000010000000100000003-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+        storagePutP(storageNewWriteP(storageTest, walRepo3Bad), walBuffer3);
+
         TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
         harnessLogResult(
             "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000003\n"
-            "P01 DETAIL: pushed WAL file '000000010000000100000003' to the archive");
+            "P01 DETAIL: pushed WAL file '000000010000000100000003' to the archive\n"
+            "P02   WARN: could not push queued WAL file '000000010000000100000003' to the repo3 archive (will be retried): [45]"
+                " raised from local-2 protocol: WAL file '000000010000000100000003' already exists in the repo3 archive with a"
+                " different checksum");
 
         TEST_RESULT_BOOL(
             storageExistsP(
                 storageTest, strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000003-%s", walBuffer3Sha1)),
             true, "check repo1 for WAL 3 file");
+        TEST_RESULT_STRLST_Z(
+            strLstSort(storageListP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc),
+            "000000010000000100000001.ok\n000000010000000100000002.ok\n000000010000000100000003.ok\nrepo3.lag\n",
+            "check status files");
+
+        StringList *lagList = strLstNewSplitZ(
+            strNewBuf(storageGetP(storageNewReadP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/repo3.lag")))), "\n");
+
+        TEST_RESULT_UINT(strLstSize(lagList), 4, "check repo3 lag lines");
+        TEST_RESULT_STR_Z(strLstGet(lagList, 0), "1", "check repo3 queued files");
+        TEST_RESULT_STR_Z(strLstGet(lagList, 2), "45", "check repo3 error code");
+        TEST_RESULT_STR_Z(
+            strLstGet(lagList, 3),
+            "raised from local-2 protocol: WAL file '000000010000000100000003' already exists in the repo3 archive with a"
+                " different checksum",
+            "check repo3 error message");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("failed repo is retried when more WAL is pushed");
+
+        storageRemoveP(storageTest, walRepo3Bad, .errorOnMissing = true);
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000003.ok"));
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
+        harnessLogResult(
+            "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000003\n"
+            "P01   WARN: WAL file '000000010000000100000003' already exists in the repo1 archive with the same checksum\n"
+            "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000003' to the archive\n"
+            "P02 DETAIL: pushed queued WAL file '000000010000000100000003' to the repo3 archive");
+
         TEST_RESULT_BOOL(
             storageExistsP(
                 storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000003-%s", walBuffer3Sha1)),
             true, "check repo3 for WAL 3 file");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/repo3.lag")))), "0\n0",
+            "check repo3 lag");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("all repos gate the status when the repo queue is disabled");
+
+        // Replace WAL 3 in repo3 with a different checksum so the push to repo3 fails
+        storageRemoveP(
+            storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000003-%s", walBuffer3Sha1),
+            .errorOnMissing = true);
+        storagePutP(storageNewWriteP(storageTest, walRepo3Bad), walBuffer3);
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000003.ok"));
+
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argListNoQueue);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
+        harnessLogResult(
+            "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000003\n"
+            "P01   WARN: could not push WAL file '000000010000000100000003' to the archive (will be retried): [45] raised from"
+                " local-1 protocol: WAL file '000000010000000100000003' already exists in the repo3 archive with a different"
+                " checksum");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                storageGetP(storageNewReadP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000003.error")))),
+            "45\nraised from local-1 protocol: WAL file '000000010000000100000003' already exists in the repo3 archive with a"
+                " different checksum",
+            "failed repo3 push is an error");
+
+        storageRemoveP(storageTest, walRepo3Bad, .errorOnMissing = true);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
+        harnessLogResult(
+            "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000003\n"
+            "P01   WARN: WAL file '000000010000000100000003' already exists in the repo1 archive with the same checksum\n"
+            "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000003' to the archive");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000003-%s", walBuffer3Sha1)),
+            true, "check repo3 for WAL 3 file");
+        TEST_RESULT_STRLST_Z(storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_QUEUE "/repo3")), NULL, "nothing queued");
+        TEST_RESULT_BOOL(
+            storageExistsP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000003.ok")), true,
+            "status is ok once all repos have the WAL");
 
         // Remove the ready file to prevent WAL 3 from being considered for the next test
         storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000003.ready"), .errorOnMissing = true);
@@ -918,5 +1194,133 @@ testRun(void)
             "000000010000000100000001.ok\n000000010000000100000002.ok\n", "check status files");
         }
 
+    // *****************************************************************************************************************************
+    if (testBegin("archiveServerExecute(), cmdArchiveServer(), and archivePushServerFile()"))
+    {
+        TEST_TITLE("create pg_control, archive.info, and WAL");
+
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("pg/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL)),
+            pgControlTestToBuffer((PgControl){.version = PG_VERSION_11, .systemId = 0xFACEFACEFACEFACE}));
+
+        storagePutP(
+            storageNewWriteP(storageTest, strNew("repo/archive/test/archive.info")),
+            harnessInfoChecksumZ(
+                "[db]\n"
+                "db-id=1\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-id\":18072658121562454734,\"db-version\":\"11\"}\n"));
+
+        Buffer *walBuffer = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer, bufSize(walBuffer));
+        memset(bufPtr(walBuffer), 0, bufSize(walBuffer));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_11, .systemId = 0xFACEFACEFACEFACE}, walBuffer);
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_wal/000000010000000100000001")), walBuffer);
+
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--" CFGOPT_STANZA "=test");
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAddZ(argList, "--" CFGOPT_ARCHIVE_SERVER);
+
+        StringList *argListWal = strLstDup(argList);
+        strLstAdd(argListWal, strNewFmt("%s/pg/pg_wal/000000010000000100000001", testPath()));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL using the archive server");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argList);
+                storagePathCreateP(storageLocalWrite(), cfgOptionStr(cfgOptLockPath));
+
+                TEST_RESULT_VOID(cmdArchiveServer(archiveModePush, 1), "archive server");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                harnessCfgLoad(cfgCmdArchivePush, argListWal);
+
+                // Wait for the server to create the socket
+                const String *socketPath = strNewFmt("%s/test-archive-push.sock", strZ(cfgOptionStr(cfgOptLockPath)));
+                Wait *wait = waitNew(5000);
+
+                while (!storageInfoP(storageLocal(), socketPath, .ignoreMissing = true).exists && waitMore(wait));
+
+                TEST_RESULT_VOID(cmdArchivePush(), "push WAL");
+                harnessLogResultRegExp(
+                    "P01   INFO: archive server listening on '.*/lock/test-archive-push.sock'\n"
+                    "P00   INFO: pushed WAL file '000000010000000100000001' to the archive using the archive server");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageTest, strNew("repo/archive/test/11-1/0000000100000001")),
+            TEST_64BIT() ?
+                "000000010000000100000001-aae7591a1dbc58f21d0d004886075094f622e6dd.gz\n" :
+                "000000010000000100000001-28a13fd8cf6fcd9f9a8108aed4c8bcc58040863a.gz\n",
+            "check repo for WAL file");
+        TEST_RESULT_BOOL(
+            storageInfoP(
+                storageLocal(), strNewFmt("%s/test-archive-push.sock", strZ(cfgOptionStr(cfgOptLockPath))),
+                .ignoreMissing = true).exists,
+            false,
+            "socket removed on exit");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("archive info is cached until there is an error");
+
+        const String *walFile = strNewFmt("%s/pg/pg_wal/000000010000000100000001", testPath());
+
+        TEST_RESULT_STR_Z(
+            archivePushServerFile(walFile),
+            "WAL file '000000010000000100000001' already exists in the repo1 archive with the same checksum"
+                "\nHINT: this is valid in some recovery scenarios but may also indicate a problem.",
+            "push duplicate");
+
+        storageRemoveP(storageTest, strNew("repo/archive/test/archive.info"), .errorOnMissing = true);
+
+        TEST_RESULT_STR_Z(
+            archivePushServerFile(walFile),
+            "WAL file '000000010000000100000001' already exists in the repo1 archive with the same checksum"
+                "\nHINT: this is valid in some recovery scenarios but may also indicate a problem.",
+            "push with cached archive info");
+
+        storagePutP(storageNewWriteP(storageTest, strNew("pg/pg_wal/000000010000000100000001")), BUFSTRDEF("BOGUS"));
+
+        TEST_ERROR_FMT(
+            archivePushServerFile(walFile), FileReadError, "unable to read 512 byte(s) from '%s'", strZ(walFile));
+
+        TEST_ERROR_FMT(
+            archivePushServerFile(walFile), FileMissingError,
+            "unable to load info file '%s/repo/archive/test/archive.info' or '%s/repo/archive/test/archive.info.copy':\n"
+            "FileMissingError: unable to open missing file '%s/repo/archive/test/archive.info' for read\n"
+            "FileMissingError: unable to open missing file '%s/repo/archive/test/archive.info.copy' for read\n"
+            "HINT: archive.info cannot be opened but is required to push/get WAL segments.\n"
+            "HINT: is archive_command configured correctly in postgresql.conf?\n"
+            "HINT: has a stanza-create been performed?\n"
+            "HINT: use --no-archive-check to disable archive checks during backup if you have an alternate archiving scheme.",
+            testPath(), testPath(), testPath(), testPath());
+
+        TEST_ERROR_FMT(
+            archivePushServerFile(walFile), FileMissingError,
+            "unable to load info file '%s/repo/archive/test/archive.info' or '%s/repo/archive/test/archive.info.copy':\n"
+            "FileMissingError: unable to open missing file '%s/repo/archive/test/archive.info' for read\n"
+            "FileMissingError: unable to open missing file '%s/repo/archive/test/archive.info.copy' for read\n"
+            "HINT: archive.info cannot be opened but is required to push/get WAL segments.\n"
+            "HINT: is archive_command configured correctly in postgresql.conf?\n"
+            "HINT: has a stanza-create been performed?\n"
+            "HINT: use --no-archive-check to disable archive checks during backup if you have an alternate archiving scheme.",
+            testPath(), testPath(), testPath(), testPath());
+        TEST_RESULT_PTR(archivePushLocal.memContext, NULL, "failed check is not cached");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -242,6 +242,8 @@ typedef struct TestBackupPqScriptParam
     bool startFast;
     bool backupStandby;
     bool errorAfterStart;
+    bool precopy;                                                   // Copy files while waiting for the backup to start
+    bool precopyWait;                                               // Pre-copy completes before the backup starts
     bool noWal;                                                     // Don't write test WAL segments
     CompressType walCompressType;                                   // Compress type for the archive files
     unsigned int walTotal;                                          // Total WAL to write
@@ -381,7 +383,7 @@ testBackupPqScript(unsigned int pgVersion, time_t backupTimeStart, TestBackupPqS
     // -----------------------------------------------------------------------------------------------------------------------------
     else if (pgVersion == PG_VERSION_11)
     {
-        ASSERT(!param.backupStandby);
+        ASSERT(!param.backupStandby || param.precopy);
 
         if (param.errorAfterStart)
         {
@@ -406,6 +408,112 @@ testBackupPqScript(unsigned int pgVersion, time_t backupTimeStart, TestBackupPqS
                 HRNPQ_MACRO_DONE()
             });
         }
+        else if (param.precopy && param.backupStandby)
+        {
+            harnessPqScriptSet((HarnessPq [])
+            {
+                // Connect to primary
+                HRNPQ_MACRO_OPEN_GE_96(1, "dbname='postgres' port=5432", PG_VERSION_11, pg1Path, false, NULL, NULL),
+
+                // Connect to standby
+                HRNPQ_MACRO_OPEN_GE_96(2, "dbname='postgres' port=5433", PG_VERSION_11, pg2Path, true, NULL, NULL),
+
+                // Get start time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000),
+
+                // Build pre-copy manifest
+                HRNPQ_MACRO_TABLESPACE_LIST_1(1, 32768, "tblspc32768"),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 999),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 1000),
+
+                // Start backup and pre-copy until the backup has started and the standby has caught up
+                HRNPQ_MACRO_ADVISORY_LOCK(1, true),
+                HRNPQ_MACRO_START_BACKUP_POLL_GE_10(1, param.startFast, lsnStartStr, walSegmentStart),
+                HRNPQ_MACRO_DATABASE_LIST_1(1, "test1"),
+                HRNPQ_MACRO_TABLESPACE_LIST_1(1, 32768, "tblspc32768"),
+                HRNPQ_MACRO_REPLAY_WAIT_POLL_GE_10(2, lsnStartStr),
+
+                // Get copy start time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 1999),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 2000),
+
+                // Stop backup
+                HRNPQ_MACRO_STOP_BACKUP_GE_10(1, lsnStopStr, walSegmentStop, false),
+
+                // Get stop time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 3000),
+
+                HRNPQ_MACRO_DONE()
+            });
+        }
+        else if (param.precopy && param.precopyWait)
+        {
+            harnessPqScriptSet((HarnessPq [])
+            {
+                // Connect to primary
+                HRNPQ_MACRO_OPEN_GE_96(1, "dbname='postgres' port=5432", PG_VERSION_11, pg1Path, false, NULL, NULL),
+
+                // Get start time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000),
+
+                // Build pre-copy manifest
+                HRNPQ_MACRO_TABLESPACE_LIST_1(1, 32768, "tblspc32768"),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 999),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 1000),
+
+                // Start backup and pre-copy all files before the backup has started
+                HRNPQ_MACRO_ADVISORY_LOCK(1, true),
+                HRNPQ_MACRO_START_BACKUP_POLL_WAIT_GE_10(1, param.startFast, lsnStartStr, walSegmentStart),
+                HRNPQ_MACRO_DATABASE_LIST_1(1, "test1"),
+                HRNPQ_MACRO_TABLESPACE_LIST_1(1, 32768, "tblspc32768"),
+
+                // Get copy start time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 1999),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 2000),
+
+                // Stop backup
+                HRNPQ_MACRO_STOP_BACKUP_GE_10(1, lsnStopStr, walSegmentStop, false),
+
+                // Get stop time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 3000),
+
+                HRNPQ_MACRO_DONE()
+            });
+        }
+        else if (param.precopy)
+        {
+            harnessPqScriptSet((HarnessPq [])
+            {
+                // Connect to primary
+                HRNPQ_MACRO_OPEN_GE_96(1, "dbname='postgres' port=5432", PG_VERSION_11, pg1Path, false, NULL, NULL),
+
+                // Get start time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000),
+
+                // Build pre-copy manifest
+                HRNPQ_MACRO_TABLESPACE_LIST_1(1, 32768, "tblspc32768"),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 999),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 1000),
+
+                // Start backup and pre-copy until the backup has started
+                HRNPQ_MACRO_ADVISORY_LOCK(1, true),
+                HRNPQ_MACRO_START_BACKUP_POLL_GE_10(1, param.startFast, lsnStartStr, walSegmentStart),
+                HRNPQ_MACRO_DATABASE_LIST_1(1, "test1"),
+                HRNPQ_MACRO_TABLESPACE_LIST_1(1, 32768, "tblspc32768"),
+
+                // Get copy start time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 1999),
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 2000),
+
+                // Stop backup
+                HRNPQ_MACRO_STOP_BACKUP_GE_10(1, lsnStopStr, walSegmentStop, false),
+
+                // Get stop time
+                HRNPQ_MACRO_TIME_QUERY(1, (int64_t)backupTimeStart * 1000 + 3000),
+
+                HRNPQ_MACRO_DONE()
+            });
+        }
         else
         {
             harnessPqScriptSet((HarnessPq [])
@@ -494,7 +602,7 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                missingFile, true, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
+                missingFile, true, 0, true, NULL, NULL, false, 0, missingFile, false, compressTypeNone, 1, 0, backupLabel, false,
                 cipherTypeNone, NULL),
             "pg file missing, ignoreMissing=true, no delta");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy/repo size 0");
@@ -508,14 +616,17 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(0));              // pgFileSize
         varLstAdd(paramList, varNewBool(true));             // pgFileCopyExactSize
         varLstAdd(paramList, NULL);                         // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumDedup
         varLstAdd(paramList, varNewBool(false));            // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit
         varLstAdd(paramList, varNewStr(missingFile));       // repoFile
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone)); // repoFileCompress
         varLstAdd(paramList, varNewInt(0));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt64(0));              // repoFileCompressFrameSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
@@ -527,7 +638,7 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ERROR_FMT(
             backupFile(
-                missingFile, false, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
+                missingFile, false, 0, true, NULL, NULL, false, 0, missingFile, false, compressTypeNone, 1, 0, backupLabel, false,
                 cipherTypeNone, NULL),
             FileMissingError, "unable to open missing file '%s/pg/missing' for read", testPath());
 
@@ -549,7 +660,7 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9999999, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false,
+                pgFile, false, 9999999, true, NULL, NULL, false, 0, pgFile, false, compressTypeNone, 1, 0, backupLabel, false,
                 cipherTypeNone, NULL),
             "pg file exists and shrunk, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
@@ -577,8 +688,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                pgFile, false, 9, true, NULL, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, compressTypeNone, 1, 0, backupLabel,
+                false, cipherTypeNone, NULL),
             "file checksummed with pageChecksum enabled");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -600,14 +711,17 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(8));              // pgFileSize
         varLstAdd(paramList, varNewBool(false));            // pgFileCopyExactSize
         varLstAdd(paramList, NULL);                         // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumDedup
         varLstAdd(paramList, varNewBool(true));             // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0xFFFFFFFFFFFFFFFF)); // pgFileChecksumPageLsnLimit
         varLstAdd(paramList, varNewStr(pgFile));            // repoFile
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone)); // repoFileCompress
         varLstAdd(paramList, varNewInt(1));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt64(0));              // repoFileCompressFrameSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
@@ -623,8 +737,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, pgFile, true,
+                compressTypeNone, 1, 0, backupLabel, true, cipherTypeNone, NULL),
             "file in db and repo, checksum equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 0, "    repo size not set since already exists in repo");
@@ -634,6 +748,31 @@ testRun(void)
                 storageExistsP(storageRepo(), backupPathFile) && result.pageChecksumResult == NULL),
             true, "    noop");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        // File matches one of the prior file checksums, delta set, hasReference - NOOP with the matching checksum
+        StringList *checksumDedup = strLstNew();
+        strLstAddZ(checksumDedup, "1234567890123456789012345678901234567890");
+        strLstAddZ(checksumDedup, "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, checksumDedup, false, 0, pgFile, true, compressTypeNone, 1, 0, backupLabel, true,
+                cipherTypeNone, NULL),
+            "file in db matches prior file checksum, delta, hasReference");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultNoOp, "    noop file");
+        TEST_RESULT_STR_Z(result.copyChecksum, "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "    matching checksum");
+
+        strLstRemoveIdx(checksumDedup, 1);
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, checksumDedup, false, 0, pgFile, true, compressTypeNone, 1, 0, backupLabel, true,
+                cipherTypeNone, NULL),
+            "file in db does not match prior file checksum, delta, hasReference");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
         // pgFileChecksum, hasReference, delta
@@ -643,14 +782,17 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(12));             // pgFileSize
         varLstAdd(paramList, varNewBool(false));            // pgFileCopyExactSize
         varLstAdd(paramList, varNewStrZ("c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9"));   // pgFileChecksum
+        varLstAdd(paramList, varNewVarLst(varLstNewStrLst(checksumDedup)));             // pgFileChecksumDedup
         varLstAdd(paramList, varNewBool(false));            // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit
         varLstAdd(paramList, varNewStr(pgFile));            // repoFile
         varLstAdd(paramList, varNewBool(true));             // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone)); // repoFileCompress
         varLstAdd(paramList, varNewInt(1));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt64(0));              // repoFileCompressFrameSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(true));             // delta
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
@@ -664,8 +806,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), NULL, false, 0, pgFile, true,
+                compressTypeNone, 1, 0, backupLabel, true, cipherTypeNone, NULL),
             "file in db and repo, pg checksum not equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -679,8 +821,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9999999, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                pgFile, false, 9999999, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, pgFile, true,
+                compressTypeNone, 1, 0, backupLabel, true, cipherTypeNone, NULL),
             "db & repo file, pg checksum same, pg size different, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 24, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -696,8 +838,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, STRDEF(BOGUS_STR), false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, STRDEF(BOGUS_STR),
+                false, compressTypeNone, 1, 0, backupLabel, true, cipherTypeNone, NULL),
             "backup file");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    check copy result");
@@ -714,8 +856,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, pgFile, false,
+                compressTypeNone, 1, 0, backupLabel, true, cipherTypeNone, NULL),
             "    db & repo file, pgFileMatch, repo checksum no match, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    recopy file");
@@ -732,8 +874,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                missingFile, true, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                missingFile, true, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, pgFile, false,
+                compressTypeNone, 1, 0, backupLabel, true, cipherTypeNone, NULL),
             "    file in repo only, checksum in repo equal, ignoreMissing=true, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=0 size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -746,7 +888,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, backupLabel, false, cipherTypeNone, NULL),
+                pgFile, false, 9, true, NULL, NULL, false, 0, pgFile, false, compressTypeGz, 3, 0, backupLabel, false,
+                cipherTypeNone, NULL),
             "pg file exists, no checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -763,8 +906,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, compressTypeGz,
-                3, backupLabel, false, cipherTypeNone, NULL),
+                pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, pgFile, false,
+                compressTypeGz, 3, 0, backupLabel, false, cipherTypeNone, NULL),
             "pg file & repo exists, match, checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -785,14 +928,17 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(9));              // pgFileSize
         varLstAdd(paramList, varNewBool(true));             // pgFileCopyExactSize
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));   // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumDedup
         varLstAdd(paramList, varNewBool(false));            // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit
         varLstAdd(paramList, varNewStr(pgFile));            // repoFile
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeGz));   // repoFileCompress
         varLstAdd(paramList, varNewInt(3));                 // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt64(0));              // repoFileCompressFrameSize
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
 
         TEST_RESULT_BOOL(
@@ -809,8 +955,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                strNew("zerofile"), false, 0, true, NULL, false, 0, strNew("zerofile"), false, compressTypeNone, 1, backupLabel,
-                false, cipherTypeNone, NULL),
+                strNew("zerofile"), false, 0, true, NULL, NULL, false, 0, strNew("zerofile"), false, compressTypeNone, 1, 0,
+                backupLabel, false, cipherTypeNone, NULL),
             "zero-sized pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=pgFile size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -850,8 +996,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false, cipherTypeAes256Cbc,
-                strNew("12345678")),
+                pgFile, false, 9, true, NULL, NULL, false, 0, pgFile, false, compressTypeNone, 1, 0, backupLabel, false,
+                cipherTypeAes256Cbc, strNew("12345678")),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -867,8 +1013,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 8, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeAes256Cbc, strNew("12345678")),
+                pgFile, false, 8, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, pgFile, false,
+                compressTypeNone, 1, 0, backupLabel, true, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, pgFileMatch false, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 8, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -884,8 +1030,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, false,
-                compressTypeNone, 0, backupLabel, false, cipherTypeAes256Cbc, strNew("12345678")),
+                pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), NULL, false, 0, pgFile, false,
+                compressTypeNone, 0, 0, backupLabel, false, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, repo checksum no match, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -904,14 +1050,17 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(9));                  // pgFileSize
         varLstAdd(paramList, varNewBool(true));                 // pgFileCopyExactSize
         varLstAdd(paramList, varNewStrZ("1234567890123456789012345678901234567890"));   // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumDedup
         varLstAdd(paramList, varNewBool(false));                // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));                  // pgFileChecksumPageLsnLimit
         varLstAdd(paramList, varNewStr(pgFile));                // repoFile
         varLstAdd(paramList, varNewBool(false));                // repoFileHasReference
         varLstAdd(paramList, varNewUInt(compressTypeNone));     // repoFileCompress
         varLstAdd(paramList, varNewInt(0));                     // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt64(0));                  // repoFileCompressFrameSize
         varLstAdd(paramList, varNewStr(backupLabel));           // backupLabel
         varLstAdd(paramList, varNewBool(false));                // delta
+        varLstAdd(paramList, varNewUInt(cipherTypeAes256Cbc)); // cipherType
         varLstAdd(paramList, varNewStrZ("12345678"));           // cipherPass
 
         TEST_RESULT_BOOL(
@@ -1267,7 +1416,7 @@ testRun(void)
 
         storagePathCreateP(storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F"));
 
-        TEST_RESULT_PTR(backupResumeFind((Manifest *)1, NULL), NULL, "find resumable backup");
+        TEST_RESULT_PTR(backupResumeFind((Manifest *)1, NULL, false), NULL, "find resumable backup");
 
         TEST_RESULT_LOG(
             "P00   WARN: backup '20191003-105320F' cannot be resumed: partially deleted by prior resume or invalid");
@@ -1284,7 +1433,7 @@ testRun(void)
                 storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" BACKUP_MANIFEST_FILE INFO_COPY_EXT)),
             NULL);
 
-        TEST_RESULT_PTR(backupResumeFind((Manifest *)1, NULL), NULL, "find resumable backup");
+        TEST_RESULT_PTR(backupResumeFind((Manifest *)1, NULL, false), NULL, "find resumable backup");
 
         TEST_RESULT_LOG(
             "P00   WARN: backup '20191003-105320F' cannot be resumed: resume is disabled");
@@ -1317,7 +1466,7 @@ testRun(void)
         manifest->data.backupType = backupTypeFull;
         manifest->data.backrestVersion = STRDEF("BOGUS");
 
-        TEST_RESULT_PTR(backupResumeFind(manifest, NULL), NULL, "find resumable backup");
+        TEST_RESULT_PTR(backupResumeFind(manifest, NULL, false), NULL, "find resumable backup");
 
         TEST_RESULT_LOG(
             "P00   WARN: backup '20191003-105320F' cannot be resumed:"
@@ -1340,7 +1489,7 @@ testRun(void)
                 storageNewWriteP(
                     storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" BACKUP_MANIFEST_FILE INFO_COPY_EXT))));
 
-        TEST_RESULT_PTR(backupResumeFind(manifest, NULL), NULL, "find resumable backup");
+        TEST_RESULT_PTR(backupResumeFind(manifest, NULL, false), NULL, "find resumable backup");
 
         TEST_RESULT_LOG(
             "P00   WARN: backup '20191003-105320F' cannot be resumed:"
@@ -1363,7 +1512,7 @@ testRun(void)
                 storageNewWriteP(
                     storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" BACKUP_MANIFEST_FILE INFO_COPY_EXT))));
 
-        TEST_RESULT_PTR(backupResumeFind(manifest, NULL), NULL, "find resumable backup");
+        TEST_RESULT_PTR(backupResumeFind(manifest, NULL, false), NULL, "find resumable backup");
 
         TEST_RESULT_LOG(
             "P00   WARN: backup '20191003-105320F' cannot be resumed:"
@@ -1385,7 +1534,7 @@ testRun(void)
                 storageNewWriteP(
                     storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191003-105320F/" BACKUP_MANIFEST_FILE INFO_COPY_EXT))));
 
-        TEST_RESULT_PTR(backupResumeFind(manifest, NULL), NULL, "find resumable backup");
+        TEST_RESULT_PTR(backupResumeFind(manifest, NULL, false), NULL, "find resumable backup");
 
         TEST_RESULT_LOG(
             "P00   WARN: backup '20191003-105320F' cannot be resumed:"
@@ -1409,7 +1558,7 @@ testRun(void)
         ProtocolParallelJob *job = protocolParallelJobNew(VARSTRDEF("key"), protocolCommandNew(STRDEF("command")));
         protocolParallelJobErrorSet(job, errorTypeCode(&AssertError), STRDEF("error message"));
 
-        TEST_ERROR(backupJobResult((Manifest *)1, NULL, STRDEF("log"), strLstNew(), job, 0, 0), AssertError, "error message");
+        TEST_ERROR(backupJobResult((Manifest *)1, NULL, NULL, STRDEF("log"), strLstNew(), job, 0, 0), AssertError, "error message");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("report host/100% progress on noop result");
@@ -1428,12 +1577,55 @@ testRun(void)
 
         // Create manifest with file
         Manifest *manifest = manifestNewInternal();
-        manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF("pg_data/test")});
+        manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF("pg_data/test"), .reference = STRDEF("20190101-010101F")});
 
         TEST_RESULT_UINT(
-            backupJobResult(manifest, STRDEF("host"), STRDEF("log-test"), strLstNew(), job, 0, 0), 0, "log noop result");
+            backupJobResult(manifest, NULL, STRDEF("host"), STRDEF("log-test"), strLstNew(), job, 0, 0), 0, "log noop result");
 
         TEST_RESULT_LOG("P00 DETAIL: match file from prior backup host:log-test (0B, 100%)");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("reference prior file with a different name on noop result");
+
+        job = protocolParallelJobNew(VARSTRDEF("pg_data/base/2/3"), protocolCommandNew(STRDEF("command")));
+
+        result = varLstNew();
+        varLstAdd(result, varNewUInt64(backupCopyResultNoOp));
+        varLstAdd(result, varNewUInt64(8192));
+        varLstAdd(result, varNewUInt64(0));
+        varLstAdd(result, varNewStrZ("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
+        varLstAdd(result, NULL);
+
+        protocolParallelJobResultSet(job, varNewVarLst(result));
+
+        manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF("pg_data/base/2/3"), .size = 8192});
+
+        List *priorList = lstNewP(sizeof(ManifestFileDedupPrior), .comparator = lstComparatorZ);
+        lstAdd(
+            priorList,
+            &(ManifestFileDedupPrior){
+                .checksumSha1 = "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb", .reference = STRDEF("20190101-010101F"),
+                .referenceName = STRDEF("pg_data/base/1/2"), .sizeRepo = 98});
+        lstAdd(
+            priorList,
+            &(ManifestFileDedupPrior){
+                .checksumSha1 = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", .reference = STRDEF("20190101-010101F"),
+                .referenceName = STRDEF("pg_data/base/1/3"), .sizeRepo = 99});
+
+        List *dedupList = lstNewP(sizeof(ManifestFileDedup), .comparator = lstComparatorStr);
+        lstAdd(dedupList, &(ManifestFileDedup){.name = STRDEF("pg_data/base/2/3"), .priorList = priorList});
+
+        TEST_RESULT_UINT(
+            backupJobResult(manifest, dedupList, NULL, STRDEF("base/2/3"), strLstNew(), job, 8192, 0), 8192, "log noop result");
+
+        TEST_RESULT_LOG(
+            "P00 DETAIL: match file from prior backup base/2/3 to pg_data/base/1/3 (8KB, 100%) checksum"
+                " aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+
+        const ManifestFile *file = manifestFileFind(manifest, STRDEF("pg_data/base/2/3"));
+        TEST_RESULT_STR_Z(file->reference, "20190101-010101F", "check reference");
+        TEST_RESULT_STR_Z(file->referenceName, "pg_data/base/1/3", "check reference name");
+        TEST_RESULT_UINT(file->sizeRepo, 99, "check repo size");
     }
 
     // Offline tests should only be used to test offline functionality and errors easily tested in offline mode
@@ -2577,6 +2769,137 @@ testRun(void)
             // Remove test files
             storagePathRemoveP(storagePgWrite(), STRDEF("base/1"), .recurse = true);
         }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("online 11 full backup with pre-copy");
+
+        backupTimeStart = BACKUP_EPOCH + 2500000;
+
+        {
+            // Load options
+            StringList *argList = strLstNew();
+            strLstAddZ(argList, "--" CFGOPT_STANZA "=test1");
+            hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+            hrnCfgArgRaw(argList, cfgOptPgPath, pg1Path);
+            hrnCfgArgRawZ(argList, cfgOptRepoRetentionFull, "1");
+            strLstAddZ(argList, "--" CFGOPT_TYPE "=" BACKUP_TYPE_FULL);
+            hrnCfgArgRawBool(argList, cfgOptBackupPrecopy, true);
+            harnessCfgLoad(cfgCmdBackup, argList);
+
+            // Update pg_control timestamp so it would be pre-copied if it were not excluded
+            THROW_ON_SYS_ERROR(
+                utime(
+                    strZ(storagePathP(storagePg(), STRDEF("global/pg_control"))),
+                    &(struct utimbuf){.actime = backupTimeStart - 1, .modtime = backupTimeStart - 1}) != 0, FileWriteError,
+                "unable to set time");
+
+            // Run backup. The backup starts before PG_VERSION is pre-copied.
+            testBackupPqScriptP(PG_VERSION_11, backupTimeStart, .precopy = true);
+            TEST_RESULT_VOID(cmdBackup(), "backup");
+
+            TEST_RESULT_LOG(
+                "P00   INFO: execute non-exclusive pg_start_backup(): backup begins after the next regular checkpoint completes\n"
+                "P00   INFO: pre-copy up to 2 file(s) (13B) while waiting for the backup to start\n"
+                "P00   INFO: backup start archive = 0000000105DBA72000000000, lsn = 5dba720/0\n"
+                "P00 DETAIL: backup started, stop pre-copy\n"
+                "P01   INFO: backup file {[path]}/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
+                "P00   INFO: check files pre-copied to backup 20191031-053320F -- remove changed files and resume\n"
+                "P01   INFO: backup file {[path]}/pg1/global/pg_control (8KB, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: checksum resumed file {[path]}/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
+                "P01   INFO: backup file {[path]}/pg1/PG_VERSION (2B, [PCT]) checksum [SHA1]\n"
+                "P01   INFO: backup file {[path]}/pg1/pg_tblspc/32768/PG_11_201809051/1/5 (0B, [PCT])\n"
+                "P00   INFO: full backup size = [SIZE]\n"
+                "P00   INFO: execute non-exclusive pg_stop_backup() and wait for all WAL segments to archive\n"
+                "P00   INFO: backup stop archive = 0000000105DBA72000000000, lsn = 5dba720/80000\n"
+                "P00 DETAIL: wrote 'backup_label' file returned from pg_stop_backup()\n"
+                "P00   INFO: check archive for segment(s) 0000000105DBA72000000000:0000000105DBA72000000000\n"
+                "P00   INFO: new backup label = 20191031-053320F");
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("online 11 backup-standby full backup with pre-copy");
+
+        backupTimeStart = BACKUP_EPOCH + 2600000;
+
+        {
+            // Load options
+            StringList *argList = strLstNew();
+            strLstAddZ(argList, "--" CFGOPT_STANZA "=test1");
+            hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+            hrnCfgArgKeyRaw(argList, cfgOptPgPath, 1, pg1Path);
+            hrnCfgArgKeyRaw(argList, cfgOptPgPath, 2, pg2Path);
+            hrnCfgArgKeyRawZ(argList, cfgOptPgPort, 2, "5433");
+            hrnCfgArgRawZ(argList, cfgOptRepoRetentionFull, "1");
+            strLstAddZ(argList, "--" CFGOPT_TYPE "=" BACKUP_TYPE_FULL);
+            strLstAddZ(argList, "--" CFGOPT_BACKUP_STANDBY);
+            hrnCfgArgRawBool(argList, cfgOptBackupPrecopy, true);
+            harnessCfgLoad(cfgCmdBackup, argList);
+
+            // Remove the replicated file so all files are copied from the primary and the log order is deterministic
+            storageRemoveP(storagePgWrite(), STRDEF("pg_tblspc/32768/PG_11_201809051/1/5"), .errorOnMissing = true);
+
+            // Run backup. PG_VERSION is pre-copied while waiting for replay on the standby.
+            testBackupPqScriptP(PG_VERSION_11, backupTimeStart, .precopy = true, .backupStandby = true);
+            TEST_RESULT_VOID(cmdBackup(), "backup");
+
+            TEST_RESULT_LOG(
+                "P00   INFO: execute non-exclusive pg_start_backup(): backup begins after the next regular checkpoint completes\n"
+                "P00   INFO: pre-copy up to 2 file(s) (13B) while waiting for the backup to start\n"
+                "P00   INFO: backup start archive = 0000000105DBBF8000000000, lsn = 5dbbf80/0\n"
+                "P00   INFO: wait for replay on the standby to reach 5dbbf80/0\n"
+                "P01   INFO: backup file {[path]}/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
+                "P00 DETAIL: backup started and standby replay caught up, stop pre-copy\n"
+                "P01   INFO: backup file {[path]}/pg1/PG_VERSION (2B, [PCT]) checksum [SHA1]\n"
+                "P00   INFO: replay on the standby reached 5dbbf80/0\n"
+                "P00   INFO: check files pre-copied to backup 20191101-092000F -- remove changed files and resume\n"
+                "P01   INFO: backup file {[path]}/pg1/global/pg_control (8KB, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: checksum resumed file {[path]}/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: checksum resumed file {[path]}/pg1/PG_VERSION (2B, [PCT]) checksum [SHA1]\n"
+                "P00   INFO: full backup size = [SIZE]\n"
+                "P00   INFO: execute non-exclusive pg_stop_backup() and wait for all WAL segments to archive\n"
+                "P00   INFO: backup stop archive = 0000000105DBBF8000000000, lsn = 5dbbf80/80000\n"
+                "P00 DETAIL: wrote 'backup_label' file returned from pg_stop_backup()\n"
+                "P00   INFO: check archive for segment(s) 0000000105DBBF8000000000:0000000105DBBF8000000000\n"
+                "P00   INFO: new backup label = 20191101-092000F");
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("online 11 full backup with pre-copy complete before the backup starts");
+
+        backupTimeStart = BACKUP_EPOCH + 2700000;
+
+        {
+            // Load options
+            StringList *argList = strLstNew();
+            strLstAddZ(argList, "--" CFGOPT_STANZA "=test1");
+            hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+            hrnCfgArgRaw(argList, cfgOptPgPath, pg1Path);
+            hrnCfgArgRawZ(argList, cfgOptRepoRetentionFull, "1");
+            strLstAddZ(argList, "--" CFGOPT_TYPE "=" BACKUP_TYPE_FULL);
+            hrnCfgArgRawBool(argList, cfgOptBackupPrecopy, true);
+            harnessCfgLoad(cfgCmdBackup, argList);
+
+            // Run backup. All files are pre-copied and keep-alives are sent until the backup starts.
+            testBackupPqScriptP(PG_VERSION_11, backupTimeStart, .precopy = true, .precopyWait = true);
+            TEST_RESULT_VOID(cmdBackup(), "backup");
+
+            TEST_RESULT_LOG(
+                "P00   INFO: execute non-exclusive pg_start_backup(): backup begins after the next regular checkpoint completes\n"
+                "P00   INFO: pre-copy up to 2 file(s) (13B) while waiting for the backup to start\n"
+                "P01   INFO: backup file {[path]}/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
+                "P01   INFO: backup file {[path]}/pg1/PG_VERSION (2B, [PCT]) checksum [SHA1]\n"
+                "P00   INFO: backup start archive = 0000000105DBD7F000000000, lsn = 5dbd7f0/0\n"
+                "P00   INFO: check files pre-copied to backup 20191102-130640F -- remove changed files and resume\n"
+                "P01   INFO: backup file {[path]}/pg1/global/pg_control (8KB, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: checksum resumed file {[path]}/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: checksum resumed file {[path]}/pg1/PG_VERSION (2B, [PCT]) checksum [SHA1]\n"
+                "P00   INFO: full backup size = [SIZE]\n"
+                "P00   INFO: execute non-exclusive pg_stop_backup() and wait for all WAL segments to archive\n"
+                "P00   INFO: backup stop archive = 0000000105DBD7F000000000, lsn = 5dbd7f0/80000\n"
+                "P00 DETAIL: wrote 'backup_label' file returned from pg_stop_backup()\n"
+                "P00   INFO: check archive for segment(s) 0000000105DBD7F000000000:0000000105DBD7F000000000\n"
+                "P00   INFO: new backup label = 20191102-130640F");
+        }
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -5,6 +5,8 @@ Test Common Command Routines
 #include <unistd.h>
 
 #include "common/stat.h"
+#include "common/type/json.h"
+#include "storage/posix/storage.h"
 #include "version.h"
 
 #include "common/harnessConfig.h"
@@ -131,6 +133,58 @@ testRun(void)
             "P00 DETAIL: statistics: {\"test\":{\"total\":1}}\n"
             "P00   INFO: restore command end: completed successfully");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("command end writes profile and metrics");
+
+        harnessLogLevelReset();
+
+        Storage *storageTest = storagePosixNewP(strNew(testPath()), .write = true);
+
+        TEST_RESULT_VOID(
+            cmdStatFileSet(strNewFmt("%s/test.profile.json", testPath()), strNewFmt("%s/test.prom", testPath())), "set stat files");
+
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end");
+        TEST_RESULT_LOG("P00   INFO: restore command end: completed successfully");
+
+        const KeyValue *profileKv = jsonToKv(strNewBuf(storageGetP(storageNewReadP(storageTest, STRDEF("test.profile.json")))));
+
+        TEST_RESULT_STR_Z(jsonFromKv(varKv(kvGet(profileKv, VARSTRDEF("test")))), "{\"total\":1}", "check counter");
+        TEST_RESULT_STR_Z(
+            jsonFromKv(varKv(kvGet(profileKv, VARSTRDEF("command.result")))), "{\"gauge\":0}", "check result gauge");
+        TEST_RESULT_BOOL(kvKeyExists(profileKv, VARSTRDEF("command.duration.msec")), true, "check duration gauge");
+        TEST_RESULT_BOOL(kvKeyExists(profileKv, VARSTRDEF("command.end.sec")), true, "check end gauge");
+
+        const String *metric = strNewBuf(storageGetP(storageNewReadP(storageTest, STRDEF("test.prom"))));
+
+        TEST_RESULT_BOOL(
+            strstr(
+                strZ(metric),
+                "# TYPE pgbackrest_test_total counter\n"
+                "pgbackrest_test_total{stanza=\"test\",command=\"restore\",role=\"default\"} 1\n") != NULL,
+            true, "check counter metric");
+        TEST_RESULT_BOOL(
+            strstr(
+                strZ(metric),
+                "# TYPE pgbackrest_command_result gauge\n"
+                "pgbackrest_command_result{stanza=\"test\",command=\"restore\",role=\"default\"} 0\n") != NULL,
+            true, "check result metric");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("command end warns when stats cannot be written");
+
+        storagePutP(storageNewWriteP(storageTest, STRDEF("file")), NULL);
+
+        TEST_RESULT_VOID(cmdStatFileSet(strNewFmt("%s/file/test.profile.json", testPath()), NULL), "set profile file");
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end");
+        TEST_RESULT_LOG_FMT(
+            "P00   INFO: restore command end: completed successfully\n"
+            "P00   WARN: unable to write stats: unable to open file '%s/file/test.profile.json' for write: [20] Not a directory",
+            testPath());
+
+        TEST_RESULT_VOID(cmdStatFileSet(NULL, NULL), "disable stat files");
+
+        harnessLogLevelSet(logLevelDetail);
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("switch to a new command so some options are not valid");
 
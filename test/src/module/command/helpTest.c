@@ -27,20 +27,22 @@ testRun(void)
         "    pgbackrest [options] [command]\n"
         "\n"
         "Commands:\n"
-        "    archive-get     Get a WAL segment from the archive.\n"
-        "    archive-push    Push a WAL segment to the archive.\n"
-        "    backup          Backup a database cluster.\n"
-        "    check           Check the configuration.\n"
-        "    expire          Expire backups that exceed retention.\n"
-        "    help            Get help.\n"
-        "    info            Retrieve information about backups.\n"
-        "    restore         Restore a database cluster.\n"
-        "    stanza-create   Create the required stanza data.\n"
-        "    stanza-delete   Delete a stanza.\n"
-        "    stanza-upgrade  Upgrade a stanza.\n"
-        "    start           Allow pgBackRest processes to run.\n"
-        "    stop            Stop pgBackRest processes from running.\n"
-        "    version         Get version.\n"
+        "    archive-get       Get a WAL segment from the archive.\n"
+        "    archive-push      Push a WAL segment to the archive.\n"
+        "    backup            Backup a database cluster.\n"
+        "    check             Check the configuration.\n"
+        "    expire            Expire backups that exceed retention.\n"
+        "    help              Get help.\n"
+        "    info              Retrieve information about backups.\n"
+        "    relation-restore  Restore relation files from a backup.\n"
+        "    restore           Restore a database cluster.\n"
+        "    server            Accept remote connections via TLS.\n"
+        "    stanza-create     Create the required stanza data.\n"
+        "    stanza-delete     Delete a stanza.\n"
+        "    stanza-upgrade    Upgrade a stanza.\n"
+        "    start             Allow pgBackRest processes to run.\n"
+        "    stop              Stop pgBackRest processes from running.\n"
+        "    version           Get version.\n"
         "\n"
         "Use 'pgbackrest help [command]' for more information.\n",
         helpVersion));
@@ -136,6 +138,10 @@ testRun(void)
             "                                   [current=/link1=/dest1, /link2=/dest2]\n"
             "  --recovery-option                set an option in recovery.conf\n"
             "  --set                            backup set to restore [default=latest]\n"
+            "  --sparse                         restore relation files as sparse files\n"
+            "                                   [default=n]\n"
+            "  --sync-batch                     sync the filesystem of each target after all\n"
+            "                                   files are restored [default=n]\n"
             "  --tablespace-map                 restore a tablespace into the specified\n"
             "                                   directory\n"
             "  --tablespace-map-all             restore all tablespaces into the specified\n"
@@ -152,7 +158,11 @@ testRun(void)
             "\n"
             "  --buffer-size                    buffer size for file operations\n"
             "                                   [current=32768, default=1048576]\n"
+            "  --cipher-compat                  decrypt aes-256-cbc files when aes-256-gcm\n"
+            "                                   is configured [default=n]\n"
             "  --cmd-ssh                        path to ssh client executable [default=ssh]\n"
+            "  --cmd-ssh-control-path           path where SSH connection sharing sockets\n"
+            "                                   are stored\n"
             "  --compress-level-network         network compression level [default=3]\n"
             "  --config                         pgBackRest configuration file\n"
             "                                   [default=/etc/pgbackrest/pgbackrest.conf]\n"
@@ -183,6 +193,8 @@ testRun(void)
             "                                   [default=/var/log/pgbackrest]\n"
             "  --log-subprocess                 enable logging in subprocesses [default=n]\n"
             "  --log-timestamp                  enable timestamp in logging [default=y]\n"
+            "  --metric-path                    path where metrics are stored\n"
+            "  --profile                        write profiling statistics [default=n]\n"
             "\n",
             "Repository Options:\n"
             "\n"
@@ -204,6 +216,8 @@ testRun(void)
             "                                   [current=aes-256-cbc, default=none]\n"
             "  --repo-host                      repository host when operating remotely via\n"
             "                                   SSH [current=backup.example.net]\n"
+            "  --repo-host-ca-file              repository host certificate authority file\n"
+            "  --repo-host-cert-file            repository host client certificate file\n"
             "  --repo-host-cmd                  pgBackRest exe path on the repository host\n"
             "                                   [default=/path/to/pgbackrest]\n"
             "  --repo-host-config               pgBackRest repository host configuration\n"
@@ -213,7 +227,9 @@ testRun(void)
             "                                   include path [default=/etc/pgbackrest/conf.d]\n"
             "  --repo-host-config-path          pgBackRest repository host configuration\n"
             "                                   path [default=/etc/pgbackrest]\n"
+            "  --repo-host-key-file             repository host client key file\n"
             "  --repo-host-port                 repository host port when repo-host is set\n"
+            "  --repo-host-type                 repository host protocol type [default=ssh]\n"
             "  --repo-host-user                 repository host user when repo-host is set\n"
             "                                   [default=pgbackrest]\n"
             "  --repo-path                      path where backups and archive are stored\n"
@@ -6,6 +6,8 @@ Test Restore Command
 #include "common/io/io.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "postgres/interface.h"
+#include "postgres/interface/static.vendor.h"
 #include "postgres/version.h"
 #include "storage/posix/storage.h"
 #include "storage/helper.h"
@@ -139,6 +141,35 @@ testManifestMinimal(const String *label, unsigned int pgVersion, const String *p
     FUNCTION_HARNESS_RESULT(MANIFEST, result);
 }
 
+/***********************************************************************************************************************************
+Check the targets and clean the paths in the current process. The paths are sorted by name so a path is always cleaned after the
+path that contains it.
+***********************************************************************************************************************************/
+static void
+testRestoreCleanBuild(Manifest *manifest)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(MANIFEST, manifest);
+    FUNCTION_HARNESS_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        List *cleanPathList = restoreCleanBuild(manifest);
+
+        for (unsigned int cleanPathIdx = 0; cleanPathIdx < lstSize(cleanPathList); cleanPathIdx++)
+        {
+            RestoreCleanPath *cleanPath = lstGet(cleanPathList, cleanPathIdx);
+            StringList *logList = restoreCleanPath(cleanPath->pgPath, cleanPath->entryList, cleanPath->fileIgnore);
+
+            for (unsigned int logIdx = 0; logIdx < strLstSize(logList); logIdx++)
+                LOG_DETAIL(strZ(strLstGet(logList, logIdx)));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -180,7 +211,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("sparse-zero"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), true, 0x10000000000UL, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, cipherTypeNone, NULL, true, false),
             false, "zero sparse 1TB file");
         TEST_RESULT_UINT(storageInfoP(storagePg(), strNew("sparse-zero")).size, 0x10000000000UL, "    check size");
 
@@ -188,7 +219,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("normal-zero"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, NULL),
+                strNew(testGroup()), 0, false, false, cipherTypeNone, NULL, true, false),
             true, "zero-length file");
         TEST_RESULT_UINT(storageInfoP(storagePg(), strNew("normal-zero")).size, 0, "    check size");
 
@@ -206,7 +237,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeGz, strNew("normal"),
                 strNew("ffffffffffffffffffffffffffffffffffffffff"), false, 7, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, strNew("badpass")),
+                strNew(testGroup()), 0, false, false, cipherTypeAes256Cbc, strNew("badpass"), true, false),
             ChecksumError,
             "error restoring 'normal': actual checksum 'd1cd8a7d11daa26814b93eb604e1d49ab4b43770' does not match expected checksum"
                 " 'ffffffffffffffffffffffffffffffffffffffff'");
@@ -221,8 +252,8 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeGz, strNew("normal"),
                 strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), false, 7, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, strNew("badpass")),
-            true, "copy file");
+                strNew(testGroup()), 0, false, false, cipherTypeAes256Cbc, strNew("badpass"), false, false),
+            true, "copy file without sync");
 
         StorageInfo info = storageInfoP(storagePg(), strNew("normal"));
         TEST_RESULT_BOOL(info.exists, true, "    check exists");
@@ -233,6 +264,16 @@ testRun(void)
         TEST_RESULT_STR_Z(info.group, testGroup(), "    check group");
         TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("normal")))), "acefile", "    check contents");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("aes-256-cbc file is rejected when aes-256-gcm is configured");
+
+        TEST_ERROR(
+            restoreFile(
+                repoFile1, repoFileReferenceFull, compressTypeGz, strNew("normal"),
+                strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), false, 7, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, false, false, cipherTypeAes256Gcm, strNew("badpass"), false, false),
+            CryptoError, "cipher header is aes-256-cbc but aes-256-gcm is required");
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Create a repo file
         storagePutP(
@@ -244,7 +285,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, cipherTypeNone, NULL, true, false),
             true, "sha1 delta missing");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -256,7 +297,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, cipherTypeNone, NULL, true, false),
             false, "sha1 delta existing");
 
         ioBufferSizeSet(oldBufferSize);
@@ -265,7 +306,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew(testGroup()), 1557432155, true, true, cipherTypeNone, NULL, true, false),
             false, "sha1 delta force existing");
 
         // Change the existing file so it no longer matches by size
@@ -275,7 +316,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, cipherTypeNone, NULL, true, false),
             true, "sha1 delta existing, size differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -286,7 +327,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew(testGroup()), 1557432155, true, true, cipherTypeNone, NULL, true, false),
             true, "delta force existing, size differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -298,7 +339,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, cipherTypeNone, NULL, true, false),
             true, "sha1 delta existing, content differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -309,14 +350,14 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew(testGroup()), 1557432155, true, true, cipherTypeNone, NULL, true, false),
             true, "delta force existing, timestamp differs");
 
         TEST_RESULT_BOOL(
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432153, true, true, NULL),
+                strNew(testGroup()), 1557432153, true, true, cipherTypeNone, NULL, true, false),
             true, "delta force existing, timestamp after copy time");
 
         // Change the existing file to zero-length
@@ -326,7 +367,7 @@ testRun(void)
             restoreFile(
                 repoFile1, repoFileReferenceFull, compressTypeNone, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, cipherTypeNone, NULL, true, false),
             false, "sha1 delta existing, content differs");
 
         // Check protocol function directly
@@ -346,7 +387,10 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(1557432200));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewBool(true));
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
         TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":true}\n", "    check result");
@@ -377,15 +421,99 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(1557432200));
         varLstAdd(paramList, varNewBool(true));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt(cipherTypeNone));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewBool(false));
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
         TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":false}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
+        // Check protocol clean path
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("clean/bogus")), NULL);
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("clean/file"), .modeFile = 0640), NULL);
+
+        VariantList *entryParam = varLstNew();
+        varLstAdd(entryParam, varNewStrZ("file"));
+        varLstAdd(entryParam, varNewUInt(storageTypeFile));
+        varLstAdd(entryParam, varNewStrZ("0640"));
+        varLstAdd(entryParam, NULL);
+        varLstAdd(entryParam, NULL);
+        varLstAdd(entryParam, NULL);
+
+        VariantList *entryParamList = varLstNew();
+        varLstAdd(entryParamList, varNewVarLst(entryParam));
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(storagePathP(storagePg(), STRDEF("clean"))));
+        varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewVarLst(entryParamList));
+
+        TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_CLEAN_STR, paramList, server), true, "protocol restore clean");
+        TEST_RESULT_STR(
+            strNewBuf(serverWrite),
+            strNewFmt("{\"out\":[\"remove invalid file '%s/clean/bogus'\"]}\n", strZ(storagePathP(storagePg(), NULL))),
+            "    check result");
+        bufUsedSet(serverWrite, 0);
+
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("clean/bogus")), NULL);
+
+        StringList *fileIgnore = strLstNew();
+        strLstAddZ(fileIgnore, "bogus");
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(storagePathP(storagePg(), STRDEF("clean"))));
+        varLstAdd(paramList, varNewVarLst(varLstNewStrLst(fileIgnore)));
+        varLstAdd(paramList, varNewVarLst(entryParamList));
+
+        TEST_RESULT_BOOL(
+            restoreProtocol(PROTOCOL_COMMAND_RESTORE_CLEAN_STR, paramList, server), true, "protocol restore clean with ignore");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":[]}\n", "    check result");
+        bufUsedSet(serverWrite, 0);
+
         // Check invalid protocol function
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_BOOL(restoreProtocol(strNew(BOGUS_STR), paramList, server), false, "invalid function");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("sync the filesystem of each target");
+
+        // Enable storageFeaturePathSyncFs in case the kernel is too old for syncfs() to report errors
+        ((Storage *)storageLocalWrite())->interface.feature |= 1 << storageFeaturePathSyncFs;
+
+        Manifest *manifest = NULL;
+
+        MEM_CONTEXT_NEW_BEGIN("Manifest")
+        {
+            manifest = manifestNewInternal();
+            manifestTargetAdd(
+                manifest, &(ManifestTarget){.name = MANIFEST_TARGET_PGDATA_STR, .path = storagePathP(storagePg(), NULL)});
+            manifestTargetAdd(
+                manifest,
+                &(ManifestTarget){
+                    .type = manifestTargetTypeLink, .name = STRDEF(MANIFEST_TARGET_PGDATA "/link"),
+                    .path = storagePathP(storagePg(), NULL), .file = STRDEF("normal")});
+            manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/normal")});
+            manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/protocol")});
+        }
+        MEM_CONTEXT_NEW_END();
+
+        harnessLogLevelSet(logLevelDetail);
+
+        TEST_RESULT_VOID(restoreSyncBatch(manifest), "sync targets");
+        harnessLogResultRegExp("P00 DETAIL: sync 2 file\\(s\\) on 1 target\\(s\\) in [0-9]+ms");
+
+        manifestTargetAdd(
+            manifest,
+            &(ManifestTarget){
+                .type = manifestTargetTypeLink, .name = STRDEF(MANIFEST_TARGET_PGTBLSPC "/1"),
+                .path = strNewFmt("%s/missing", testPath()), .tablespaceId = 1});
+
+        TEST_ERROR_FMT(
+            restoreSyncBatch(manifest), PathMissingError, "unable to sync missing path '%s/missing'", testPath());
+
+        harnessLogLevelReset();
     }
 
     // *****************************************************************************************************************************
@@ -957,8 +1085,8 @@ testRun(void)
 
         // Expect an error here since we can't really set ownership to root
         TEST_ERROR_FMT(
-            restoreCleanOwnership(STR(testPath()), STRDEF("root"), STRDEF("root"), userId(), groupId(), false), FileOwnerError,
-            "unable to set ownership for '%s': [1] Operation not permitted", testPath());
+            restoreCleanOwnership(STR(testPath()), STRDEF("root"), STRDEF("root"), userId(), groupId(), false, NULL),
+            FileOwnerError, "unable to set ownership for '%s': [1] Operation not permitted", testPath());
 
         TEST_RESULT_LOG("P00 DETAIL: update ownership for '{[path]}'");
 
@@ -966,10 +1094,10 @@ testRun(void)
         TEST_TITLE("restoreCleanOwnership() update to bogus (new)");
 
         // Will succeed because bogus will be remapped to the current user/group
-        restoreCleanOwnership(STR(testPath()), STRDEF("bogus"), STRDEF("bogus"), 0, 0, true);
+        restoreCleanOwnership(STR(testPath()), STRDEF("bogus"), STRDEF("bogus"), 0, 0, true, NULL);
 
         // Test again with only group for coverage
-        restoreCleanOwnership(STR(testPath()), STRDEF("bogus"), STRDEF("bogus"), userId(), 0, true);
+        restoreCleanOwnership(STR(testPath()), STRDEF("bogus"), STRDEF("bogus"), userId(), 0, true, NULL);
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("directory with bad permissions/mode");
@@ -1037,7 +1165,7 @@ testRun(void)
 
         storagePathCreateP(storageTest, STRDEF("conf"), .mode = 0700);
 
-        TEST_RESULT_VOID(restoreCleanBuild(manifest), "restore");
+        TEST_RESULT_VOID(testRestoreCleanBuild(manifest), "restore");
 
         TEST_RESULT_LOG(
             "P00 DETAIL: check '{[path]}/pg' exists\n"
@@ -1074,7 +1202,7 @@ testRun(void)
         strLstAddZ(argList, "--type=preserve");
         harnessCfgLoad(cfgCmdRestore, argList);
 
-        TEST_RESULT_VOID(restoreCleanBuild(manifest), "restore");
+        TEST_RESULT_VOID(testRestoreCleanBuild(manifest), "restore");
 
         TEST_RESULT_LOG(
             "P00 DETAIL: check '{[path]}/pg' exists\n"
@@ -1084,7 +1212,7 @@ testRun(void)
         TEST_SYSTEM_FMT("rm -rf %s/*", strZ(pgPath));
 
         storagePutP(storageNewWriteP(storagePgWrite(), PG_FILE_RECOVERYCONF_STR), NULL);
-        TEST_RESULT_VOID(restoreCleanBuild(manifest), "normal restore ignore recovery.conf");
+        TEST_RESULT_VOID(testRestoreCleanBuild(manifest), "normal restore ignore recovery.conf");
 
         TEST_RESULT_LOG(
             "P00 DETAIL: check '{[path]}/pg' exists\n"
@@ -1098,7 +1226,7 @@ testRun(void)
 
         manifest->data.pgVersion = PG_VERSION_12;
 
-        TEST_RESULT_VOID(restoreCleanBuild(manifest), "restore");
+        TEST_RESULT_VOID(testRestoreCleanBuild(manifest), "restore");
 
         TEST_RESULT_LOG(
             "P00 DETAIL: check '{[path]}/pg' exists\n"
@@ -1116,7 +1244,7 @@ testRun(void)
         storagePutP(storageNewWriteP(storagePgWrite(), PG_FILE_RECOVERYSIGNAL_STR), NULL);
         storagePutP(storageNewWriteP(storagePgWrite(), PG_FILE_STANDBYSIGNAL_STR), NULL);
 
-        TEST_RESULT_VOID(restoreCleanBuild(manifest), "restore");
+        TEST_RESULT_VOID(testRestoreCleanBuild(manifest), "restore");
 
         TEST_RESULT_LOG(
             "P00 DETAIL: check '{[path]}/pg' exists\n"
@@ -1135,12 +1263,61 @@ testRun(void)
         strLstAdd(argList, strNewFmt("--pg1-path=%s", strZ(pgPath)));
         harnessCfgLoad(cfgCmdRestore, argList);
 
-        TEST_RESULT_VOID(restoreCleanBuild(manifest), "restore");
+        TEST_RESULT_VOID(testRestoreCleanBuild(manifest), "restore");
 
         TEST_RESULT_LOG(
             "P00 DETAIL: check '{[path]}/pg' exists\n"
             "P00 DETAIL: check '{[path]}/conf' exists\n"
             "P00 DETAIL: create symlink '{[path]}/pg/pg_hba.conf' to '../conf/pg_hba.conf'");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("restoreCleanPath() cleans a single path");
+
+        TEST_SYSTEM_FMT("rm -rf %s/*", strZ(pgPath));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("file"), .modeFile = 0600), NULL);
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("bogus-file")), NULL);
+        storagePutP(storageNewWriteP(storagePgWrite(), BACKUP_MANIFEST_FILE_STR), NULL);
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("path/file")), NULL);
+        storagePathCreateP(storagePgWrite(), STRDEF("bogus-path/sub"));
+        TEST_SYSTEM_FMT("ln -s ../conf %s/link", strZ(pgPath));
+        TEST_SYSTEM_FMT("ln -s ../bogus %s/link-moved", strZ(pgPath));
+        TEST_SYSTEM_FMT("ln -s ../conf %s/bogus-link", strZ(pgPath));
+        TEST_SYSTEM_FMT("mkfifo %s/pipe", strZ(pgPath));
+
+        List *entryList = lstNewP(sizeof(RestoreCleanEntry));
+        lstAdd(entryList, &(RestoreCleanEntry){.name = STRDEF("file"), .type = storageTypeFile, .mode = 0640});
+        lstAdd(entryList, &(RestoreCleanEntry){.name = STRDEF("path"), .type = storageTypePath, .mode = 0750});
+        lstAdd(entryList, &(RestoreCleanEntry){.name = STRDEF("new-path"), .type = storageTypePath, .mode = 0700});
+        lstAdd(
+            entryList, &(RestoreCleanEntry){.name = STRDEF("new-link"), .type = storageTypeLink, .destination = STRDEF("../conf")});
+        lstAdd(entryList, &(RestoreCleanEntry){.name = STRDEF("link"), .type = storageTypeLink, .destination = STRDEF("../conf")});
+        lstAdd(entryList, &(RestoreCleanEntry){.name = STRDEF("link"), .type = storageTypePath, .mode = 0700});
+        lstAdd(
+            entryList,
+            &(RestoreCleanEntry){.name = STRDEF("link-moved"), .type = storageTypeLink, .destination = STRDEF("../conf")});
+
+        StringList *fileIgnore = strLstNew();
+        strLstAdd(fileIgnore, BACKUP_MANIFEST_FILE_STR);
+
+        TEST_RESULT_STRLST_Z(
+            restoreCleanPath(pgPath, entryList, fileIgnore),
+            hrnReplaceKey(
+                "remove invalid file '{[path]}/pg/bogus-file'\n"
+                "remove invalid link '{[path]}/pg/bogus-link'\n"
+                "remove invalid path '{[path]}/pg/bogus-path'\n"
+                "update mode for '{[path]}/pg/file' to 0640\n"
+                "remove link '{[path]}/pg/link-moved' because destination changed\n"
+                "remove special file '{[path]}/pg/pipe'\n"
+                "create symlink '{[path]}/pg/link-moved' to '../conf'\n"
+                "create symlink '{[path]}/pg/new-link' to '../conf'\n"
+                "create path '{[path]}/pg/new-path'\n"),
+            "clean path");
+
+        TEST_RESULT_BOOL(storageExistsP(storagePg(), STRDEF("path/file")), true, "subpath is not cleaned");
+        TEST_RESULT_BOOL(storageExistsP(storagePg(), BACKUP_MANIFEST_FILE_STR), true, "ignored file is not removed");
+        TEST_RESULT_STR_Z(
+            storageInfoP(storagePg(), STRDEF("link-moved")).linkDestination, "../conf", "link destination updated");
     }
 
     // *****************************************************************************************************************************
@@ -1678,6 +1855,14 @@ testRun(void)
         TEST_RESULT_INT(restoreJobQueueNext(0, 1, 2), 0, "client idx 0, queue idx 1, 2 queues")
         TEST_RESULT_INT(restoreJobQueueNext(1, 0, 2), 1, "client idx 1, queue idx 0, 2 queues")
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("verify next file calculations");
+
+        TEST_RESULT_UINT(restoreJobQueueFileIdx(0, 1), 0, "client idx 0, 1 file");
+        TEST_RESULT_UINT(restoreJobQueueFileIdx(1, 1), 0, "client idx 1, 1 file");
+        TEST_RESULT_UINT(restoreJobQueueFileIdx(2, 3), 0, "client idx 2 gets largest file");
+        TEST_RESULT_UINT(restoreJobQueueFileIdx(3, 3), 2, "client idx 3 gets smallest file");
+
         // Locality error
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("incorrect locality");
@@ -1705,8 +1890,12 @@ testRun(void)
         strLstAdd(argList, strNewFmt("--repo1-path=%s", strZ(repoPath)));
         strLstAdd(argList, strNewFmt("--pg1-path=%s", strZ(pgPath)));
         strLstAddZ(argList, "--set=20161219-212741F");
+        strLstAddZ(argList, "--" CFGOPT_SYNC_BATCH);
         harnessCfgLoad(cfgCmdRestore, argList);
 
+        // Enable storageFeaturePathSyncFs in case the kernel is too old for syncfs() to report errors
+        ((Storage *)storageLocalWrite())->interface.feature |= 1 << storageFeaturePathSyncFs;
+
         #define TEST_LABEL                                          "20161219-212741F"
         #define TEST_PGDATA                                         MANIFEST_TARGET_PGDATA "/"
         #define TEST_REPO_PATH                                      STORAGE_REPO_BACKUP "/" TEST_LABEL "/" TEST_PGDATA
@@ -1787,16 +1976,19 @@ testRun(void)
 
         TEST_RESULT_VOID(cmdRestore(), "successful restore");
 
+        hrnLogReplaceAdd(" in [0-9]+ms", "[0-9]+", "TIME", false);
+
         TEST_RESULT_LOG(
             "P00   INFO: restore backup set 20161219-212741F\n"
             "P00 DETAIL: check '{[path]}/pg' exists\n"
             "P00 DETAIL: check '{[path]}/ts/1' exists\n"
             "P00 DETAIL: update mode for '{[path]}/pg' to 0700\n"
-            "P00 DETAIL: create path '{[path]}/pg/global'\n"
-            "P00 DETAIL: create path '{[path]}/pg/pg_tblspc'\n"
-            "P00 DETAIL: create symlink '{[path]}/pg/pg_tblspc/1' to '{[path]}/ts/1'\n"
-            "P00 DETAIL: create path '{[path]}/pg/pg_tblspc/1/16384'\n"
+            "P01 DETAIL: create path '{[path]}/pg/global'\n"
+            "P01 DETAIL: create path '{[path]}/pg/pg_tblspc'\n"
+            "P01 DETAIL: create symlink '{[path]}/pg/pg_tblspc/1' to '{[path]}/ts/1'\n"
+            "P01 DETAIL: create path '{[path]}/ts/1/16384'\n"
             "P01   INFO: restore file {[path]}/pg/PG_VERSION (4B, 100%) checksum 797e375b924134687cbf9eacd37a4355f3d825e4\n"
+            "P00 DETAIL: sync 1 file(s) on 2 target(s) in [TIME]ms\n"
             "P00   INFO: write {[path]}/pg/recovery.conf\n"
             "P00 DETAIL: sync path '{[path]}/pg'\n"
             "P00 DETAIL: sync path '{[path]}/pg/pg_tblspc'\n"
@@ -1805,6 +1997,8 @@ testRun(void)
             "P00   WARN: backup does not contain 'global/pg_control' -- cluster will not start\n"
             "P00 DETAIL: sync path '{[path]}/pg/global'");
 
+        hrnLogReplaceClear();
+
         // Remove recovery.conf before file comparison since it will have a new timestamp.  Make sure it existed, though.
         storageRemoveP(storagePgWrite(), PG_FILE_RECOVERYCONF_STR, .errorOnMissing = true);
 
@@ -1902,11 +2096,11 @@ testRun(void)
             "P00 DETAIL: check '{[path]}/pg' exists\n"
             "P00 DETAIL: check '{[path]}/ts/1' exists\n"
             "P00   INFO: remove invalid files/links/paths from '{[path]}/pg'\n"
-            "P00 DETAIL: remove invalid file '{[path]}/pg/bogus-file'\n"
-            "P00 DETAIL: remove link '{[path]}/pg/pg_tblspc/1' because destination changed\n"
-            "P00 DETAIL: remove special file '{[path]}/pg/pipe'\n"
             "P00   INFO: remove invalid files/links/paths from '{[path]}/ts/1'\n"
-            "P00 DETAIL: create symlink '{[path]}/pg/pg_tblspc/1' to '{[path]}/ts/1'\n"
+            "P01 DETAIL: remove invalid file '{[path]}/pg/bogus-file'\n"
+            "P01 DETAIL: remove special file '{[path]}/pg/pipe'\n"
+            "P01 DETAIL: remove link '{[path]}/pg/pg_tblspc/1' because destination changed\n"
+            "P01 DETAIL: create symlink '{[path]}/pg/pg_tblspc/1' to '{[path]}/ts/1'\n"
             "P01 DETAIL: restore file {[path]}/pg/PG_VERSION - exists and matches size 4 and modification time 1482182860 (4B, 50%)"
                 " checksum 797e375b924134687cbf9eacd37a4355f3d825e4\n"
             "P01   INFO: restore file {[path]}/pg/tablespace_map (0B, 50%)\n"
@@ -1950,8 +2144,12 @@ testRun(void)
         strLstAddZ(argList, "--" CFGOPT_TYPE "=" RECOVERY_TYPE_PRESERVE);
         strLstAddZ(argList, "--" CFGOPT_SET "=20161219-212741F");
         strLstAddZ(argList, "--" CFGOPT_FORCE);
+        strLstAddZ(argList, "--" CFGOPT_SYNC_BATCH);
         harnessCfgLoad(cfgCmdRestore, argList);
 
+        // Disable storageFeaturePathSyncFs so files will be synced as they are restored
+        ((Storage *)storageLocalWrite())->interface.feature &= ~((uint64_t)1 << storageFeaturePathSyncFs);
+
         cmdRestore();
 
         TEST_RESULT_LOG(
@@ -1960,6 +2158,7 @@ testRun(void)
             "P00 DETAIL: check '{[path]}/ts/1' exists\n"
             "P00   INFO: remove invalid files/links/paths from '{[path]}/pg'\n"
             "P00   INFO: remove invalid files/links/paths from '{[path]}/ts/1'\n"
+            "P00   WARN: option sync-batch is enabled but filesystem sync is not supported - files will be synced as restored\n"
             "P01   INFO: restore file {[path]}/pg/PG_VERSION (4B, 50%) checksum 797e375b924134687cbf9eacd37a4355f3d825e4\n"
             "P01   INFO: restore file {[path]}/pg/tablespace_map (0B, 50%)\n"
             "P01   INFO: restore file {[path]}/pg/pg_tblspc/1/16384/PG_VERSION (4B, 100%)"
@@ -2278,16 +2477,16 @@ testRun(void)
             "P00 DETAIL: check '{[path]}/ts/1/PG_10_201707211' exists\n"
             "P00 DETAIL: skip 'tablespace_map' -- tablespace links will be created based on mappings\n"
             "P00   INFO: remove invalid files/links/paths from '{[path]}/pg'\n"
-            "P00 DETAIL: remove invalid path '{[path]}/pg/bogus1'\n"
-            "P00 DETAIL: remove invalid path '{[path]}/pg/global/bogus3'\n"
-            "P00 DETAIL: remove invalid link '{[path]}/pg/pg_wal2'\n"
-            "P00 DETAIL: remove invalid file '{[path]}/pg/tablespace_map'\n"
-            "P00 DETAIL: create path '{[path]}/pg/base'\n"
-            "P00 DETAIL: create path '{[path]}/pg/base/1'\n"
-            "P00 DETAIL: create path '{[path]}/pg/base/16384'\n"
-            "P00 DETAIL: create path '{[path]}/pg/base/32768'\n"
-            "P00 DETAIL: create symlink '{[path]}/pg/pg_hba.conf' to '../config/pg_hba.conf'\n"
-            "P00 DETAIL: create symlink '{[path]}/pg/postgresql.conf' to '../config/postgresql.conf'\n"
+            "P01 DETAIL: remove invalid path '{[path]}/pg/bogus1'\n"
+            "P01 DETAIL: remove invalid link '{[path]}/pg/pg_wal2'\n"
+            "P01 DETAIL: remove invalid file '{[path]}/pg/tablespace_map'\n"
+            "P01 DETAIL: create path '{[path]}/pg/base'\n"
+            "P01 DETAIL: create symlink '{[path]}/pg/pg_hba.conf' to '../config/pg_hba.conf'\n"
+            "P01 DETAIL: create symlink '{[path]}/pg/postgresql.conf' to '../config/postgresql.conf'\n"
+            "P01 DETAIL: create path '{[path]}/pg/base/1'\n"
+            "P01 DETAIL: create path '{[path]}/pg/base/16384'\n"
+            "P01 DETAIL: create path '{[path]}/pg/base/32768'\n"
+            "P01 DETAIL: remove invalid path '{[path]}/pg/global/bogus3'\n"
             "P01   INFO: restore file {[path]}/pg/base/32768/32769 (32KB, 49%) checksum a40f0986acb1531ce0cc75a23dcf8aa406ae9081\n"
             "P01   INFO: restore file {[path]}/pg/base/16384/16385 (16KB, 74%) checksum d74e5f7ebe52a3ed468ba08c5b6aefaccd1ca88f\n"
             "P01   INFO: restore file {[path]}/pg/global/pg_control.pgbackrest.tmp (8KB, 87%)"
@@ -2364,6 +2563,7 @@ testRun(void)
         strLstAddZ(argList, "--link-map=postgresql.conf=../config/postgresql.conf");
         strLstAddZ(argList, "--link-map=pg_hba.conf=../config/pg_hba.conf");
         strLstAddZ(argList, "--db-include=16384");
+        strLstAddZ(argList, "--sparse");
         harnessCfgLoad(cfgCmdRestore, argList);
 
         // Move pg1-path and put a link in its place. This tests that restore works when pg1-path is a symlink yet should be
@@ -2441,5 +2641,312 @@ testRun(void)
             testPath());
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("cmdRelationRestore()"))
+    {
+        const String *repoPath = strNewFmt("%s/repo-relation", testPath());
+        const String *relationPath = strNewFmt("%s/relation", testPath());
+
+        harnessLogLevelReset();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("relation parameters");
+
+        StringList *argBaseList = strLstNew();
+        strLstAddZ(argBaseList, "--stanza=test1");
+        strLstAdd(argBaseList, strNewFmt("--repo1-path=%s", strZ(repoPath)));
+        strLstAdd(argBaseList, strNewFmt("--relation-path=%s", strZ(relationPath)));
+
+        StringList *argList = strLstDup(argBaseList);
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(cmdRelationRestore(), ParamRequiredError, "relation to restore required");
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "base/1/16384:10-");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(cmdRelationRestore(), ParamInvalidError, "invalid block range in 'base/1/16384:10-'");
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "base/1/16384:10-9");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(cmdRelationRestore(), ParamInvalidError, "invalid block range in 'base/1/16384:10-9'");
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "/base/1/16384");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(
+            cmdRelationRestore(), ParamInvalidError, "relation '/base/1/16384' must be relative to the data directory");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("backup set");
+
+        storagePutP(
+            storageNewWriteP(storageRepoWrite(), INFO_BACKUP_PATH_FILE_STR),
+            harnessInfoChecksumZ(TEST_RESTORE_BACKUP_INFO_DB));
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "base/1/16384");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(cmdRelationRestore(), BackupSetInvalidError, "no backup sets to restore");
+
+        storagePutP(
+            storageNewWriteP(storageRepoWrite(), INFO_BACKUP_PATH_FILE_STR),
+            harnessInfoChecksumZ(TEST_RESTORE_BACKUP_INFO "\n" TEST_RESTORE_BACKUP_INFO_DB));
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "--set=20161219-212741F_20161219-212804D");
+        strLstAddZ(argList, "base/1/16384");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(cmdRelationRestore(), BackupSetInvalidError, "backup set 20161219-212741F_20161219-212804D is not valid");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write manifest and repo files");
+
+        #define TEST_RELATION_LABEL                                 "20161219-212741F"
+        #define TEST_RELATION_REPO_PATH                             STORAGE_REPO_BACKUP "/" TEST_RELATION_LABEL "/"
+
+        // Relation with three pages that are each filled with a different byte
+        Buffer *relation = bufNew(PG_PAGE_SIZE_DEFAULT * 3);
+        memset(bufPtr(relation), 'a', PG_PAGE_SIZE_DEFAULT);
+        memset(bufPtr(relation) + PG_PAGE_SIZE_DEFAULT, 'b', PG_PAGE_SIZE_DEFAULT);
+        memset(bufPtr(relation) + PG_PAGE_SIZE_DEFAULT * 2, 'c', PG_PAGE_SIZE_DEFAULT);
+        bufUsedSet(relation, bufSize(relation));
+
+        Manifest *manifest = NULL;
+
+        MEM_CONTEXT_NEW_BEGIN("Manifest")
+        {
+            manifest = manifestNewInternal();
+            manifest->info = infoNew(NULL);
+            manifest->data.backupLabel = strNew(TEST_RELATION_LABEL);
+            manifest->data.pgVersion = PG_VERSION_94;
+            manifest->data.backupType = backupTypeFull;
+
+            manifestTargetAdd(manifest, &(ManifestTarget){.name = MANIFEST_TARGET_PGDATA_STR, .path = STRDEF("/pg")});
+            manifestPathAdd(manifest, &(ManifestPath){.name = MANIFEST_TARGET_PGDATA_STR, .mode = 0700});
+
+            // Relation with a second segment that has been truncated to zero bytes
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/16384"), .size = bufUsed(relation), .mode = 0600,
+                    .checksumSha1 = "a6832080e758eee27120b50ceb2e60b91a2969a3"});
+            storagePutP(
+                storageNewWriteP(storageRepoWrite(), STRDEF(TEST_RELATION_REPO_PATH MANIFEST_TARGET_PGDATA "/base/1/16384")),
+                relation);
+
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/16384.1"), .size = 0, .mode = 0600,
+                    .checksumSha1 = "da39a3ee5e6b4b0d3255bfef95601890afd80709"});
+
+            // Files that are not segments of base/1/16384
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/16384_fsm"), .size = 4, .mode = 0600,
+                    .checksumSha1 = "da39a3ee5e6b4b0d3255bfef95601890afd80709"});
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/16384.x"), .size = 4, .mode = 0600,
+                    .checksumSha1 = "da39a3ee5e6b4b0d3255bfef95601890afd80709"});
+
+            // Relation with a checksum that does not match the repo file
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/16386"), .size = 4, .mode = 0600,
+                    .checksumSha1 = "da39a3ee5e6b4b0d3255bfef95601890afd80709"});
+            storagePutP(
+                storageNewWriteP(storageRepoWrite(), STRDEF(TEST_RELATION_REPO_PATH MANIFEST_TARGET_PGDATA "/base/1/16386")),
+                BUFSTRDEF("bad\n"));
+
+            // Relation in a tablespace
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGTBLSPC "/1/PG_9.4_201409291/1/16385"), .size = 4, .mode = 0600,
+                    .checksumSha1 = "3457f6a77bba644720d30c48a4b9a5fbba9c7518"});
+            storagePutP(
+                storageNewWriteP(
+                    storageRepoWrite(), STRDEF(TEST_RELATION_REPO_PATH MANIFEST_TARGET_PGTBLSPC "/1/PG_9.4_201409291/1/16385")),
+                BUFSTRDEF("ts1\n"));
+
+            // Relations with page checksums where page 1 is invalid. The backup reported the error for 16388 but not for 16387.
+            Buffer *relationPage = bufNew(PG_PAGE_SIZE_DEFAULT * 3);
+            memset(bufPtr(relationPage), 0, bufSize(relationPage));
+            bufUsedSet(relationPage, bufSize(relationPage));
+
+            for (unsigned int pageIdx = 0; pageIdx < 3; pageIdx++)
+            {
+                unsigned char *page = bufPtr(relationPage) + PG_PAGE_SIZE_DEFAULT * pageIdx;
+
+                *(PageHeaderData *)page = (PageHeaderData){.pd_upper = 0x01};
+                ((PageHeaderData *)page)->pd_checksum = (uint16_t)(pgPageChecksum(page, pageIdx) + (pageIdx == 1 ? 1 : 0));
+            }
+
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/16387"), .size = bufUsed(relationPage), .mode = 0600,
+                    .checksumSha1 = "831033f96f050ce6b8793d81bd4cb795c791addf", .checksumPage = true});
+            storagePutP(
+                storageNewWriteP(storageRepoWrite(), STRDEF(TEST_RELATION_REPO_PATH MANIFEST_TARGET_PGDATA "/base/1/16387")),
+                relationPage);
+
+            manifestFileAdd(
+                manifest,
+                &(ManifestFile){
+                    .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/16388"), .size = bufUsed(relationPage), .mode = 0600,
+                    .checksumSha1 = "831033f96f050ce6b8793d81bd4cb795c791addf", .checksumPage = true,
+                    .checksumPageError = true});
+            storagePutP(
+                storageNewWriteP(storageRepoWrite(), STRDEF(TEST_RELATION_REPO_PATH MANIFEST_TARGET_PGDATA "/base/1/16388")),
+                relationPage);
+
+            lstSort(manifest->fileList, sortOrderAsc);
+        }
+        MEM_CONTEXT_NEW_END();
+
+        manifestSave(
+            manifest,
+            storageWriteIo(
+                storageNewWriteP(
+                    storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/" TEST_RELATION_LABEL "/" BACKUP_MANIFEST_FILE))));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("relation does not exist");
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "--set=" TEST_RELATION_LABEL);
+        strLstAddZ(argList, "base/1/1638");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(
+            cmdRelationRestore(), FileMissingError, "relation 'base/1/1638' does not exist in backup set " TEST_RELATION_LABEL);
+
+        TEST_RESULT_LOG("P00   INFO: restore relations from backup set " TEST_RELATION_LABEL);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("checksum mismatch");
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "--set=" TEST_RELATION_LABEL);
+        strLstAddZ(argList, "base/1/16386");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(
+            cmdRelationRestore(), ChecksumError,
+            "error restoring 'base/1/16386': actual checksum 'e9b396d2dddffdb373bf2c6ad073696aa25b4f68' does not match expected"
+                " checksum 'da39a3ee5e6b4b0d3255bfef95601890afd80709'");
+
+        TEST_RESULT_LOG(
+            "P00   INFO: restore relations from backup set " TEST_RELATION_LABEL "\n"
+            "P00   INFO: restore file base/1/16386 (4B)");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("restore entire relations from the latest backup set");
+
+        storagePutP(
+            storageNewWriteP(storageRepoWrite(), INFO_BACKUP_PATH_FILE_STR),
+            harnessInfoChecksumZ(
+                "[backup:current]\n"
+                TEST_RELATION_LABEL "={\"backrest-format\":5,\"backrest-version\":\"2.04\","
+                "\"backup-archive-start\":\"00000007000000000000001C\",\"backup-archive-stop\":\"00000007000000000000001C\","
+                "\"backup-info-repo-size\":3159776,\"backup-info-repo-size-delta\":3159776,\"backup-info-size\":26897030,"
+                "\"backup-info-size-delta\":26897030,\"backup-timestamp-start\":1482182846,\"backup-timestamp-stop\":1482182861,"
+                "\"backup-type\":\"full\",\"db-id\":1,\"option-archive-check\":true,\"option-archive-copy\":false,"
+                "\"option-backup-standby\":false,\"option-checksum-page\":false,\"option-compress\":false,"
+                "\"option-hardlink\":false,\"option-online\":true}\n"
+                "\n"
+                TEST_RESTORE_BACKUP_INFO_DB));
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "base/1/16384");
+        strLstAddZ(argList, "pg_tblspc/1/PG_9.4_201409291/1/16385");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_RESULT_VOID(cmdRelationRestore(), "restore relations");
+
+        TEST_RESULT_LOG(
+            "P00   INFO: restore relations from backup set " TEST_RELATION_LABEL "\n"
+            "P00   INFO: restore file base/1/16384 (24KB)\n"
+            "P00   INFO: restore file base/1/16384.1 (0B)\n"
+            "P00   INFO: restore file pg_tblspc/1/PG_9.4_201409291/1/16385 (4B)");
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storageLocal(), strNewFmt("%s/base/1/16384", strZ(relationPath)))), relation),
+            true, "check relation");
+        TEST_RESULT_UINT(
+            storageInfoP(storageLocal(), strNewFmt("%s/base/1/16384.1", strZ(relationPath))).size, 0, "check empty segment");
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                storageGetP(
+                    storageNewReadP(
+                        storageLocal(), strNewFmt("%s/pg_tblspc/1/PG_9.4_201409291/1/16385", strZ(relationPath))))),
+            "ts1\n", "check tablespace relation");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("restore block ranges");
+
+        storagePathRemoveP(storageLocalWrite(), relationPath, .recurse = true);
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "base/1/16384:1-5");
+        strLstAddZ(argList, "base/1/16384:131072");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_RESULT_VOID(cmdRelationRestore(), "restore blocks");
+
+        TEST_RESULT_LOG(
+            "P00   INFO: restore relations from backup set " TEST_RELATION_LABEL "\n"
+            "P00   INFO: restore file base/1/16384.blocks-1-2 (16KB)\n"
+            "P00   WARN: relation 'base/1/16384' does not contain the requested blocks");
+
+        TEST_RESULT_STR(
+            strNewBuf(storageGetP(storageNewReadP(storageLocal(), strNewFmt("%s/base/1/16384.blocks-1-2", strZ(relationPath))))),
+            strNewN((const char *)bufPtr(relation) + PG_PAGE_SIZE_DEFAULT, PG_PAGE_SIZE_DEFAULT * 2), "check blocks");
+        TEST_RESULT_BOOL(
+            storageExistsP(storageLocal(), strNewFmt("%s/base/1/16384", strZ(relationPath))), false, "segment name not used");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("verify page checksums of block ranges");
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "base/1/16387:0");
+        strLstAddZ(argList, "base/1/16387:2");
+        strLstAddZ(argList, "base/1/16388:1-2");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_RESULT_VOID(cmdRelationRestore(), "restore blocks");
+
+        TEST_RESULT_LOG(
+            "P00   INFO: restore relations from backup set " TEST_RELATION_LABEL "\n"
+            "P00   INFO: restore file base/1/16387.blocks-0-0 (8KB)\n"
+            "P00   INFO: restore file base/1/16387.blocks-2-2 (8KB)\n"
+            "P00   INFO: restore file base/1/16388.blocks-1-2 (16KB)\n"
+            "P00   WARN: restored 'base/1/16388.blocks-1-2' with invalid page checksum in relation block(s) 1");
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "base/1/16387:1-2");
+        harnessCfgLoad(cfgCmdRelationRestore, argList);
+
+        TEST_ERROR(
+            cmdRelationRestore(), ChecksumError,
+            "error restoring 'base/1/16387.blocks-1-2': invalid page checksum in relation block(s) 1");
+
+        TEST_RESULT_LOG(
+            "P00   INFO: restore relations from backup set " TEST_RELATION_LABEL "\n"
+            "P00   INFO: restore file base/1/16387.blocks-1-2 (16KB)");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -0,0 +1,237 @@
+/***********************************************************************************************************************************
+Test Server Command
+***********************************************************************************************************************************/
+#include <stdlib.h>
+
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
+#include "protocol/client.h"
+#include "protocol/helper.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessConfig.h"
+#include "common/harnessFork.h"
+#include "common/harnessServer.h"
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // Create default storage object for testing
+    Storage *storageTest = storagePosixNewP(strNew(testPath()), .write = true);
+
+    const String *const caFile = strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath());
+    const String *const certFile = strNewFmt("%s/" HRN_SERVER_CERT_PREFIX ".crt", testRepoPath());
+    const String *const keyFile = strNewFmt("%s/" HRN_SERVER_CERT_PREFIX ".key", testRepoPath());
+    const String *const configFile = strNewFmt("%s/pgbackrest.conf", testPath());
+
+    // Server options
+    StringList *argListServer = strLstNew();
+    hrnCfgArgRaw(argListServer, cfgOptConfig, configFile);
+    hrnCfgArgRaw(argListServer, cfgOptTlsServerAddress, hrnServerHost());
+    hrnCfgArgRaw(argListServer, cfgOptTlsServerCaFile, caFile);
+    hrnCfgArgRaw(argListServer, cfgOptTlsServerCertFile, certFile);
+    hrnCfgArgRaw(argListServer, cfgOptTlsServerKeyFile, keyFile);
+    hrnCfgArgRawFmt(argListServer, cfgOptTlsServerPort, "%u", hrnServerPort(0));
+
+    // *****************************************************************************************************************************
+    if (testBegin("cmdServerParam() and cmdServerSessionParam()"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("server parameters include the config options that were set");
+
+        storagePutP(storageNewWriteP(storageTest, configFile), NULL);
+        harnessCfgLoad(cfgCmdServer, argListServer);
+
+        StringList *paramServer = NULL;
+        TEST_ASSIGN(paramServer, cmdServerParam(), "server param");
+        TEST_RESULT_STR(
+            strLstJoin(paramServer, "|"),
+            strNewFmt(
+                "%s|--config=%s|--log-level-console=off|--log-level-stderr=error", testProjectExe(), strZ(configFile)),
+            "check server param");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("client options that are not allowed");
+
+        StringList *paramClient = strLstNew();
+        strLstAddZ(paramClient, "--" CFGOPT_STANZA "=test");
+        strLstAddZ(paramClient, "--repo1-path=/bogus");
+        strLstAddZ(paramClient, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+        TEST_ERROR(
+            cmdServerSessionParam(paramServer, paramClient), OptionInvalidError, "option 'repo1-path' cannot be set by the client");
+
+        paramClient = strLstNew();
+        strLstAddZ(paramClient, "--" CFGOPT_LOCK_PATH);
+
+        TEST_ERROR(
+            cmdServerSessionParam(paramServer, paramClient), OptionInvalidError, "option 'lock-path' cannot be set by the client");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("client commands that are not allowed");
+
+        paramClient = strLstNew();
+        strLstAddZ(paramClient, CFGCMD_STANZA_DELETE);
+
+        TEST_ERROR(
+            cmdServerSessionParam(paramServer, paramClient), CommandInvalidError,
+            "server only runs the remote role but 'stanza-delete' was requested");
+
+        paramClient = strLstNew();
+        strLstAddZ(paramClient, CFGCMD_ARCHIVE_PUSH ":" CONFIG_COMMAND_ROLE_LOCAL);
+
+        TEST_ERROR(
+            cmdServerSessionParam(paramServer, paramClient), CommandInvalidError,
+            "server only runs the remote role but 'archive-push:local' was requested");
+
+        paramClient = strLstNew();
+        strLstAddZ(paramClient, "bogus:" CONFIG_COMMAND_ROLE_REMOTE);
+
+        TEST_ERROR(
+            cmdServerSessionParam(paramServer, paramClient), CommandInvalidError,
+            "server only runs the remote role but 'bogus:remote' was requested");
+
+        paramClient = strLstNew();
+        strLstAddZ(paramClient, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+        TEST_ERROR(
+            cmdServerSessionParam(paramServer, paramClient), CommandInvalidError,
+            "server only runs the remote role but 'info:remote:remote' was requested");
+
+        paramClient = strLstNew();
+        strLstAddZ(paramClient, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+        strLstAddZ(paramClient, CFGCMD_BACKUP);
+
+        TEST_ERROR(
+            cmdServerSessionParam(paramServer, paramClient), ParamInvalidError,
+            "command 'backup' is not expected since a command was already sent");
+
+        TEST_ERROR(cmdServerSessionParam(paramServer, strLstNew()), CommandRequiredError, "no command sent by the client");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("allowed client parameters are appended to the server parameters");
+
+        paramClient = strLstNew();
+        strLstAddZ(paramClient, "--" CFGOPT_STANZA "=test");
+        strLstAddZ(paramClient, "--" CFGOPT_PROCESS "=0");
+        strLstAddZ(paramClient, "--" CFGOPT_REMOTE_TYPE "=" PROTOCOL_REMOTE_TYPE_REPO);
+        strLstAddZ(paramClient, "--" CFGOPT_REPO "=1");
+        strLstAddZ(paramClient, "--" CFGOPT_PG "=1");
+        strLstAddZ(paramClient, CFGCMD_INFO ":" CONFIG_COMMAND_ROLE_REMOTE);
+
+        TEST_RESULT_STR(
+            strLstJoin(cmdServerSessionParam(paramServer, paramClient), "|"),
+            strNewFmt(
+                "%s|--config=%s|--log-level-console=off|--log-level-stderr=error|--stanza=test|--process=0|--remote-type=repo"
+                    "|--repo=1|--pg=1|info:remote",
+                testProjectExe(), strZ(configFile)),
+            "check session param");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("cmdServer()"))
+    {
+        // Add the test host so the server certificate can be verified
+#ifdef TEST_CONTAINER_REQUIRED
+        if (system(                                                                                         // {uncoverable_branch}
+                strZ(strNewFmt("echo \"127.0.0.1 %s\" | sudo tee -a /etc/hosts > /dev/null", strZ(hrnServerHost())))) != 0)
+        {
+            THROW(AssertError, "unable to add test host to /etc/hosts");                                    // {uncovered+}
+        }
+
+        // A second session is started by the protocol helper
+        const uint64_t connectionMax = 2;
+#else
+        const uint64_t connectionMax = 1;
+#endif
+
+        // Sessions load the repository, lock, and log settings from the server configuration
+        storagePutP(
+            storageNewWriteP(storageTest, configFile),
+            BUFSTR(
+                strNewFmt(
+                    "[global]\n"
+                    "repo1-path=%s/repo\n"
+                    "lock-path=%s/lock\n"
+                    "log-path=%s\n"
+                    "log-level-file=off\n",
+                    testPath(), testPath(), testPath())));
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                harnessCfgLoad(cfgCmdServer, argListServer);
+
+                // Both the server and the session return from here when done
+                cmdServer(connectionMax);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remote session with a client certificate");
+
+                // The client retries until the server is listening
+                IoClient *client = NULL;
+                TEST_ASSIGN(
+                    client,
+                    tlsClientNew(
+                        sckClientNew(hrnServerHost(), hrnServerPort(0), 5000), hrnServerHost(), 5000, false, NULL, NULL, certFile,
+                        keyFile),
+                    "new client");
+
+                IoSession *session = NULL;
+                TEST_ASSIGN(session, ioClientOpen(client), "open session");
+
+                ioWriteStrLine(
+                    ioSessionIoWrite(session),
+                    STRDEF("[\"--stanza=test\",\"--process=0\",\"--remote-type=repo\",\"--repo=1\",\"info:remote\"]"));
+                ioWriteFlush(ioSessionIoWrite(session));
+
+                ProtocolClient *protocolClient = NULL;
+                TEST_ASSIGN(
+                    protocolClient,
+                    protocolClientNew(
+                        STRDEF("test"), PROTOCOL_SERVICE_REMOTE_STR, ioSessionIoRead(session), ioSessionIoWrite(session)),
+                    "new protocol client");
+                TEST_RESULT_VOID(protocolClientNoOp(protocolClient), "noop");
+                TEST_RESULT_VOID(protocolClientFree(protocolClient), "free protocol client");
+                TEST_RESULT_VOID(ioSessionFree(session), "free session");
+                TEST_RESULT_VOID(ioClientFree(client), "free client");
+
+                TEST_RESULT_LOG_FMT("P01   INFO: listening on '%s:%u'", strZ(hrnServerHost()), hrnServerPort(0));
+
+#ifdef TEST_CONTAINER_REQUIRED
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remote session started by the protocol helper");
+
+                StringList *argList = strLstNew();
+                strLstAddZ(argList, "--" CFGOPT_STANZA "=test");
+                hrnCfgArgRawZ(argList, cfgOptRepoPath, "/bogus");
+                hrnCfgArgRaw(argList, cfgOptRepoHost, hrnServerHost());
+                hrnCfgArgRawZ(argList, cfgOptRepoHostType, "tls");
+                hrnCfgArgRawFmt(argList, cfgOptRepoHostPort, "%u", hrnServerPort(0));
+                hrnCfgArgRaw(argList, cfgOptRepoHostCaFile, caFile);
+                hrnCfgArgRaw(argList, cfgOptRepoHostCertFile, certFile);
+                hrnCfgArgRaw(argList, cfgOptRepoHostKeyFile, keyFile);
+                harnessCfgLoad(cfgCmdInfo, argList);
+
+                TEST_ASSIGN(protocolClient, protocolRemoteGet(protocolStorageTypeRepo, 0), "get remote protocol");
+                TEST_RESULT_VOID(protocolClientNoOp(protocolClient), "noop");
+                TEST_RESULT_VOID(protocolFree(), "free remote protocol");
+#endif
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -4,6 +4,7 @@ Test Stanza Commands
 #include "storage/posix/storage.h"
 
 #include "common/harnessConfig.h"
+#include "common/harnessFork.h"
 #include "common/harnessInfo.h"
 #include "common/harnessPq.h"
 #include "common/io/bufferRead.h"
@@ -617,7 +618,7 @@ testRun(void)
 
         String *filePathName =  strNewFmt(STORAGE_REPO_ARCHIVE "/testfile");
         TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageRepoWrite(), filePathName), BUFSTRDEF("")), "put zero-sized file");
-        TEST_RESULT_UINT(verifyFile(filePathName, STRDEF(HASH_TYPE_SHA1_ZERO), 0, NULL), verifyOk, "file ok");
+        TEST_RESULT_UINT(verifyFile(filePathName, STRDEF(HASH_TYPE_SHA1_ZERO), 0, cipherTypeNone, NULL), verifyOk, "file ok");
 
         const char *fileContents = "acefile";
         uint64_t fileSize = 7;
@@ -625,13 +626,14 @@ testRun(void)
 
         TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageRepoWrite(), filePathName), BUFSTRZ(fileContents)), "put file");
 
-        TEST_RESULT_UINT(verifyFile(filePathName, checksum, fileSize, NULL), verifyOk, "file size ok");
-        TEST_RESULT_UINT(verifyFile(filePathName, checksum, 0, NULL), verifySizeInvalid, "file size invalid");
+        TEST_RESULT_UINT(verifyFile(filePathName, checksum, fileSize, cipherTypeNone, NULL), verifyOk, "file size ok");
+        TEST_RESULT_UINT(verifyFile(filePathName, checksum, 0, cipherTypeNone, NULL), verifySizeInvalid, "file size invalid");
         TEST_RESULT_UINT(
-            verifyFile(filePathName, strNew("badchecksum"), fileSize, NULL), verifyChecksumMismatch, "file checksum mismatch");
+            verifyFile(filePathName, strNew("badchecksum"), fileSize, cipherTypeNone, NULL), verifyChecksumMismatch,
+            "file checksum mismatch");
         TEST_RESULT_UINT(
-            verifyFile(
-                strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), checksum, 0, NULL), verifyFileMissing, "file missing");
+            verifyFile(strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), checksum, 0, cipherTypeNone, NULL), verifyFileMissing,
+            "file missing");
 
         // Create a compressed encrypted repo file
         filePathName = strNew(STORAGE_REPO_BACKUP "/testfile.gz");
@@ -642,11 +644,15 @@ testRun(void)
         TEST_RESULT_VOID(storagePutP(write, BUFSTRZ(fileContents)), "write encrypted, compressed file");
 
         TEST_RESULT_UINT(
-            verifyFile(filePathName, checksum, fileSize, strNew("pass")), verifyOk, "file encrypted compressed ok");
+            verifyFile(filePathName, checksum, fileSize, cipherTypeAes256Cbc, strNew("pass")), verifyOk,
+            "file encrypted compressed ok");
         TEST_RESULT_UINT(
             verifyFile(
-                filePathName, strNew("badchecksum"), fileSize, strNew("pass")), verifyChecksumMismatch,
+                filePathName, strNew("badchecksum"), fileSize, cipherTypeAes256Cbc, strNew("pass")), verifyChecksumMismatch,
                 "file encrypted compressed checksum mismatch");
+        TEST_ERROR(
+            verifyFile(filePathName, checksum, fileSize, cipherTypeAes256Gcm, strNew("pass")), CryptoError,
+            "cipher header is aes-256-cbc but aes-256-gcm is required");
 
         //--------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("verifyProtocol()");
@@ -662,6 +668,7 @@ testRun(void)
         varLstAdd(paramList, varNewStr(filePathName));
         varLstAdd(paramList, varNewStr(checksum));
         varLstAdd(paramList, varNewUInt64(fileSize));
+        varLstAdd(paramList, varNewUInt(cipherTypeAes256Cbc));
         varLstAdd(paramList, varNewStrZ("pass"));
 
         TEST_RESULT_BOOL(verifyProtocol(PROTOCOL_COMMAND_VERIFY_FILE_STR, paramList, server), true, "protocol verify file");
@@ -671,6 +678,100 @@ testRun(void)
         TEST_RESULT_BOOL(verifyProtocol(strNew(BOGUS_STR), paramList, server), false, "invalid protocol function");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("VerifyLedger"))
+    {
+        // Load Parameters
+        StringList *argList = strLstDup(argListBase);
+        harnessCfgLoad(cfgCmdVerify, argList);
+
+        const String *ledgerFile = STRDEF(STORAGE_REPO_ARCHIVE "/11-2/" VERIFY_LEDGER_FILE);
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("missing ledger is empty");
+
+        VerifyLedger *ledger = NULL;
+
+        TEST_ASSIGN(ledger, verifyLedgerLoadFile(storageRepo(), ledgerFile, cipherTypeNone, NULL), "load missing ledger");
+        TEST_RESULT_UINT(verifyLedgerFileTotal(ledger), 0, "no files");
+        TEST_RESULT_VOID(verifyLedgerFree(ledger), "free ledger");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("save and load encrypted ledger");
+
+        TEST_ASSIGN(ledger, verifyLedgerNew(), "new ledger");
+        TEST_RESULT_VOID(
+            verifyLedgerFileAdd(
+                ledger,
+                &(VerifyLedgerFile)
+                {
+                    .name = STRDEF("0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306"),
+                    .checksum = STRDEF("ee161f898c9012dd0c28b3fd1e7140b9cf411306"), .size = 16777216,
+                    .timeModified = 1599999999, .timestamp = 1600000001,
+                }),
+            "add file");
+        TEST_RESULT_VOID(
+            verifyLedgerFileAdd(
+                ledger,
+                &(VerifyLedgerFile)
+                {
+                    .name = STRDEF("0000000200000007/000000020000000700000FFE-d1cd8a7d11daa26814b93eb604e1d49ab4b43770"),
+                    .checksum = STRDEF("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), .size = 16777216, .timestamp = 1600000000,
+                }),
+            "add file");
+        TEST_RESULT_VOID(
+            verifyLedgerFileAdd(
+                ledger,
+                &(VerifyLedgerFile)
+                {
+                    .name = STRDEF("0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306"),
+                    .checksum = STRDEF("ee161f898c9012dd0c28b3fd1e7140b9cf411306"), .size = 16777215,
+                    .timeModified = 1599999998, .timestamp = 1600000002,
+                }),
+            "replace file");
+        TEST_RESULT_UINT(verifyLedgerFileTotal(ledger), 2, "two files");
+
+        TEST_RESULT_VOID(
+            verifyLedgerSaveFile(ledger, storageRepoWrite(), ledgerFile, cipherTypeAes256Cbc, STRDEF("pass")), "save ledger");
+        TEST_RESULT_VOID(verifyLedgerFree(ledger), "free ledger");
+
+        TEST_ASSIGN(
+            ledger, verifyLedgerLoadFile(storageRepo(), ledgerFile, cipherTypeAes256Cbc, STRDEF("pass")), "load ledger");
+        TEST_RESULT_UINT(verifyLedgerFileTotal(ledger), 2, "two files");
+        TEST_RESULT_STR_Z(
+            verifyLedgerFile(ledger, 0)->name, "0000000200000007/000000020000000700000FFE-d1cd8a7d11daa26814b93eb604e1d49ab4b43770",
+            "files are sorted");
+
+        const VerifyLedgerFile *file = NULL;
+
+        TEST_ASSIGN(
+            file,
+            verifyLedgerFileFind(
+                ledger, STRDEF("0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306")),
+            "find file");
+        TEST_RESULT_STR_Z(file->checksum, "ee161f898c9012dd0c28b3fd1e7140b9cf411306", "check checksum");
+        TEST_RESULT_UINT(file->size, 16777215, "check size");
+        TEST_RESULT_INT(file->timeModified, 1599999998, "check time modified");
+        TEST_RESULT_INT(file->timestamp, 1600000002, "check timestamp");
+        TEST_RESULT_PTR(verifyLedgerFileFind(ledger, STRDEF(BOGUS_STR)), NULL, "file not found");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("invalid ledger is empty");
+
+        TEST_RESULT_VOID(
+            storagePutP(storageNewWriteP(storageRepoWrite(), ledgerFile), BUFSTRDEF(BOGUS_STR)), "write invalid ledger");
+
+        TEST_ASSIGN(ledger, verifyLedgerLoadFile(storageRepo(), ledgerFile, cipherTypeNone, NULL), "load invalid ledger");
+        TEST_RESULT_UINT(verifyLedgerFileTotal(ledger), 0, "no files");
+        harnessLogResult(
+            strZ(strNewFmt(
+                "P00   WARN: unable to load verify ledger '%s/repo/archive/db/11-2/verify.ledger', all files will be verified: "
+                    "key/value found outside of section at line 1: " BOGUS_STR,
+                testPath())));
+
+        TEST_RESULT_VOID(storageRemoveP(storageRepoWrite(), ledgerFile, .errorOnMissing = true), "remove invalid ledger");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("cmdVerify(), verifyProcess()"))
     {
@@ -909,6 +1010,186 @@ testRun(void)
                 strNewFmt("%s/11-2/0000000200000008/000000020000000800000003-656817043007aa2100c44c712bcb456db705dab9",
                     strZ(archiveStanzaPath))),
             "remove unreadable WAL");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ledger records valid WAL and skips it on the next run");
+
+        argList = strLstDup(argListBase);
+        hrnCfgArgRawBool(argList, cfgOptVerifyLedger, true);
+        hrnCfgArgRawZ(argList, cfgOptVerifySample, "0");
+        harnessCfgLoad(cfgCmdVerify, argList);
+
+        // Set log level to errors only
+        harnessLogLevelSet(logLevelError);
+
+        errorTotal = 0;
+        TEST_RESULT_STR_Z(
+            verifyProcess(&errorTotal),
+            "Results:\n"
+            "  archiveId: 9.4-1, total WAL checked: 0, total valid WAL: 0\n"
+            "  archiveId: 11-2, total WAL checked: 7, total valid WAL: 5\n"
+            "    missing: 0, checksum invalid: 1, size invalid: 1, other: 0",
+            "all WAL verified");
+        TEST_RESULT_UINT(errorTotal, 2, "errors");
+        harnessLogResult(
+            "P01  ERROR: [028]: invalid checksum "
+                "'11-2/0000000200000007/000000020000000700000FFD-a6e1a64f0813352bc2e97f116a1800377e17d2e4.gz'\n"
+            "P01  ERROR: [028]: invalid size "
+                "'11-2/0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306'");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(storageTest, strNewFmt("%s/9.4-1/" VERIFY_LEDGER_FILE, strZ(archiveStanzaPath))), false,
+            "no ledger for empty archive id");
+        TEST_RESULT_UINT(
+            verifyLedgerFileTotal(
+                verifyLedgerLoadFile(
+                    storageRepo(), STRDEF(STORAGE_REPO_ARCHIVE "/11-2/" VERIFY_LEDGER_FILE), cipherTypeNone, NULL)),
+            5, "valid WAL in ledger");
+
+        errorTotal = 0;
+        TEST_RESULT_STR_Z(
+            verifyProcess(&errorTotal),
+            "Results:\n"
+            "  archiveId: 9.4-1, total WAL checked: 0, total valid WAL: 0\n"
+            "  archiveId: 11-2, total WAL checked: 7, total valid WAL: 5 (5 verified by prior run)\n"
+            "    missing: 0, checksum invalid: 1, size invalid: 1, other: 0",
+            "WAL in ledger skipped");
+        TEST_RESULT_UINT(errorTotal, 2, "errors");
+        harnessLogResult(
+            "P01  ERROR: [028]: invalid checksum "
+                "'11-2/0000000200000007/000000020000000700000FFD-a6e1a64f0813352bc2e97f116a1800377e17d2e4.gz'\n"
+            "P01  ERROR: [028]: invalid size "
+                "'11-2/0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306'");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ledger does not skip WAL rewritten in the repo");
+
+        const String *walRewrite = strNewFmt(
+            "%s/11-2/0000000300000000/000000030000000000000000-%s", strZ(archiveStanzaPath), walBufferSha1);
+        Buffer *walBufferBad = bufDup(walBuffer);
+        bufPtr(walBufferBad)[bufUsed(walBufferBad) - 1] ^= 0xFF;
+
+        TEST_RESULT_VOID(
+            storagePutP(storageNewWriteP(storageTest, walRewrite, .timeModified = 1600000000), walBufferBad),
+            "rewrite WAL with the same size");
+
+        errorTotal = 0;
+        TEST_RESULT_STR_Z(
+            verifyProcess(&errorTotal),
+            "Results:\n"
+            "  archiveId: 9.4-1, total WAL checked: 0, total valid WAL: 0\n"
+            "  archiveId: 11-2, total WAL checked: 7, total valid WAL: 4 (4 verified by prior run)\n"
+            "    missing: 0, checksum invalid: 2, size invalid: 1, other: 0",
+            "rewritten WAL verified");
+        TEST_RESULT_UINT(errorTotal, 3, "errors");
+        harnessLogResult(
+            strZ(
+                strNewFmt(
+                    "P01  ERROR: [028]: invalid checksum "
+                        "'11-2/0000000200000007/000000020000000700000FFD-a6e1a64f0813352bc2e97f116a1800377e17d2e4.gz'\n"
+                    "P01  ERROR: [028]: invalid size "
+                        "'11-2/0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306'\n"
+                    "P01  ERROR: [028]: invalid checksum '11-2/0000000300000000/000000030000000000000000-%s'", walBufferSha1)));
+
+        TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageTest, walRewrite), walBuffer), "restore WAL");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ledger not saved when the backup lock is held");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                TEST_RESULT_BOOL(
+                    lockAcquire(cfgOptionStr(cfgOptLockPath), stanza, STRDEF("999-ffffffff"), lockTypeBackup, 0, true), true,
+                    "acquire backup lock");
+
+                sleepMSec(1000);
+                lockRelease(true);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                sleepMSec(250);
+
+                harnessLogLevelSet(logLevelWarn);
+
+                errorTotal = 0;
+                TEST_RESULT_BOOL(
+                    strEndsWithZ(verifyProcess(&errorTotal), "missing: 0, checksum invalid: 1, size invalid: 1, other: 0"), true,
+                    "restored WAL verified");
+                TEST_RESULT_UINT(errorTotal, 2, "errors");
+                harnessLogResult(
+                    "P00   WARN: no backups exist in the repo\n"
+                    "P00   WARN: archive path '9.4-1' is empty\n"
+                    "P00   WARN: path '11-2/0000000100000000' does not contain any valid WAL to be processed\n"
+                    "P01  ERROR: [028]: invalid checksum "
+                        "'11-2/0000000200000007/000000020000000700000FFD-a6e1a64f0813352bc2e97f116a1800377e17d2e4.gz'\n"
+                    "P01  ERROR: [028]: invalid size "
+                        "'11-2/0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306'\n"
+                    "P00   WARN: unable to acquire backup lock, verify ledger not saved");
+
+                harnessLogLevelSet(logLevelError);
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        TEST_RESULT_UINT(
+            verifyLedgerFileTotal(
+                verifyLedgerLoadFile(
+                    storageRepo(), STRDEF(STORAGE_REPO_ARCHIVE "/11-2/" VERIFY_LEDGER_FILE), cipherTypeNone, NULL)),
+            4, "ledger not updated");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ledger sample verifies all WAL again");
+
+        argList = strLstDup(argListBase);
+        hrnCfgArgRawBool(argList, cfgOptVerifyLedger, true);
+        hrnCfgArgRawZ(argList, cfgOptVerifySample, "100");
+        harnessCfgLoad(cfgCmdVerify, argList);
+
+        errorTotal = 0;
+        TEST_RESULT_STR_Z(
+            verifyProcess(&errorTotal),
+            "Results:\n"
+            "  archiveId: 9.4-1, total WAL checked: 0, total valid WAL: 0\n"
+            "  archiveId: 11-2, total WAL checked: 7, total valid WAL: 5\n"
+            "    missing: 0, checksum invalid: 1, size invalid: 1, other: 0",
+            "WAL in ledger verified again");
+        TEST_RESULT_UINT(errorTotal, 2, "errors");
+        harnessLogResult(
+            "P01  ERROR: [028]: invalid checksum "
+                "'11-2/0000000200000007/000000020000000700000FFD-a6e1a64f0813352bc2e97f116a1800377e17d2e4.gz'\n"
+            "P01  ERROR: [028]: invalid size "
+                "'11-2/0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306'");
+
+        harnessLogLevelReset();
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ledger sample of some WAL");
+
+        argList = strLstDup(argListBase);
+        hrnCfgArgRawBool(argList, cfgOptVerifyLedger, true);
+        hrnCfgArgRawZ(argList, cfgOptVerifySample, "50");
+        harnessCfgLoad(cfgCmdVerify, argList);
+
+        // Which WAL are sampled is random so only check the totals
+        harnessLogLevelSet(logLevelError);
+
+        errorTotal = 0;
+        TEST_RESULT_BOOL(
+            strEndsWithZ(verifyProcess(&errorTotal), "missing: 0, checksum invalid: 1, size invalid: 1, other: 0"), true,
+            "sampled WAL verified");
+        TEST_RESULT_UINT(errorTotal, 2, "errors");
+        harnessLogResult(
+            "P01  ERROR: [028]: invalid checksum "
+                "'11-2/0000000200000007/000000020000000700000FFD-a6e1a64f0813352bc2e97f116a1800377e17d2e4.gz'\n"
+            "P01  ERROR: [028]: invalid size "
+                "'11-2/0000000200000007/000000020000000700000FFF-ee161f898c9012dd0c28b3fd1e7140b9cf411306'");
+
+        harnessLogLevelReset();
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
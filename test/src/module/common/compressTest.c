@@ -168,6 +168,122 @@ testSuite(CompressType type, const char *decompressCmd)
         "non-zero data - decompress large in/small out buffer");
 }
 
+#if defined(HAVE_LIBLZ4) || defined(HAVE_LIBZST)
+/***********************************************************************************************************************************
+Frame test suite to be applied to compression types that support frames
+***********************************************************************************************************************************/
+static void
+testFrameSuite(CompressType type, const char *decompressCmd)
+{
+    Storage *storageTest = storagePosixNewP(strNew(testPath()), .write = true);
+
+    Buffer *decompressed = bufNew(256 * 1024 + 1000);
+    unsigned char *chr = bufPtr(decompressed);
+
+    for (size_t chrIdx = 0; chrIdx < bufSize(decompressed); chrIdx++)
+        chr[chrIdx] = (unsigned char)(chrIdx % 94 + chrIdx / 4096 % 7 + 32);
+
+    bufUsedSet(decompressed, bufSize(decompressed));
+
+    // -------------------------------------------------------------------------------------------------------------------------
+    TEST_TITLE("compress frames");
+
+    TEST_RESULT_BOOL(compressTypeFrame(type), true, "frames supported");
+
+    Buffer *compressed = NULL;
+
+    TEST_ASSIGN(
+        compressed, testCompress(compressFilterFrame(type, 1, 64 * 1024), decompressed, 100000, 1024 * 1024),
+        "compress large in/large out buffer");
+    TEST_RESULT_UINT(bufPtr(compressed)[bufUsed(compressed) - COMPRESS_FRAME_FOOTER_SIZE], 5, "check frame total");
+    TEST_RESULT_BOOL(memcmp(bufPtr(compressed) + bufUsed(compressed) - 4, "\xB1\xEA\x92\x8F", 4) == 0, true, "check magic");
+
+    // -------------------------------------------------------------------------------------------------------------------------
+    TEST_TITLE("decompress a range using the index");
+
+    size_t indexSize = 0;
+
+    TEST_ASSIGN(
+        indexSize,
+        compressFrameIndexSize(
+            BUF(bufPtr(compressed) + bufUsed(compressed) - COMPRESS_FRAME_FOOTER_SIZE, COMPRESS_FRAME_FOOTER_SIZE)),
+        "index size");
+    TEST_RESULT_UINT(
+        indexSize, COMPRESS_FRAME_HEADER_SIZE + 5 * COMPRESS_FRAME_ENTRY_SIZE + COMPRESS_FRAME_FOOTER_SIZE, "check size");
+
+    CompressFrameRange range = {0};
+
+    TEST_ASSIGN(
+        range, compressFrameIndexRange(BUF(bufPtr(compressed) + bufUsed(compressed) - indexSize, indexSize), 100000, 70000),
+        "range");
+    TEST_RESULT_UINT(range.skip, 100000 - 64 * 1024, "check skip");
+
+    Buffer *rangeDecompressed = testDecompress(
+        decompressFilter(type), bufNewC(bufPtr(compressed) + range.offset, (size_t)range.size), 1024, 1024);
+
+    TEST_RESULT_UINT(bufUsed(rangeDecompressed), 2 * 64 * 1024, "check decompressed size");
+    TEST_RESULT_BOOL(
+        memcmp(bufPtr(rangeDecompressed) + range.skip, bufPtr(decompressed) + 100000, 70000) == 0, true, "check range");
+
+    TEST_RESULT_BOOL(
+        bufEq(compressed, testCompress(compressFilterFrame(type, 1, 64 * 1024), decompressed, 7, 13)), true,
+        "compress small in/small out buffer");
+
+    VariantList *paramList = varLstNew();
+    varLstAdd(paramList, varNewInt(1));
+    varLstAdd(paramList, varNewUInt64(64 * 1024));
+
+    TEST_RESULT_BOOL(
+        bufEq(
+            compressed,
+            testCompress(
+                compressFilterVar(strNewFmt("%sCompress", strZ(compressTypeStr(type))), paramList), decompressed, 65536,
+                65536)),
+        true, "compress with filter var");
+
+    // -------------------------------------------------------------------------------------------------------------------------
+    TEST_TITLE("decompress frames");
+
+    TEST_RESULT_BOOL(
+        bufEq(decompressed, testDecompress(decompressFilter(type), compressed, 1024, 1024)), true,
+        "decompress large in/large out buffer");
+    TEST_RESULT_BOOL(
+        bufEq(decompressed, testDecompress(decompressFilter(type), compressed, 333, 77)), true,
+        "decompress small in/small out buffer");
+
+    storagePutP(storageNewWriteP(storageTest, STRDEF("test.cmp")), compressed);
+    TEST_SYSTEM_FMT("%s {[path]}/test.cmp > {[path]}/test.out", decompressCmd);
+    TEST_RESULT_BOOL(
+        bufEq(decompressed, storageGetP(storageNewReadP(storageTest, STRDEF("test.out")))), true,
+        "decompress with command-line tool");
+
+    // -------------------------------------------------------------------------------------------------------------------------
+    TEST_TITLE("input ends on a frame boundary");
+
+    bufUsedSet(decompressed, 128 * 1024);
+    decompressed = bufDup(decompressed);
+
+    TEST_ASSIGN(
+        compressed, testCompress(compressFilterFrame(type, 1, 64 * 1024), decompressed, 64 * 1024, 1024 * 1024), "compress");
+    TEST_RESULT_UINT(bufPtr(compressed)[bufUsed(compressed) - COMPRESS_FRAME_FOOTER_SIZE], 2, "check frame total");
+    TEST_RESULT_BOOL(bufEq(decompressed, testDecompress(decompressFilter(type), compressed, 1024, 1024)), true, "decompress");
+
+    // -------------------------------------------------------------------------------------------------------------------------
+    TEST_TITLE("compress zero bytes");
+
+    TEST_ASSIGN(compressed, testCompress(compressFilterFrame(type, 1, 1024), bufNew(0), 1, 1), "compress");
+    TEST_RESULT_UINT(bufPtr(compressed)[bufUsed(compressed) - COMPRESS_FRAME_FOOTER_SIZE], 1, "check frame total");
+    TEST_RESULT_UINT(bufUsed(testDecompress(decompressFilter(type), compressed, 1024, 1024)), 0, "decompress");
+
+    // -------------------------------------------------------------------------------------------------------------------------
+    TEST_TITLE("compressFrameToLog()");
+
+    TEST_RESULT_STR_Z(
+        compressFrameToLog(ioFilterDriver(compressFilterFrame(type, 1, 1024))),
+        "{frameSize: 1024, frameTotal: 0, inputSame: false, flushing: false, done: false}", "format object");
+}
+#endif
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -182,6 +298,120 @@ testRun(void)
         // Run standard test suite
         testSuite(compressTypeGz, "gzip -dc");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("decompress concatenated members");
+
+        Buffer *member = testCompress(gzCompressNew(3), bufNewC("ABCDEFGHIJ", 10), 1024, 1024);
+        Buffer *compressed = bufDup(member);
+        bufCat(compressed, testCompress(gzCompressNew(3), bufNewC("0123456789", 10), 1024, 1024));
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), compressed, 1024, 1024)), "ABCDEFGHIJ0123456789",
+            "decompress large in/large out buffer");
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), compressed, bufUsed(member), 1)), "ABCDEFGHIJ0123456789",
+            "decompress member size in/small out buffer");
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), compressed, 1, 1)), "ABCDEFGHIJ0123456789",
+            "decompress small in/small out buffer");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ignore trailing data after the last member");
+
+        Buffer *trailing = bufDup(compressed);
+        bufCat(trailing, BUFSTRDEF("BOGUS"));
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), trailing, 1024, 1024)), "ABCDEFGHIJ0123456789",
+            "decompress large in/large out buffer");
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), trailing, bufUsed(compressed), 1)), "ABCDEFGHIJ0123456789",
+            "decompress member size in/small out buffer");
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), trailing, 1, 1)), "ABCDEFGHIJ0123456789",
+            "decompress small in/small out buffer");
+
+        trailing = bufDup(member);
+        bufCat(trailing, BUFSTRDEF("\x1f" "BOGUS"));
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), trailing, 1024, 1024)), "ABCDEFGHIJ", "first magic byte only");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("decompress existing file with concatenated members and trailing zeros");
+
+        Storage *storageTest = storagePosixNewP(strNew(testPath()), .write = true);
+
+        TEST_SYSTEM(
+            "printf 'ABCDEFGHIJ' | gzip -c > {[path]}/multi.gz && printf '0123456789' | gzip -c >> {[path]}/multi.gz &&"
+                " head -c 512 /dev/zero >> {[path]}/multi.gz");
+
+        compressed = storageGetP(storageNewReadP(storageTest, STRDEF("multi.gz")));
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), compressed, 1024, 1024)), "ABCDEFGHIJ0123456789",
+            "decompress large in/large out buffer");
+        TEST_RESULT_STR_Z(
+            strNewBuf(testDecompress(gzDecompressNew(), compressed, 1, 1)), "ABCDEFGHIJ0123456789",
+            "decompress small in/small out buffer");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress input larger than the block size");
+
+        Buffer *decompressed = bufNew(GZ_COMPRESS_BLOCK_SIZE * 2 + GZ_COMPRESS_BLOCK_SIZE / 2);
+        unsigned char *chr = bufPtr(decompressed);
+
+        for (size_t chrIdx = 0; chrIdx < bufSize(decompressed); chrIdx++)
+            chr[chrIdx] = (unsigned char)(chrIdx % 94 + chrIdx / 4096 % 7 + 32);
+
+        bufUsedSet(decompressed, bufSize(decompressed));
+
+        TEST_ASSIGN(compressed, testCompress(gzCompressNew(3), decompressed, 65536, 65536), "compress");
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(gzCompressNew(3), decompressed, 100000, 7)), true, "compress odd in/small out buffer");
+
+        // Inflate only the first member to check that the output is a single member, which older versions require
+        z_stream stream = {.zalloc = NULL};
+        unsigned char *member1 = memNew(bufUsed(decompressed));
+
+        TEST_RESULT_INT(inflateInit2(&stream, WANT_GZ | WINDOW_BITS), Z_OK, "init inflate");
+
+        stream.next_in = bufPtr(compressed);
+        stream.avail_in = (unsigned int)bufUsed(compressed);
+        stream.next_out = member1;
+        stream.avail_out = (unsigned int)bufUsed(decompressed);
+
+        TEST_RESULT_INT(inflate(&stream, Z_NO_FLUSH), Z_STREAM_END, "inflate first member");
+        TEST_RESULT_UINT(stream.total_out, bufUsed(decompressed), "single member");
+        TEST_RESULT_UINT(stream.avail_in, 0, "no data after member");
+        TEST_RESULT_INT(inflateEnd(&stream), Z_OK, "end inflate");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(gzDecompressNew(), compressed, 65536, 65536)), true, "decompress");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(gzDecompressNew(), compressed, 7, 100000)), true,
+            "decompress small in/odd out buffer");
+
+        storagePutP(storageNewWriteP(storageTest, STRDEF("test.gz")), compressed);
+        TEST_SYSTEM("gzip -dc {[path]}/test.gz > {[path]}/test.out");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, storageGetP(storageNewReadP(storageTest, STRDEF("test.out")))), true,
+            "decompress with command-line tool");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress input equal to the block size and at level 0");
+
+        decompressed = bufNewC(bufPtr(decompressed), GZ_COMPRESS_BLOCK_SIZE);
+
+        TEST_ASSIGN(compressed, testCompress(gzCompressNew(3), decompressed, 65536, 65536), "compress");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(gzDecompressNew(), compressed, 65536, 65536)), true, "decompress");
+
+        TEST_ASSIGN(compressed, testCompress(gzCompressNew(0), decompressed, 65536, 7), "compress level 0");
+        TEST_RESULT_BOOL(bufUsed(compressed) > GZ_COMPRESS_BLOCK_SIZE, true, "stored");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(gzDecompressNew(), compressed, 65536, 65536)), true, "decompress level 0");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("gzError()");
 
@@ -258,6 +488,7 @@ testRun(void)
 #ifdef HAVE_LIBLZ4
         // Run standard test suite
         testSuite(compressTypeLz4, "lz4 -dc");
+        testFrameSuite(compressTypeLz4, "lz4 -dc");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("lz4Error()");
@@ -296,6 +527,7 @@ testRun(void)
 #ifdef HAVE_LIBZST
         // Run standard test suite
         testSuite(compressTypeZst, "zstd -dc");
+        testFrameSuite(compressTypeZst, "zstd -dc");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("zstError()");
@@ -356,6 +588,75 @@ testRun(void)
 
         TEST_RESULT_PTR(compressFilterVar(STRDEF("BOGUS"), 0), NULL, "no filter match");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressFilterFrame()");
+
+        IoFilter *filter = NULL;
+
+        TEST_ASSIGN(filter, compressFilterFrame(compressTypeGz, 6, 1024), "gz does not support frames");
+        TEST_RESULT_STR_Z(ioFilterType(filter), GZ_COMPRESS_FILTER_TYPE, "check filter type");
+        TEST_RESULT_UINT(varLstSize(ioFilterParamList(filter)), 1, "check param list");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressTypeFrame()");
+
+        TEST_RESULT_BOOL(compressTypeFrame(compressTypeNone), false, "none does not support frames");
+        TEST_RESULT_BOOL(compressTypeFrame(compressTypeGz), false, "gz does not support frames");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressFrameIndexSize()");
+
+        // Index with two frames, the first 100 bytes compressed to 10 bytes and the second 50 bytes compressed to 20 bytes
+        const Buffer *index = BUF(
+            (const unsigned char *)
+            "\x5E\x2A\x4D\x18\x19\x00\x00\x00"
+            "\x0A\x00\x00\x00\x64\x00\x00\x00"
+            "\x14\x00\x00\x00\x32\x00\x00\x00"
+            "\x02\x00\x00\x00\x00\xB1\xEA\x92\x8F",
+            33);
+
+        // Same index with a checksum in each entry
+        const Buffer *indexChecksum = BUF(
+            (const unsigned char *)
+            "\x5E\x2A\x4D\x18\x21\x00\x00\x00"
+            "\x0A\x00\x00\x00\x64\x00\x00\x00\xFF\xFF\xFF\xFF"
+            "\x14\x00\x00\x00\x32\x00\x00\x00\xFF\xFF\xFF\xFF"
+            "\x02\x00\x00\x00\x80\xB1\xEA\x92\x8F",
+            41);
+
+        TEST_RESULT_UINT(compressFrameIndexSize(BUF(bufPtrConst(index) + 24, 9)), 33, "index size");
+        TEST_RESULT_UINT(compressFrameIndexSize(BUF(bufPtrConst(indexChecksum) + 32, 9)), 41, "index size with checksum");
+        TEST_RESULT_UINT(compressFrameIndexSize(BUFSTRDEF("123456789")), 0, "no index");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressFrameIndexRange()");
+
+        CompressFrameRange range = {0};
+
+        TEST_ASSIGN(range, compressFrameIndexRange(index, 0, 100), "first frame");
+        TEST_RESULT_UINT(range.offset, 0, "check offset");
+        TEST_RESULT_UINT(range.size, 10, "check size");
+        TEST_RESULT_UINT(range.skip, 0, "check skip");
+
+        TEST_ASSIGN(range, compressFrameIndexRange(index, 50, 60), "range across frames");
+        TEST_RESULT_UINT(range.offset, 0, "check offset");
+        TEST_RESULT_UINT(range.size, 30, "check size");
+        TEST_RESULT_UINT(range.skip, 50, "check skip");
+
+        TEST_ASSIGN(range, compressFrameIndexRange(indexChecksum, 120, 10), "second frame with checksum");
+        TEST_RESULT_UINT(range.offset, 10, "check offset");
+        TEST_RESULT_UINT(range.size, 20, "check size");
+        TEST_RESULT_UINT(range.skip, 20, "check skip");
+
+        TEST_ASSIGN(range, compressFrameIndexRange(index, 200, 10), "offset past end");
+        TEST_RESULT_UINT(range.offset, 10, "check offset");
+        TEST_RESULT_UINT(range.size, 20, "check size");
+        TEST_RESULT_UINT(range.skip, 100, "check skip");
+
+        TEST_ERROR(compressFrameIndexRange(BUFSTRDEF("bogus"), 0, 1), FormatError, "invalid compress frame index");
+        TEST_ERROR(
+            compressFrameIndexRange(BUF(bufPtrConst(index) + 1, 32), 0, 1), FormatError, "invalid compress frame index");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("compressExtStr()");
 
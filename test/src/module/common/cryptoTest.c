@@ -1,6 +1,7 @@
 /***********************************************************************************************************************************
 Test Block Cipher
 ***********************************************************************************************************************************/
+#include "common/io/bufferRead.h"
 #include "common/io/filter/filter.intern.h"
 #include "common/io/io.h"
 #include "common/type/json.h"
@@ -13,6 +14,19 @@ Data for testing
 #define TEST_PLAINTEXT                                              "plaintext"
 #define TEST_BUFFER_SIZE                                            256
 
+/***********************************************************************************************************************************
+Run a buffer through a cipher filter
+***********************************************************************************************************************************/
+static Buffer *
+testCipher(CipherMode mode, CipherType cipherType, const Buffer *source)
+{
+    IoRead *read = ioBufferReadNew(source);
+    ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(mode, cipherType, BUFSTRDEF("areallybadpassphrase"), NULL));
+    ioReadOpen(read);
+
+    return ioReadBuf(read);
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -49,10 +63,12 @@ testRun(void)
         TEST_ERROR(cipherType(strNew(BOGUS_STR)), AssertError, "invalid cipher name 'BOGUS'");
         TEST_RESULT_UINT(cipherType(strNew("none")), cipherTypeNone, "none type");
         TEST_RESULT_UINT(cipherType(strNew("aes-256-cbc")), cipherTypeAes256Cbc, "aes-256-cbc type");
+        TEST_RESULT_UINT(cipherType(strNew("aes-256-gcm")), cipherTypeAes256Gcm, "aes-256-gcm type");
 
-        TEST_ERROR(cipherTypeName((CipherType)2), AssertError, "invalid cipher type 2");
+        TEST_ERROR(cipherTypeName((CipherType)3), AssertError, "invalid cipher type 3");
         TEST_RESULT_STR_Z(cipherTypeName(cipherTypeNone), "none", "none name");
         TEST_RESULT_STR_Z(cipherTypeName(cipherTypeAes256Cbc), "aes-256-cbc", "aes-256-cbc name");
+        TEST_RESULT_STR_Z(cipherTypeName(cipherTypeAes256Gcm), "aes-256-gcm", "aes-256-gcm name");
 
         // Test if the buffer was overrun
         // -------------------------------------------------------------------------------------------------------------------------
@@ -286,6 +302,176 @@ testRun(void)
 
         ioFilterFree(blockDecryptFilter);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("authenticated format");
+
+        Buffer *plainBuffer = bufNew(CIPHER_BLOCK_AEAD_CHUNK_SIZE * 3 + 777);
+
+        for (size_t byteIdx = 0; byteIdx < bufSize(plainBuffer); byteIdx++)
+            bufPtr(plainBuffer)[byteIdx] = (unsigned char)(byteIdx % 251);
+
+        bufUsedSet(plainBuffer, bufSize(plainBuffer));
+
+        Buffer *aeadBuffer = NULL;
+
+        TEST_ASSIGN(aeadBuffer, testCipher(cipherModeEncrypt, cipherTypeAes256Gcm, plainBuffer), "encrypt");
+        TEST_RESULT_UINT(
+            bufUsed(aeadBuffer), CIPHER_BLOCK_HEADER_SIZE + bufUsed(plainBuffer) + 4 * CIPHER_BLOCK_AEAD_TAG_SIZE, "check size");
+        TEST_RESULT_BOOL(
+            memcmp(bufPtr(aeadBuffer), CIPHER_BLOCK_MAGIC_AEAD, CIPHER_BLOCK_MAGIC_SIZE) == 0, true, "check header magic");
+        TEST_RESULT_BOOL(
+            bufEq(testCipher(cipherModeDecrypt, cipherTypeAes256Gcm, aeadBuffer), plainBuffer), true, "decrypt");
+        TEST_RESULT_BOOL(
+            bufEq(testCipher(cipherModeDecrypt, cipherTypeAes256Cbc, aeadBuffer), plainBuffer), true,
+            "decrypt with cbc cipher type");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("unauthenticated format requires compatibility when authenticated format is configured");
+
+        Buffer *cbcBuffer = testCipher(cipherModeEncrypt, cipherTypeAes256Cbc, plainBuffer);
+
+        TEST_ERROR(
+            testCipher(cipherModeDecrypt, cipherTypeAes256Gcm, cbcBuffer), CryptoError,
+            "cipher header is aes-256-cbc but aes-256-gcm is required");
+
+        TEST_RESULT_VOID(cipherBlockCompatSet(true), "enable compatibility");
+
+        IoFilter *compatFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL);
+
+        TEST_RESULT_VOID(cipherBlockCompatSet(false), "disable compatibility");
+
+        // The filter recreated from its parameters keeps the compatibility setting it was created with
+        IoRead *read = ioBufferReadNew(cbcBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNewVar(ioFilterParamList(compatFilter)));
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(read), plainBuffer), true, "decrypt cbc with gcm cipher type");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("authenticated format with exact chunk multiple and zero bytes");
+
+        bufUsedSet(plainBuffer, CIPHER_BLOCK_AEAD_CHUNK_SIZE * 2);
+
+        TEST_ASSIGN(aeadBuffer, testCipher(cipherModeEncrypt, cipherTypeAes256Gcm, plainBuffer), "encrypt");
+        TEST_RESULT_UINT(
+            bufUsed(aeadBuffer), CIPHER_BLOCK_HEADER_SIZE + bufUsed(plainBuffer) + 2 * CIPHER_BLOCK_AEAD_TAG_SIZE, "check size");
+        TEST_RESULT_BOOL(
+            bufEq(testCipher(cipherModeDecrypt, cipherTypeAes256Gcm, aeadBuffer), plainBuffer), true, "decrypt");
+
+        TEST_ASSIGN(aeadBuffer, testCipher(cipherModeEncrypt, cipherTypeAes256Gcm, bufNew(0)), "encrypt zero bytes");
+        TEST_RESULT_UINT(bufUsed(aeadBuffer), CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE, "check size");
+        TEST_RESULT_UINT(bufUsed(testCipher(cipherModeDecrypt, cipherTypeAes256Gcm, aeadBuffer)), 0, "decrypt zero bytes");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("authenticated format detects modification and truncation");
+
+        TEST_ASSIGN(aeadBuffer, testCipher(cipherModeEncrypt, cipherTypeAes256Gcm, plainBuffer), "encrypt");
+
+        bufPtr(aeadBuffer)[CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_CHUNK_SIZE + 99] ^= 0x01;
+        TEST_ERROR(
+            testCipher(cipherModeDecrypt, cipherTypeAes256Gcm, aeadBuffer), CryptoError, "cipher authentication failed");
+        bufPtr(aeadBuffer)[CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_CHUNK_SIZE + 99] ^= 0x01;
+
+        bufUsedSet(aeadBuffer, CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_CHUNK_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE);
+        TEST_ERROR(
+            testCipher(cipherModeDecrypt, cipherTypeAes256Gcm, aeadBuffer), CryptoError, "cipher authentication failed");
+
+        bufUsedSet(aeadBuffer, CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE - 1);
+        TEST_ERROR(testCipher(cipherModeDecrypt, cipherTypeAes256Gcm, aeadBuffer), CryptoError, "cipher data truncated");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("authenticated format decrypts a range of chunks");
+
+        bufUsedSet(plainBuffer, bufSize(plainBuffer));
+
+        TEST_ASSIGN(aeadBuffer, testCipher(cipherModeEncrypt, cipherTypeAes256Gcm, plainBuffer), "encrypt");
+        TEST_RESULT_UINT(cipherBlockAeadSize(bufUsed(aeadBuffer)), bufUsed(plainBuffer), "check plaintext size");
+        TEST_RESULT_UINT(
+            cipherBlockAeadSize(CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE), 0, "check plaintext size of zero bytes");
+        TEST_RESULT_BOOL(cipherBlockHeaderAead(BUF(bufPtr(aeadBuffer), CIPHER_BLOCK_HEADER_SIZE)), true, "check gcm header");
+        TEST_RESULT_BOOL(cipherBlockHeaderAead(BUF(bufPtr(cbcBuffer), CIPHER_BLOCK_HEADER_SIZE)), false, "check cbc header");
+
+        CipherBlockRange range = cipherBlockAeadRange(bufUsed(aeadBuffer), CIPHER_BLOCK_AEAD_CHUNK_SIZE + 100, 1000);
+        TEST_RESULT_UINT(range.chunkNo, 1, "check chunk");
+        TEST_RESULT_UINT(range.offset, CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE, "check offset");
+        TEST_RESULT_UINT(range.size, CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE, "check size");
+        TEST_RESULT_UINT(range.skip, 100, "check skip");
+        TEST_RESULT_BOOL(range.final, false, "check not final");
+
+        // The filter recreated from its parameters starts at the same chunk
+        Buffer *rangeBuffer = bufNew(CIPHER_BLOCK_HEADER_SIZE + (size_t)range.size);
+        bufCatSub(rangeBuffer, aeadBuffer, 0, CIPHER_BLOCK_HEADER_SIZE);
+        bufCatSub(rangeBuffer, aeadBuffer, (size_t)range.offset, (size_t)range.size);
+
+        read = ioBufferReadNew(rangeBuffer);
+        ioFilterGroupAdd(
+            ioReadFilterGroup(read),
+            cipherBlockNewVar(ioFilterParamList(cipherBlockNewRange(testPass, NULL, range.chunkNo, range.final))));
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(
+            bufEq(ioReadBuf(read), BUF(bufPtr(plainBuffer) + CIPHER_BLOCK_AEAD_CHUNK_SIZE, CIPHER_BLOCK_AEAD_CHUNK_SIZE)), true,
+            "decrypt chunk");
+
+        range = cipherBlockAeadRange(bufUsed(aeadBuffer), CIPHER_BLOCK_AEAD_CHUNK_SIZE * 2 - 10, CIPHER_BLOCK_AEAD_CHUNK_SIZE * 2);
+        TEST_RESULT_UINT(range.chunkNo, 1, "check chunk");
+        TEST_RESULT_UINT(range.size, CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE * 2 + 777 + CIPHER_BLOCK_AEAD_TAG_SIZE, "check size");
+        TEST_RESULT_UINT(range.skip, CIPHER_BLOCK_AEAD_CHUNK_SIZE - 10, "check skip");
+        TEST_RESULT_BOOL(range.final, true, "check final");
+
+        bufUsedZero(rangeBuffer);
+        bufResize(rangeBuffer, CIPHER_BLOCK_HEADER_SIZE + (size_t)range.size);
+        bufCatSub(rangeBuffer, aeadBuffer, 0, CIPHER_BLOCK_HEADER_SIZE);
+        bufCatSub(rangeBuffer, aeadBuffer, (size_t)range.offset, (size_t)range.size);
+
+        read = ioBufferReadNew(rangeBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNewRange(testPass, NULL, range.chunkNo, range.final));
+        ioReadOpen(read);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                ioReadBuf(read),
+                BUF(bufPtr(plainBuffer) + CIPHER_BLOCK_AEAD_CHUNK_SIZE, bufUsed(plainBuffer) - CIPHER_BLOCK_AEAD_CHUNK_SIZE)),
+            true, "decrypt chunks to the end");
+
+        range = cipherBlockAeadRange(bufUsed(aeadBuffer), bufUsed(plainBuffer) + 10, 10);
+        TEST_RESULT_UINT(range.chunkNo, 3, "check chunk when range is past the end");
+        TEST_RESULT_UINT(range.skip, 777 + 10, "check skip when range is past the end");
+
+        range = cipherBlockAeadRange(CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_TAG_SIZE, 0, 10);
+        TEST_RESULT_UINT(range.size, CIPHER_BLOCK_AEAD_TAG_SIZE, "check size of zero bytes");
+        TEST_RESULT_BOOL(range.final, true, "check final of zero bytes");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("authenticated format range errors");
+
+        // Chunks decrypted with the wrong chunk number fail authentication
+        bufUsedZero(rangeBuffer);
+        bufCatSub(rangeBuffer, aeadBuffer, 0, CIPHER_BLOCK_HEADER_SIZE);
+        bufCatSub(
+            rangeBuffer, aeadBuffer, CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE * 2,
+            CIPHER_BLOCK_AEAD_CHUNK_FILE_SIZE);
+
+        read = ioBufferReadNew(rangeBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNewRange(testPass, NULL, 1, false));
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), CryptoError, "cipher authentication failed");
+
+        // A chunk that is not final fails authentication when read as final
+        read = ioBufferReadNew(rangeBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNewRange(testPass, NULL, 2, true));
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), CryptoError, "cipher authentication failed");
+
+        // The unauthenticated format cannot be decrypted starting at a chunk
+        read = ioBufferReadNew(cbcBuffer);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNewRange(testPass, NULL, 1, false));
+        ioReadOpen(read);
+
+        TEST_ERROR(ioReadBuf(read), CryptoError, "cipher header is aes-256-cbc but aes-256-gcm is required");
+
         // Helper function
         // -------------------------------------------------------------------------------------------------------------------------
         IoFilterGroup *filterGroup = ioFilterGroupNew();
@@ -4,6 +4,7 @@ Test IO
 #include <fcntl.h>
 #include <netdb.h>
 
+#include "common/stat.h"
 #include "common/type/json.h"
 
 #include "common/harnessFork.h"
@@ -277,10 +278,18 @@ testRun(void)
         TEST_ASSIGN(
             read, ioReadNewP((void *)999, .close = testIoReadClose, .open = testIoReadOpen, .read = testIoRead),
             "create io read object");
+        TEST_RESULT_VOID(ioReadProfileSet(read, STRDEF("test.read")), "    set profile");
+
+        statProfileSet(true);
 
         TEST_RESULT_BOOL(ioReadOpen(read), true, "    open io object");
         TEST_RESULT_BOOL(ioReadReadyP(read), true, "read defaults to ready");
         TEST_RESULT_UINT(ioRead(read, buffer), 2, "    read 2 bytes");
+
+        statProfileSet(false);
+
+        TEST_RESULT_BOOL(kvKeyExists(statToKv(), VARSTRDEF("test.read.open.usec")), true, "    check open profile");
+        TEST_RESULT_BOOL(kvKeyExists(statToKv(), VARSTRDEF("test.read.usec")), true, "    check read profile");
         TEST_RESULT_BOOL(ioReadEof(read), false, "    no eof");
         TEST_RESULT_VOID(ioReadClose(read), "    close io object");
         TEST_RESULT_BOOL(testIoReadCloseCalled, true, "    check io object closed");
@@ -461,6 +470,40 @@ testRun(void)
 
         TEST_RESULT_STR_Z(strNewBuf(ioReadBuf(bufferRead)), "a test string", "read into buffer");
 
+        // Read a range of IO
+        // -------------------------------------------------------------------------------------------------------------------------
+        bufferRead = ioBufferReadNew(BUFSTRDEF("0123456789abcdef"));
+        ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioRangeNew(4, 7));
+        ioReadOpen(bufferRead);
+
+        TEST_RESULT_STR_Z(strNewBuf(ioReadBuf(bufferRead)), "456789a", "read range");
+
+        bufferRead = ioBufferReadNew(BUFSTRDEF("0123"));
+        ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioRangeNew(6, 2));
+        ioReadOpen(bufferRead);
+
+        TEST_RESULT_UINT(bufUsed(ioReadBuf(bufferRead)), 0, "read range past end");
+
+        IoFilter *range = NULL;
+        TEST_ASSIGN(range, ioRangeNewVar(ioFilterParamList(ioRangeNew(2, 5))), "new range from params");
+
+        buffer = bufNew(2);
+        TEST_RESULT_VOID(ioFilterProcessInOut(range, BUFSTRDEF("012345"), buffer), "process input larger than output");
+        TEST_RESULT_STR_Z(strNewBuf(buffer), "23", "    check output");
+        TEST_RESULT_BOOL(ioFilterInputSame(range), true, "    same input required");
+        TEST_RESULT_STR_Z(
+            ioRangeToLog(ioFilterDriver(range)), "{offset: 2, size: 5, current: 4, inputSame: true}", "    check log");
+
+        bufUsedZero(buffer);
+        TEST_RESULT_VOID(ioFilterProcessInOut(range, BUFSTRDEF("012345"), buffer), "process same input");
+        TEST_RESULT_STR_Z(strNewBuf(buffer), "45", "    check output");
+        TEST_RESULT_BOOL(ioFilterInputSame(range), false, "    new input required");
+
+        bufUsedZero(buffer);
+        TEST_RESULT_VOID(ioFilterProcessInOut(range, BUFSTRDEF("6789"), buffer), "process input past range");
+        TEST_RESULT_STR_Z(strNewBuf(buffer), "6", "    check output");
+        TEST_RESULT_BOOL(ioFilterInputSame(range), false, "    new input required");
+
         // Drain read IO
         // -------------------------------------------------------------------------------------------------------------------------
         bufferRead = ioBufferReadNew(BUFSTRDEF("a better test string"));
@@ -485,6 +528,9 @@ testRun(void)
         TEST_ASSIGN(
             write, ioWriteNewP((void *)999, .close = testIoWriteClose, .open = testIoWriteOpen, .write = testIoWrite),
             "create io write object");
+        TEST_RESULT_VOID(ioWriteProfileSet(write, STRDEF("test.write")), "    set profile");
+
+        statProfileSet(true);
 
         TEST_RESULT_VOID(ioWriteOpen(write), "    open io object");
         TEST_RESULT_BOOL(ioWriteReadyP(write), true, "write defaults to ready");
@@ -493,6 +539,12 @@ testRun(void)
         TEST_RESULT_VOID(ioWriteClose(write), "    close io object");
         TEST_RESULT_BOOL(testIoWriteCloseCalled, true, "    check io object closed");
 
+        statProfileSet(false);
+
+        TEST_RESULT_BOOL(kvKeyExists(statToKv(), VARSTRDEF("test.write.open.usec")), true, "    check open profile");
+        TEST_RESULT_BOOL(kvKeyExists(statToKv(), VARSTRDEF("test.write.usec")), true, "    check write profile");
+        TEST_RESULT_BOOL(kvKeyExists(statToKv(), VARSTRDEF("test.write.close.usec")), true, "    check close profile");
+
         TEST_RESULT_VOID(ioWriteFree(write), "    free write object");
 
         // -------------------------------------------------------------------------------------------------------------------------
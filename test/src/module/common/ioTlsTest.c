@@ -6,6 +6,8 @@ Test Tls Client
 
 #include "common/io/fdRead.h"
 #include "common/io/fdWrite.h"
+#include "common/io/socket/server.h"
+#include "common/io/tls/server.h"
 
 #include "common/harnessFork.h"
 #include "common/harnessServer.h"
@@ -214,14 +216,15 @@ testRun(void)
         // Connection errors
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ASSIGN(
-            client, tlsClientNew(sckClientNew(strNew("99.99.99.99.99"), 7777, 0), strNew("X"), 0, true, NULL, NULL),
+            client, tlsClientNew(sckClientNew(strNew("99.99.99.99.99"), 7777, 0), strNew("X"), 0, true, NULL, NULL, NULL, NULL),
             "new client");
         TEST_RESULT_STR_Z(ioClientName(client), "99.99.99.99.99:7777", " check name");
         TEST_ERROR(
             ioClientOpen(client), HostConnectError, "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
 
         TEST_ASSIGN(
-            client, tlsClientNew(sckClientNew(strNew("localhost"), hrnServerPort(0), 100), strNew("X"), 100, true, NULL, NULL),
+            client,
+            tlsClientNew(sckClientNew(strNew("localhost"), hrnServerPort(0), 100), strNew("X"), 100, true, NULL, NULL, NULL, NULL),
             "new client");
         TEST_ERROR_FMT(
             ioClientOpen(client), HostConnectError, "unable to connect to 'localhost:%u': [111] Connection refused",
@@ -234,7 +237,8 @@ testRun(void)
             ioClientOpen(
                 tlsClientNew(
                     sckClientNew(
-                        strNew("localhost"), hrnServerPort(0), 5000), strNew("X"), 0, true, strNew("bogus.crt"), strNew("/bogus"))),
+                        strNew("localhost"), hrnServerPort(0), 5000), strNew("X"), 0, true, strNew("bogus.crt"), strNew("/bogus"),
+                    NULL, NULL)),
             CryptoError, "unable to set user-defined CA certificate location: [33558530] No such file or directory");
 
         // Certificate location and validation errors
@@ -277,7 +281,7 @@ testRun(void)
                     ioClientOpen(
                         tlsClientNew(
                             sckClientNew(strNew("localhost"), hrnServerPort(0), 5000), strNew("X"), 0, true, NULL,
-                            strNew("/bogus"))),
+                            strNew("/bogus"), NULL, NULL)),
                     CryptoError,
                     "unable to verify certificate presented by 'localhost:%u': [20] unable to get local issuer certificate",
                     hrnServerPort(0));
@@ -292,7 +296,7 @@ testRun(void)
                     ioClientOpen(
                         tlsClientNew(
                             sckClientNew(strNew("test.pgbackrest.org"), hrnServerPort(0), 5000), strNew("test.pgbackrest.org"),
-                            0, true, strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                            0, true, strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
                     "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -306,7 +310,7 @@ testRun(void)
                         tlsClientNew(
                             sckClientNew(strNew("host.test2.pgbackrest.org"), hrnServerPort(0), 5000),
                             strNew("host.test2.pgbackrest.org"), 0, true,
-                            strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                            strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
                     "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -319,7 +323,7 @@ testRun(void)
                     ioClientOpen(
                         tlsClientNew(
                             sckClientNew(strNew("test3.pgbackrest.org"), hrnServerPort(0), 5000), strNew("test3.pgbackrest.org"),
-                            0, true, strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                            0, true, strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
                     CryptoError,
                     "unable to find hostname 'test3.pgbackrest.org' in certificate common name or subject alternative names");
 
@@ -334,7 +338,7 @@ testRun(void)
                         tlsClientNew(
                             sckClientNew(strNew("localhost"), hrnServerPort(0), 5000), strNew("X"), 0, true,
                             strNewFmt("%s/" HRN_SERVER_CERT_PREFIX ".crt", testRepoPath()),
-                        NULL)),
+                        NULL, NULL, NULL)),
                     CryptoError,
                     "unable to verify certificate presented by 'localhost:%u': [20] unable to get local issuer certificate",
                     hrnServerPort(0));
@@ -348,7 +352,8 @@ testRun(void)
                 TEST_RESULT_VOID(
                     ioClientOpen(
                         tlsClientNew(
-                            sckClientNew(strNew("localhost"), hrnServerPort(0), 5000), strNew("X"), 0, false, NULL, NULL)),
+                            sckClientNew(strNew("localhost"), hrnServerPort(0), 5000), strNew("X"), 0, false, NULL, NULL, NULL,
+                            NULL)),
                         "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -387,7 +392,7 @@ testRun(void)
                     client,
                     tlsClientNew(
                         sckClientNew(hrnServerHost(), hrnServerPort(0), 5000), hrnServerHost(), 0, testContainer(), NULL,
-                        NULL),
+                        NULL, NULL, NULL),
                     "new client");
 
                 hrnServerScriptAccept(tls);
@@ -506,5 +511,78 @@ testRun(void)
         TEST_RESULT_BOOL(varLstSize(kvKeyList(statToKv())) > 0, true, "check");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("SocketServer and TlsServer"))
+    {
+        const String *caFile = strNewFmt("%s/" HRN_SERVER_CERT_PREFIX "-ca.crt", testRepoPath());
+        const String *certFile = strNewFmt("%s/" HRN_SERVER_CERT_PREFIX ".crt", testRepoPath());
+        const String *keyFile = strNewFmt("%s/" HRN_SERVER_CERT_PREFIX ".key", testRepoPath());
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("server errors");
+
+        TEST_ERROR(
+            sckServerNew(strNew("99.99.99.99.99"), 7777, 100), HostConnectError,
+            "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
+        TEST_ERROR(
+            tlsServerNew(strNew("localhost"), caFile, keyFile, strNew(BOGUS_STR), 100), CryptoError,
+            "unable to load server certificate file '" BOGUS_STR "': [2147483650] no details available");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("accept session with client certificate");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, true)
+            {
+                IoServer *socketServer = NULL;
+                TEST_ASSIGN(socketServer, sckServerNew(strNew("localhost"), hrnServerPort(0), 5000), "new socket server");
+                TEST_RESULT_STR(
+                    ioServerName(socketServer), strNewFmt("localhost:%u", hrnServerPort(0)), "check socket server name");
+
+                IoServer *tlsServer = NULL;
+                TEST_ASSIGN(tlsServer, tlsServerNew(strNew("localhost"), caFile, keyFile, certFile, 5000), "new tls server");
+                TEST_RESULT_STR_Z(ioServerName(tlsServer), "localhost", "check tls server name");
+
+                IoSession *session = NULL;
+                TEST_ASSIGN(session, ioServerAccept(tlsServer, ioServerAccept(socketServer, NULL)), "accept session");
+                TEST_RESULT_INT(ioSessionRole(session), ioSessionRoleServer, "check role");
+
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session)), "ping", "read ping");
+                ioWriteStrLine(ioSessionIoWrite(session), STRDEF("pong"));
+                ioWriteFlush(ioSessionIoWrite(session));
+
+                TEST_RESULT_VOID(ioSessionFree(session), "free session");
+                TEST_RESULT_VOID(ioServerFree(tlsServer), "free tls server");
+                TEST_RESULT_VOID(ioServerFree(socketServer), "free socket server");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                // The client retries until the server is listening
+                IoClient *client = NULL;
+                TEST_ASSIGN(
+                    client,
+                    tlsClientNew(
+                        sckClientNew(strNew("localhost"), hrnServerPort(0), 5000), strNew("localhost"), 5000, false, NULL, NULL,
+                        certFile, keyFile),
+                    "new client with certificate");
+
+                IoSession *session = NULL;
+                TEST_ASSIGN(session, ioClientOpen(client), "open session");
+
+                ioWriteStrLine(ioSessionIoWrite(session), STRDEF("ping"));
+                ioWriteFlush(ioSessionIoWrite(session));
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session)), "pong", "read pong");
+
+                TEST_RESULT_VOID(ioSessionFree(session), "free session");
+                TEST_RESULT_VOID(ioClientFree(client), "free client");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -27,6 +27,120 @@ testRun(void)
         TEST_RESULT_UINT(lstSize(statLocalData.stat), 2, "stat list has two stats");
 
         TEST_RESULT_STR_Z(jsonFromKv(statToKv()), "{\"http.session\":{\"total\":1},\"tls.client\":{\"total\":2}}", "stat output");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("measurements");
+
+        const String *statStorageInfo = STRDEF("storage.posix.info.usec");
+
+        TEST_RESULT_VOID(statAdd(statStorageInfo, 3), "add 3");
+        TEST_RESULT_VOID(statAdd(statStorageInfo, 0), "add 0");
+        TEST_RESULT_VOID(statAdd(statStorageInfo, 4), "add 4");
+        TEST_RESULT_VOID(statAdd(statStorageInfo, 17), "add 17");
+        TEST_RESULT_VOID(statAdd(STRDEF("big"), UINT64_MAX), "add max to another stat");
+
+        TEST_RESULT_STR_Z(
+            jsonFromKv(statToKv()),
+            "{\"big\":{\"bucket\":[0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1],"
+                "\"max\":18446744073709551615,\"min\":18446744073709551615,\"sum\":18446744073709551615,\"total\":1},"
+            "\"http.session\":{\"total\":1},"
+            "\"storage.posix.info.usec\":{\"bucket\":[1,0,2,0,0,1],\"max\":17,\"min\":0,\"sum\":24,\"total\":4},"
+            "\"tls.client\":{\"total\":2}}",
+            "stat output");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("profiling");
+
+        TEST_RESULT_BOOL(statProfile(), false, "profiling disabled");
+        TEST_RESULT_UINT(statProfileBegin(), 0, "begin returns zero when profiling is disabled");
+        TEST_RESULT_VOID(statProfileEnd(0, "filter.%s.usec", "test"), "end skipped when profiling is disabled");
+        TEST_RESULT_UINT(lstSize(statLocalData.stat), 4, "no stat added");
+
+        TEST_RESULT_VOID(statProfileSet(true), "enable profiling");
+        TEST_RESULT_BOOL(statProfile(), true, "profiling enabled");
+
+        TimeUSec timeBegin = statProfileBegin();
+        TEST_RESULT_BOOL(timeBegin > 0, true, "begin returns time");
+
+        TEST_RESULT_VOID(statProfileEnd(timeBegin, "filter.%s.usec", "test"), "end");
+        TEST_RESULT_UINT(lstSize(statLocalData.stat), 5, "stat added");
+        TEST_RESULT_BOOL(kvKeyExists(statToKv(), VARSTRDEF("filter.test.usec")), true, "check stat");
+
+        TEST_RESULT_VOID(statProfileSet(false), "disable profiling");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("gauges");
+
+        lstClear(statLocalData.stat);
+
+        const String *statCommandResult = STRDEF("command.result");
+
+        TEST_RESULT_VOID(statGaugeSet(statCommandResult, 1), "set gauge");
+        TEST_RESULT_VOID(statGaugeSet(statCommandResult, -1), "set gauge again");
+        TEST_RESULT_STR_Z(jsonFromKv(statToKv()), "{\"command.result\":{\"gauge\":-1}}", "stat output");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("merge");
+
+        TEST_RESULT_VOID(statInc(statTlsClient), "inc tls.client");
+        TEST_RESULT_VOID(statAdd(statStorageInfo, 3), "add 3");
+
+        TEST_RESULT_VOID(
+            statMerge(
+                jsonToKv(
+                    STRDEF(
+                        "{\"command.result\":{\"gauge\":0},"
+                        "\"http.session\":{\"total\":2},"
+                        "\"storage.posix.info.usec\":{\"bucket\":[1,0,0,0,0,1],\"max\":17,\"min\":0,\"sum\":17,\"total\":2},"
+                        "\"storage.posix.list.usec\":{\"bucket\":[0,1],\"max\":2,\"min\":2,\"sum\":2,\"total\":1},"
+                        "\"tls.client\":{\"total\":3}}"))),
+            "merge");
+
+        TEST_RESULT_STR_Z(
+            jsonFromKv(statToKv()),
+            "{\"command.result\":{\"gauge\":0},"
+            "\"http.session\":{\"total\":2},"
+            "\"storage.posix.info.usec\":{\"bucket\":[1,0,1,0,0,1],\"max\":17,\"min\":0,\"sum\":20,\"total\":3},"
+            "\"storage.posix.list.usec\":{\"bucket\":[0,1],\"max\":2,\"min\":2,\"sum\":2,\"total\":1},"
+            "\"tls.client\":{\"total\":4}}",
+            "stat output");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("prometheus");
+
+        lstClear(statLocalData.stat);
+
+        TEST_RESULT_VOID(statGaugeSet(statCommandResult, 0), "set gauge");
+        TEST_RESULT_VOID(statInc(statTlsClient), "inc tls.client");
+        TEST_RESULT_VOID(statAdd(statStorageInfo, 3), "add 3");
+        TEST_RESULT_VOID(statAdd(statStorageInfo, 0), "add 0");
+
+        TEST_RESULT_STR_Z(
+            statToPrometheus(STRDEF("stanza=\"db\"")),
+            "# TYPE pgbackrest_command_result gauge\n"
+            "pgbackrest_command_result{stanza=\"db\"} 0\n"
+            "# TYPE pgbackrest_storage_posix_info_usec histogram\n"
+            "pgbackrest_storage_posix_info_usec_bucket{stanza=\"db\",le=\"1\"} 1\n"
+            "pgbackrest_storage_posix_info_usec_bucket{stanza=\"db\",le=\"2\"} 1\n"
+            "pgbackrest_storage_posix_info_usec_bucket{stanza=\"db\",le=\"4\"} 2\n"
+            "pgbackrest_storage_posix_info_usec_bucket{stanza=\"db\",le=\"+Inf\"} 2\n"
+            "pgbackrest_storage_posix_info_usec_sum{stanza=\"db\"} 3\n"
+            "pgbackrest_storage_posix_info_usec_count{stanza=\"db\"} 2\n"
+            "# TYPE pgbackrest_tls_client_total counter\n"
+            "pgbackrest_tls_client_total{stanza=\"db\"} 1\n",
+            "prometheus output");
+
+        lstClear(statLocalData.stat);
+        TEST_RESULT_VOID(statAdd(STRDEF("big"), UINT64_MAX), "add max");
+
+        TEST_RESULT_BOOL(
+            strEndsWithZ(
+                statToPrometheus(STRDEF("stanza=\"db\"")),
+                "pgbackrest_big_bucket{stanza=\"db\",le=\"274877906944\"} 0\n"
+                "pgbackrest_big_bucket{stanza=\"db\",le=\"+Inf\"} 1\n"
+                "pgbackrest_big_sum{stanza=\"db\"} 18446744073709551615\n"
+                "pgbackrest_big_count{stanza=\"db\"} 1\n"),
+            true, "last bucket is only included in +Inf");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -47,6 +47,13 @@ testRun(void)
         TEST_RESULT_VOID(lstClear(list), "clear list");
         TEST_RESULT_STR_Z(lstToLog(list), "{size: 0}", "check log after clear");
 
+        TEST_RESULT_VOID(lstAdd(list, &ptr), "add item");
+        TEST_RESULT_VOID(lstAdd(list, &ptr), "add item");
+        TEST_RESULT_VOID(lstRemoveIdx(list, 0), "remove first item");
+        TEST_RESULT_VOID(lstClear(list), "clear list after first item removed");
+        TEST_RESULT_VOID(lstAdd(list, &ptr), "add item after clear");
+        TEST_RESULT_STR_Z(lstToLog(list), "{size: 1}", "check log");
+
         TEST_RESULT_VOID(lstFree(list), "free list");
         TEST_RESULT_VOID(lstFree(lstNewP(1)), "free empty list");
         TEST_RESULT_VOID(lstFree(NULL), "free null list");
@@ -207,5 +214,149 @@ testRun(void)
             CHECK(*(int *)lstFind(list, &listIdx) == listIdx);
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("lstFind() with hash index"))
+    {
+        TEST_RESULT_UINT(lstHashStr(&EMPTY_STR), 2166136261U, "empty string hash");
+        TEST_RESULT_UINT(lstHashStr(&(const String *){STRDEF("a")}), 0xE40C292C, "string hash");
+
+        // Generate a list of strings
+        unsigned int testMax = 200;
+
+        List *list = lstNewP(sizeof(String *), .comparator = lstComparatorStr, .hash = lstHashStr);
+
+        for (unsigned int listIdx = 0; listIdx < testMax; listIdx++)
+        {
+            String *value = strNewFmt("%u", testMax - listIdx - 1);
+            lstAdd(list, &value);
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("small list is not indexed");
+
+        List *listSmall = lstNewP(sizeof(String *), .comparator = lstComparatorStr, .hash = lstHashStr);
+        lstAdd(listSmall, &(String *){strNew("a")});
+
+        TEST_RESULT_STR_Z(*(String **)lstFind(listSmall, &(String *){strNew("a")}), "a", "find");
+        TEST_RESULT_PTR(listSmall->index, NULL, "no index");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("unsorted list builds index after enough finds");
+
+        TEST_RESULT_PTR(list->index, NULL, "no index before find");
+
+        for (unsigned int findIdx = 0; findIdx < LIST_INDEX_FIND_MIN; findIdx++)
+            CHECK(lstFind(list, &(String *){strNew("0")}) != NULL);
+
+        TEST_RESULT_PTR(list->index, NULL, "index not built");
+
+        for (unsigned int listIdx = 0; listIdx < testMax; listIdx++)
+        {
+            const String *value = strNewFmt("%u", listIdx);
+            CHECK(strEq(*(String **)lstFind(list, &value), value));
+        }
+
+        TEST_RESULT_BOOL(list->index != NULL, true, "index built");
+        TEST_RESULT_UINT(list->indexSize, 512, "index size");
+        TEST_RESULT_PTR(lstFind(list, &(String *){strNew(BOGUS_STR)}), NULL, "missing item");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("append updates index, duplicate finds first item");
+
+        const ListIndexSlot *index = list->index;
+
+        String *value = strNew("0");
+        TEST_RESULT_VOID(lstAdd(list, &value), "append duplicate");
+        TEST_RESULT_PTR(list->index, index, "index not rebuilt");
+        TEST_RESULT_UINT(lstFindIdx(list, &value), testMax - 1, "first item found");
+
+        value = strNew("new");
+        TEST_RESULT_VOID(lstAdd(list, &value), "append new");
+        TEST_RESULT_PTR(list->index, index, "index not rebuilt");
+        TEST_RESULT_UINT(lstFindIdx(list, &value), testMax + 1, "new item found");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("insert and remove free index");
+
+        value = strNew("insert");
+        TEST_RESULT_VOID(lstInsert(list, 0, &value), "insert");
+        TEST_RESULT_PTR(list->index, NULL, "index freed");
+        TEST_RESULT_UINT(lstFindIdx(list, &value), 0, "inserted item found");
+        TEST_RESULT_PTR(list->index, NULL, "index not built");
+
+        TEST_RESULT_BOOL(lstRemove(list, &value), true, "remove");
+        TEST_RESULT_PTR(list->index, NULL, "index freed");
+        TEST_RESULT_UINT(lstFindIdx(list, &(String *){strNew("new")}), testMax + 1, "item found");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("interleaved finds and removes do not build index");
+
+        for (unsigned int removeIdx = 0; removeIdx < LIST_INDEX_FIND_MIN * 2; removeIdx++)
+        {
+            value = strNewFmt("%u", removeIdx);
+            CHECK(lstFind(list, &value) != NULL);
+            CHECK(lstRemove(list, &value));
+        }
+
+        TEST_RESULT_PTR(list->index, NULL, "index not built");
+        TEST_RESULT_PTR(lstFind(list, &(String *){strNew("1")}), NULL, "removed item not found");
+
+        for (unsigned int findIdx = 0; findIdx < LIST_INDEX_FIND_MIN; findIdx++)
+            CHECK(lstFind(list, &(String *){strNew("new")}) != NULL);
+
+        TEST_RESULT_BOOL(list->index != NULL, true, "index built");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("append that needs a larger index rebuilds index");
+
+        while (lstSize(list) * 2 < list->indexSize)
+            lstAdd(list, &(String *){strNewFmt("%u", lstSize(list) + testMax)});
+
+        TEST_RESULT_UINT(list->indexSize, 512, "index not grown");
+        TEST_RESULT_VOID(lstAdd(list, &(String *){strNew("grow")}), "append");
+        TEST_RESULT_UINT(list->indexSize, 1024, "index grown");
+        TEST_RESULT_STR_Z(*(String **)lstFind(list, &(String *){strNew("grow")}), "grow", "find");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("sorted list defers index build");
+
+        TEST_RESULT_VOID(lstSort(list, sortOrderAsc), "sort");
+
+        for (unsigned int findIdx = 0; findIdx < lstSize(list) / 16; findIdx++)
+            CHECK(lstFind(list, &(String *){strNew("grow")}) != NULL);
+
+        TEST_RESULT_PTR(list->index, NULL, "index not built");
+        TEST_RESULT_STR_Z(*(String **)lstFind(list, &(String *){strNew("grow")}), "grow", "find");
+        TEST_RESULT_BOOL(list->index != NULL, true, "index built");
+
+        TEST_RESULT_VOID(lstSort(list, sortOrderDesc), "sort");
+        TEST_RESULT_PTR(list->index, NULL, "index freed");
+
+        TEST_RESULT_VOID(lstClear(list), "clear");
+        TEST_RESULT_PTR(list->index, NULL, "no index");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("setting comparator disables index");
+
+        TEST_RESULT_VOID(lstComparatorSet(list, lstComparatorStr), "set comparator");
+        TEST_RESULT_PTR(list->hash, NULL, "no hash");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("find struct with a char array as the first member");
+
+        typedef struct TestListZ
+        {
+            char name[8];
+            int value;
+        } TestListZ;
+
+        list = lstNewP(sizeof(TestListZ), .comparator = lstComparatorZ);
+        lstAdd(list, &(TestListZ){.name = "b", .value = 2});
+        lstAdd(list, &(TestListZ){.name = "a", .value = 1});
+
+        TEST_RESULT_INT(((TestListZ *)lstFind(list, "a"))->value, 1, "find a");
+        TEST_RESULT_PTR(lstFind(list, "c"), NULL, "c not found");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -107,5 +107,57 @@ testRun(void)
             "get xml");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("xmlReader*()"))
+    {
+        TEST_ERROR(xmlReaderNext(xmlReaderNewBuf(BUFSTRDEF(BOGUS_STR))), FormatError, "invalid xml");
+        TEST_ERROR(
+            xmlReaderNext(xmlReaderNewBuf(BUFSTRDEF("<ListBucketResult><Contents><Key>test1.txt</Key>"))), FormatError,
+            "invalid xml");
+
+        XmlReader *reader = NULL;
+        TEST_ASSIGN(reader, xmlReaderNewBuf(BUFSTRDEF("<ListBucketResult/>")), "reader with empty root");
+        TEST_RESULT_PTR(xmlReaderNext(reader), NULL, "no children");
+        TEST_RESULT_VOID(xmlReaderFree(reader), "free reader");
+
+        TEST_ASSIGN(
+            reader,
+            xmlReaderNewBuf(
+                BUFSTRDEF(
+                    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                    "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">\n"
+                    "    <Name id=\"test\">bucket</Name>\n"
+                    "    <Contents>\n"
+                    "        <Key>test1.txt</Key>\n"
+                    "        <Size>1234</Size>\n"
+                    "    </Contents>\n"
+                    "    <Contents><Key>test2.txt</Key><Size>4321</Size></Contents>"
+                    "    <Prefix/>\n"
+                    "</ListBucketResult>")),
+            "new reader");
+
+        const XmlNode *node = NULL;
+        TEST_ASSIGN(node, xmlReaderNext(reader), "get first child");
+        TEST_RESULT_STR_Z(xmlNodeName(node), "Name", "    check name");
+        TEST_RESULT_STR_Z(xmlNodeContent(node), "bucket", "    check content");
+        TEST_RESULT_STR_Z(xmlNodeAttribute(node, strNew("id")), "test", "    check attribute");
+
+        TEST_ASSIGN(node, xmlReaderNext(reader), "get second child");
+        TEST_RESULT_STR_Z(xmlNodeName(node), "Contents", "    check name");
+        TEST_RESULT_STR_Z(xmlNodeContent(xmlNodeChild(node, strNew("Key"), true)), "test1.txt", "    check Key");
+        TEST_RESULT_STR_Z(xmlNodeContent(xmlNodeChild(node, strNew("Size"), true)), "1234", "    check Size");
+
+        TEST_ASSIGN(node, xmlReaderNext(reader), "get third child");
+        TEST_RESULT_STR_Z(xmlNodeName(node), "Contents", "    check name");
+        TEST_RESULT_STR_Z(xmlNodeContent(xmlNodeChild(node, strNew("Key"), true)), "test2.txt", "    check Key");
+
+        TEST_ASSIGN(node, xmlReaderNext(reader), "get empty child");
+        TEST_RESULT_STR_Z(xmlNodeName(node), "Prefix", "    check name");
+        TEST_RESULT_STR_Z(xmlNodeContent(node), "", "    check content");
+
+        TEST_RESULT_PTR(xmlReaderNext(reader), NULL, "no more children");
+        TEST_RESULT_VOID(xmlReaderFree(reader), "free reader");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -20,6 +20,9 @@ testRun(void)
         TEST_RESULT_UINT(userIdFromName(userName()), userId(), "get user id");
         TEST_RESULT_UINT(userIdFromName(NULL), (uid_t)-1, "get null user id");
         TEST_RESULT_UINT(userIdFromName(STRDEF("bogus")), (uid_t)-1, "get bogus user id");
+        TEST_RESULT_UINT(userIdFromName(STRDEF("bogus")), (uid_t)-1, "get bogus user id again");
+        TEST_RESULT_UINT(userIdFromName(userName()), userId(), "get user id again");
+        TEST_RESULT_UINT(userIdFromName(userName()), userId(), "get user id from cache");
         TEST_RESULT_STR_Z(userName(), testUser(), "check user name");
         TEST_RESULT_STR_Z(userNameFromId(77777), NULL, "invalid user name by id");
         TEST_RESULT_BOOL(userRoot(), false, "check user is root");
@@ -28,6 +31,9 @@ testRun(void)
         TEST_RESULT_UINT(groupIdFromName(groupName()), groupId(), "get group id");
         TEST_RESULT_UINT(groupIdFromName(NULL), (gid_t)-1, "get null group id");
         TEST_RESULT_UINT(groupIdFromName(STRDEF("bogus")), (uid_t)-1, "get bogus group id");
+        TEST_RESULT_UINT(groupIdFromName(STRDEF("bogus")), (uid_t)-1, "get bogus group id again");
+        TEST_RESULT_UINT(groupIdFromName(groupName()), groupId(), "get group id again");
+        TEST_RESULT_UINT(groupIdFromName(groupName()), groupId(), "get group id from cache");
         TEST_RESULT_STR_Z(groupName(), testGroup(), "check name name");
         TEST_RESULT_STR_Z(groupNameFromId(77777), NULL, "invalid group name by id");
     }
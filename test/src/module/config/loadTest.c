@@ -1,8 +1,10 @@
 /***********************************************************************************************************************************
 Test Configuration Load
 ***********************************************************************************************************************************/
+#include "command/command.h"
 #include "common/io/io.h"
 #include "common/log.h"
+#include "common/stat.h"
 #include "protocol/helper.h"
 #include "version.h"
 
@@ -637,6 +639,41 @@ testRun(void)
         TEST_RESULT_INT(lstat(strZ(strNewFmt("%s/db-backup-local-001.log", testPath())), &statLog), 0, "   check log file exists");
         TEST_RESULT_STR_Z(cfgOptionStr(cfgOptExecId), "1111-fe70d611", "   exec-id is preserved");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("local command enables profiling without a log file");
+
+        argList = strLstNew();
+        strLstAddZ(argList, PROJECT_BIN);
+        hrnCfgArgRawZ(argList, cfgOptStanza, "db");
+        strLstAdd(argList, strNewFmt("--" CFGOPT_LOG_PATH "=%s", testPath()));
+        hrnCfgArgRawZ(argList, cfgOptPgPath, "/path/to");
+        hrnCfgArgRawZ(argList, cfgOptProcess, "2");
+        strLstAddZ(argList, "--" CFGOPT_REMOTE_TYPE "=" PROTOCOL_REMOTE_TYPE_REPO);
+        hrnCfgArgRawZ(argList, cfgOptLogLevelFile, "off");
+        hrnCfgArgRawBool(argList, cfgOptProfile, true);
+        strLstAddZ(argList, CFGCMD_BACKUP ":" CONFIG_COMMAND_ROLE_LOCAL);
+
+        TEST_RESULT_VOID(cfgLoad(strLstSize(argList), strLstPtr(argList)), "load config");
+        TEST_RESULT_BOOL(statProfile(), true, "   profiling enabled");
+        TEST_RESULT_INT(lstat(strZ(strNewFmt("%s/db-backup-local-002.log", testPath())), &statLog), -1, "   check no log file");
+
+        cmdStatFileSet(NULL, NULL);
+        statProfileSet(false);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("local command enables stats when metric-path is set");
+
+        strLstRemoveIdx(argList, strLstSize(argList) - 1);
+        strLstRemoveIdx(argList, strLstSize(argList) - 1);
+        strLstAdd(argList, strNewFmt("--" CFGOPT_METRIC_PATH "=%s", testPath()));
+        strLstAddZ(argList, CFGCMD_BACKUP ":" CONFIG_COMMAND_ROLE_LOCAL);
+
+        TEST_RESULT_VOID(cfgLoad(strLstSize(argList), strLstPtr(argList)), "load config");
+        TEST_RESULT_BOOL(statProfile(), true, "   profiling enabled");
+
+        cmdStatFileSet(NULL, NULL);
+        statProfileSet(false);
+
         // Remote command opens log file with special filename
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
@@ -14,15 +14,19 @@ Test Database
 Macro to check that replay is making progress -- this does not seem useful enough to be included in the pq harness header
 ***********************************************************************************************************************************/
 #define HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS(                                                                                \
-    sessionParam, walNameParam, lsnNameParam, targetLsnParam, targetReachedParam, replayLsnParam, replayLastLsnParam,              \
+    sessionParam, walNameParam, lsnNameParam, targetLsnParam, retryParam, targetReachedParam, replayLsnParam, replayLastLsnParam,  \
     replayProgressParam, sleepParam)                                                                                               \
     {.session = sessionParam,                                                                                                      \
         .function = HRNPQ_SENDQUERY,                                                                                               \
-        .param =                                                                                                                   \
+        .param = strZ(strNewFmt(                                                                                                   \
             "[\"select replayLsn::text,\\n"                                                                                        \
-            "       (replayLsn > '" targetLsnParam "')::bool as targetReached,\\n"                                                 \
+            "       (replayLsn > '%s')::bool as targetReached,\\n"                                                                 \
             "       (replayLsn > '" replayLastLsnParam "')::bool as replayProgress\\n"                                             \
-            "  from pg_catalog.pg_last_" walNameParam "_replay_" lsnNameParam "() as replayLsn\"]",                                \
+            "  from (select pg_catalog.pg_last_" walNameParam "_replay_" lsnNameParam "() as replayLsn\\n"                         \
+            "          from pg_catalog.generate_series(1, %u) as retry\\n"                                                         \
+            "         where retry = %u or pg_catalog.pg_last_" walNameParam "_replay_" lsnNameParam "() is null or"                \
+            " pg_catalog.pg_last_" walNameParam "_replay_" lsnNameParam "() > '%s' or pg_catalog.pg_sleep(0.1) is null\\n"         \
+            "         limit 1) as replay\"]", targetLsnParam, retryParam, retryParam, targetLsnParam)),                            \
         .resultInt = 1, .sleep = sleepParam},                                                                                      \
     {.session = sessionParam, .function = HRNPQ_CONSUMEINPUT},                                                                     \
     {.session = sessionParam, .function = HRNPQ_ISBUSY},                                                                           \
@@ -40,10 +44,11 @@ Macro to check that replay is making progress -- this does not seem useful enoug
     {.session = sessionParam, .function = HRNPQ_GETRESULT, .resultNull = true}
 
 #define HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(                                                                          \
-    sessionParam, targetLsnParam, targetReachedParam, replayLsnParam, replayLastLsnParam, replayProgressParam, sleepParam)         \
+    sessionParam, targetLsnParam, retryParam, targetReachedParam, replayLsnParam, replayLastLsnParam, replayProgressParam,         \
+    sleepParam)                                                                                                                    \
     HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS(                                                                                    \
-        sessionParam, "wal", "lsn", targetLsnParam, targetReachedParam, replayLsnParam, replayLastLsnParam, replayProgressParam,   \
-        sleepParam)
+        sessionParam, "wal", "lsn", targetLsnParam, retryParam, targetReachedParam, replayLsnParam, replayLastLsnParam,            \
+        replayProgressParam, sleepParam)
 
 /***********************************************************************************************************************************
 Test Run
@@ -416,7 +421,11 @@ testRun(void)
                 .param =
                     "[\"select replayLsn::text,\\n"
                     "       (replayLsn > '5/5')::bool as targetReached\\n"
-                    "  from pg_catalog.pg_last_wal_replay_lsn() as replayLsn\"]",
+                    "  from (select pg_catalog.pg_last_wal_replay_lsn() as replayLsn\\n"
+                    "          from pg_catalog.generate_series(1, 1) as retry\\n"
+                    "         where retry = 1 or pg_catalog.pg_last_wal_replay_lsn() is null or"
+                    " pg_catalog.pg_last_wal_replay_lsn() > '5/5' or pg_catalog.pg_sleep(0.1) is null\\n"
+                    "         limit 1) as replay\"]",
                 .resultInt = 1},
             {.session = 2, .function = HRNPQ_CONSUMEINPUT},
             {.session = 2, .function = HRNPQ_ISBUSY},
@@ -433,20 +442,19 @@ testRun(void)
             {.session = 2, .function = HRNPQ_GETRESULT, .resultNull = true},
 
             // Timeout waiting for sync
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_GE_10(2, "5/5", false, "5/3"),
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", false, "5/3", "5/3", false, 250),
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", false, "5/3", "5/3", false, 0),
+            HRNPQ_MACRO_REPLAY_TARGET_REACHED_GE_10(2, "5/5", 1, false, "5/3"),
+            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", 2, false, "5/3", "5/3", false, 250),
 
             // Checkpoint target not reached
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_GE_10(2, "5/5", true, "5/5"),
+            HRNPQ_MACRO_REPLAY_TARGET_REACHED_GE_10(2, "5/5", 1, true, "5/5"),
             HRNPQ_MACRO_CHECKPOINT(2),
             HRNPQ_MACRO_CHECKPOINT_TARGET_REACHED_GE_10(2, "5/5", false, "5/4"),
 
-            // Wait for standby to sync
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_GE_10(2, "5/5", false, "5/3"),
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", false, "5/3", "5/3", false, 0),
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", false, "5/4", "5/3", true, 0),
-            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", true, "5/5", "5/4", true, 0),
+            // Wait for standby to sync. Each query waits longer on the standby than the last.
+            HRNPQ_MACRO_REPLAY_TARGET_REACHED_GE_10(2, "5/5", 1, false, "5/3"),
+            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", 2, false, "5/3", "5/3", false, 0),
+            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", 4, false, "5/4", "5/3", true, 0),
+            HRNPQ_MACRO_REPLAY_TARGET_REACHED_PROGRESS_GE_10(2, "5/5", 8, true, "5/5", "5/4", true, 0),
             HRNPQ_MACRO_CHECKPOINT(2),
             HRNPQ_MACRO_CHECKPOINT_TARGET_REACHED_GE_10(2, "5/5", true, "X/X"),
 
@@ -97,10 +97,14 @@ testRun(void)
         String *callbackContent = strNew("");
 
         TEST_ERROR(
-            infoNewLoad(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), FormatError,
+            infoNewLoadP(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), FormatError,
             "expected format 5 but found 4");
         TEST_RESULT_STR_Z(callbackContent, "", "    check callback content");
 
+        TEST_ERROR(
+            infoNewLoadP(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent, .formatReferenceName = true),
+            FormatError, "expected format 5 or 6 but found 4");
+
         // Checksum not found
         // --------------------------------------------------------------------------------------------------------------------------
         contentLoad = BUFSTRDEF(
@@ -108,7 +112,7 @@ testRun(void)
             "backrest-format=5\n");
 
         TEST_ERROR(
-            infoNewLoad(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), ChecksumError,
+            infoNewLoadP(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), ChecksumError,
             "invalid checksum, actual 'a3765a8c2c1e5d35274a0b0ce118f4031faff0bd' but no checksum found");
         TEST_RESULT_STR_Z(callbackContent, "", "    check callback content");
 
@@ -122,7 +126,7 @@ testRun(void)
             "bogus=\"BOGUS\"\n");
 
         TEST_ERROR(
-            infoNewLoad(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), ChecksumError,
+            infoNewLoadP(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), ChecksumError,
             "invalid checksum, actual 'fe989a75dcf7a0261e57d210707c0db741462763' but expected 'BOGUS'");
         TEST_RESULT_STR_Z(callbackContent, "", "    check callback content");
 
@@ -138,7 +142,7 @@ testRun(void)
         ioFilterGroupAdd(ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("X"), NULL));
 
         TEST_ERROR(
-            infoNewLoad(read, harnessInfoLoadNewCallback, callbackContent), CryptoError,
+            infoNewLoadP(read, harnessInfoLoadNewCallback, callbackContent), CryptoError,
             "cipher header invalid\n"
             "HINT: is or was the repo encrypted?");
         TEST_RESULT_STR_Z(callbackContent, "", "    check callback content");
@@ -153,7 +157,8 @@ testRun(void)
         callbackContent = strNew("");
 
         TEST_ASSIGN(
-            info, infoNewLoad(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), "info with other cipher");
+            info, infoNewLoadP(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent),
+            "info with other cipher");
         TEST_RESULT_STR_Z(callbackContent, "", "    check callback content");
         TEST_RESULT_STR(infoCipherPass(info), NULL, "    check cipher pass not set");
 
@@ -169,7 +174,7 @@ testRun(void)
         callbackContent = strNew("");
 
         TEST_ASSIGN(
-            info, infoNewLoad(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), "info with content");
+            info, infoNewLoadP(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), "info with content");
         TEST_RESULT_STR_Z(callbackContent, "[c] key=1\n[d] key=1\n", "    check callback content");
         TEST_RESULT_STR(infoCipherPass(info), NULL, "    check cipher pass not set");
 
@@ -177,6 +182,30 @@ testRun(void)
 
         TEST_RESULT_VOID(infoSave(info, ioBufferWriteNew(contentSave), testInfoSaveCallback, strNew("1")), "info save");
         TEST_RESULT_STR(strNewBuf(contentSave), strNewBuf(contentLoad), "   check save");
+        TEST_RESULT_UINT(infoFormat(info), REPOSITORY_FORMAT, "    check format");
+
+        // Save and load the format used for files that reference a file with a different name
+        // --------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(infoFormatSet(info, REPOSITORY_FORMAT_REFERENCE_NAME), "set format");
+
+        contentSave = bufNew(0);
+
+        TEST_RESULT_VOID(infoSave(info, ioBufferWriteNew(contentSave), testInfoSaveCallback, strNew("1")), "info save");
+        TEST_RESULT_BOOL(
+            strstr(strZ(strNewBuf(contentSave)), "backrest-format=6\n") != NULL, true, "    check format saved");
+
+        TEST_ERROR(
+            infoNewLoadP(ioBufferReadNew(contentSave), harnessInfoLoadNewCallback, callbackContent), FormatError,
+            "expected format 5 but found 6");
+
+        callbackContent = strNew("");
+
+        TEST_ASSIGN(
+            info,
+            infoNewLoadP(ioBufferReadNew(contentSave), harnessInfoLoadNewCallback, callbackContent, .formatReferenceName = true),
+            "info with format 6");
+        TEST_RESULT_STR_Z(callbackContent, "[c] key=1\n[d] key=1\n", "    check callback content");
+        TEST_RESULT_UINT(infoFormat(info), REPOSITORY_FORMAT_REFERENCE_NAME, "    check format");
 
         // File with content and cipher
         // --------------------------------------------------------------------------------------------------------------------------
@@ -193,8 +222,8 @@ testRun(void)
         callbackContent = strNew("");
 
         TEST_ASSIGN(
-            info,
-            infoNewLoad(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent), "info with content and cipher");
+            info, infoNewLoadP(ioBufferReadNew(contentLoad), harnessInfoLoadNewCallback, callbackContent),
+            "info with content and cipher");
         TEST_RESULT_STR_Z(callbackContent, "[c] key=1\n[d] key=1\n", "    check callback content");
         TEST_RESULT_STR_Z(infoCipherPass(info), "somepass", "    check cipher pass set");
         TEST_RESULT_STR_Z(infoBackrestVersion(info), PROJECT_VERSION, "    check backrest version");
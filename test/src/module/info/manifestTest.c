@@ -30,7 +30,7 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_UINT(sizeof(ManifestLoadFound), TEST_64BIT() ? 1 : 1, "check size of ManifestLoadFound");
         TEST_RESULT_UINT(sizeof(ManifestPath), TEST_64BIT() ? 32 : 16, "check size of ManifestPath");
-        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 120 : 92, "check size of ManifestFile");
+        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 128 : 96, "check size of ManifestFile");
     }
 
     // *****************************************************************************************************************************
@@ -1574,6 +1574,110 @@ testRun(void)
                 TEST_MANIFEST_PATH_DEFAULT))),
             "check manifest");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("find prior files with a different name that may have the same content");
+
+        manifest = manifestNewInternal();
+        manifest->info = infoNew(NULL);
+        manifest->data.backupOptionDelta = BOOL_FALSE_VAR;
+
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/1000"), .size = 8192, .timestamp = 1482182860});
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/3000"), .size = 16384, .timestamp = 1482182860});
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/2/1000"), .size = 8192, .timestamp = 1482182860});
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/2/2000"), .size = 16384, .timestamp = 1482182860});
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/2/3000"), .size = 16384, .timestamp = 1482182860});
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/2/4000"), .size = 8192, .timestamp = 1482182860});
+        manifestFileAdd(
+            manifest, &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/2/5000"), .size = 0, .timestamp = 1482182860});
+
+        manifestPrior = manifestNewInternal();
+        manifestPrior->data.backupLabel = strNew("20190101-010101F_20190202-010101I");
+        manifestFileAdd(
+            manifestPrior,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/1000"), .size = 8192, .sizeRepo = 100, .timestamp = 1482182860,
+               .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd"});
+        manifestFileAdd(
+            manifestPrior,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/1001"), .size = 8192, .sizeRepo = 101, .timestamp = 1482182860,
+               .checksumSha1 = "bbbbbbbbbbccccccccccddddddddddaaaaaaaaaa"});
+        manifestFileAdd(
+            manifestPrior,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/1002"), .size = 8192, .sizeRepo = 101, .timestamp = 1482182860,
+               .checksumSha1 = "bbbbbbbbbbccccccccccddddddddddaaaaaaaaaa"});
+        manifestFileAdd(
+            manifestPrior,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/3000"), .size = 16384, .sizeRepo = 102, .timestamp = 1482182860,
+               .checksumSha1 = "ccccccccccddddddddddaaaaaaaaaabbbbbbbbbb", .reference = STRDEF("20190101-010101F"),
+               .referenceName = STRDEF(MANIFEST_TARGET_PGDATA "/base/0/3000"), .checksumPage = true});
+        manifestFileAdd(
+            manifestPrior,
+            &(ManifestFile){.name = STRDEF(MANIFEST_TARGET_PGDATA "/base/1/5000"), .size = 0, .timestamp = 1482182860});
+
+        TEST_RESULT_VOID(manifestBuildIncr(manifest, manifestPrior, backupTypeIncr, NULL), "incremental manifest");
+
+        const ManifestFile *file = manifestFileFind(manifest, STRDEF(MANIFEST_TARGET_PGDATA "/base/1/3000"));
+        TEST_RESULT_STR_Z(file->reference, "20190101-010101F", "    check reference");
+        TEST_RESULT_STR_Z(file->referenceName, MANIFEST_TARGET_PGDATA "/base/0/3000", "    check reference name");
+
+        List *dedupList = NULL;
+        TEST_ASSIGN(dedupList, manifestBuildDedup(manifest, manifestPrior), "find files");
+        TEST_RESULT_UINT(lstSize(dedupList), 3, "    check size");
+
+        const ManifestFileDedup *fileDedup = lstGet(dedupList, 0);
+        TEST_RESULT_STR_Z(fileDedup->name, MANIFEST_TARGET_PGDATA "/base/2/1000", "    check name");
+        TEST_RESULT_UINT(lstSize(fileDedup->priorList), 2, "    check prior files with distinct checksums");
+
+        const ManifestFileDedupPrior *prior = lstGet(fileDedup->priorList, 0);
+        TEST_RESULT_Z(prior->checksumSha1, "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd", "    check checksum matched by base name");
+        TEST_RESULT_STR_Z(prior->reference, "20190101-010101F_20190202-010101I", "    check reference");
+        TEST_RESULT_STR_Z(prior->referenceName, MANIFEST_TARGET_PGDATA "/base/1/1000", "    check reference name");
+        TEST_RESULT_UINT(prior->sizeRepo, 100, "    check repo size");
+
+        prior = lstGet(fileDedup->priorList, 1);
+        TEST_RESULT_Z(prior->checksumSha1, "bbbbbbbbbbccccccccccddddddddddaaaaaaaaaa", "    check checksum matched by size");
+        TEST_RESULT_STR_Z(prior->referenceName, MANIFEST_TARGET_PGDATA "/base/1/1001", "    check reference name");
+        TEST_RESULT_PTR(
+            lstFind(fileDedup->priorList, "bbbbbbbbbbccccccccccddddddddddaaaaaaaaaa"), prior, "    check find by checksum");
+
+        fileDedup = lstGet(dedupList, 1);
+        TEST_RESULT_STR_Z(fileDedup->name, MANIFEST_TARGET_PGDATA "/base/2/3000", "    check name");
+        TEST_RESULT_UINT(lstSize(fileDedup->priorList), 1, "    check prior files");
+
+        prior = lstGet(fileDedup->priorList, 0);
+        TEST_RESULT_STR_Z(prior->reference, "20190101-010101F", "    check reference matched by prior reference");
+        TEST_RESULT_STR_Z(prior->referenceName, MANIFEST_TARGET_PGDATA "/base/0/3000", "    check reference name");
+        TEST_RESULT_BOOL(prior->checksumPage, true, "    check checksum page");
+
+        fileDedup = lstGet(dedupList, 2);
+        TEST_RESULT_STR_Z(fileDedup->name, MANIFEST_TARGET_PGDATA "/base/2/4000", "    check name");
+        TEST_RESULT_UINT(lstSize(fileDedup->priorList), 1, "    check prior files removed since the prior backup");
+
+        prior = lstGet(fileDedup->priorList, 0);
+        TEST_RESULT_STR_Z(prior->referenceName, MANIFEST_TARGET_PGDATA "/base/1/1001", "    check reference name");
+
+        TEST_RESULT_VOID(
+            manifestFileUpdate(
+                manifest, STRDEF(MANIFEST_TARGET_PGDATA "/base/1/3000"), 16384, 16384, NULL, varNewStr(NULL), NULL, false, false,
+                NULL),
+            "remove reference");
+        TEST_RESULT_PTR(file->referenceName, NULL, "    check reference name removed");
+
         #undef TEST_MANIFEST_HEADER_PRE
         #undef TEST_MANIFEST_HEADER_POST
         #undef TEST_MANIFEST_FILE_DEFAULT
@@ -1832,8 +1936,8 @@ testRun(void)
         TEST_TITLE("manifest validation");
 
         // Munge files to produce errors
-        manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 0, NULL, NULL, false, false, NULL);
-        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 0, 0, NULL, NULL, true, false, NULL);
+        manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 0, NULL, NULL, NULL, false, false, NULL);
+        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 0, 0, NULL, NULL, NULL, true, false, NULL);
 
         TEST_ERROR(
             manifestValidate(manifest, false), FormatError,
@@ -1848,10 +1952,10 @@ testRun(void)
             "repo size must be > 0 for file 'pg_data/postgresql.conf'");
 
         // Undo changes made to files
-        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, NULL, NULL, true, false, NULL);
+        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, NULL, NULL, NULL, true, false, NULL);
         manifestFileUpdate(
-            manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "184473f470864e067ee3a22e64b47b0a1c356f29", NULL, false,
-            false, NULL);
+            manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "184473f470864e067ee3a22e64b47b0a1c356f29", NULL, NULL,
+            false, false, NULL);
 
         TEST_RESULT_VOID(manifestValidate(manifest, true), "successful validate");
 
@@ -1944,10 +2048,11 @@ testRun(void)
         TEST_RESULT_PTR(file, NULL, "    return default NULL");
 
         TEST_RESULT_VOID(
-            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "", NULL, false, false, NULL),
+            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "", NULL, NULL, false, false, NULL),
             "update file");
         TEST_RESULT_VOID(
-            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, NULL, varNewStr(NULL), false, false, NULL),
+            manifestFileUpdate(
+                manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, NULL, varNewStr(NULL), NULL, false, false, NULL),
             "update file");
 
         // ManifestDb getters
@@ -2026,6 +2131,44 @@ testRun(void)
 
         TEST_RESULT_STR(strNewBuf(contentSave), strNewBuf(contentCompare), "   check save");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("save and load with a reference to a file with a different name");
+
+        TEST_RESULT_VOID(
+            manifestFileUpdate(
+                manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, "6e99b589e550e68e934fd235ccba59fe5b592a9e",
+                VARSTRDEF("20190818-084502F"), STRDEF("pg_data/base/16384/33000.32767"), true, false, NULL),
+            "set reference name");
+
+        contentSave = bufNew(0);
+
+        TEST_RESULT_VOID(manifestSave(manifest, ioBufferWriteNew(contentSave)), "save manifest");
+        TEST_RESULT_BOOL(
+            strstr(strZ(strNewBuf(contentSave)), "backrest-format=6\n") != NULL, true, "    check format");
+        TEST_RESULT_BOOL(
+            strstr(
+                strZ(strNewBuf(contentSave)),
+                ",\"reference\":\"20190818-084502F\",\"reference-name\":\"pg_data/base/16384/33000.32767\",") != NULL,
+            true, "    check reference name");
+
+        Manifest *manifestReferenceName = NULL;
+
+        TEST_ASSIGN(manifestReferenceName, manifestNewLoad(ioBufferReadNew(contentSave)), "load manifest");
+        TEST_RESULT_STR_Z(
+            manifestFileFind(manifestReferenceName, STRDEF("pg_data/base/32768/33000.32767"))->referenceName,
+            "pg_data/base/16384/33000.32767", "    check reference name");
+
+        TEST_RESULT_VOID(
+            manifestFileUpdate(
+                manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, "6e99b589e550e68e934fd235ccba59fe5b592a9e",
+                VARSTRDEF("20190818-084502F"), NULL, true, false, NULL),
+            "remove reference name");
+
+        contentSave = bufNew(0);
+
+        TEST_RESULT_VOID(manifestSave(manifest, ioBufferWriteNew(contentSave)), "save manifest");
+        TEST_RESULT_STR(strNewBuf(contentSave), strNewBuf(contentCompare), "   check save");
+
         TEST_RESULT_VOID(manifestFileRemove(manifest, STRDEF("pg_data/PG_VERSION")), "remove file");
         TEST_ERROR(
             manifestFileRemove(manifest, STRDEF("pg_data/PG_VERSION")), AssertError,
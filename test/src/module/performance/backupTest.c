@@ -0,0 +1,323 @@
+/***********************************************************************************************************************************
+Backup Performance
+
+Benchmark backup, verify, and restore end-to-end against a synthetic cluster for each compression and encryption combination. The
+cluster is built from sample table pages with valid checksums, all-zero pages, and a mix of small and large relations so page
+checksum validation, compression, and encryption all do realistic work.
+
+The starting values are small enough to run quickly but can be scaled up to give stable results for comparison between versions.
+***********************************************************************************************************************************/
+#include <sys/resource.h>
+
+#include "command/archive/push/push.h"
+#include "command/backup/backup.h"
+#include "command/restore/restore.h"
+#include "command/stanza/create.h"
+#include "command/verify/verify.h"
+#include "common/time.h"
+#include "postgres/interface.h"
+#include "postgres/version.h"
+#include "protocol/helper.h"
+#include "storage/helper.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessConfig.h"
+
+/***********************************************************************************************************************************
+Create pg_control and WAL for PostgreSQL 11. pgControlTestToBuffer() and pgWalTestToBuffer() are not available because performance
+tests are built without DEBUG so build them directly from the vendored structs.
+***********************************************************************************************************************************/
+#define PG_VERSION                                                  PG_VERSION_11
+
+#include "postgres/interface/version.vendor.h"
+
+static Buffer *
+testPgControl(void)
+{
+    Buffer *result = bufNew(8 * 1024);
+    memset(bufPtr(result), 0, bufSize(result));
+    bufUsedSet(result, bufSize(result));
+
+    *(ControlFileData *)bufPtr(result) = (ControlFileData)
+    {
+        .system_identifier = 1000000000000000110,
+        .pg_control_version = PG_CONTROL_VERSION,
+        .catalog_version_no = 201809051,
+        .blcksz = PG_PAGE_SIZE_DEFAULT,
+        .xlog_seg_size = PG_WAL_SEGMENT_SIZE_DEFAULT,
+        .data_checksum_version = 1,
+    };
+
+    return result;
+}
+
+static Buffer *
+testPgWal(const Buffer *sample)
+{
+    Buffer *result = bufNew(PG_WAL_SEGMENT_SIZE_DEFAULT);
+
+    // Fill the segment with sample pages so compression has realistic work to do
+    while (bufUsed(result) < bufSize(result))
+        bufCat(result, sample);
+
+    *(XLogLongPageHeaderData *)bufPtr(result) = (XLogLongPageHeaderData)
+    {
+        .std = {.xlp_magic = XLOG_PAGE_MAGIC, .xlp_info = XLP_LONG_HEADER},
+        .xlp_sysid = 1000000000000000110,
+        .xlp_seg_size = PG_WAL_SEGMENT_SIZE_DEFAULT,
+    };
+
+    return result;
+}
+
+/***********************************************************************************************************************************
+Create a synthetic cluster and return the total size. Every tenth relation is large (the sample followed by zero pages as if the
+relation had been extended), every seventh relation is all zero pages, and the rest are a prefix of the sample between one and
+sixteen pages. Prefixes of the sample are used so the block numbers, and therefore the page checksums, remain valid.
+***********************************************************************************************************************************/
+static uint64_t
+testPgCreate(const Storage *storage, const String *pgPath, unsigned int fileTotal, const Buffer *sample)
+{
+    uint64_t result = 0;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        storagePutP(
+            storageNewWriteP(storage, strNewFmt("%s/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL, strZ(pgPath))), testPgControl());
+        storagePutP(
+            storageNewWriteP(storage, strNewFmt("%s/" PG_FILE_PGVERSION, strZ(pgPath))), BUFSTRDEF(PG_VERSION_11_STR "\n"));
+
+        Buffer *zero = bufNew(bufSize(sample));
+        memset(bufPtr(zero), 0, bufSize(zero));
+        bufUsedSet(zero, bufSize(zero));
+
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            for (unsigned int fileIdx = 0; fileIdx < fileTotal; fileIdx++)
+            {
+                Buffer *file = NULL;
+
+                if (fileIdx % 10 == 0)
+                {
+                    file = bufDup(sample);
+                    bufCat(file, zero);
+                }
+                else if (fileIdx % 7 == 0)
+                    file = bufNewC(bufPtr(zero), PG_PAGE_SIZE_DEFAULT * 8);
+                else
+                    file = bufNewC(bufPtrConst(sample), PG_PAGE_SIZE_DEFAULT * (fileIdx % 16 + 1));
+
+                storagePutP(storageNewWriteP(storage, strNewFmt("%s/base/1/%u", strZ(pgPath), 16384 + fileIdx)), file);
+                result += bufUsed(file);
+
+                MEM_CONTEXT_TEMP_RESET(100);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    return result;
+}
+
+/***********************************************************************************************************************************
+Measure a benchmark phase. Locals are separate processes so their resource usage is included once they have exited, which is why
+protocolFree() is called before the phase ends. Peak RSS is the peak over the life of the process (or any child), so it only
+increases from phase to phase.
+***********************************************************************************************************************************/
+typedef struct TestPhase
+{
+    TimeMSec timeBegin;                                             // Time the phase began
+    struct rusage usageSelf;                                        // Resource usage of this process when the phase began
+    struct rusage usageChild;                                       // Resource usage of children when the phase began
+} TestPhase;
+
+static uint64_t
+testCpuMSec(const struct rusage *usage)
+{
+    return
+        (uint64_t)(usage->ru_utime.tv_sec + usage->ru_stime.tv_sec) * MSEC_PER_SEC +
+        (uint64_t)(usage->ru_utime.tv_usec + usage->ru_stime.tv_usec) / 1000;
+}
+
+static TestPhase
+testPhaseBegin(void)
+{
+    TestPhase result = {.timeBegin = timeMSec()};
+
+    getrusage(RUSAGE_SELF, &result.usageSelf);
+    getrusage(RUSAGE_CHILDREN, &result.usageChild);
+
+    return result;
+}
+
+static void
+testPhaseEnd(const TestPhase *phase, const char *name, uint64_t byteTotal, unsigned int fileTotal)
+{
+    protocolFree();
+
+    // Start time at 1ms just in case something takes 0ms to run
+    uint64_t time = timeMSec() - phase->timeBegin + 1;
+
+    struct rusage usageSelf;
+    struct rusage usageChild;
+
+    getrusage(RUSAGE_SELF, &usageSelf);
+    getrusage(RUSAGE_CHILDREN, &usageChild);
+
+    TEST_LOG_FMT(
+        "%s time %" PRIu64 "ms, throughput %" PRIu64 "MB/s, %.1f files/s, cpu %" PRIu64 "ms (local %" PRIu64 "ms),"
+            " peak rss %ldKB (local %ldKB)",
+        name, time, byteTotal * MSEC_PER_SEC / time / 1000000, (double)fileTotal * MSEC_PER_SEC / (double)time,
+        testCpuMSec(&usageSelf) - testCpuMSec(&phase->usageSelf), testCpuMSec(&usageChild) - testCpuMSec(&phase->usageChild),
+        usageSelf.ru_maxrss, usageChild.ru_maxrss);
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("archive-push, backup, verify, and restore"))
+    {
+        // A thousand relations is a small cluster but enough to show per-file overhead
+        CHECK(testScale() <= 10000);
+        unsigned int fileTotal = 1000 * (unsigned int)testScale();
+        unsigned int walTotal = 8 * (unsigned int)testScale();
+
+        // Set processes
+        unsigned int processMax = 2;
+
+        // Combinations of compression and encryption to test
+        const struct
+        {
+            const char *compressType;
+            const char *cipherType;
+        } combinationList[] =
+        {
+            {.compressType = "none", .cipherType = "none"},
+            {.compressType = "gz", .cipherType = "none"},
+#ifdef HAVE_LIBLZ4
+            {.compressType = "lz4", .cipherType = "none"},
+#endif
+#ifdef HAVE_LIBZST
+            {.compressType = "zst", .cipherType = "none"},
+#endif
+            {.compressType = "gz", .cipherType = "aes-256-cbc"},
+        };
+
+        // Get the sample pages from disk
+        const Buffer *sample = storageGetP(
+            storageNewReadP(storagePosixNewP(STR(testRepoPath())), STRDEF("test/data/filecopy.table.bin")));
+        ASSERT(bufUsed(sample) == 1024 * 1024);
+
+        // Create the cluster and WAL
+        Storage *storageTest = storagePosixNewP(strNew(testPath()), .write = true);
+        const String *pgPath = strNewFmt("%s/pg", testPath());
+        const String *restorePath = strNewFmt("%s/restore", testPath());
+
+        uint64_t byteTotal = testPgCreate(storageTest, pgPath, fileTotal, sample);
+        const Buffer *wal = testPgWal(sample);
+
+        for (unsigned int walIdx = 0; walIdx < walTotal; walIdx++)
+            storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/pg_wal/0000000100000000%08X", strZ(pgPath), walIdx + 1)), wal);
+
+        uint64_t walByteTotal = (uint64_t)walTotal * bufUsed(wal);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE_FMT(
+            "%u file(s) totaling %" PRIu64 "MiB and %u WAL segment(s) with %u process(es)", fileTotal, byteTotal / 1024 / 1024,
+            walTotal, processMax);
+
+        // The commands log at info level for each file so only log warnings and errors
+        harnessLogLevelSet(logLevelWarn);
+
+        for (unsigned int combinationIdx = 0; combinationIdx < sizeof(combinationList) / sizeof(combinationList[0]);
+             combinationIdx++)
+        {
+            const char *compressType = combinationList[combinationIdx].compressType;
+            const char *cipherType = combinationList[combinationIdx].cipherType;
+            const String *repoPath = strNewFmt("%s/repo-%s-%s", testPath(), compressType, cipherType);
+
+            if (strcmp(cipherType, "none") != 0)
+                hrnCfgEnvRawZ(cfgOptRepoCipherPass, "12345678");
+
+            StringList *argList = strLstNew();
+            hrnCfgArgRawZ(argList, cfgOptStanza, "test");
+            hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+            hrnCfgArgRawZ(argList, cfgOptRepoCipherType, cipherType);
+
+            TEST_LOG_FMT("compress %s, cipher %s", compressType, cipherType);
+
+            // Stanza create
+            StringList *argListPg = strLstDup(argList);
+            hrnCfgArgRaw(argListPg, cfgOptPgPath, pgPath);
+
+            StringList *argListStanza = strLstDup(argListPg);
+            hrnCfgArgRawBool(argListStanza, cfgOptOnline, false);
+            harnessCfgLoad(cfgCmdStanzaCreate, argListStanza);
+
+            cmdStanzaCreate();
+
+            // Archive push. Each segment is pushed separately with the config reloaded as it would be by PostgreSQL.
+            TestPhase phase = testPhaseBegin();
+
+            for (unsigned int walIdx = 0; walIdx < walTotal; walIdx++)
+            {
+                StringList *argListPush = strLstDup(argListPg);
+                hrnCfgArgRawZ(argListPush, cfgOptCompressType, compressType);
+                strLstAdd(argListPush, strNewFmt("%s/pg_wal/0000000100000000%08X", strZ(pgPath), walIdx + 1));
+                harnessCfgLoad(cfgCmdArchivePush, argListPush);
+
+                cmdArchivePush();
+            }
+
+            testPhaseEnd(&phase, "  archive-push", walByteTotal, walTotal);
+
+            // Backup
+            StringList *argListBackup = strLstDup(argListStanza);
+            hrnCfgArgRawZ(argListBackup, cfgOptCompressType, compressType);
+            hrnCfgArgRawFmt(argListBackup, cfgOptProcessMax, "%u", processMax);
+            hrnCfgArgRawZ(argListBackup, cfgOptRepoRetentionFull, "9999999");
+            hrnCfgArgRawZ(argListBackup, cfgOptType, "full");
+            harnessCfgLoad(cfgCmdBackup, argListBackup);
+
+            phase = testPhaseBegin();
+            cmdBackup();
+            testPhaseEnd(&phase, "  backup", byteTotal, fileTotal);
+
+            // Verify. Only the WAL archive is verified since that is all verify currently checks.
+            StringList *argListVerify = strLstDup(argList);
+            hrnCfgArgRawFmt(argListVerify, cfgOptProcessMax, "%u", processMax);
+            harnessCfgLoad(cfgCmdVerify, argListVerify);
+
+            phase = testPhaseBegin();
+            cmdVerify();
+            testPhaseEnd(&phase, "  verify", walByteTotal, walTotal);
+
+            // Restore
+            StringList *argListRestore = strLstDup(argList);
+            hrnCfgArgRaw(argListRestore, cfgOptPgPath, restorePath);
+            hrnCfgArgRawFmt(argListRestore, cfgOptProcessMax, "%u", processMax);
+            hrnCfgArgRawZ(argListRestore, cfgOptType, "none");
+            harnessCfgLoad(cfgCmdRestore, argListRestore);
+
+            storagePathCreateP(storageTest, restorePath, .mode = 0700);
+
+            phase = testPhaseBegin();
+            cmdRestore();
+            testPhaseEnd(&phase, "  restore", byteTotal, fileTotal);
+
+            storagePathRemoveP(storageTest, restorePath, .recurse = true);
+            hrnCfgEnvRemoveRaw(cfgOptRepoCipherPass);
+        }
+
+        harnessLogLevelReset();
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
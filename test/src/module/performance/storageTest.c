@@ -7,13 +7,16 @@ Generally speaking, the starting values should be high enough to "blow up" in te
 problems without taking very long if everything is running smoothly. These starting values can then be scaled up for profiling and
 stress testing as needed.
 ***********************************************************************************************************************************/
+#include <sys/resource.h>
+
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
 #include "common/harnessStorage.h"
 
+#include "command/backup/pageChecksum.h"
+#include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
-#include "common/compress/gz/compress.h"
-#include "common/compress/lz4/compress.h"
+#include "common/compress/helper.h"
 #include "common/io/filter/filter.intern.h"
 #include "common/io/filter/sink.h"
 #include "common/io/bufferRead.h"
@@ -22,6 +25,8 @@ stress testing as needed.
 #include "common/io/fdWrite.h"
 #include "common/io/io.h"
 #include "common/type/object.h"
+#include "postgres/interface.h"
+#include "postgres/interface/static.vendor.h"
 #include "protocol/client.h"
 #include "protocol/server.h"
 #include "storage/posix/storage.h"
@@ -132,6 +137,96 @@ testIoRateNew(uint64_t bytesPerSec)
     return this;
 }
 
+/***********************************************************************************************************************************
+Filter chain to benchmark. Filters are added in the same order as backup adds them.
+***********************************************************************************************************************************/
+typedef struct TestFilterChain
+{
+    const char *name;                                               // Name to display in results
+    bool pageChecksum;                                              // Validate page checksums?
+    const char *hashType;                                           // Hash type (NULL for none)
+    CompressType compressType;                                      // Compression type
+    int compressLevel;                                              // Compression level
+    bool cipher;                                                    // Encrypt with aes-256-cbc?
+} TestFilterChain;
+
+typedef struct TestFilterResult
+{
+    uint64_t timeMSec;                                              // Elapsed time
+    uint64_t cpuUSec;                                               // User and system cpu time
+} TestFilterResult;
+
+static uint64_t
+testCpuUSec(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return
+        (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 +
+        (uint64_t)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+static TestFilterResult
+testFilterBenchmark(const Buffer *input, const TestFilterChain *chain, uint64_t rateIn, uint64_t rateOut)
+{
+    TestFilterResult result = {0};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        IoWrite *write = ioBufferWriteNew(bufNew(0));
+        IoFilterGroup *filterGroup = ioWriteFilterGroup(write);
+
+        if (chain->pageChecksum)
+            ioFilterGroupAdd(filterGroup, pageChecksumNew(0, PG_SEGMENT_PAGE_DEFAULT, UINT64_MAX));
+
+        if (chain->hashType != NULL)
+            ioFilterGroupAdd(filterGroup, cryptoHashNew(STR(chain->hashType)));
+
+        if (chain->compressType != compressTypeNone)
+            ioFilterGroupAdd(filterGroup, compressFilter(chain->compressType, chain->compressLevel));
+
+        if (chain->cipher)
+            ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("12345678"), NULL));
+
+        if (rateOut != 0)
+            ioFilterGroupAdd(filterGroup, testIoRateNew(rateOut * 1000 * 1000));
+
+        ioFilterGroupAdd(filterGroup, ioSinkNew());
+        ioWriteOpen(write);
+
+        IoRead *read = ioBufferReadNew(input);
+
+        if (rateIn != 0)
+            ioFilterGroupAdd(ioReadFilterGroup(read), testIoRateNew(rateIn * 1000 * 1000));
+
+        ioReadOpen(read);
+
+        TimeMSec timeBegin = timeMSec();
+        uint64_t cpuBegin = testCpuUSec();
+
+        Buffer *buffer = bufNew(ioBufferSize());
+
+        do
+        {
+            ioRead(read, buffer);
+            ioWrite(write, buffer);
+            bufUsedZero(buffer);
+        }
+        while (!ioReadEof(read));
+
+        ioReadClose(read);
+        ioWriteClose(write);
+
+        // Start totals at 1 just in case something takes 0 time to run
+        result.timeMSec = timeMSec() - timeBegin + 1;
+        result.cpuUSec = testCpuUSec() - cpuBegin + 1;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    return result;
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -218,12 +313,9 @@ testRun(void)
     // *****************************************************************************************************************************
     if (testBegin("benchmark filters"))
     {
-        // 4MB buffers are the current default
-        ioBufferSizeSet(4 * 1024 * 1024);
-
-        // 1MB is a fairly normal table size
-        CHECK(testScale() <= 1024 * 1024 * 1024);
-        uint64_t blockTotal = (uint64_t)1 * testScale();
+        // 4MB fills the largest buffer size at least once. Scale up for more stable results with the larger buffer sizes.
+        CHECK(testScale() <= 256);
+        uint64_t blockTotal = (uint64_t)4 * testScale();
 
         // Set iteration
         unsigned int iteration = 1;
@@ -232,147 +324,157 @@ testRun(void)
         uint64_t rateIn = 0; // MB/s (0 disables)
         uint64_t rateOut = 0; // MB/s (0 disables)
 
+        // Buffer sizes to test, 4MB is the current default
+        const size_t bufferSizeList[] = {16 * 1024, 64 * 1024, 1024 * 1024, 4 * 1024 * 1024};
+        const unsigned int bufferSizeTotal = sizeof(bufferSizeList) / sizeof(bufferSizeList[0]);
+
+        // Filter chains to test
+        const TestFilterChain filterChainList[] =
+        {
+            {.name = "copy"},
+            {.name = "md5", .hashType = HASH_TYPE_MD5},
+            {.name = "sha1", .hashType = HASH_TYPE_SHA1},
+            {.name = "sha256", .hashType = HASH_TYPE_SHA256},
+            {.name = "page checksum", .pageChecksum = true},
+            {.name = "gz -1", .compressType = compressTypeGz, .compressLevel = 1},
+            {.name = "gz -6", .compressType = compressTypeGz, .compressLevel = 6},
+            {.name = "gz -9", .compressType = compressTypeGz, .compressLevel = 9},
+            {.name = "bz2 -1", .compressType = compressTypeBz2, .compressLevel = 1},
+            {.name = "bz2 -9", .compressType = compressTypeBz2, .compressLevel = 9},
+#ifdef HAVE_LIBLZ4
+            {.name = "lz4 -1", .compressType = compressTypeLz4, .compressLevel = 1},
+            {.name = "lz4 -9", .compressType = compressTypeLz4, .compressLevel = 9},
+#endif
+#ifdef HAVE_LIBZST
+            {.name = "zst -1", .compressType = compressTypeZst, .compressLevel = 1},
+            {.name = "zst -3", .compressType = compressTypeZst, .compressLevel = 3},
+            {.name = "zst -9", .compressType = compressTypeZst, .compressLevel = 9},
+#endif
+            {.name = "aes-256-cbc", .cipher = true},
+            {
+                .name = "backup gz -6 aes", .pageChecksum = true, .hashType = HASH_TYPE_SHA1, .compressType = compressTypeGz,
+                .compressLevel = 6, .cipher = true,
+            },
+#ifdef HAVE_LIBLZ4
+            {
+                .name = "backup lz4 -1 aes", .pageChecksum = true, .hashType = HASH_TYPE_SHA1, .compressType = compressTypeLz4,
+                .compressLevel = 1, .cipher = true,
+            },
+#endif
+        };
+        const unsigned int filterChainTotal = sizeof(filterChainList) / sizeof(filterChainList[0]);
+
         // Get the sample pages from disk
         Buffer *block = storageGetP(storageNewReadP(storagePosixNewP(STR(testRepoPath())), STRDEF("test/data/filecopy.table.bin")));
         ASSERT(bufUsed(block) == 1024 * 1024);
 
-        // Build the input buffer
-        Buffer *input = bufNew(blockTotal * bufSize(block));
+        // Build the relation by repeating the sample pages. Checksums are recalculated so each page is valid for its block number.
+        Buffer *relation = bufNew(blockTotal * bufSize(block));
 
         for (unsigned int blockIdx = 0; blockIdx < blockTotal; blockIdx++)
-            memcpy(bufPtr(input) + (blockIdx * bufSize(block)), bufPtr(block), bufSize(block));
+            memcpy(bufPtr(relation) + (blockIdx * bufSize(block)), bufPtr(block), bufSize(block));
+
+        bufUsedSet(relation, bufSize(relation));
+
+        for (unsigned int pageIdx = 0; pageIdx < bufUsed(relation) / PG_PAGE_SIZE_DEFAULT; pageIdx++)
+        {
+            unsigned char *page = bufPtr(relation) + pageIdx * PG_PAGE_SIZE_DEFAULT;
 
-        bufUsedSet(input, bufSize(input));
+            if (((PageHeaderData *)page)->pd_upper != 0)
+                ((PageHeaderData *)page)->pd_checksum = pgPageChecksum(page, pageIdx);
+        }
+
+        // Approximate WAL with full page images followed by the zeroed tail of a segment that was switched early
+        Buffer *wal = bufNew(bufSize(relation));
+        memcpy(bufPtr(wal), bufPtr(relation), bufSize(wal) / 2);
+        memset(bufPtr(wal) + bufSize(wal) / 2, 0, bufSize(wal) - bufSize(wal) / 2);
+        bufUsedSet(wal, bufSize(wal));
+
+        const struct
+        {
+            const char *name;
+            const Buffer *input;
+        } inputList[] =
+        {
+            {.name = "relation", .input = relation},
+            {.name = "wal", .input = wal},
+        };
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE_FMT(
-            "%u iteration(s) of %" PRIu64 "MiB with %" PRIu64 "MB/s input, %" PRIu64 "MB/s output", iteration,
-            bufUsed(input) / bufUsed(block), rateIn, rateOut);
-
-        #define BENCHMARK_BEGIN()                                                                                                  \
-            IoWrite *write = ioBufferWriteNew(bufNew(0));                                                                          \
-
-        #define BENCHMARK_FILTER_ADD(filter)                                                                                       \
-            ioFilterGroupAdd(ioWriteFilterGroup(write), filter);
-
-        #define BENCHMARK_END(addTo)                                                                                               \
-            if (rateOut != 0)                                                                                                      \
-                ioFilterGroupAdd(ioWriteFilterGroup(write), testIoRateNew(rateOut * 1000 * 1000));                                 \
-            ioFilterGroupAdd(ioWriteFilterGroup(write), ioSinkNew());                                                              \
-            ioWriteOpen(write);                                                                                                    \
-                                                                                                                                   \
-            IoRead *read = ioBufferReadNew(input);                                                                                 \
-            if (rateIn != 0)                                                                                                       \
-                ioFilterGroupAdd(ioReadFilterGroup(read), testIoRateNew(rateIn * 1000 * 1000));                                    \
-            ioReadOpen(read);                                                                                                      \
-                                                                                                                                   \
-            uint64_t benchMarkBegin = timeMSec();                                                                                  \
-                                                                                                                                   \
-            Buffer *buffer = bufNew(ioBufferSize());                                                                               \
-                                                                                                                                   \
-            do                                                                                                                     \
-            {                                                                                                                      \
-                ioRead(read, buffer);                                                                                              \
-                ioWrite(write, buffer);                                                                                            \
-                bufUsedZero(buffer);                                                                                               \
-            }                                                                                                                      \
-            while (!ioReadEof(read));                                                                                              \
-                                                                                                                                   \
-            ioReadClose(read);                                                                                                     \
-            ioWriteClose(write);                                                                                                   \
-                                                                                                                                   \
-            addTo += timeMSec() - benchMarkBegin;
-
-        // Start totals to 1ms just in case something takes 0ms to run
-        uint64_t copyTotal = 1;
-        uint64_t md5Total = 1;
-        uint64_t sha1Total = 1;
-        uint64_t sha256Total = 1;
-        uint64_t gzip6Total = 1;
-        uint64_t lz41Total = 1;
+            "%u iteration(s) of %" PRIu64 "MiB with %" PRIu64 "MB/s input, %" PRIu64 "MB/s output", iteration, blockTotal, rateIn,
+            rateOut);
+
+        // Results are stored per input, chain, and buffer size
+        TestFilterResult result
+            [sizeof(inputList) / sizeof(inputList[0])][sizeof(filterChainList) / sizeof(filterChainList[0])]
+            [sizeof(bufferSizeList) / sizeof(bufferSizeList[0])] = {{{{0}}}};
 
         for (unsigned int idx = 0; idx < iteration; idx++)
         {
-            // -------------------------------------------------------------------------------------------------------------------------
-            TEST_LOG_FMT("copy iteration %u", idx + 1);
-
-            MEM_CONTEXT_TEMP_BEGIN()
+            for (unsigned int inputIdx = 0; inputIdx < sizeof(inputList) / sizeof(inputList[0]); inputIdx++)
             {
-                BENCHMARK_BEGIN();
-                BENCHMARK_END(copyTotal);
-            }
-            MEM_CONTEXT_TEMP_END();
+                for (unsigned int chainIdx = 0; chainIdx < filterChainTotal; chainIdx++)
+                {
+                    // Page checksums are not calculated for WAL
+                    if (inputList[inputIdx].input == wal && filterChainList[chainIdx].pageChecksum)
+                        continue;
 
-            // -------------------------------------------------------------------------------------------------------------------------
-            TEST_LOG_FMT("md5 iteration %u", idx + 1);
+                    TEST_LOG_FMT("%s %s iteration %u", inputList[inputIdx].name, filterChainList[chainIdx].name, idx + 1);
 
-            MEM_CONTEXT_TEMP_BEGIN()
-            {
-                BENCHMARK_BEGIN();
-                BENCHMARK_FILTER_ADD(cryptoHashNew(HASH_TYPE_MD5_STR));
-                BENCHMARK_END(md5Total);
-            }
-            MEM_CONTEXT_TEMP_END();
+                    for (unsigned int bufferSizeIdx = 0; bufferSizeIdx < bufferSizeTotal; bufferSizeIdx++)
+                    {
+                        ioBufferSizeSet(bufferSizeList[bufferSizeIdx]);
 
-            // -------------------------------------------------------------------------------------------------------------------------
-            TEST_LOG_FMT("sha1 iteration %u", idx + 1);
+                        TestFilterResult benchmark = testFilterBenchmark(
+                            inputList[inputIdx].input, &filterChainList[chainIdx], rateIn, rateOut);
 
-            MEM_CONTEXT_TEMP_BEGIN()
-            {
-                BENCHMARK_BEGIN();
-                BENCHMARK_FILTER_ADD(cryptoHashNew(HASH_TYPE_SHA1_STR));
-                BENCHMARK_END(sha1Total);
+                        result[inputIdx][chainIdx][bufferSizeIdx].timeMSec += benchmark.timeMSec;
+                        result[inputIdx][chainIdx][bufferSizeIdx].cpuUSec += benchmark.cpuUSec;
+                    }
+                }
             }
-            MEM_CONTEXT_TEMP_END();
+        }
 
-            // -------------------------------------------------------------------------------------------------------------------------
-            TEST_LOG_FMT("sha256 iteration %u", idx + 1);
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("results in MB/s per core (MB/s elapsed)");
 
-            MEM_CONTEXT_TEMP_BEGIN()
-            {
-                BENCHMARK_BEGIN();
-                BENCHMARK_FILTER_ADD(cryptoHashNew(HASH_TYPE_SHA256_STR));
-                BENCHMARK_END(sha256Total);
-            }
-            MEM_CONTEXT_TEMP_END();
+        uint64_t byteTotal = iteration * blockTotal * 1024 * 1024;
+
+        for (unsigned int inputIdx = 0; inputIdx < sizeof(inputList) / sizeof(inputList[0]); inputIdx++)
+        {
+            String *header = strNewFmt("%-20s", inputList[inputIdx].name);
+
+            for (unsigned int bufferSizeIdx = 0; bufferSizeIdx < bufferSizeTotal; bufferSizeIdx++)
+                strCatFmt(header, " %18zuKiB", bufferSizeList[bufferSizeIdx] / 1024);
 
-            // -------------------------------------------------------------------------------------------------------------------------
-            TEST_LOG_FMT("gzip -6 iteration %u", idx + 1);
+            TEST_LOG(strZ(header));
 
-            MEM_CONTEXT_TEMP_BEGIN()
+            for (unsigned int chainIdx = 0; chainIdx < filterChainTotal; chainIdx++)
             {
-                BENCHMARK_BEGIN();
-                BENCHMARK_FILTER_ADD(gzCompressNew(6));
-                BENCHMARK_END(gzip6Total);
-            }
-            MEM_CONTEXT_TEMP_END();
+                if (inputList[inputIdx].input == wal && filterChainList[chainIdx].pageChecksum)
+                    continue;
 
-            // -------------------------------------------------------------------------------------------------------------------------
-            TEST_LOG_FMT("lz4 -1 iteration %u", idx + 1);
+                String *row = strNewFmt("%-20s", filterChainList[chainIdx].name);
 
-            MEM_CONTEXT_TEMP_BEGIN()
-            {
-                BENCHMARK_BEGIN();
-                BENCHMARK_FILTER_ADD(lz4CompressNew(1));
-                BENCHMARK_END(lz41Total);
+                for (unsigned int bufferSizeIdx = 0; bufferSizeIdx < bufferSizeTotal; bufferSizeIdx++)
+                {
+                    const TestFilterResult *total = &result[inputIdx][chainIdx][bufferSizeIdx];
+
+                    strCatFmt(
+                        row, " %21s",
+                        strZ(
+                            strNewFmt(
+                                "%" PRIu64 " (%" PRIu64 ")", byteTotal * 1000000 / total->cpuUSec / 1000000,
+                                byteTotal * 1000 / total->timeMSec / 1000000)));
+                }
+
+                TEST_LOG(strZ(row));
             }
-            MEM_CONTEXT_TEMP_END();
         }
 
-        // -------------------------------------------------------------------------------------------------------------------------
-        TEST_TITLE("results");
-
-        #define TEST_RESULT(name, total)                                                                                           \
-            TEST_LOG_FMT(                                                                                                          \
-                "%s time %" PRIu64"ms, avg time %" PRIu64"ms, avg throughput: %" PRIu64 "MB/s", name, total, total / iteration,    \
-                iteration * blockTotal * 1024 * 1024 * 1000 / total / 1000000);
-
-        TEST_RESULT("copy", copyTotal);
-        TEST_RESULT("md5", md5Total);
-        TEST_RESULT("sha1", sha1Total);
-        TEST_RESULT("sha256", sha256Total);
-        TEST_RESULT("gzip -6", gzip6Total);
-        TEST_RESULT("lz4 -1", lz41Total);
+        // Reset to the default
+        ioBufferSizeSet(4 * 1024 * 1024);
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -254,6 +254,42 @@ testRun(void)
             pgClientQuery(client, query), FormatError,
             "unable to parse type 1184 in column 0 for query 'select clock_timestamp()'");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("send query and poll for result");
+
+#ifndef HARNESS_PQ_REAL
+        harnessPqScriptSet((HarnessPq [])
+        {
+            {.function = HRNPQ_SENDQUERY, .param = "[\"select 1::bigint\"]", .resultInt = 1},
+            {.function = HRNPQ_CONSUMEINPUT},
+            {.function = HRNPQ_ISBUSY, .resultInt = 1},
+            {.function = HRNPQ_CONSUMEINPUT},
+            {.function = HRNPQ_ISBUSY},
+            {.function = HRNPQ_CONSUMEINPUT},
+            {.function = HRNPQ_ISBUSY},
+            {.function = HRNPQ_GETRESULT},
+            {.function = HRNPQ_RESULTSTATUS, .resultInt = PGRES_TUPLES_OK},
+            {.function = HRNPQ_NTUPLES, .resultInt = 1},
+            {.function = HRNPQ_NFIELDS, .resultInt = 1},
+            {.function = HRNPQ_FTYPE, .param = "[0]", .resultInt = HRNPQ_TYPE_INT},
+            {.function = HRNPQ_GETVALUE, .param = "[0,0]", .resultZ = "1"},
+            {.function = HRNPQ_CLEAR},
+            {.function = HRNPQ_GETRESULT, .resultNull = true},
+            {.function = NULL}
+        });
+#endif
+
+        TEST_RESULT_VOID(pgClientQuerySend(client, STRDEF("select 1::bigint")), "send query");
+#ifndef HARNESS_PQ_REAL
+        TEST_RESULT_BOOL(pgClientQueryReady(client), false, "query not ready");
+#endif
+        TEST_ERROR(
+            pgClientQuerySend(client, STRDEF("select 2::bigint")), AssertError, "check 'this->query == NULL' failed");
+
+        while (!pgClientQueryReady(client));
+
+        TEST_RESULT_STR_Z(jsonFromVar(varNewVarLst(pgClientQueryResult(client))), "[[1]]", "query result");
+
         // Successful query
         // -------------------------------------------------------------------------------------------------------------------------
 #ifndef HARNESS_PQ_REAL
@@ -324,6 +324,26 @@ testRun(void)
                 " --pg1-path=/path/to/pg --process=3 --remote-type=repo --repo=1 --stanza=test1 archive-get:remote\n",
             "remote protocol params for backup local");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("share ssh connection when control path is set");
+
+        argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=test1");
+        hrnCfgArgRawZ(argList, cfgOptPgPath, "/path/to/pg");
+        hrnCfgArgRawZ(argList, cfgOptCmdSshControlPath, "/var/run/pgbackrest");
+        strLstAddZ(argList, "--repo1-host=repo-host");
+        strLstAddZ(argList, CFGCMD_ARCHIVE_GET);
+        harnessCfgLoadRaw(strLstSize(argList), strLstPtr(argList));
+
+        TEST_RESULT_STRLST_Z(
+            protocolRemoteParam(protocolStorageTypeRepo, 0),
+            "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\n-o\nControlMaster=auto\n-o\n"
+                "ControlPath=/var/run/pgbackrest/%C\n-o\nControlPersist=60\npgbackrest@repo-host\n"
+                "pgbackrest --exec-id=1-test --log-level-console=off --log-level-file=off --log-level-stderr=error"
+                " --pg1-path=/path/to/pg --process=0 --remote-type=repo --repo=1 --stanza=test1 archive-get:remote\n",
+            "remote protocol params with shared connection");
+
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
         strLstAddZ(argList, "pgbackrest");
@@ -558,10 +578,14 @@ testRun(void)
                 // Get command output
                 const VariantList *output = NULL;
 
+                TEST_RESULT_BOOL(protocolClientCommandPending(client), false, "no command pending");
                 TEST_RESULT_VOID(
                     protocolClientWriteCommand(client, protocolCommandNew(strNew("test"))), "execute command with output");
+                TEST_RESULT_BOOL(protocolClientCommandPending(client), true, "command pending");
                 TEST_RESULT_STR_Z(protocolClientReadLine(client), "OUTPUT", "check output");
+                TEST_RESULT_BOOL(protocolClientCommandPending(client), true, "command pending until output is read");
                 TEST_ASSIGN(output, varVarLst(protocolClientReadOutput(client, true)), "execute command with output");
+                TEST_RESULT_BOOL(protocolClientCommandPending(client), false, "no command pending");
                 TEST_RESULT_UINT(varLstSize(output), 2, "check output size");
                 TEST_RESULT_STR_Z(varStr(varLstGet(output, 0)), "value1", "check value1");
                 TEST_RESULT_STR_Z(varStr(varLstGet(output, 1)), "value2", "check value2");
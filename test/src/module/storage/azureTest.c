@@ -31,6 +31,7 @@ typedef struct TestRequestParam
     VAR_PARAM_HEADER;
     const char *content;
     const char *blobType;
+    const char *range;
 } TestRequestParam;
 
 #define testRequestP(write, verb, uri, ...)                                                                                        \
@@ -85,6 +86,10 @@ testRequest(IoWrite *write, const char *verb, const char *uri, TestRequestParam
     // Add host
     strCatFmt(request, "host:%s\r\n", strZ(hrnServerHost()));
 
+    // Add range
+    if (param.range != NULL)
+        strCatFmt(request, "range:bytes=%s\r\n", param.range);
+
     // Add blob type
     if (param.blobType != NULL)
         strCatFmt(request, "x-ms-blob-type:%s\r\n", param.blobType);
@@ -200,6 +205,7 @@ testRun(void)
         TEST_RESULT_UINT(((StorageAzure *)storage->driver)->blockSize, STORAGE_AZURE_BLOCKSIZE_MIN, "    check block size");
         TEST_RESULT_BOOL(storageFeature(storage, storageFeaturePath), false, "    check path feature");
         TEST_RESULT_BOOL(storageFeature(storage, storageFeatureCompress), false, "    check compress feature");
+        TEST_RESULT_BOOL(storageFeature(storage, storageFeatureLimitRead), true, "    check limit read feature");
     }
 
     // *****************************************************************************************************************************
@@ -245,6 +251,20 @@ testRun(void)
                 ", host: 'account.blob.core.windows.net', x-ms-version: '2019-02-02'}",
             "check headers");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("auth with range");
+
+        header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_LENGTH_STR, ZERO_STR);
+        httpHeaderAdd(header, HTTP_HEADER_RANGE_STR, STRDEF("bytes=5-11"));
+
+        TEST_RESULT_VOID(storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path/file"), NULL, dateTime, header), "auth");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(header),
+            "{authorization: 'SharedKey account:9dNIu2USMJt8IbRWRiiBvnpq2wMir0lsn1PhQwee5S0=', content-length: '0'"
+                ", date: 'Sun, 21 Jun 2020 12:46:19 GMT', host: 'account.blob.core.windows.net', range: 'bytes=5-11'"
+                ", x-ms-version: '2019-02-02'}",
+            "check headers");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("SAS auth");
 
@@ -347,6 +367,16 @@ testRun(void)
                 TEST_RESULT_STR_Z(
                     strNewBuf(storageGetP(storageNewReadP(storage, strNew("file0.txt")))), "", "get zero-length file");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get range of file");
+
+                testRequestP(service, HTTP_VERB_GET, "/file.txt", .range = "5-11");
+                testResponseP(service, .code = 206, .content = "is a sa");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(storage, strNew("file.txt"), .offset = 5, .limit = VARUINT64(7)))),
+                    "is a sa", "get range");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("non-404 error");
 
@@ -4,8 +4,11 @@ Test Posix Storage
 #include <unistd.h>
 #include <utime.h>
 
+#include "common/compress/helper.h"
+#include "common/crypto/cipherBlock.h"
 #include "common/io/io.h"
 #include "common/time.h"
+#include "storage/range.h"
 #include "storage/read.h"
 #include "storage/write.h"
 
@@ -738,6 +741,30 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_VOID(storagePathCreateP(storageTest, pathName), "create path to sync");
         TEST_RESULT_VOID(storagePathSyncP(storageTest, pathName), "sync path");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("syncfs() reports writeback errors on kernel 5.8 and later");
+
+        TEST_RESULT_BOOL(storagePosixSyncFsErrorReported("4.19.0-16-amd64"), false, "kernel 4.19");
+        TEST_RESULT_BOOL(storagePosixSyncFsErrorReported("5.7.19"), false, "kernel 5.7");
+        TEST_RESULT_BOOL(storagePosixSyncFsErrorReported("5.8.0-63-generic"), true, "kernel 5.8");
+        TEST_RESULT_BOOL(storagePosixSyncFsErrorReported("6.1.0"), true, "kernel 6.1");
+        TEST_RESULT_BOOL(storagePosixSyncFsErrorReported("5"), false, "release without minor version");
+        TEST_RESULT_BOOL(storagePosixSyncFsErrorReported("bogus"), false, "invalid release");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("sync filesystem");
+
+        struct utsname kernel;
+        TEST_RESULT_INT(uname(&kernel), 0, "get kernel release");
+
+        TEST_RESULT_BOOL(
+            storageFeature(storageTest, storageFeaturePathSyncFs), storagePosixSyncFsErrorReported(kernel.release),
+            "filesystem sync feature depends on kernel");
+
+        // Enable the feature in case the kernel is too old so syncfs() can still be tested
+        storageTest->interface.feature |= 1 << storageFeaturePathSyncFs;
+        TEST_RESULT_VOID(storagePathSyncP(storageTest, pathName, .fileSystem = true), "sync filesystem");
     }
 
     // *****************************************************************************************************************************
@@ -873,6 +900,27 @@ testRun(void)
             buffer, storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .limit = VARUINT64(7))), "get");
         TEST_RESULT_UINT(bufSize(buffer), 7, "check size");
         TEST_RESULT_BOOL(memcmp(bufPtrConst(buffer), "TESTFIL", bufSize(buffer)) == 0, true, "check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read limited bytes from offset");
+
+        StorageRead *read = NULL;
+
+        TEST_ASSIGN(
+            read, storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = 2, .limit = VARUINT64(5)),
+            "new read");
+        TEST_RESULT_UINT(storageReadOffset(read), 2, "check offset");
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(read)), "STFIL", "check content");
+
+        TEST_ASSIGN(read, storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = 4), "new read");
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(read)), "FILE\n", "check content");
+
+        TEST_ASSIGN(read, storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = 100), "new read");
+        TEST_RESULT_UINT(bufUsed(storageGetP(read)), 0, "no content past end");
+
+        TEST_ERROR_FMT(
+            storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = UINT64_MAX)), FileOpenError,
+            "unable to seek to %" PRIu64 " in file '%s/test.txt': [22] Invalid argument", UINT64_MAX, testPath());
     }
 
     // *****************************************************************************************************************************
@@ -1125,6 +1173,39 @@ testRun(void)
         TEST_RESULT_INT(storageInfoP(storageTest, fileName).mode, 0600, "    check file mode");
 
         storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write sparse file");
+
+        // Zero-filled blocks at the beginning, middle, and end of the file with data in unaligned buffers
+        Buffer *sparseBuffer = bufNew(4096 * 6 + 100);
+        memset(bufPtr(sparseBuffer), 0, bufSize(sparseBuffer));
+        bufUsedSet(sparseBuffer, bufSize(sparseBuffer));
+        memset(bufPtr(sparseBuffer) + 4096 * 2 + 10, 'X', 4096);
+        bufPtr(sparseBuffer)[4096 * 5 - 1] = 'Y';
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .sparse = true), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "    open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), BUF(bufPtr(sparseBuffer), 1)), "   write one byte");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), BUF(bufPtr(sparseBuffer) + 1, 8191)), "   write zero blocks");
+        TEST_RESULT_VOID(
+            ioWrite(storageWriteIo(file), BUF(bufPtr(sparseBuffer) + 8192, bufUsed(sparseBuffer) - 8192)), "   write remainder");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "   close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "    check file contents");
+        TEST_RESULT_UINT(storageInfoP(storageTest, fileName).size, bufUsed(sparseBuffer), "    check file size");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write sparse file that ends with data");
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .sparse = true), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "    open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), buffer), "   write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "   close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), buffer), true, "    check file contents");
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
     }
 
     // *****************************************************************************************************************************
@@ -1258,6 +1339,13 @@ testRun(void)
             storagePathP(storage, strNewFmt("%s/%s", STORAGE_SPOOL_ARCHIVE_IN, "file.ext")),
             strNewFmt("%s/archive/db/in/file.ext", testPath()), "check spool in file");
 
+        TEST_RESULT_STR(
+            storagePathP(storage, strNew(STORAGE_SPOOL_ARCHIVE_QUEUE)), strNewFmt("%s/archive/db/queue", testPath()),
+            "check spool queue path");
+        TEST_RESULT_STR(
+            storagePathP(storage, strNewFmt("%s/%s", STORAGE_SPOOL_ARCHIVE_QUEUE, "repo2/file.ext")),
+            strNewFmt("%s/archive/db/queue/repo2/file.ext", testPath()), "check spool queue file");
+
         TEST_ERROR(storagePathP(storage, strNew("<" BOGUS_STR ">")), AssertError, "invalid expression '<BOGUS>'");
 
         TEST_ERROR(storageNewWriteP(storage, writeFile), AssertError, "assertion 'this->write' failed");
@@ -1304,5 +1392,264 @@ testRun(void)
         TEST_ERROR(storageSpoolWrite(), AssertError, "stanza cannot be NULL for this storage object");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("storageNewReadRange()"))
+    {
+        Buffer *content = bufNew(256 * 1024 + 1000);
+        unsigned char *chr = bufPtr(content);
+
+        for (size_t chrIdx = 0; chrIdx < bufSize(content); chrIdx++)
+            chr[chrIdx] = (unsigned char)(chrIdx % 94 + chrIdx / 4096 % 7 + 32);
+
+        bufUsedSet(content, bufSize(content));
+
+        const Buffer *range = BUF(bufPtr(content) + 100000, 70000);
+        const Buffer *rangeEnd = BUF(bufPtr(content) + bufUsed(content) - 100, 100);
+        StorageRead *read = NULL;
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of uncompressed file");
+
+        storagePutP(storageNewWriteP(storageTest, STRDEF("range")), content);
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadRangeP(storageTest, STRDEF("range"), 100000, 70000)), range), true, "check range");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadRangeP(storageTest, STRDEF("range"), bufUsed(content) - 100, 1000)), rangeEnd), true,
+            "check range reduced at end");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of compressed file");
+
+        StorageWrite *write = storageNewWriteP(storageTest, STRDEF("range.gz"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressTypeGz, 1));
+        storagePutP(write, content);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(storageNewReadRangeP(storageTest, STRDEF("range.gz"), 100000, 70000, .compressType = compressTypeGz)),
+                range),
+            true, "check range");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of compressed and encrypted file");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.gz.enc"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressTypeGz, 1));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+        storagePutP(write, content);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadRangeP(
+                        storageTest, STRDEF("range.gz.enc"), 100000, 70000, .compressType = compressTypeGz,
+                        .cipherType = cipherTypeAes256Cbc, .cipherPass = STRDEF("pass"))),
+                range),
+            true, "check range");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of encrypted file stops at the end of the range");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.enc"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+        storagePutP(write, content);
+
+        // The file is truncated after the range so it can only be read when reading stops at the end of the range
+        storagePutP(
+            storageNewWriteP(storageTest, STRDEF("range.enc")),
+            storageGetP(storageNewReadP(storageTest, STRDEF("range.enc"), .limit = VARUINT64(200000))));
+
+        TEST_ERROR(
+            storageGetP(
+                storageNewReadRangeP(
+                    storageTest, STRDEF("range.enc"), 0, bufUsed(content), .cipherType = cipherTypeAes256Cbc,
+                    .cipherPass = STRDEF("pass"))),
+            CryptoError, "unable to flush");
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadRangeP(
+                        storageTest, STRDEF("range.enc"), 100000, 70000, .cipherType = cipherTypeAes256Cbc,
+                        .cipherPass = STRDEF("pass"))),
+                range),
+            true, "check range");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of file encrypted in chunks");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.enc"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Gcm, BUFSTRDEF("pass"), NULL));
+        storagePutP(write, content);
+
+        // The first chunk is modified so it can only be read when reading starts at the chunk that contains the range
+        Buffer *encrypted = storageGetP(storageNewReadP(storageTest, STRDEF("range.enc")));
+        bufPtr(encrypted)[CIPHER_BLOCK_HEADER_SIZE] ^= 0x01;
+        storagePutP(storageNewWriteP(storageTest, STRDEF("range.enc")), encrypted);
+
+        TEST_ERROR(
+            storageGetP(
+                storageNewReadRangeP(
+                    storageTest, STRDEF("range.enc"), 0, 70000, .cipherType = cipherTypeAes256Gcm, .cipherPass = STRDEF("pass"))),
+            CryptoError, "cipher authentication failed");
+
+        TEST_ASSIGN(
+            read,
+            storageNewReadRangeP(
+                storageTest, STRDEF("range.enc"), 100000, 70000, .cipherType = cipherTypeAes256Gcm, .cipherPass = STRDEF("pass")),
+            "new read");
+        TEST_RESULT_UINT(
+            storageReadOffset(read), CIPHER_BLOCK_HEADER_SIZE + 64 * 1024 + CIPHER_BLOCK_AEAD_TAG_SIZE,
+            "check offset of first chunk");
+        TEST_RESULT_UINT(
+            varUInt64(storageReadLimit(read)), 2 * (64 * 1024 + CIPHER_BLOCK_AEAD_TAG_SIZE), "check limit of chunks");
+        TEST_RESULT_BOOL(bufEq(storageGetP(read), range), true, "check range");
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadRangeP(
+                        storageTest, STRDEF("range.enc"), bufUsed(content) - 100, 1000, .cipherType = cipherTypeAes256Gcm,
+                        .cipherPass = STRDEF("pass"))),
+                rangeEnd),
+            true, "check range reduced at end");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of compressed file encrypted in chunks");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.gz.enc"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressTypeGz, 1));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Gcm, BUFSTRDEF("pass"), NULL));
+        storagePutP(write, content);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadRangeP(
+                        storageTest, STRDEF("range.gz.enc"), 100000, 70000, .compressType = compressTypeGz,
+                        .cipherType = cipherTypeAes256Gcm, .cipherPass = STRDEF("pass"))),
+                range),
+            true, "check range");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of file encrypted without chunks when chunks are configured");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.enc"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+        storagePutP(write, content);
+
+        cipherBlockCompatSet(true);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadRangeP(
+                        storageTest, STRDEF("range.enc"), 100000, 70000, .cipherType = cipherTypeAes256Gcm,
+                        .cipherPass = STRDEF("pass"))),
+                range),
+            true, "check range");
+
+        cipherBlockCompatSet(false);
+
+        storagePutP(storageNewWriteP(storageTest, STRDEF("range.enc")), BUFSTRDEF("BOGUS"));
+
+        TEST_ERROR(
+            storageGetP(
+                storageNewReadRangeP(
+                    storageTest, STRDEF("range.enc"), 0, 100, .cipherType = cipherTypeAes256Gcm, .cipherPass = STRDEF("pass"))),
+            CryptoError, "cipher header missing");
+
+#ifdef HAVE_LIBLZ4
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of file compressed without frames");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.lz4"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressTypeLz4, 1));
+        storagePutP(write, content);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(storageNewReadRangeP(storageTest, STRDEF("range.lz4"), 100000, 70000, .compressType = compressTypeLz4)),
+                range),
+            true, "check range");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of file compressed in frames");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.lz4"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilterFrame(compressTypeLz4, 1, 64 * 1024));
+        storagePutP(write, content);
+
+        TEST_ASSIGN(
+            read, storageNewReadRangeP(storageTest, STRDEF("range.lz4"), 100000, 70000, .compressType = compressTypeLz4),
+            "new read");
+        TEST_RESULT_BOOL(storageReadOffset(read) > 0, true, "check offset of first frame");
+        TEST_RESULT_BOOL(
+            varUInt64(storageReadLimit(read)) < storageInfoP(storageTest, STRDEF("range.lz4")).size, true, "check limit of frames");
+        TEST_RESULT_BOOL(bufEq(storageGetP(read), range), true, "check range");
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadRangeP(
+                        storageTest, STRDEF("range.lz4"), bufUsed(content) - 100, 1000, .compressType = compressTypeLz4)),
+                rangeEnd),
+            true, "check range reduced at end");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of file compressed in frames and encrypted in chunks");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.lz4.enc"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilterFrame(compressTypeLz4, 1, 64 * 1024));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Gcm, BUFSTRDEF("pass"), NULL));
+        storagePutP(write, content);
+
+        TEST_ASSIGN(
+            read,
+            storageNewReadRangeP(
+                storageTest, STRDEF("range.lz4.enc"), 100000, 70000, .compressType = compressTypeLz4,
+                .cipherType = cipherTypeAes256Gcm, .cipherPass = STRDEF("pass")),
+            "new read");
+        TEST_RESULT_BOOL(storageReadOffset(read) > 0, true, "check offset of first chunk");
+        TEST_RESULT_BOOL(bufEq(storageGetP(read), range), true, "check range");
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    storageNewReadRangeP(
+                        storageTest, STRDEF("range.lz4.enc"), bufUsed(content) - 100, 1000, .compressType = compressTypeLz4,
+                        .cipherType = cipherTypeAes256Gcm, .cipherPass = STRDEF("pass"))),
+                rangeEnd),
+            true, "check range reduced at end");
+#endif // HAVE_LIBLZ4
+
+#ifdef HAVE_LIBZST
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read range of file compressed in zst frames");
+
+        write = storageNewWriteP(storageTest, STRDEF("range.zst"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilterFrame(compressTypeZst, 1, 64 * 1024));
+        storagePutP(write, content);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(storageNewReadRangeP(storageTest, STRDEF("range.zst"), 100000, 70000, .compressType = compressTypeZst)),
+                range),
+            true, "check range");
+#endif // HAVE_LIBZST
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -7,6 +7,7 @@ Test Remote Storage
 #include "common/crypto/cipherBlock.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/io/filter/range.h"
 #include "postgres/interface.h"
 
 #include "common/harnessConfig.h"
@@ -358,6 +359,12 @@ testRun(void)
         TEST_RESULT_STR_Z(strNewBuf(storageGetP(fileRead)), "BABABABABAB", "    check contents");
         TEST_RESULT_UINT(((StorageReadRemote *)fileRead->driver)->protocolReadBytes, 11, "    check read size");
 
+        TEST_ASSIGN(
+            fileRead, storageNewReadP(storageRemote, strNew("test.txt"), .offset = 1, .limit = VARUINT64(11)),
+            "get file at offset");
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(fileRead)), "ABABABABABA", "    check contents");
+        TEST_RESULT_UINT(((StorageReadRemote *)fileRead->driver)->protocolReadBytes, 11, "    check read size");
+
         // Enable protocol compression in the storage object
         ((StorageRemote *)storageRemote->driver)->compressLevel = 3;
 
@@ -377,6 +384,7 @@ testRun(void)
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNew("missing.txt")));
         varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, NULL);
         varLstAdd(paramList, varNewVarLst(varLstNew()));
 
@@ -395,6 +403,7 @@ testRun(void)
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/test.txt", testPath())));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, varNewUInt64(8));
 
         // Create filters to test filter logic
@@ -406,6 +415,7 @@ testRun(void)
         ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRZ("x"), NULL));
         ioFilterGroupAdd(filterGroup, compressFilter(compressTypeGz, 3));
         ioFilterGroupAdd(filterGroup, decompressFilter(compressTypeGz));
+        ioFilterGroupAdd(filterGroup, ioRangeNew(0, 8));
         varLstAdd(paramList, ioFilterGroupParamAll(filterGroup));
 
         TEST_RESULT_BOOL(
@@ -418,7 +428,7 @@ testRun(void)
                 "DATABRBLOCK0\n"
                 "{\"out\":{\"buffer\":null,\"cipherBlock\":null,\"gzCompress\":null,\"gzDecompress\":null"
                     ",\"hash\":\"bbbcf2c59433f68f22376cd2439d6cd309378df6\",\"pageChecksum\":{\"align\":false,\"valid\":false}"
-                    ",\"size\":8}}\n",
+                    ",\"range\":null,\"size\":8}}\n",
             "check result");
 
         bufUsedSet(serverWrite, 0);
@@ -431,6 +441,7 @@ testRun(void)
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/test.txt", testPath())));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, NULL);
 
         // Create filters to test filter logic
@@ -456,6 +467,7 @@ testRun(void)
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/test.txt", testPath())));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, NULL);
         varLstAdd(paramList, varNewVarLst(varLstAdd(varLstNew(), varNewKv(kvAdd(kvNew(), varNewStrZ("bogus"), NULL)))));
 
@@ -761,11 +773,13 @@ testRun(void)
         String *path = strNew("testpath");
         TEST_RESULT_VOID(storagePathCreateP(storageRemote, path), "new path");
         TEST_RESULT_VOID(storagePathSyncP(storageRemote, path), "sync path");
+        TEST_RESULT_VOID(storagePathSyncP(storageRemote, path, .fileSystem = true), "sync filesystem");
 
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/%s", testPath(), strZ(path))));
+        varLstAdd(paramList, varNewBool(true));
 
         TEST_RESULT_BOOL(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_PATH_SYNC_STR, paramList, server), true,
@@ -775,6 +789,7 @@ testRun(void)
 
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(strNewFmt("%s/repo/anewpath", testPath())));
+        varLstAdd(paramList, varNewBool(false));
         TEST_ERROR_FMT(
             storageRemoteProtocol(PROTOCOL_COMMAND_STORAGE_PATH_SYNC_STR, paramList, server), PathMissingError,
             "raised from remote-0 protocol on 'localhost': " STORAGE_ERROR_PATH_SYNC_MISSING,
@@ -26,6 +26,7 @@ typedef struct TestRequestParam
     const char *content;
     const char *accessKey;
     const char *securityToken;
+    const char *range;
 } TestRequestParam;
 
 #define testRequestP(write, s3, verb, uri, ...)                                                                                    \
@@ -64,7 +65,12 @@ testRequest(IoWrite *write, Storage *s3, const char *verb, const char *uri, Test
         if (param.content != NULL)
             strCatZ(request, ";content-md5");
 
-        strCatZ(request, ";host;x-amz-content-sha256;x-amz-date");
+        strCatZ(request, ";host");
+
+        if (param.range != NULL)
+            strCatZ(request, ";range");
+
+        strCatZ(request, ";x-amz-content-sha256;x-amz-date");
 
         if (securityToken != NULL)
             strCatZ(request, ";x-amz-security-token");
@@ -94,6 +100,10 @@ testRequest(IoWrite *write, Storage *s3, const char *verb, const char *uri, Test
     else
         strCatFmt(request, "host:%s\r\n", strZ(hrnServerHost()));
 
+    // Add range
+    if (param.range != NULL)
+        strCatFmt(request, "range:bytes=%s\r\n", param.range);
+
     // Add content checksum and date if s3 service
     if (s3 != NULL)
     {
@@ -398,6 +408,7 @@ testRun(void)
                 TEST_RESULT_STR(s3->path, path, "check path");
                 TEST_RESULT_BOOL(storageFeature(s3, storageFeaturePath), false, "check path feature");
                 TEST_RESULT_BOOL(storageFeature(s3, storageFeatureCompress), false, "check compress feature");
+                TEST_RESULT_BOOL(storageFeature(s3, storageFeatureLimitRead), true, "check limit read feature");
 
                 // Coverage for noop functions
                 // -----------------------------------------------------------------------------------------------------------------
@@ -439,6 +450,23 @@ testRun(void)
 
                 TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3, strNew("file0.txt")))), "", "get zero-length file");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get range of file");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "5-11");
+                testResponseP(service, .code = 206, .content = "is a sa");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, strNew("file.txt"), .offset = 5, .limit = VARUINT64(7)))), "is a sa",
+                    "get range");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "10-");
+                testResponseP(service, .code = 206, .content = "sample file");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, strNew("file.txt"), .offset = 10))), "sample file",
+                    "get from offset");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("switch to temp credentials");
 
@@ -856,8 +884,8 @@ testRun(void)
                     storageInfoListP(s3, strNew("/path/to"), hrnStorageInfoListCallback, &callbackData), "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "test_path {path}\n"
-                    "test_file {file, s=787, t=1255369830}\n",
+                    "test_file {file, s=787, t=1255369830}\n"
+                    "test_path {path}\n",
                     "check");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -884,8 +912,8 @@ testRun(void)
                     "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "path1 {}\n"
-                    "test1.txt {}\n",
+                    "test1.txt {}\n"
+                    "path1 {}\n",
                     "check");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -960,11 +988,11 @@ testRun(void)
                     "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "path1 {}\n"
                     "test1.txt {}\n"
                     "test2.txt {}\n"
-                    "path2 {}\n"
-                    "test3.txt {}\n",
+                    "path1 {}\n"
+                    "test3.txt {}\n"
+                    "path2 {}\n",
                     "check");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -1002,9 +1030,9 @@ testRun(void)
                     "list");
                 TEST_RESULT_STR_Z(
                     callbackData.content,
-                    "test1.path {}\n"
                     "test1.txt {}\n"
-                    "test3.txt {}\n",
+                    "test3.txt {}\n"
+                    "test1.path {}\n",
                     "check");
 
                 // -----------------------------------------------------------------------------------------------------------------